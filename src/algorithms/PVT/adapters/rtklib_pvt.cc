@@ -86,6 +86,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.system_ecef_pos_sd_m = configuration->property(role + ".kf_system_ecef_pos_sd_m", 2.0);
     pvt_output_parameters.system_ecef_vel_sd_ms = configuration->property(role + ".kf_system_ecef_vel_sd_ms", 0.5);
 
+    // Vector tracking: Doppler predictions sent to the tracking channels
+    pvt_output_parameters.enable_vector_tracking = configuration->property(role + ".enable_vector_tracking", false);
+
     // NMEA Printer settings
     pvt_output_parameters.flag_nmea_tty_port = configuration->property(role + ".flag_nmea_tty_port", false);
     pvt_output_parameters.nmea_dump_filename = configuration->property(role + ".nmea_dump_filename", default_nmea_dump_filename);
@@ -913,6 +916,13 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.log_source_timetag = configuration->property(role + ".log_timetag", pvt_output_parameters.log_source_timetag);
     pvt_output_parameters.log_source_timetag_file = configuration->property(role + ".log_source_timetag_file", pvt_output_parameters.log_source_timetag_file);
 
+    // Record observables and navigation data for offline replay of the PVT solver
+    pvt_output_parameters.replay_record = configuration->property(role + ".record_replay", pvt_output_parameters.replay_record);
+    pvt_output_parameters.replay_record_filename = configuration->property(role + ".record_replay_filename", pvt_output_parameters.replay_record_filename);
+
+    // Observations of the base station for the relative positioning modes, as a file of RTCM 3 messages
+    pvt_output_parameters.rtk_base_rtcm_file = configuration->property(role + ".rtk_base_rtcm_file", pvt_output_parameters.rtk_base_rtcm_file);
+
     // Use E6 for PVT
     pvt_output_parameters.use_e6_for_pvt = configuration->property(role + ".use_e6_for_pvt", pvt_output_parameters.use_e6_for_pvt);
     pvt_output_parameters.use_has_corrections = configuration->property(role + ".use_has_corrections", pvt_output_parameters.use_has_corrections);
@@ -54,7 +54,9 @@
 #include "nmea_printer.h"
 #include "osnma_data.h"
 #include "pvt_conf.h"
+#include "pvt_replay.h"
 #include "rinex_printer.h"
+#include "rtcm_base_reader.h"
 #include "rtcm_printer.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_solver.h"
@@ -185,12 +187,17 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
       d_log_timetag(conf_.log_source_timetag),
       d_use_has_corrections(conf_.use_has_corrections),
       d_use_unhealthy_sats(conf_.use_unhealthy_sats),
-      d_osnma_strict(conf_.osnma_strict)
+      d_osnma_strict(conf_.osnma_strict),
+      d_enable_vector_tracking(conf_.enable_vector_tracking)
 {
     // Send feedback message to observables block with the receiver clock offset
     this->message_port_register_out(pmt::mp("pvt_to_observables"));
-    // Experimental: VLT commands from PVT to tracking channels
-    this->message_port_register_out(pmt::mp("pvt_to_trk"));
+    // Experimental: VLT commands from PVT to tracking channels, one port per
+    // channel so that each command is only handled by its channel
+    for (uint32_t i = 0; i < d_nchannels; i++)
+        {
+            this->message_port_register_out(pmt::mp("pvt_to_trk" + std::to_string(i)));
+        }
     // Send PVT status to gnss_flowgraph
     this->message_port_register_out(pmt::mp("status"));
 
@@ -463,6 +470,26 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_has_simple_printer = nullptr;
         }
 
+    // Initialize recorder of PVT inputs for offline replay
+    if (conf_.replay_record)
+        {
+            d_replay_writer = std::make_unique<Pvt_Replay_Writer>(conf_.replay_record_filename, d_type_of_rx, rtk.opt.nf, rtk.opt.navsys);
+            if (!d_replay_writer->is_open())
+                {
+                    d_replay_writer = nullptr;
+                }
+        }
+
+    // Initialize reader of the base station observations for the relative positioning modes
+    if (!conf_.rtk_base_rtcm_file.empty())
+        {
+            d_rtk_base_reader = std::make_unique<Rtcm_Base_Reader>(conf_.rtk_base_rtcm_file);
+            if (!d_rtk_base_reader->is_open())
+                {
+                    d_rtk_base_reader = nullptr;
+                }
+        }
+
     // Initialize AN printer
     if (d_an_printer_enabled)
         {
@@ -1223,6 +1250,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_eph);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
@@ -1246,6 +1277,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS IONO ###
                     const auto gps_iono = wht::any_cast<std::shared_ptr<Gps_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_iono = *gps_iono;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_iono);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_iono = *gps_iono;
@@ -1257,6 +1292,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS UTC MODEL ###
                     const auto gps_utc_model = wht::any_cast<std::shared_ptr<Gps_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_utc_model = *gps_utc_model;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_utc_model);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_utc_model = *gps_utc_model;
@@ -1291,6 +1330,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_cnav_ephemeris);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
@@ -1315,6 +1358,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV IONO ###
                     const auto gps_cnav_iono = wht::any_cast<std::shared_ptr<Gps_CNAV_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_cnav_iono);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_cnav_iono = *gps_cnav_iono;
@@ -1326,6 +1373,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV UTC MODEL ###
                     const auto gps_cnav_utc_model = wht::any_cast<std::shared_ptr<Gps_CNAV_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_cnav_utc_model);
+                        }
                     {
                         d_user_pvt_solver->gps_cnav_utc_model = *gps_cnav_utc_model;
                     }
@@ -1337,6 +1388,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS ALMANAC ###
                     const auto gps_almanac = wht::any_cast<std::shared_ptr<Gps_Almanac>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->gps_almanac_map[gps_almanac->PRN] = *gps_almanac;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*gps_almanac);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_almanac_map[gps_almanac->PRN] = *gps_almanac;
@@ -1383,6 +1438,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*galileo_eph);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
@@ -1408,6 +1467,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### Galileo IONO ###
                     const auto galileo_iono = wht::any_cast<std::shared_ptr<Galileo_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->galileo_iono = *galileo_iono;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*galileo_iono);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_iono = *galileo_iono;
@@ -1419,6 +1482,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### Galileo UTC MODEL ###
                     const auto galileo_utc_model = wht::any_cast<std::shared_ptr<Galileo_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->galileo_utc_model = *galileo_utc_model;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*galileo_utc_model);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_utc_model = *galileo_utc_model;
@@ -1436,6 +1503,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv1.PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv1.PRN] = sv1;
+                            if (d_replay_writer)
+                                {
+                                    d_replay_writer->write(sv1);
+                                }
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv1.PRN] = sv1;
@@ -1444,6 +1515,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv2.PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv2.PRN] = sv2;
+                            if (d_replay_writer)
+                                {
+                                    d_replay_writer->write(sv2);
+                                }
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv2.PRN] = sv2;
@@ -1452,6 +1527,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     if (sv3.PRN != 0)
                         {
                             d_internal_pvt_solver->galileo_almanac_map[sv3.PRN] = sv3;
+                            if (d_replay_writer)
+                                {
+                                    d_replay_writer->write(sv3);
+                                }
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->galileo_almanac_map[sv3.PRN] = sv3;
@@ -1465,6 +1544,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     const auto galileo_alm = wht::any_cast<std::shared_ptr<Galileo_Almanac>>(pmt::any_ref(msg));
                     // update/insert new almanac record to the global almanac map
                     d_internal_pvt_solver->galileo_almanac_map[galileo_alm->PRN] = *galileo_alm;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*galileo_alm);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_almanac_map[galileo_alm->PRN] = *galileo_alm;
@@ -1506,6 +1589,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*glonass_gnav_eph);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
@@ -1516,6 +1603,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GLONASS GNAV UTC MODEL ###
                     const auto glonass_gnav_utc_model = wht::any_cast<std::shared_ptr<Glonass_Gnav_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*glonass_gnav_utc_model);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_utc_model = *glonass_gnav_utc_model;
@@ -1527,6 +1618,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GLONASS GNAV Almanac ###
                     const auto glonass_gnav_almanac = wht::any_cast<std::shared_ptr<Glonass_Gnav_Almanac>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->glonass_gnav_almanac = *glonass_gnav_almanac;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*glonass_gnav_almanac);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_almanac = *glonass_gnav_almanac;
@@ -1569,6 +1664,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                 }
                         }
                     d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*bds_dnav_eph);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
@@ -1592,6 +1691,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou IONO ###
                     const auto bds_dnav_iono = wht::any_cast<std::shared_ptr<Beidou_Dnav_Iono>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*bds_dnav_iono);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_iono = *bds_dnav_iono;
@@ -1603,6 +1706,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou UTC MODEL ###
                     const auto bds_dnav_utc_model = wht::any_cast<std::shared_ptr<Beidou_Dnav_Utc_Model>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*bds_dnav_utc_model);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_utc_model = *bds_dnav_utc_model;
@@ -1614,6 +1721,10 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### BeiDou ALMANAC ###
                     const auto bds_dnav_almanac = wht::any_cast<std::shared_ptr<Beidou_Dnav_Almanac>>(pmt::any_ref(msg));
                     d_internal_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->PRN] = *bds_dnav_almanac;
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write(*bds_dnav_almanac);
+                        }
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_almanac_map[bds_dnav_almanac->PRN] = *bds_dnav_almanac;
@@ -1643,6 +1754,10 @@ void rtklib_pvt_gs::msg_handler_has_data(const pmt::pmt_t& msg)
                     if (d_use_has_corrections && (has_data->has_status == 1))  // operational mode
                         {
                             d_internal_pvt_solver->store_has_data(*has_data);
+                            if (d_replay_writer)
+                                {
+                                    d_replay_writer->write(*has_data);
+                                }
                             if (d_enable_rx_clock_correction == true)
                                 {
                                     d_user_pvt_solver->store_has_data(*has_data);
@@ -1975,6 +2090,28 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
 }
 
 
+void rtklib_pvt_gs::send_tracking_predictions()
+{
+    // One command per channel, published on the port of that channel
+    for (const auto& observables : d_gnss_observables_map)
+        {
+            const Gnss_Synchro& gnss_synchro = observables.second;
+            double pseudorange_rate_m_s = 0.0;
+            if (d_user_pvt_solver->get_predicted_pseudorange_rate(gnss_synchro.System, gnss_synchro.PRN, pseudorange_rate_m_s))
+                {
+                    const std::shared_ptr<TrackingCmd> trk_cmd = std::make_shared<TrackingCmd>();
+                    trk_cmd->enable_carrier_nco_cmd = true;
+                    trk_cmd->enable_code_nco_cmd = true;
+                    trk_cmd->pseudorange_rate_m_s = pseudorange_rate_m_s;
+                    trk_cmd->sample_counter = gnss_synchro.Tracking_sample_counter;
+                    trk_cmd->channel_id = gnss_synchro.Channel_ID;
+                    trk_cmd->prn = gnss_synchro.PRN;
+                    this->message_port_pub(pmt::mp("pvt_to_trk" + std::to_string(gnss_synchro.Channel_ID)), pmt::make_any(trk_cmd));
+                }
+        }
+}
+
+
 void rtklib_pvt_gs::update_HAS_corrections()
 {
     this->d_internal_pvt_solver->update_has_corrections(this->d_gnss_observables_map);
@@ -2183,6 +2320,27 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                     // LOG(INFO) << "diff raw obs time: " << d_gnss_observables_map.cbegin()->second.RX_time * 1000.0 - old_time_debug;
                     // old_time_debug = d_gnss_observables_map.cbegin()->second.RX_time * 1000.0;
                     uint32_t current_RX_time_ms = 0;
+                    if (d_rtk_base_reader && d_internal_pvt_solver->pvt_sol.time.time != 0)
+                        {
+                            // The base station epochs are matched with the time of the previous solution
+                            const gtime_t rover_time = timeadd(d_internal_pvt_solver->pvt_sol.time, d_observable_interval_ms / 1000.0);
+                            if (d_rtk_base_reader->read_until(rover_time))
+                                {
+                                    d_internal_pvt_solver->set_base_observations(d_rtk_base_reader->get_observations(), d_rtk_base_reader->get_position());
+                                    if (d_enable_rx_clock_correction == true)
+                                        {
+                                            d_user_pvt_solver->set_base_observations(d_rtk_base_reader->get_observations(), d_rtk_base_reader->get_position());
+                                        }
+                                    if (d_replay_writer)
+                                        {
+                                            d_replay_writer->write_base_observations(d_rtk_base_reader->get_observations(), d_rtk_base_reader->get_position());
+                                        }
+                                }
+                        }
+                    if (d_replay_writer)
+                        {
+                            d_replay_writer->write_epoch(d_gnss_observables_map, d_observable_interval_ms / 1000.0);
+                        }
                     // #### solve PVT and store the corrected observable set
                     if (d_internal_pvt_solver->get_PVT(d_gnss_observables_map, d_observable_interval_ms / 1000.0))
                         {
@@ -2303,12 +2461,12 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
 
                     if (flag_pvt_valid == true)
                         {
-                            // experimental VTL tests
-                            // send tracking command
-                            //                            const std::shared_ptr<TrackingCmd> trk_cmd_test = std::make_shared<TrackingCmd>(TrackingCmd());
-                            //                            trk_cmd_test->carrier_freq_hz = 12345.4;
-                            //                            trk_cmd_test->sample_counter = d_gnss_observables_map.begin()->second.Tracking_sample_counter;
-                            //                            this->message_port_pub(pmt::mp("pvt_to_trk"), pmt::make_any(trk_cmd_test));
+                            // Vector tracking: send the pseudorange rates predicted by the
+                            // solution to the tracking channels
+                            if (d_enable_vector_tracking)
+                                {
+                                    send_tracking_predictions();
+                                }
 
                             // initialize (if needed) the accumulated phase offset and apply it to the active channels
                             // required to report accumulated phase cycles comparable to pseudoranges
@@ -63,7 +63,9 @@ class Monitor_Pvt_Udp_Sink;
 class Monitor_Ephemeris_Udp_Sink;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Replay_Writer;
 class Rinex_Printer;
+class Rtcm_Base_Reader;
 class Rtcm_Printer;
 class An_Packet_Printer;
 class Has_Simple_Printer;
@@ -151,6 +153,8 @@ private:
 
     void initialize_and_apply_carrier_phase_offset();
 
+    void send_tracking_predictions();
+
     void apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
         double rx_clock_offset_s);
 
@@ -188,6 +192,8 @@ private:
     std::unique_ptr<Monitor_Ephemeris_Udp_Sink> d_eph_udp_sink_ptr;
     std::unique_ptr<Has_Simple_Printer> d_has_simple_printer;
     std::unique_ptr<An_Packet_Printer> d_an_printer;
+    std::unique_ptr<Pvt_Replay_Writer> d_replay_writer;
+    std::unique_ptr<Rtcm_Base_Reader> d_rtk_base_reader;
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
@@ -279,6 +285,7 @@ private:
     bool d_use_has_corrections;
     bool d_use_unhealthy_sats;
     bool d_osnma_strict;
+    bool d_enable_vector_tracking;
 };
 
 
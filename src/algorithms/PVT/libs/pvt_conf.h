@@ -51,6 +51,8 @@ public:
     std::string udp_ports;
     std::string udp_eph_addresses;
     std::string log_source_timetag_file;
+    std::string replay_record_filename = std::string("./pvt_replay.dat");
+    std::string rtk_base_rtcm_file;
 
     uint32_t type_of_receiver = 0;
     uint32_t observable_interval_ms = 20;
@@ -96,6 +98,7 @@ public:
     bool use_has_corrections = true;
     bool use_unhealthy_sats = false;
     bool osnma_strict = false;
+    bool replay_record = false;
 
     // PVT KF parameters
     bool enable_pvt_kf = false;
@@ -103,6 +106,9 @@ public:
     double measures_ecef_vel_sd_ms = 0.1;
     double system_ecef_pos_sd_m = 0.01;
     double system_ecef_vel_sd_ms = 0.001;
+
+    // Vector tracking
+    bool enable_vector_tracking = false;
 };
 
 
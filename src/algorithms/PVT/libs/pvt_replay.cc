@@ -0,0 +1,421 @@
+/*!
+ * \file pvt_replay.cc
+ * \brief Classes that record the inputs of the PVT solver (observables and
+ * navigation messages) to a compact binary file and load them back for replay
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_replay.h"
+#include "beidou_dnav_almanac.h"
+#include "beidou_dnav_ephemeris.h"
+#include "beidou_dnav_iono.h"
+#include "beidou_dnav_utc_model.h"
+#include "galileo_almanac.h"
+#include "galileo_ephemeris.h"
+#include "galileo_has_data.h"
+#include "galileo_iono.h"
+#include "galileo_utc_model.h"
+#include "glonass_gnav_almanac.h"
+#include "glonass_gnav_ephemeris.h"
+#include "glonass_gnav_utc_model.h"
+#include "gnss_sdr_make_unique.h"
+#include "gps_almanac.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_cnav_iono.h"
+#include "gps_cnav_utc_model.h"
+#include "gps_ephemeris.h"
+#include "gps_iono.h"
+#include "gps_utc_model.h"
+#include "rtklib_solver.h"
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+namespace boost
+{
+namespace serialization
+{
+// Classes without their own serialize() method
+
+template <class Archive>
+void serialize(Archive& ar, mt1_header& header, const unsigned int /* version */)
+{
+    ar& header.toh;
+    ar& header.mask_id;
+    ar& header.iod_set_id;
+    ar& header.reserved;
+    ar& header.mask_flag;
+    ar& header.orbit_correction_flag;
+    ar& header.clock_fullset_flag;
+    ar& header.clock_subset_flag;
+    ar& header.code_bias_flag;
+    ar& header.phase_bias_flag;
+}
+
+
+template <class Archive>
+void serialize(Archive& ar, Galileo_HAS_data& has_data, const unsigned int /* version */)
+{
+    ar& has_data.gnss_id_mask;
+    ar& has_data.satellite_mask;
+    ar& has_data.signal_mask;
+    ar& has_data.cell_mask_availability_flag;
+    ar& has_data.cell_mask;
+    ar& has_data.nav_message;
+    ar& has_data.gnss_iod;
+    ar& has_data.delta_radial;
+    ar& has_data.delta_in_track;
+    ar& has_data.delta_cross_track;
+    ar& has_data.delta_clock_multiplier;
+    ar& has_data.delta_clock_correction;
+    ar& has_data.gnss_id_clock_subset;
+    ar& has_data.delta_clock_multiplier_clock_subset;
+    ar& has_data.satellite_submask;
+    ar& has_data.delta_clock_correction_clock_subset;
+    ar& has_data.code_bias;
+    ar& has_data.phase_bias;
+    ar& has_data.phase_discontinuity_indicator;
+    ar& has_data.tow;
+    ar& has_data.header;
+    ar& has_data.has_status;
+    ar& has_data.message_id;
+    ar& has_data.Nsys;
+    ar& has_data.Nsys_sub;
+    ar& has_data.validity_interval_index_orbit_corrections;
+    ar& has_data.validity_interval_index_clock_fullset_corrections;
+    ar& has_data.validity_interval_index_clock_subset_corrections;
+    ar& has_data.validity_interval_index_code_bias_corrections;
+    ar& has_data.validity_interval_index_phase_bias_corrections;
+}
+
+
+template <class Archive>
+void serialize(Archive& ar, obsd_t& obs, const unsigned int /* version */)
+{
+    // time_t has no fixed size
+    auto time = static_cast<int64_t>(obs.time.time);
+    ar& time;
+    obs.time.time = static_cast<time_t>(time);
+    ar& obs.time.sec;
+    ar& obs.sat;
+    ar& obs.rcv;
+    ar& obs.SNR;
+    ar& obs.LLI;
+    ar& obs.code;
+    ar& obs.L;
+    ar& obs.P;
+    ar& obs.D;
+}
+}  // namespace serialization
+}  // namespace boost
+
+
+namespace
+{
+const std::array<char, 20> PVT_REPLAY_MAGIC{"GNSS-SDR PVT replay"};
+constexpr uint32_t PVT_REPLAY_VERSION = 2;  // version 2 adds records 16 to 20
+
+
+template <typename T>
+void read_nav(boost::archive::binary_iarchive& ia,
+    std::vector<std::function<void(Rtklib_Solver&)>>& pending,
+    void (*store)(Rtklib_Solver&, const T&))
+{
+    T object;
+    ia >> object;
+    pending.emplace_back([object, store](Rtklib_Solver& solver) { store(solver, object); });
+}
+}  // namespace
+
+
+Pvt_Replay_Writer::Pvt_Replay_Writer(const std::string& filename, uint32_t type_of_rx, int32_t nf, int32_t navsys)
+    : d_records(0)
+{
+    d_file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!d_file.is_open())
+        {
+            LOG(WARNING) << "Unable to open PVT replay file " << filename;
+            return;
+        }
+    d_file.write(PVT_REPLAY_MAGIC.data(), PVT_REPLAY_MAGIC.size());
+    d_file.write(reinterpret_cast<const char*>(&PVT_REPLAY_VERSION), sizeof(PVT_REPLAY_VERSION));
+    d_file.write(reinterpret_cast<const char*>(&type_of_rx), sizeof(type_of_rx));
+    d_file.write(reinterpret_cast<const char*>(&nf), sizeof(nf));
+    d_file.write(reinterpret_cast<const char*>(&navsys), sizeof(navsys));
+    d_archive = std::make_unique<boost::archive::binary_oarchive>(d_file, boost::archive::no_header);
+    LOG(INFO) << "Recording PVT replay file " << filename;
+}
+
+
+Pvt_Replay_Writer::~Pvt_Replay_Writer()
+{
+    try
+        {
+            d_archive.reset();
+            if (d_file.is_open())
+                {
+                    d_file.close();
+                    LOG(INFO) << "PVT replay file closed after " << d_records << " records";
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Problem closing PVT replay file: " << e.what();
+        }
+}
+
+
+bool Pvt_Replay_Writer::is_open() const
+{
+    return d_archive != nullptr && d_file.good();
+}
+
+
+template <typename T>
+void Pvt_Replay_Writer::write_record(Pvt_Replay_Record type, const T& object)
+{
+    if (!is_open())
+        {
+            return;
+        }
+    try
+        {
+            const auto type_u8 = static_cast<uint8_t>(type);
+            *d_archive << type_u8;
+            *d_archive << object;
+            d_records++;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error writing PVT replay record: " << e.what();
+            d_archive.reset();
+        }
+}
+
+
+void Pvt_Replay_Writer::write_epoch(const std::map<int, Gnss_Synchro>& observables, double kf_update_interval_s)
+{
+    if (!is_open())
+        {
+            return;
+        }
+    try
+        {
+            const auto type_u8 = static_cast<uint8_t>(Pvt_Replay_Record::EPOCH);
+            *d_archive << type_u8;
+            *d_archive << kf_update_interval_s;
+            *d_archive << observables;
+            d_records++;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error writing PVT replay record: " << e.what();
+            d_archive.reset();
+        }
+}
+
+
+void Pvt_Replay_Writer::write(const Gps_Ephemeris& eph) { write_record(Pvt_Replay_Record::GPS_EPHEMERIS, eph); }
+void Pvt_Replay_Writer::write(const Gps_Iono& iono) { write_record(Pvt_Replay_Record::GPS_IONO, iono); }
+void Pvt_Replay_Writer::write(const Gps_Utc_Model& utc) { write_record(Pvt_Replay_Record::GPS_UTC_MODEL, utc); }
+void Pvt_Replay_Writer::write(const Gps_CNAV_Ephemeris& eph) { write_record(Pvt_Replay_Record::GPS_CNAV_EPHEMERIS, eph); }
+void Pvt_Replay_Writer::write(const Gps_CNAV_Iono& iono) { write_record(Pvt_Replay_Record::GPS_CNAV_IONO, iono); }
+void Pvt_Replay_Writer::write(const Gps_CNAV_Utc_Model& utc) { write_record(Pvt_Replay_Record::GPS_CNAV_UTC_MODEL, utc); }
+void Pvt_Replay_Writer::write(const Gps_Almanac& alm) { write_record(Pvt_Replay_Record::GPS_ALMANAC, alm); }
+void Pvt_Replay_Writer::write(const Galileo_Ephemeris& eph) { write_record(Pvt_Replay_Record::GALILEO_EPHEMERIS, eph); }
+void Pvt_Replay_Writer::write(const Galileo_Iono& iono) { write_record(Pvt_Replay_Record::GALILEO_IONO, iono); }
+void Pvt_Replay_Writer::write(const Galileo_Utc_Model& utc) { write_record(Pvt_Replay_Record::GALILEO_UTC_MODEL, utc); }
+void Pvt_Replay_Writer::write(const Galileo_Almanac& alm) { write_record(Pvt_Replay_Record::GALILEO_ALMANAC, alm); }
+void Pvt_Replay_Writer::write(const Galileo_HAS_data& has_data) { write_record(Pvt_Replay_Record::GALILEO_HAS_DATA, has_data); }
+void Pvt_Replay_Writer::write(const Glonass_Gnav_Ephemeris& eph) { write_record(Pvt_Replay_Record::GLONASS_GNAV_EPHEMERIS, eph); }
+void Pvt_Replay_Writer::write(const Glonass_Gnav_Utc_Model& utc) { write_record(Pvt_Replay_Record::GLONASS_GNAV_UTC_MODEL, utc); }
+void Pvt_Replay_Writer::write(const Glonass_Gnav_Almanac& alm) { write_record(Pvt_Replay_Record::GLONASS_GNAV_ALMANAC, alm); }
+void Pvt_Replay_Writer::write(const Beidou_Dnav_Ephemeris& eph) { write_record(Pvt_Replay_Record::BEIDOU_DNAV_EPHEMERIS, eph); }
+void Pvt_Replay_Writer::write(const Beidou_Dnav_Iono& iono) { write_record(Pvt_Replay_Record::BEIDOU_DNAV_IONO, iono); }
+void Pvt_Replay_Writer::write(const Beidou_Dnav_Utc_Model& utc) { write_record(Pvt_Replay_Record::BEIDOU_DNAV_UTC_MODEL, utc); }
+void Pvt_Replay_Writer::write(const Beidou_Dnav_Almanac& alm) { write_record(Pvt_Replay_Record::BEIDOU_DNAV_ALMANAC, alm); }
+
+
+void Pvt_Replay_Writer::write_base_observations(const std::vector<obsd_t>& base_obs, const std::array<double, 3>& base_position_ecef)
+{
+    if (!is_open())
+        {
+            return;
+        }
+    try
+        {
+            const auto type_u8 = static_cast<uint8_t>(Pvt_Replay_Record::BASE_OBSERVATIONS);
+            *d_archive << type_u8;
+            *d_archive << base_position_ecef;
+            *d_archive << base_obs;
+            d_records++;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error writing PVT replay record: " << e.what();
+            d_archive.reset();
+        }
+}
+
+
+Pvt_Replay_Session pvt_replay_load(const std::string& filename)
+{
+    Pvt_Replay_Session session;
+    std::vector<Pvt_Replay_Epoch>& epochs = session.epochs;
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        {
+            LOG(WARNING) << "Unable to open PVT replay file " << filename;
+            return session;
+        }
+
+    std::array<char, 20> magic{};
+    uint32_t version = 0;
+    file.read(magic.data(), magic.size());
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!file || std::memcmp(magic.data(), PVT_REPLAY_MAGIC.data(), magic.size()) != 0)
+        {
+            LOG(WARNING) << filename << " is not a PVT replay file";
+            return session;
+        }
+    if (version == 0 || version > PVT_REPLAY_VERSION)
+        {
+            LOG(WARNING) << "Unsupported PVT replay file version " << version;
+            return session;
+        }
+    file.read(reinterpret_cast<char*>(&session.type_of_rx), sizeof(session.type_of_rx));
+    file.read(reinterpret_cast<char*>(&session.nf), sizeof(session.nf));
+    file.read(reinterpret_cast<char*>(&session.navsys), sizeof(session.navsys));
+    if (!file)
+        {
+            LOG(WARNING) << "Truncated header in PVT replay file " << filename;
+            return session;
+        }
+
+    std::vector<std::function<void(Rtklib_Solver&)>> pending;
+    try
+        {
+            boost::archive::binary_iarchive ia(file, boost::archive::no_header);
+            while (file.peek() != std::ifstream::traits_type::eof())
+                {
+                    uint8_t type_u8 = 0;
+                    ia >> type_u8;
+                    switch (static_cast<Pvt_Replay_Record>(type_u8))
+                        {
+                        case Pvt_Replay_Record::EPOCH:
+                            {
+                                Pvt_Replay_Epoch epoch;
+                                ia >> epoch.kf_update_interval_s;
+                                ia >> epoch.observables;
+                                epoch.nav_updates.swap(pending);
+                                epochs.push_back(std::move(epoch));
+                                break;
+                            }
+                        case Pvt_Replay_Record::GPS_EPHEMERIS:
+                            read_nav<Gps_Ephemeris>(ia, pending, [](Rtklib_Solver& s, const Gps_Ephemeris& e) { s.gps_ephemeris_map[e.PRN] = e; });
+                            break;
+                        case Pvt_Replay_Record::GPS_IONO:
+                            read_nav<Gps_Iono>(ia, pending, [](Rtklib_Solver& s, const Gps_Iono& i) { s.gps_iono = i; });
+                            break;
+                        case Pvt_Replay_Record::GPS_UTC_MODEL:
+                            read_nav<Gps_Utc_Model>(ia, pending, [](Rtklib_Solver& s, const Gps_Utc_Model& u) { s.gps_utc_model = u; });
+                            break;
+                        case Pvt_Replay_Record::GPS_CNAV_EPHEMERIS:
+                            read_nav<Gps_CNAV_Ephemeris>(ia, pending, [](Rtklib_Solver& s, const Gps_CNAV_Ephemeris& e) { s.gps_cnav_ephemeris_map[e.PRN] = e; });
+                            break;
+                        case Pvt_Replay_Record::GPS_CNAV_IONO:
+                            read_nav<Gps_CNAV_Iono>(ia, pending, [](Rtklib_Solver& s, const Gps_CNAV_Iono& i) { s.gps_cnav_iono = i; });
+                            break;
+                        case Pvt_Replay_Record::GPS_CNAV_UTC_MODEL:
+                            read_nav<Gps_CNAV_Utc_Model>(ia, pending, [](Rtklib_Solver& s, const Gps_CNAV_Utc_Model& u) { s.gps_cnav_utc_model = u; });
+                            break;
+                        case Pvt_Replay_Record::GPS_ALMANAC:
+                            read_nav<Gps_Almanac>(ia, pending, [](Rtklib_Solver& s, const Gps_Almanac& a) { s.gps_almanac_map[a.PRN] = a; });
+                            break;
+                        case Pvt_Replay_Record::GALILEO_EPHEMERIS:
+                            read_nav<Galileo_Ephemeris>(ia, pending, [](Rtklib_Solver& s, const Galileo_Ephemeris& e) { s.galileo_ephemeris_map[e.PRN] = e; });
+                            break;
+                        case Pvt_Replay_Record::GALILEO_IONO:
+                            read_nav<Galileo_Iono>(ia, pending, [](Rtklib_Solver& s, const Galileo_Iono& i) { s.galileo_iono = i; });
+                            break;
+                        case Pvt_Replay_Record::GALILEO_UTC_MODEL:
+                            read_nav<Galileo_Utc_Model>(ia, pending, [](Rtklib_Solver& s, const Galileo_Utc_Model& u) { s.galileo_utc_model = u; });
+                            break;
+                        case Pvt_Replay_Record::GALILEO_ALMANAC:
+                            read_nav<Galileo_Almanac>(ia, pending, [](Rtklib_Solver& s, const Galileo_Almanac& a) { s.galileo_almanac_map[a.PRN] = a; });
+                            break;
+                        case Pvt_Replay_Record::GALILEO_HAS_DATA:
+                            read_nav<Galileo_HAS_data>(ia, pending, [](Rtklib_Solver& s, const Galileo_HAS_data& h) { s.store_has_data(h); });
+                            break;
+                        case Pvt_Replay_Record::GLONASS_GNAV_EPHEMERIS:
+                            read_nav<Glonass_Gnav_Ephemeris>(ia, pending, [](Rtklib_Solver& s, const Glonass_Gnav_Ephemeris& e) { s.glonass_gnav_ephemeris_map[e.PRN] = e; });
+                            break;
+                        case Pvt_Replay_Record::GLONASS_GNAV_UTC_MODEL:
+                            read_nav<Glonass_Gnav_Utc_Model>(ia, pending, [](Rtklib_Solver& s, const Glonass_Gnav_Utc_Model& u) { s.glonass_gnav_utc_model = u; });
+                            break;
+                        case Pvt_Replay_Record::GLONASS_GNAV_ALMANAC:
+                            read_nav<Glonass_Gnav_Almanac>(ia, pending, [](Rtklib_Solver& s, const Glonass_Gnav_Almanac& a) { s.glonass_gnav_almanac = a; });
+                            break;
+                        case Pvt_Replay_Record::BEIDOU_DNAV_EPHEMERIS:
+                            read_nav<Beidou_Dnav_Ephemeris>(ia, pending, [](Rtklib_Solver& s, const Beidou_Dnav_Ephemeris& e) { s.beidou_dnav_ephemeris_map[e.PRN] = e; });
+                            break;
+                        case Pvt_Replay_Record::BEIDOU_DNAV_IONO:
+                            read_nav<Beidou_Dnav_Iono>(ia, pending, [](Rtklib_Solver& s, const Beidou_Dnav_Iono& i) { s.beidou_dnav_iono = i; });
+                            break;
+                        case Pvt_Replay_Record::BEIDOU_DNAV_UTC_MODEL:
+                            read_nav<Beidou_Dnav_Utc_Model>(ia, pending, [](Rtklib_Solver& s, const Beidou_Dnav_Utc_Model& u) { s.beidou_dnav_utc_model = u; });
+                            break;
+                        case Pvt_Replay_Record::BEIDOU_DNAV_ALMANAC:
+                            read_nav<Beidou_Dnav_Almanac>(ia, pending, [](Rtklib_Solver& s, const Beidou_Dnav_Almanac& a) { s.beidou_dnav_almanac_map[a.PRN] = a; });
+                            break;
+                        case Pvt_Replay_Record::BASE_OBSERVATIONS:
+                            {
+                                std::array<double, 3> base_position_ecef{};
+                                std::vector<obsd_t> base_obs;
+                                ia >> base_position_ecef;
+                                ia >> base_obs;
+                                pending.emplace_back([base_obs, base_position_ecef](Rtklib_Solver& s) { s.set_base_observations(base_obs, base_position_ecef); });
+                                break;
+                            }
+                        default:
+                            LOG(WARNING) << "Unknown record type " << static_cast<int>(type_u8) << " in PVT replay file " << filename;
+                            return session;
+                        }
+                }
+        }
+    catch (const boost::archive::archive_exception& e)
+        {
+            // A run that was not shut down cleanly may leave a truncated last record
+            LOG(INFO) << "End of PVT replay file " << filename << ": " << e.what();
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Error reading PVT replay file " << filename << ": " << e.what();
+        }
+
+    return session;
+}
@@ -0,0 +1,188 @@
+/*!
+ * \file pvt_replay.h
+ * \brief Classes that record the inputs of the PVT solver (observables and
+ * navigation messages) to a compact binary file and load them back for replay
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_REPLAY_H
+#define GNSS_SDR_PVT_REPLAY_H
+
+#include "gnss_synchro.h"
+#include "rtklib.h"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+namespace boost
+{
+namespace archive
+{
+class binary_oarchive;
+}  // namespace archive
+}  // namespace boost
+
+class Beidou_Dnav_Almanac;
+class Beidou_Dnav_Ephemeris;
+class Beidou_Dnav_Iono;
+class Beidou_Dnav_Utc_Model;
+class Galileo_Almanac;
+class Galileo_Ephemeris;
+class Galileo_HAS_data;
+class Galileo_Iono;
+class Galileo_Utc_Model;
+class Glonass_Gnav_Almanac;
+class Glonass_Gnav_Ephemeris;
+class Glonass_Gnav_Utc_Model;
+class Gps_Almanac;
+class Gps_CNAV_Ephemeris;
+class Gps_CNAV_Iono;
+class Gps_CNAV_Utc_Model;
+class Gps_Ephemeris;
+class Gps_Iono;
+class Gps_Utc_Model;
+class Rtklib_Solver;
+
+/*!
+ * \brief Type of each record stored in a PVT replay file.
+ * Values are part of the file format and must not be reordered.
+ */
+enum class Pvt_Replay_Record : uint8_t
+{
+    EPOCH = 0,
+    GPS_EPHEMERIS = 1,
+    GPS_IONO = 2,
+    GPS_UTC_MODEL = 3,
+    GPS_CNAV_EPHEMERIS = 4,
+    GPS_ALMANAC = 5,
+    GALILEO_EPHEMERIS = 6,
+    GALILEO_IONO = 7,
+    GALILEO_UTC_MODEL = 8,
+    GALILEO_ALMANAC = 9,
+    GLONASS_GNAV_EPHEMERIS = 10,
+    GLONASS_GNAV_UTC_MODEL = 11,
+    GLONASS_GNAV_ALMANAC = 12,
+    BEIDOU_DNAV_EPHEMERIS = 13,
+    BEIDOU_DNAV_UTC_MODEL = 14,
+    BEIDOU_DNAV_ALMANAC = 15,
+    GPS_CNAV_IONO = 16,
+    GPS_CNAV_UTC_MODEL = 17,
+    BEIDOU_DNAV_IONO = 18,
+    GALILEO_HAS_DATA = 19,
+    BASE_OBSERVATIONS = 20
+};
+
+
+/*!
+ * \brief One epoch of a PVT replay session: the navigation data received
+ * since the previous epoch, and the observables passed to the solver.
+ */
+class Pvt_Replay_Epoch
+{
+public:
+    std::vector<std::function<void(Rtklib_Solver&)>> nav_updates;  //!< Navigation data, HAS corrections and base station observations to be stored in the solver before this epoch
+    std::map<int, Gnss_Synchro> observables;                       //!< Observables passed to Rtklib_Solver::get_PVT
+    double kf_update_interval_s{};                                 //!< Second argument of Rtklib_Solver::get_PVT
+};
+
+
+/*!
+ * \brief Contents of a PVT replay file.
+ */
+class Pvt_Replay_Session
+{
+public:
+    std::vector<Pvt_Replay_Epoch> epochs;
+    uint32_t type_of_rx{};  //!< Receiver type (signals in use) of the recorded run
+    int32_t nf{1};          //!< Number of frequencies used by the recorded run
+    int32_t navsys{};       //!< Navigation systems (SYS_XXX mask) used by the recorded run
+};
+
+
+/*!
+ * \brief Writes the observables and navigation messages received by the
+ * PVT block to a binary file, so that they can be replayed later without
+ * running acquisition, tracking and telemetry decoding.
+ *
+ * File layout: the magic string "GNSS-SDR PVT replay", a uint32_t format
+ * version, the receiver type, number of frequencies and navigation systems
+ * of the run, and then a Boost binary archive (no header) with a sequence of
+ * {Pvt_Replay_Record, object} pairs. HAS corrections are recorded only when
+ * they are stored in the solver.
+ */
+class Pvt_Replay_Writer
+{
+public:
+    Pvt_Replay_Writer(const std::string& filename, uint32_t type_of_rx, int32_t nf, int32_t navsys);
+    ~Pvt_Replay_Writer();
+
+    bool is_open() const;  //!< Returns true if the file is ready for writing
+
+    void write_epoch(const std::map<int, Gnss_Synchro>& observables, double kf_update_interval_s);
+
+    void write(const Gps_Ephemeris& eph);
+    void write(const Gps_Iono& iono);
+    void write(const Gps_Utc_Model& utc);
+    void write(const Gps_CNAV_Ephemeris& eph);
+    void write(const Gps_CNAV_Iono& iono);
+    void write(const Gps_CNAV_Utc_Model& utc);
+    void write(const Gps_Almanac& alm);
+    void write(const Galileo_Ephemeris& eph);
+    void write(const Galileo_Iono& iono);
+    void write(const Galileo_Utc_Model& utc);
+    void write(const Galileo_Almanac& alm);
+    void write(const Galileo_HAS_data& has_data);
+    void write(const Glonass_Gnav_Ephemeris& eph);
+    void write(const Glonass_Gnav_Utc_Model& utc);
+    void write(const Glonass_Gnav_Almanac& alm);
+    void write(const Beidou_Dnav_Ephemeris& eph);
+    void write(const Beidou_Dnav_Iono& iono);
+    void write(const Beidou_Dnav_Utc_Model& utc);
+    void write(const Beidou_Dnav_Almanac& alm);
+
+    /*!
+     * \brief Records the base station observations and position passed to
+     * Rtklib_Solver::set_base_observations
+     */
+    void write_base_observations(const std::vector<obsd_t>& base_obs, const std::array<double, 3>& base_position_ecef);
+
+private:
+    template <typename T>
+    void write_record(Pvt_Replay_Record type, const T& object);
+
+    std::ofstream d_file;
+    std::unique_ptr<boost::archive::binary_oarchive> d_archive;
+    uint64_t d_records;
+};
+
+
+/*!
+ * \brief Loads a file written by Pvt_Replay_Writer. Navigation messages are
+ * attached to the epoch that follows them. Returns a session without epochs
+ * if the file cannot be read. A truncated last record is silently discarded.
+ */
+Pvt_Replay_Session pvt_replay_load(const std::string& filename);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_REPLAY_H
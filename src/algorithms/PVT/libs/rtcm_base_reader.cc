@@ -0,0 +1,136 @@
+/*!
+ * \file rtcm_base_reader.cc
+ * \brief Reads the observations and position of an RTK base station from a
+ * file of RTCM 3 messages
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_base_reader.h"
+#include "gnss_sdr_make_unique.h"
+#include "rtklib_rtcm.h"
+#include "rtklib_rtkcmn.h"
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+Rtcm_Base_Reader::Rtcm_Base_Reader(const std::string& filename)
+    : d_rtcm(std::make_unique<rtcm_t>()),
+      d_file(std::fopen(filename.c_str(), "rb")),
+      d_rtcm_initialized(false),
+      d_end_of_file(false)
+{
+    if (d_file == nullptr)
+        {
+            LOG(WARNING) << "Unable to open RTCM base station file " << filename;
+            return;
+        }
+    d_rtcm_initialized = (init_rtcm(d_rtcm.get()) != 0);
+    if (!d_rtcm_initialized)
+        {
+            LOG(WARNING) << "Unable to allocate the RTCM decoder for " << filename;
+            std::fclose(d_file);
+            d_file = nullptr;
+            return;
+        }
+    LOG(INFO) << "Reading RTK base station observations from " << filename;
+}
+
+
+Rtcm_Base_Reader::~Rtcm_Base_Reader()
+{
+    if (d_rtcm_initialized)
+        {
+            free_rtcm(d_rtcm.get());
+        }
+    if (d_file != nullptr)
+        {
+            std::fclose(d_file);
+        }
+}
+
+
+bool Rtcm_Base_Reader::is_open() const
+{
+    return d_file != nullptr;
+}
+
+
+bool Rtcm_Base_Reader::read_until(const gtime_t& rover_time)
+{
+    if (d_file == nullptr)
+        {
+            return false;
+        }
+    bool updated = false;
+    if (!d_next_obs.empty() && timediff(d_next_obs[0].time, rover_time) <= 0.0)
+        {
+            d_obs.swap(d_next_obs);
+            d_next_obs.clear();
+            updated = true;
+        }
+    // The decoder resolves the week of the messages from the time of the
+    // previous one, so it starts from the rover time
+    if (d_rtcm->time.time == 0)
+        {
+            d_rtcm->time = rover_time;
+        }
+    while (d_next_obs.empty() && !d_end_of_file)
+        {
+            const int ret = input_rtcm3f(d_rtcm.get(), d_file);
+            if (ret == -2)
+                {
+                    d_end_of_file = true;
+                }
+            else if (ret == 5)
+                {
+                    for (int i = 0; i < 3; i++)
+                        {
+                            d_position[i] = d_rtcm->sta.pos[i];
+                        }
+                }
+            else if (ret == 1 && d_rtcm->obs.n > 0)
+                {
+                    std::vector<obsd_t> epoch(d_rtcm->obs.data, d_rtcm->obs.data + d_rtcm->obs.n);
+                    for (auto& obs : epoch)
+                        {
+                            obs.rcv = 2;
+                        }
+                    if (timediff(epoch[0].time, rover_time) <= 0.0)
+                        {
+                            d_obs.swap(epoch);
+                            updated = true;
+                        }
+                    else
+                        {
+                            d_next_obs.swap(epoch);
+                        }
+                }
+        }
+    const bool position_known = (d_position[0] != 0.0 || d_position[1] != 0.0 || d_position[2] != 0.0);
+    return updated && position_known;
+}
+
+
+const std::vector<obsd_t>& Rtcm_Base_Reader::get_observations() const
+{
+    return d_obs;
+}
+
+
+const std::array<double, 3>& Rtcm_Base_Reader::get_position() const
+{
+    return d_position;
+}
@@ -0,0 +1,69 @@
+/*!
+ * \file rtcm_base_reader.h
+ * \brief Reads the observations and position of an RTK base station from a
+ * file of RTCM 3 messages
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BASE_READER_H
+#define GNSS_SDR_RTCM_BASE_READER_H
+
+#include "rtklib.h"
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Reads a file of RTCM 3 messages (MSM or legacy observations, and
+ * the station position in message 1005 or 1006) recorded at a base station,
+ * and provides the base observations for each epoch of the rover.
+ */
+class Rtcm_Base_Reader
+{
+public:
+    explicit Rtcm_Base_Reader(const std::string& filename);
+    ~Rtcm_Base_Reader();
+
+    bool is_open() const;  //!< Returns true if the file is ready for reading
+
+    /*!
+     * \brief Reads the file up to the rover time. Returns true if a newer
+     * base station epoch, not later than rover_time, is available and the
+     * station position is known.
+     */
+    bool read_until(const gtime_t& rover_time);
+
+    const std::vector<obsd_t>& get_observations() const;  //!< Last base station epoch, with rcv = 2
+    const std::array<double, 3>& get_position() const;    //!< ECEF position of the base station [m]
+
+private:
+    std::unique_ptr<rtcm_t> d_rtcm;
+    std::vector<obsd_t> d_obs;
+    std::vector<obsd_t> d_next_obs;  // epoch already read, after the rover time
+    std::array<double, 3> d_position{};
+    FILE* d_file;
+    bool d_rtcm_initialized;
+    bool d_end_of_file;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BASE_READER_H
@@ -33,6 +33,7 @@
 #include "rtklib_solver.h"
 #include "Beidou_DNAV.h"
 #include "gnss_sdr_filesystem.h"
+#include "rtklib_ephemeris.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solution.h"
 #include <matio.h>
@@ -1503,7 +1504,28 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                         }
                 }
 
-            result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
+            // In the relative modes, the base station observations follow those of the rover
+            int n_obs = valid_obs + glo_valid_obs;
+            if (d_rtk.opt.mode >= PMODE_DGPS && d_rtk.opt.mode <= PMODE_FIXED && !d_base_obs_data.empty())
+                {
+                    for (const auto &base_obs : d_base_obs_data)
+                        {
+                            if (n_obs == MAXOBS)
+                                {
+                                    break;
+                                }
+                            d_obs_data[n_obs] = base_obs;
+                            d_obs_data[n_obs].rcv = 2;
+                            n_obs++;
+                        }
+                    for (int i = 0; i < 3; i++)
+                        {
+                            d_rtk.opt.rb[i] = d_base_position_ecef[i];
+                        }
+                }
+
+            result = rtkpos(&d_rtk, d_obs_data.data(), n_obs, &d_nav_data);
+            d_sat_pos_vel_clk_drift.clear();
 
             if (result == 0)
                 {
@@ -1580,6 +1602,26 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 }
                         }
 
+                    if (d_conf.enable_vector_tracking == true)
+                        {
+                            // Keep the position, velocity and clock drift of the satellites
+                            // for the prediction of the pseudorange rates
+                            const int n = valid_obs + glo_valid_obs;
+                            std::vector<double> rs(6 * n);
+                            std::vector<double> dts(2 * n);
+                            std::vector<double> var(n);
+                            std::vector<int> svh(n);
+                            satposs(pvt_sol.time, d_obs_data.data(), n, &d_nav_data, d_rtk.opt.sateph, rs.data(), dts.data(), var.data(), svh.data());
+                            for (int i = 0; i < n; i++)
+                                {
+                                    if (svh[i] >= 0 && (rs[6 * i] != 0.0 || rs[6 * i + 1] != 0.0 || rs[6 * i + 2] != 0.0))
+                                        {
+                                            d_sat_pos_vel_clk_drift[d_obs_data[i].sat] = {rs[6 * i], rs[6 * i + 1], rs[6 * i + 2],
+                                                rs[6 * i + 3], rs[6 * i + 4], rs[6 * i + 5], dts[2 * i + 1]};
+                                        }
+                                }
+                        }
+
                     rx_position_and_time[0] = pvt_sol.rr[0];  // [m]
                     rx_position_and_time[1] = pvt_sol.rr[1];  // [m]
                     rx_position_and_time[2] = pvt_sol.rr[2];  // [m]
@@ -1808,3 +1850,71 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
         }
     return this->is_valid_position();
 }
+
+
+bool Rtklib_Solver::get_predicted_pseudorange_rate(char system, uint32_t prn, double &pseudorange_rate_m_s) const
+{
+    int sys = SYS_NONE;
+    switch (system)
+        {
+        case 'G':
+            sys = SYS_GPS;
+            break;
+        case 'E':
+            sys = SYS_GAL;
+            break;
+        case 'R':
+            sys = SYS_GLO;
+            break;
+        case 'C':
+            sys = SYS_BDS;
+            break;
+        default:
+            return false;
+        }
+    const auto it = d_sat_pos_vel_clk_drift.find(satno(sys, static_cast<int>(prn)));
+    if (it == d_sat_pos_vel_clk_drift.cend())
+        {
+            return false;
+        }
+    return compute_pseudorange_rate(it->second, pvt_sol, pseudorange_rate_m_s);
+}
+
+
+bool Rtklib_Solver::compute_pseudorange_rate(const std::array<double, 7> &sat_pos_vel_clk_drift, const sol_t &sol, double &pseudorange_rate_m_s)
+{
+    const std::array<double, 7> &sat = sat_pos_vel_clk_drift;
+    const double *rr = sol.rr;
+
+    // line-of-sight unit vector from the receiver to the satellite
+    std::array<double, 3> e{sat[0] - rr[0], sat[1] - rr[1], sat[2] - rr[2]};
+    const double range = std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+    if (range <= 0.0)
+        {
+            return false;
+        }
+    double rate = 0.0;
+    for (int j = 0; j < 3; j++)
+        {
+            e[j] /= range;
+            rate += (sat[j + 3] - rr[j + 3]) * e[j];
+        }
+
+    // Earth rotation correction and clock drifts, as in the Doppler residuals of RTKLIB
+    rate += GNSS_OMEGA_EARTH_DOT / SPEED_OF_LIGHT_M_S * (sat[4] * rr[0] + sat[1] * rr[3] - sat[3] * rr[1] - sat[0] * rr[4]);
+    pseudorange_rate_m_s = rate + sol.dtr[5] - SPEED_OF_LIGHT_M_S * sat[6];
+    return true;
+}
+
+
+void Rtklib_Solver::set_base_observations(const std::vector<obsd_t> &base_obs, const std::array<double, 3> &base_position_ecef)
+{
+    d_base_obs_data = base_obs;
+    d_base_position_ecef = base_position_ecef;
+}
+
+
+const std::vector<obsd_t> &Rtklib_Solver::get_base_observations() const
+{
+    return d_base_obs_data;
+}
@@ -67,6 +67,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 /** \addtogroup PVT
  * \{ */
@@ -100,6 +101,30 @@ public:
     void store_has_data(const Galileo_HAS_data& new_has_data);
     void update_has_corrections(const std::map<int, Gnss_Synchro>& obs_map);
 
+    /*!
+     * \brief Pseudorange rate [m/s] of a satellite predicted by the last PVT
+     * solution, for the aiding of its tracking channels. Returns false if the
+     * satellite was not in the solution. Requires enable_vector_tracking.
+     */
+    bool get_predicted_pseudorange_rate(char system, uint32_t prn, double& pseudorange_rate_m_s) const;
+
+    /*!
+     * \brief Pseudorange rate [m/s] of a satellite with ECEF position [m],
+     * velocity [m/s] and clock drift [s/s] sat_pos_vel_clk_drift, seen from
+     * the receiver position, velocity and clock drift (dtr[5], in m/s) of sol.
+     * Returns false if both positions are the same.
+     */
+    static bool compute_pseudorange_rate(const std::array<double, 7>& sat_pos_vel_clk_drift, const sol_t& sol, double& pseudorange_rate_m_s);
+
+    /*!
+     * \brief Sets the observations and ECEF position [m] of the base station
+     * used by the next solutions in the relative positioning modes (DGPS,
+     * kinematic, static, moving base and fixed).
+     */
+    void set_base_observations(const std::vector<obsd_t>& base_obs, const std::array<double, 3>& base_position_ecef);
+
+    const std::vector<obsd_t>& get_base_observations() const;
+
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
 
@@ -135,8 +160,11 @@ private:
     void get_current_has_obs_correction(const std::string& signal, uint32_t tow_obs, int prn);
 
     std::array<obsd_t, MAXOBS> d_obs_data{};
+    std::vector<obsd_t> d_base_obs_data;
+    std::array<double, 3> d_base_position_ecef{};
     std::array<double, 4> d_dop{};
     std::map<int, int> d_rtklib_freq_index;
+    std::map<int, std::array<double, 7>> d_sat_pos_vel_clk_drift;  // key is the RTKLIB satellite number
     std::map<std::string, int> d_rtklib_band_index;
 
     std::map<std::string, std::map<int, HAS_orbit_corrections>> d_has_orbit_corrections_store_map;  // first key is system, second key is PRN
@@ -135,6 +135,15 @@ void GalileoE5aPcpsAcquisition::set_doppler_center(int doppler_center)
 }
 
 
+bool GalileoE5aPcpsAcquisition::set_doppler_window(int doppler_center, unsigned int doppler_max)
+{
+    doppler_center_ = doppler_center;
+
+    acquisition_->set_doppler_window(doppler_center_, (doppler_max == 0 || doppler_max > doppler_max_) ? doppler_max_ : doppler_max);
+    return true;
+}
+
+
 void GalileoE5aPcpsAcquisition::set_gnss_synchro(Gnss_Synchro* gnss_synchro)
 {
     gnss_synchro_ = gnss_synchro;
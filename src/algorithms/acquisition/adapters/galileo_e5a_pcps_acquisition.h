@@ -111,6 +111,13 @@ public:
      */
     void set_doppler_center(int doppler_center) override;
 
+    /*!
+     * \brief Set Doppler center and maximum Doppler shift for the grid search.
+     * A doppler_max of 0 or larger than the configured one restores the
+     * configured grid. Returns true.
+     */
+    bool set_doppler_window(int doppler_center, unsigned int doppler_max) override;
+
     /*!
      * \brief Initializes acquisition algorithm.
      */
@@ -22,9 +22,11 @@
 #include "pcps_acquisition.h"
 #include "GLONASS_L1_L2_CA.h"  // for GLONASS_PRN
 #include "MATH_CONSTANTS.h"    // for TWO_PI
+#include "acq_peak_refinement.h"
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
+#include "gnss_sdr_make_unique.h"  // for std::make_unique in C++11
 #include "gnss_synchro.h"
 #include <boost/math/special_functions/gamma.hpp>
 #include <gnuradio/io_signature.h>
@@ -46,6 +48,13 @@
 #include <absl/log/log.h>
 #endif
 
+namespace
+{
+// Probability of false alarm of the verification of a folded peak when the
+// detection threshold is set directly instead of computed from a Pfa
+constexpr double FOLDED_PEAK_VERIFICATION_PFA = 0.001;
+}  // namespace
+
 
 pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_)
 {
@@ -63,6 +72,8 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_dump_number(0LL),
       d_sample_counter(0ULL),
       d_threshold(0.0),
+      d_verification_threshold(0.0),
+      d_verification_statistic(0.0),
       d_mag(0),
       d_input_power(0.0),
       d_test_statistics(0.0),
@@ -71,6 +82,8 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_positive_acq(0),
       d_doppler_center(0U),
       d_doppler_bias(0),
+      d_fixed_point_input_exponent(0),
+      d_fixed_point_codes_exponent(0),
       d_channel(0U),
       d_samplesPerChip(conf_.samples_per_chip),
       d_doppler_step(conf_.doppler_step),
@@ -80,8 +93,12 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_num_doppler_bins_step2(conf_.num_doppler_bins_step2),
       d_dump_channel(conf_.dump_channel),
       d_buffer_count(0U),
+      d_index_doppler(0U),
+      d_max_num_doppler_bins(0U),
+      d_folding_factor(conf_.folding_factor > 0 ? conf_.folding_factor : 1U),
       d_active(false),
       d_worker_active(false),
+      d_fixed_point(conf_.fixed_point),
       d_step_two(false),
       d_use_CFAR_algorithm_flag(conf_.use_CFAR_algorithm_flag),
       d_dump(conf_.dump)
@@ -114,11 +131,35 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
     //  d_acq_parameters.max_dwells = 1;  // Activation of d_acq_parameters.bit_transition_flag invalidates the value of d_acq_parameters.max_dwells
     // }
 
+    // Folding the input into 1/d_folding_factor of the code period requires
+    // the circular correlation layout
+    if (d_folding_factor > 1 && (d_acq_parameters.bit_transition_flag || d_fft_size != d_consumed_samples || d_fft_size % d_folding_factor != 0))
+        {
+            LOG(WARNING) << "Acquisition folding factor " << d_folding_factor << " is not compatible with "
+                         << (d_acq_parameters.bit_transition_flag ? "the bit transition search" : "the integration time")
+                         << ", folding is disabled";
+            d_folding_factor = 1U;
+        }
+    if (d_acq_parameters.bit_transition_flag)
+        {
+            d_effective_fft_size = d_fft_size / 2;
+        }
+    else
+        {
+            d_effective_fft_size = d_fft_size / d_folding_factor;
+        }
+
     d_tmp_buffer = volk_gnsssdr::vector<float>(d_fft_size);
     d_fft_codes = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
     d_input_signal = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
     d_fft_if = gnss_fft_fwd_make_unique(d_fft_size);
     d_ifft = gnss_fft_rev_make_unique(d_fft_size);
+    if (d_folding_factor > 1)
+        {
+            d_fft_codes_folded = volk_gnsssdr::vector<std::complex<float>>(d_effective_fft_size);
+            d_folded_fft_if = gnss_fft_fwd_make_unique(d_effective_fft_size);
+            d_folded_ifft = gnss_fft_rev_make_unique(d_effective_fft_size);
+        }
 
     d_grid = arma::fmat();
     d_narrow_grid = arma::fmat();
@@ -138,6 +179,31 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
             d_data_buffer_sc = volk_gnsssdr::vector<lv_16sc_t>(d_consumed_samples);
         }
 
+    // The fixed-point correlation works on the 16-bit input samples with the
+    // circular correlation layout, and its FFT needs a power of two size
+    if (d_fixed_point && (!d_cshort || d_acq_parameters.bit_transition_flag || d_fft_size != d_consumed_samples || d_folding_factor > 1 || !AcqFixedPointFft::is_supported_size(d_fft_size)))
+        {
+            LOG(WARNING) << "Fixed-point acquisition requires 16-bit complex input samples, no bit transition search, no folding "
+                         << "and a power of two FFT size (" << d_fft_size << "), it is disabled";
+            d_fixed_point = false;
+        }
+    if (d_fixed_point)
+        {
+            d_fixed_point_fft = std::make_unique<AcqFixedPointFft>(d_fft_size);
+            d_fixed_point_input = volk_gnsssdr::vector<lv_16sc_t>(d_fft_size);
+            d_fixed_point_buffer = volk_gnsssdr::vector<lv_16sc_t>(d_fft_size);
+            d_fixed_point_codes = volk_gnsssdr::vector<lv_16sc_t>(d_fft_size);
+        }
+
+    // The refinement of the carrier frequency and the verification of the
+    // folded peaks correlate the carrier wiped-off signal with the local code
+    // in the time domain
+    if ((d_acq_parameters.enable_peak_refinement || d_folding_factor > 1) && !d_acq_parameters.bit_transition_flag && d_fft_size == d_consumed_samples)
+        {
+            d_local_code = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
+            d_wiped_signal = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
+        }
+
     if (d_dump)
         {
             std::string dump_path;
@@ -202,6 +268,10 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
             if (d_acq_parameters.sampled_ms == d_acq_parameters.ms_per_code)
                 {
                     std::copy(code, code + d_consumed_samples, d_fft_if->get_inbuf());
+                    if (!d_local_code.empty())
+                        {
+                            std::copy(code, code + d_consumed_samples, d_local_code.begin());
+                        }
                 }
             else
                 {
@@ -212,6 +282,17 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
 
     d_fft_if->execute();  // We need the FFT of local code
     volk_32fc_conjugate_32fc(d_fft_codes.data(), d_fft_if->get_outbuf(), d_fft_size);
+    if (d_fixed_point)
+        {
+            d_fixed_point_codes_exponent = fixed_point_quantize(d_fixed_point_codes.data(), d_fft_codes.data(), d_fft_size);
+        }
+
+    // The spectrum of the folded code is the spectrum of the code decimated
+    // by the folding factor
+    for (uint32_t i = 0; i < d_fft_codes_folded.size(); i++)
+        {
+            d_fft_codes_folded[i] = d_fft_codes[i * d_folding_factor];
+        }
 }
 
 
@@ -258,6 +339,7 @@ void pcps_acquisition::init()
     d_gnss_synchro->Flag_valid_symbol_output = false;
     d_gnss_synchro->Flag_valid_pseudorange = false;
     d_gnss_synchro->Flag_valid_word = false;
+    d_gnss_synchro->Flag_refined_acquisition = false;
     d_gnss_synchro->Acq_doppler_step = 0U;
     d_gnss_synchro->Acq_delay_samples = 0.0;
     d_gnss_synchro->Acq_doppler_hz = 0.0;
@@ -267,24 +349,40 @@ void pcps_acquisition::init()
 
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(2 * d_acq_parameters.doppler_max) / static_cast<double>(d_doppler_step)));
 
-    // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs.empty())
+    if (d_acq_parameters.low_memory)
         {
-            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+            // The carrier wipeoffs are generated when they are used, and the
+            // magnitudes are stored with 16 bits per cell
+            if (d_max_num_doppler_bins == 0)
+                {
+                    d_max_num_doppler_bins = d_num_doppler_bins;
+                    d_wipeoff = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
+                    d_quantized_grid = AcqQuantizedGrid(std::max(d_num_doppler_bins, d_num_doppler_bins_step2), d_effective_fft_size);
+                }
+            d_quantized_grid.reset();
         }
-    if (d_acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two.empty()))
+    else
         {
-            d_grid_doppler_wipeoffs_step_two = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins_step2, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
-        }
+            // Create the carrier Doppler wipeoff signals
+            if (d_grid_doppler_wipeoffs.empty())
+                {
+                    d_max_num_doppler_bins = d_num_doppler_bins;
+                    d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+                }
+            if (d_acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two.empty()))
+                {
+                    d_grid_doppler_wipeoffs_step_two = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins_step2, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+                }
 
-    if (d_magnitude_grid.empty())
-        {
-            d_magnitude_grid = volk_gnsssdr::vector<volk_gnsssdr::vector<float>>(d_num_doppler_bins, volk_gnsssdr::vector<float>(d_fft_size));
-        }
+            if (d_magnitude_grid.empty())
+                {
+                    d_magnitude_grid = volk_gnsssdr::vector<volk_gnsssdr::vector<float>>(d_num_doppler_bins, volk_gnsssdr::vector<float>(d_fft_size));
+                }
 
-    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
-        {
-            std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    std::fill(d_magnitude_grid[doppler_index].begin(), d_magnitude_grid[doppler_index].end(), 0.0);
+                }
         }
 
     update_grid_doppler_wipeoffs();
@@ -292,29 +390,148 @@ void pcps_acquisition::init()
 
     if (d_dump)
         {
-            const uint32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? (d_fft_size / 2) : d_fft_size);
-            d_grid = arma::fmat(effective_fft_size, d_num_doppler_bins, arma::fill::zeros);
-            d_narrow_grid = arma::fmat(effective_fft_size, d_num_doppler_bins_step2, arma::fill::zeros);
+            d_grid = arma::fmat(d_effective_fft_size, d_num_doppler_bins, arma::fill::zeros);
+            d_narrow_grid = arma::fmat(d_effective_fft_size, d_num_doppler_bins_step2, arma::fill::zeros);
         }
 }
 
 
+float pcps_acquisition::wipeoff_frequency(uint32_t doppler_index, bool step_two) const
+{
+    if (step_two)
+        {
+            const float doppler = (static_cast<float>(doppler_index) - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0))) * d_acq_parameters.doppler_step2;
+            return d_doppler_center_step_two + doppler;
+        }
+    const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+    return static_cast<float>(d_doppler_bias + doppler);
+}
+
+
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    if (d_acq_parameters.low_memory)
+        {
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
-            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
-            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], static_cast<float>(d_doppler_bias + doppler));
+            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], wipeoff_frequency(doppler_index, false));
         }
 }
 
 
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
+    if (d_acq_parameters.low_memory)
+        {
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
         {
-            const float doppler = (static_cast<float>(doppler_index) - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0))) * d_acq_parameters.doppler_step2;
-            update_local_carrier(d_grid_doppler_wipeoffs_step_two[doppler_index], d_doppler_center_step_two + doppler);
+            update_local_carrier(d_grid_doppler_wipeoffs_step_two[doppler_index], wipeoff_frequency(doppler_index, true));
+        }
+}
+
+
+const gr_complex* pcps_acquisition::doppler_wipeoff(uint32_t doppler_index)
+{
+    if (!d_acq_parameters.low_memory)
+        {
+            return (d_step_two ? d_grid_doppler_wipeoffs_step_two[doppler_index].data() : d_grid_doppler_wipeoffs[doppler_index].data());
+        }
+    // The rotator kernels of volk_gnsssdr (volk_gnsssdr_16ic_s32fc_x2_rotator_16ic,
+    // used by correlate_fixed_point) work on 16-bit samples, while this path
+    // multiplies floating point samples, so the wipeoff is generated with
+    // the same sincos kernel as the stored ones
+    update_local_carrier(d_wipeoff, wipeoff_frequency(doppler_index, d_step_two));
+    return d_wipeoff.data();
+}
+
+
+void pcps_acquisition::store_magnitude(uint32_t doppler_index, const gr_complex* correlation, arma::fmat& dump_grid)
+{
+    // Compute squared magnitude (and accumulate in case of non-coherent integration)
+    if (!d_acq_parameters.low_memory && d_num_noncoherent_integrations_counter <= 1)
+        {
+            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), correlation, d_effective_fft_size);
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    get_grid_row(doppler_index, dump_grid.colptr(doppler_index));
+                }
+            return;
+        }
+    volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), correlation, d_effective_fft_size);
+    store_magnitude_row(doppler_index, dump_grid);
+}
+
+
+void pcps_acquisition::store_magnitude_row(uint32_t doppler_index, arma::fmat& dump_grid)
+{
+    // Store the squared magnitudes in d_tmp_buffer (and accumulate in case of non-coherent integration)
+    const bool accumulate = (d_num_noncoherent_integrations_counter > 1);
+    if (d_acq_parameters.low_memory)
+        {
+            d_quantized_grid.store_row(doppler_index, d_tmp_buffer.data(), accumulate);
+        }
+    else if (!accumulate)
+        {
+            std::copy(d_tmp_buffer.data(), d_tmp_buffer.data() + d_effective_fft_size, d_magnitude_grid[doppler_index].data());
+        }
+    else
+        {
+            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), d_effective_fft_size);
+        }
+    // Record results to file if required
+    if (d_dump and d_channel == d_dump_channel)
+        {
+            get_grid_row(doppler_index, dump_grid.colptr(doppler_index));
+        }
+}
+
+
+float pcps_acquisition::grid_row_max(uint32_t doppler_index, uint32_t& index_time) const
+{
+    if (d_acq_parameters.low_memory)
+        {
+            index_time = d_quantized_grid.row_argmax(doppler_index);
+            return d_quantized_grid.row_max(doppler_index);
+        }
+    volk_gnsssdr_32f_index_max_32u(&index_time, d_magnitude_grid[doppler_index].data(), d_effective_fft_size);
+    return d_magnitude_grid[doppler_index][index_time];
+}
+
+
+float pcps_acquisition::grid_row_sum(uint32_t doppler_index) const
+{
+    if (d_acq_parameters.low_memory)
+        {
+            return d_quantized_grid.row_sum(doppler_index);
+        }
+    return std::accumulate(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + d_effective_fft_size, static_cast<float>(0.0));
+}
+
+
+float pcps_acquisition::grid_value(uint32_t doppler_index, uint32_t index_time) const
+{
+    if (d_acq_parameters.low_memory)
+        {
+            return d_quantized_grid.value(doppler_index, index_time);
+        }
+    return d_magnitude_grid[doppler_index][index_time];
+}
+
+
+void pcps_acquisition::get_grid_row(uint32_t doppler_index, float* out) const
+{
+    if (d_acq_parameters.low_memory)
+        {
+            d_quantized_grid.get_row(doppler_index, out);
+        }
+    else
+        {
+            std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + d_effective_fft_size, out);
         }
 }
 
@@ -506,24 +723,25 @@ float pcps_acquisition::max_to_input_power_statistic(uint32_t& indext, int32_t&
     uint32_t index_doppler = 0U;
     uint32_t tmp_intex_t = 0U;
     uint32_t index_time = 0U;
-    const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
+    const auto effective_fft_size = static_cast<int32_t>(d_effective_fft_size);
 
     // Find the correlation peak and the carrier frequency
     for (uint32_t i = 0; i < num_doppler_bins; i++)
         {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), effective_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > grid_maximum)
+            const float row_maximum = grid_row_max(i, tmp_intex_t);
+            if (row_maximum > grid_maximum)
                 {
-                    grid_maximum = d_magnitude_grid[i][tmp_intex_t];
+                    grid_maximum = row_maximum;
                     index_doppler = i;
                     index_time = tmp_intex_t;
                 }
         }
     indext = index_time;
+    d_index_doppler = index_doppler;
     if (!d_step_two)
         {
             const auto index_opp = (index_doppler + d_num_doppler_bins / 2) % d_num_doppler_bins;
-            d_input_power = static_cast<float>(std::accumulate(d_magnitude_grid[index_opp].data(), d_magnitude_grid[index_opp].data() + effective_fft_size, static_cast<float>(0.0)) / effective_fft_size / 2.0 / d_num_noncoherent_integrations_counter);
+            d_input_power = static_cast<float>(grid_row_sum(index_opp) / effective_fft_size / 2.0 / d_num_noncoherent_integrations_counter);
             doppler = -static_cast<int32_t>(doppler_max) + d_doppler_center + doppler_step * static_cast<int32_t>(index_doppler);
         }
     else
@@ -552,15 +770,16 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     // Find the correlation peak and the carrier frequency
     for (uint32_t i = 0; i < num_doppler_bins; i++)
         {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), d_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > firstPeak)
+            const float row_maximum = grid_row_max(i, tmp_intex_t);
+            if (row_maximum > firstPeak)
                 {
-                    firstPeak = d_magnitude_grid[i][tmp_intex_t];
+                    firstPeak = row_maximum;
                     index_doppler = i;
                     index_time = tmp_intex_t;
                 }
         }
     indext = index_time;
+    d_index_doppler = index_doppler;
 
     if (!d_step_two)
         {
@@ -578,20 +797,20 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     // Correct code phase exclude range if the range includes array boundaries
     if (excludeRangeIndex1 < 0)
         {
-            excludeRangeIndex1 = d_fft_size + excludeRangeIndex1;
+            excludeRangeIndex1 = d_effective_fft_size + excludeRangeIndex1;
         }
-    else if (excludeRangeIndex2 >= static_cast<int32_t>(d_fft_size))
+    else if (excludeRangeIndex2 >= static_cast<int32_t>(d_effective_fft_size))
         {
-            excludeRangeIndex2 = excludeRangeIndex2 - d_fft_size;
+            excludeRangeIndex2 = excludeRangeIndex2 - d_effective_fft_size;
         }
 
     int32_t idx = excludeRangeIndex1;
-    std::copy(d_magnitude_grid[index_doppler].data(), d_magnitude_grid[index_doppler].data() + d_fft_size, d_tmp_buffer.data());
+    get_grid_row(index_doppler, d_tmp_buffer.data());
     do
         {
             d_tmp_buffer[idx] = 0.0;
             idx++;
-            if (idx == static_cast<int32_t>(d_fft_size))
+            if (idx == static_cast<int32_t>(d_effective_fft_size))
                 {
                     idx = 0;
                 }
@@ -599,7 +818,7 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     while (idx != excludeRangeIndex2);
 
     // Find the second highest correlation peak in the same freq. bin ---
-    volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_tmp_buffer.data(), d_fft_size);
+    volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_tmp_buffer.data(), d_effective_fft_size);
     const float secondPeak = d_tmp_buffer[tmp_intex_t];
 
     // Compute the test statistics and compare to the threshold
@@ -607,6 +826,156 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
 }
 
 
+void pcps_acquisition::refine_peak(const gr_complex* in, uint32_t indext)
+{
+    const bool circular = (!d_acq_parameters.bit_transition_flag && d_fft_size == d_consumed_samples);
+    const uint32_t cell = indext % d_effective_fft_size;  // lag in the (folded) magnitude grid
+    const uint32_t num_doppler_bins = (d_step_two ? d_num_doppler_bins_step2 : d_num_doppler_bins);
+    const float doppler_step = (d_step_two ? d_acq_parameters.doppler_step2 : static_cast<float>(d_doppler_step));
+
+    // Code phase: vertex of the parabola through the correlation amplitudes
+    // of the peak and its neighbouring lags
+    if (circular || (cell > 0 && cell + 1 < d_effective_fft_size))
+        {
+            const uint32_t prev = (cell + d_effective_fft_size - 1) % d_effective_fft_size;
+            const uint32_t next = (cell + 1) % d_effective_fft_size;
+            const float code_offset = parabolic_peak_offset(std::sqrt(grid_value(d_index_doppler, prev)),
+                std::sqrt(grid_value(d_index_doppler, cell)),
+                std::sqrt(grid_value(d_index_doppler, next)));
+            d_gnss_synchro->Acq_delay_samples += static_cast<double>(code_offset) * (d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampler_ratio : 1.0);
+        }
+
+    // Carrier frequency: wipe off the carrier of the Doppler bin and the
+    // aligned local code, and estimate the residual frequency with a short
+    // coherent spectral search. The grid parabola is the fallback.
+    double residual_hz = 0.0;
+    bool estimated = false;
+    if (!d_local_code.empty())
+        {
+            volk_32fc_x2_multiply_32fc(d_wiped_signal.data(), in, doppler_wipeoff(d_index_doppler), d_fft_size);
+            volk_32fc_x2_multiply_conjugate_32fc(d_wiped_signal.data() + indext, d_wiped_signal.data() + indext, d_local_code.data(), d_fft_size - indext);
+            if (indext > 0)
+                {
+                    volk_32fc_x2_multiply_conjugate_32fc(d_wiped_signal.data(), d_wiped_signal.data(), d_local_code.data() + (d_fft_size - indext), indext);
+                }
+            const double fs = (d_acq_parameters.use_automatic_resampler ? static_cast<double>(d_acq_parameters.resampled_fs) : static_cast<double>(d_acq_parameters.fs_in));
+            estimated = estimate_residual_frequency(d_wiped_signal.data(), d_fft_size, fs, doppler_step, residual_hz);
+        }
+    if (!estimated && d_index_doppler > 0 && d_index_doppler + 1 < num_doppler_bins)
+        {
+            const float doppler_offset = parabolic_peak_offset(std::sqrt(grid_value(d_index_doppler - 1, cell)),
+                std::sqrt(grid_value(d_index_doppler, cell)),
+                std::sqrt(grid_value(d_index_doppler + 1, cell)));
+            residual_hz = static_cast<double>(doppler_offset * doppler_step);
+        }
+    d_gnss_synchro->Acq_doppler_hz += residual_hz;
+    d_gnss_synchro->Flag_refined_acquisition = true;
+}
+
+
+const gr_complex* pcps_acquisition::correlate(const gr_complex* in, const gr_complex* wipeoff)
+{
+    if (d_folding_factor == 1)
+        {
+            // Remove Doppler
+            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, wipeoff, d_fft_size);
+
+            // Perform the FFT-based convolution  (parallel time search)
+            // Compute the FFT of the carrier wiped--off incoming signal
+            d_fft_if->execute();
+
+            // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
+            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+
+            // Compute the inverse FFT
+            d_ifft->execute();
+            return d_ifft->get_outbuf() + (d_acq_parameters.bit_transition_flag ? d_effective_fft_size : 0);
+        }
+
+    // Fold the carrier wiped-off signal into d_effective_fft_size samples. Its
+    // circular correlation with the folded code is the sum of the correlation
+    // values at the lags that are congruent modulo d_effective_fft_size.
+    volk_32fc_x2_multiply_32fc(d_wiped_signal.data(), in, wipeoff, d_fft_size);
+    gr_complex* folded = d_folded_fft_if->get_inbuf();
+    std::copy(d_wiped_signal.data(), d_wiped_signal.data() + d_effective_fft_size, folded);
+    for (uint32_t i = 1; i < d_folding_factor; i++)
+        {
+            volk_32f_x2_add_32f(reinterpret_cast<float*>(folded), reinterpret_cast<const float*>(folded),
+                reinterpret_cast<const float*>(d_wiped_signal.data() + i * d_effective_fft_size), 2 * d_effective_fft_size);
+        }
+    d_folded_fft_if->execute();
+    volk_32fc_x2_multiply_32fc(d_folded_ifft->get_inbuf(), d_folded_fft_if->get_outbuf(), d_fft_codes_folded.data(), d_effective_fft_size);
+    d_folded_ifft->execute();
+    return d_folded_ifft->get_outbuf();
+}
+
+
+void pcps_acquisition::correlate_fixed_point(uint32_t doppler_index)
+{
+    // Remove Doppler from the 16-bit input samples
+    const auto fs = static_cast<float>(d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in);
+    const float phase_step_rad = static_cast<float>(TWO_PI) * wipeoff_frequency(doppler_index, d_step_two) / fs;
+    lv_32fc_t phase_inc(std::cos(phase_step_rad), -std::sin(phase_step_rad));
+    lv_32fc_t phase(1.0, 0.0);
+    volk_gnsssdr_16ic_s32fc_x2_rotator_16ic(d_fixed_point_buffer.data(), d_fixed_point_input.data(), &phase_inc, &phase, d_fft_size);
+
+    // Perform the FFT-based convolution in block floating point, keeping
+    // track of the exponent of the block
+    int32_t exponent = d_fixed_point_input_exponent + d_fixed_point_fft->forward(d_fixed_point_buffer.data());
+    // The output of the last stage of the FFT uses the whole 16-bit range,
+    // and its product with the code spectrum would not fit
+    exponent += fixed_point_normalize(d_fixed_point_buffer.data(), d_fft_size);
+    fixed_point_multiply(d_fixed_point_buffer.data(), d_fixed_point_buffer.data(), d_fixed_point_codes.data(), d_fft_size);
+    exponent += d_fixed_point_codes_exponent + 15;
+    exponent += d_fixed_point_fft->inverse(d_fixed_point_buffer.data());
+
+    // The squared magnitudes are scaled back to the floating point grid
+    fixed_point_magnitude_squared(d_tmp_buffer.data(), d_fixed_point_buffer.data(), d_fft_size, exponent);
+}
+
+
+uint32_t pcps_acquisition::verify_folded_peak(const gr_complex* in, uint32_t indext)
+{
+    volk_32fc_x2_multiply_32fc(d_wiped_signal.data(), in, doppler_wipeoff(d_index_doppler), d_fft_size);
+
+    // Correlate with the full code at each of the lags folded into the peak
+    uint32_t best_lag = indext;
+    float best_power = 0.0;
+    for (uint32_t i = 0; i < d_folding_factor; i++)
+        {
+            const uint32_t lag = indext + i * d_effective_fft_size;
+            lv_32fc_t head;
+            lv_32fc_t tail(0.0, 0.0);
+            volk_32fc_x2_conjugate_dot_prod_32fc(&head, d_wiped_signal.data() + lag, d_local_code.data(), d_fft_size - lag);
+            if (lag > 0)
+                {
+                    volk_32fc_x2_conjugate_dot_prod_32fc(&tail, d_wiped_signal.data(), d_local_code.data() + (d_fft_size - lag), lag);
+                }
+            const float power = std::norm(head + tail);
+            if (power > best_power)
+                {
+                    best_power = power;
+                    best_lag = lag;
+                }
+        }
+
+    // The noise power of a folded cell is d_folding_factor times the noise
+    // power of an unfolded lag. The grid holds the output of the
+    // unnormalized IFFT, which scales the correlation by d_effective_fft_size,
+    // so its magnitudes are d_effective_fft_size^2 times the direct ones.
+    const double folded_mean = static_cast<double>(grid_row_sum(d_index_doppler)) / static_cast<double>(d_effective_fft_size) / static_cast<double>(d_num_noncoherent_integrations_counter);
+    const double grid_scale = static_cast<double>(d_effective_fft_size) * static_cast<double>(d_effective_fft_size);
+    d_verification_statistic = (folded_mean > 0.0 ? static_cast<float>(2.0 * static_cast<double>(best_power) * static_cast<double>(d_folding_factor) * grid_scale / folded_mean) : 0.0F);
+    if (d_verification_statistic < d_verification_threshold)
+        {
+            DLOG(INFO) << "Folded acquisition peak of satellite " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
+                       << " not verified, statistic " << d_verification_statistic << ", threshold " << d_verification_threshold;
+            d_test_statistics = 0.0;
+        }
+    return best_lag;
+}
+
+
 void pcps_acquisition::acquisition_core(uint64_t samp_count)
 {
     gr::thread::scoped_lock lk(d_setlock);
@@ -614,22 +983,35 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     // Initialize acquisition algorithm
     int32_t doppler = 0;
     uint32_t indext = 0U;
-    const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
-    if (d_cshort)
+    const auto effective_fft_size = static_cast<int32_t>(d_effective_fft_size);
+    if (d_fixed_point)
         {
-            volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+            // Scale the 16-bit samples once, so that the rotator and the first
+            // FFT stage use the full range without overflow
+            std::copy(d_data_buffer_sc.data(), d_data_buffer_sc.data() + d_consumed_samples, d_fixed_point_input.data());
+            d_fixed_point_input_exponent = fixed_point_normalize(d_fixed_point_input.data(), d_fft_size);
         }
-    std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
-    if (d_fft_size > d_consumed_samples)
+    // The floating point samples are only needed by the fixed-point path for
+    // the refinement of the peak
+    if (!d_fixed_point || !d_local_code.empty())
         {
-            for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+            if (d_cshort)
                 {
-                    d_input_signal[i] = gr_complex(0.0, 0.0);
+                    volk_gnsssdr_16ic_convert_32fc(d_data_buffer.data(), d_data_buffer_sc.data(), d_consumed_samples);
+                }
+            std::copy(d_data_buffer.data(), d_data_buffer.data() + d_consumed_samples, d_input_signal.data());
+            if (d_fft_size > d_consumed_samples)
+                {
+                    for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+                        {
+                            d_input_signal[i] = gr_complex(0.0, 0.0);
+                        }
                 }
         }
     const gr_complex* in = d_input_signal.data();  // Get the input samples pointer
 
     d_mag = 0.0;
+    d_gnss_synchro->Flag_refined_acquisition = false;
     d_num_noncoherent_integrations_counter++;
 
     DLOG(INFO) << "Channel: " << d_channel
@@ -649,34 +1031,16 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         {
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
-
-                    // Compute the inverse FFT
-                    d_ifft->execute();
-
-                    // Compute squared magnitude (and accumulate in case of non-coherent integration)
-                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
+                    // Remove Doppler and perform the FFT-based convolution (parallel time search)
+                    if (d_fixed_point)
                         {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                            correlate_fixed_point(doppler_index);
+                            store_magnitude_row(doppler_index, d_grid);
                         }
                     else
                         {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
-                        {
-                            std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_grid.colptr(doppler_index));
+                            const gr_complex* correlation = correlate(in, doppler_wipeoff(doppler_index));
+                            store_magnitude(doppler_index, correlation, d_grid);
                         }
                 }
 
@@ -689,6 +1053,10 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 {
                     d_test_statistics = first_vs_second_peak_statistic(indext, doppler, d_num_doppler_bins, d_acq_parameters.doppler_max, d_doppler_step);
                 }
+            if (d_folding_factor > 1 && d_test_statistics > d_threshold)
+                {
+                    indext = verify_folded_peak(in, indext);
+                }
             if (d_acq_parameters.use_automatic_resampler)
                 {
                     // take into account the acquisition resampler ratio
@@ -710,33 +1078,16 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         {
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
                 {
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs_step_two[doppler_index].data(), d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal
-                    // with the local FFT'd code reference using SIMD operations with VOLK library
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
-
-                    // compute the inverse FFT
-                    d_ifft->execute();
-
-                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
+                    // Remove Doppler and perform the FFT-based convolution (parallel time search)
+                    if (d_fixed_point)
                         {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
+                            correlate_fixed_point(doppler_index);
+                            store_magnitude_row(doppler_index, d_narrow_grid);
                         }
                     else
                         {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
-                        {
-                            std::copy(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data() + effective_fft_size, d_narrow_grid.colptr(doppler_index));
+                            const gr_complex* correlation = correlate(in, doppler_wipeoff(doppler_index));
+                            store_magnitude(doppler_index, correlation, d_narrow_grid);
                         }
                 }
             // Compute the test statistic
@@ -748,6 +1099,10 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 {
                     d_test_statistics = first_vs_second_peak_statistic(indext, doppler, d_num_doppler_bins_step2, static_cast<int32_t>(d_doppler_center_step_two - (static_cast<float>(d_num_doppler_bins_step2) / 2.0) * d_acq_parameters.doppler_step2), d_acq_parameters.doppler_step2);
                 }
+            if (d_folding_factor > 1 && d_test_statistics > d_threshold)
+                {
+                    indext = verify_folded_peak(in, indext);
+                }
 
             if (d_acq_parameters.use_automatic_resampler)
                 {
@@ -769,6 +1124,12 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 }
         }
 
+    // Interpolate the peak that is going to be reported to the tracking loops
+    if (d_acq_parameters.enable_peak_refinement && d_test_statistics > d_threshold && (!d_acq_parameters.make_2_steps || d_step_two))
+        {
+            refine_peak(in, indext);
+        }
+
     if (d_acq_parameters.blocking)
         {
             lk.lock();
@@ -896,12 +1257,20 @@ void pcps_acquisition::calculate_threshold()
 {
     const float pfa = (d_step_two ? d_acq_parameters.pfa2 : d_acq_parameters.pfa);
 
+    // The verification of a folded peak tests d_folding_factor coherent lags.
+    // It is also done when the detection threshold is set directly.
+    if (d_folding_factor > 1)
+        {
+            const double verification_pfa = (pfa > 0.0 ? pfa : FOLDED_PEAK_VERIFICATION_PFA);
+            d_verification_threshold = static_cast<float>(2.0 * boost::math::gamma_p_inv(2.0, std::pow(1.0 - verification_pfa, 1.0 / static_cast<double>(d_folding_factor))));
+        }
+
     if (pfa <= 0.0)
         {
             return;
         }
 
-    const auto effective_fft_size = static_cast<int>(d_acq_parameters.bit_transition_flag ? (d_fft_size / 2) : d_fft_size);
+    const auto effective_fft_size = static_cast<int>(d_effective_fft_size);
     const int num_doppler_bins = (d_step_two ? d_num_doppler_bins_step2 : d_num_doppler_bins);
 
     const int num_bins = effective_fft_size * num_doppler_bins;
@@ -922,6 +1291,28 @@ void pcps_acquisition::set_doppler_center(int32_t doppler_center)
 }
 
 
+void pcps_acquisition::set_doppler_window(int32_t doppler_center, uint32_t doppler_max)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    if (doppler_center == d_doppler_center && doppler_max == d_acq_parameters.doppler_max)
+        {
+            return;
+        }
+    DLOG(INFO) << " Doppler window for Channel: " << d_channel << " => Doppler: " << doppler_center << " +/- " << doppler_max << "[Hz]";
+    d_doppler_center = doppler_center;
+    d_acq_parameters.doppler_max = doppler_max;
+    if (d_max_num_doppler_bins > 0)
+        {
+            // the grid buffers are allocated in init() for the configured Doppler range
+            const auto num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(2 * d_acq_parameters.doppler_max) / static_cast<double>(d_doppler_step)));
+            d_num_doppler_bins = std::max(std::min(num_doppler_bins, d_max_num_doppler_bins), 1U);
+            update_grid_doppler_wipeoffs();
+            // fewer Doppler bins, fewer cells: the threshold for the same Pfa changes
+            calculate_threshold();
+        }
+}
+
+
 int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
     gr_vector_int& ninput_items,
     gr_vector_const_void_star& input_items,
@@ -964,6 +1355,7 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 d_gnss_synchro->Acq_doppler_hz = 0.0;
                 d_gnss_synchro->Acq_samplestamp_samples = 0ULL;
                 d_gnss_synchro->Acq_doppler_step = 0U;
+                d_gnss_synchro->Flag_refined_acquisition = false;
                 d_mag = 0.0;
                 d_state = 1;
                 d_buffer_count = 0U;
@@ -43,6 +43,8 @@
 #endif
 
 #include "acq_conf.h"
+#include "acq_fixed_point_fft.h"
+#include "acq_quantized_grid.h"
 #include "channel_fsm.h"
 #include "gnss_sdr_fft.h"
 #include <armadillo>
@@ -172,6 +174,43 @@ public:
         d_threshold = threshold;
     }
 
+    /*!
+     * \brief Returns the statistics threshold of PCPS algorithm, either set or
+     * computed from the probability of false alarm.
+     */
+    inline float get_threshold() const
+    {
+        return d_threshold;
+    }
+
+    /*!
+     * \brief Returns true if the correlation is done in fixed point, which
+     * is the case if it is configured and the input samples and FFT size
+     * allow it.
+     */
+    inline bool is_fixed_point() const
+    {
+        return d_fixed_point;
+    }
+
+    /*!
+     * \brief Returns the statistic of the last verification of a folded
+     * peak with the full local code, in the scale of its threshold.
+     */
+    inline float get_verification_statistic() const
+    {
+        return d_verification_statistic;
+    }
+
+    /*!
+     * \brief Returns the threshold of the verification of a folded peak,
+     * computed from the probability of false alarm.
+     */
+    inline float get_verification_threshold() const
+    {
+        return d_verification_threshold;
+    }
+
     /*!
      * \brief Set maximum Doppler grid search
      * \param doppler_max - Maximum Doppler shift considered in the grid search [Hz].
@@ -198,6 +237,15 @@ public:
      */
     void set_doppler_center(int32_t doppler_center);
 
+    /*!
+     * \brief Set the Doppler center and the maximum Doppler shift of the grid
+     * search, and refresh the Doppler grid. The grid can be narrowed with
+     * respect to the one set at init(), but not widened.
+     * \param doppler_center - Frequency center of the search grid [Hz].
+     * \param doppler_max - Maximum Doppler shift with respect to the center [Hz].
+     */
+    void set_doppler_window(int32_t doppler_center, uint32_t doppler_max);
+
     /*!
      * \brief Parallel Code Phase Search Acquisition signal processing.
      */
@@ -212,10 +260,22 @@ private:
     void update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const;
     void update_grid_doppler_wipeoffs();
     void update_grid_doppler_wipeoffs_step2();
+    float wipeoff_frequency(uint32_t doppler_index, bool step_two) const;
+    const gr_complex* doppler_wipeoff(uint32_t doppler_index);
+    void store_magnitude(uint32_t doppler_index, const gr_complex* correlation, arma::fmat& dump_grid);
+    void store_magnitude_row(uint32_t doppler_index, arma::fmat& dump_grid);
+    float grid_row_max(uint32_t doppler_index, uint32_t& index_time) const;
+    float grid_row_sum(uint32_t doppler_index) const;
+    float grid_value(uint32_t doppler_index, uint32_t index_time) const;
+    void get_grid_row(uint32_t doppler_index, float* out) const;
     void acquisition_core(uint64_t samp_count);
     void send_negative_acquisition();
     void send_positive_acquisition();
     void dump_results(int32_t effective_fft_size);
+    void refine_peak(const gr_complex* in, uint32_t indext);
+    const gr_complex* correlate(const gr_complex* in, const gr_complex* wipeoff);
+    void correlate_fixed_point(uint32_t doppler_index);
+    uint32_t verify_folded_peak(const gr_complex* in, uint32_t indext);
     bool is_fdma();
     bool start() override;
     void calculate_threshold(void);
@@ -228,14 +288,25 @@ private:
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
     volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
+    volk_gnsssdr::vector<std::complex<float>> d_fft_codes_folded;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
     volk_gnsssdr::vector<lv_16sc_t> d_data_buffer_sc;
+    volk_gnsssdr::vector<std::complex<float>> d_local_code;
+    volk_gnsssdr::vector<std::complex<float>> d_wiped_signal;
+    volk_gnsssdr::vector<std::complex<float>> d_wipeoff;
+    volk_gnsssdr::vector<lv_16sc_t> d_fixed_point_input;
+    volk_gnsssdr::vector<lv_16sc_t> d_fixed_point_buffer;
+    volk_gnsssdr::vector<lv_16sc_t> d_fixed_point_codes;
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_if;
     std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    std::unique_ptr<gnss_fft_complex_fwd> d_folded_fft_if;
+    std::unique_ptr<gnss_fft_complex_rev> d_folded_ifft;
+    std::unique_ptr<AcqFixedPointFft> d_fixed_point_fft;
     std::weak_ptr<ChannelFsm> d_channel_fsm;
 
     Acq_Conf d_acq_parameters;
+    AcqQuantizedGrid d_quantized_grid;
     Gnss_Synchro* d_gnss_synchro;
     arma::fmat d_grid;
     arma::fmat d_narrow_grid;
@@ -247,6 +318,8 @@ private:
     uint64_t d_sample_counter;
 
     float d_threshold;
+    float d_verification_threshold;
+    float d_verification_statistic;
     float d_mag;
     float d_input_power;
     float d_test_statistics;
@@ -256,20 +329,27 @@ private:
     int32_t d_positive_acq;
     int32_t d_doppler_center;
     int32_t d_doppler_bias;
+    int32_t d_fixed_point_input_exponent;
+    int32_t d_fixed_point_codes_exponent;
     uint32_t d_channel;
     uint32_t d_samplesPerChip;
     uint32_t d_doppler_step;
     uint32_t d_num_noncoherent_integrations_counter;
     uint32_t d_fft_size;
+    uint32_t d_effective_fft_size;
     uint32_t d_consumed_samples;
     uint32_t d_num_doppler_bins;
     uint32_t d_num_doppler_bins_step2;
     uint32_t d_dump_channel;
     uint32_t d_buffer_count;
+    uint32_t d_index_doppler;
+    uint32_t d_max_num_doppler_bins;
+    uint32_t d_folding_factor;
 
     bool d_active;
     bool d_worker_active;
     bool d_cshort;
+    bool d_fixed_point;
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
     bool d_dump;
@@ -81,6 +81,10 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
         }
     make_2_steps = configuration->property(role + ".make_two_steps", make_2_steps);
     blocking_on_standby = configuration->property(role + ".blocking_on_standby", blocking_on_standby);
+    enable_peak_refinement = configuration->property(role + ".enable_peak_refinement", enable_peak_refinement);
+    folding_factor = configuration->property(role + ".folding_factor", folding_factor);
+    low_memory = configuration->property(role + ".low_memory", low_memory);
+    fixed_point = configuration->property(role + ".fixed_point", fixed_point);
 
     if (pfa <= 0.0)
         {
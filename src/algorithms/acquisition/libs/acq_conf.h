@@ -62,6 +62,7 @@ public:
     uint32_t num_doppler_bins_step2{4U};
     uint32_t resampler_latency_samples{0U};
     uint32_t dump_channel{0U};
+    uint32_t folding_factor{1U};
     int32_t doppler_max{5000};
     int32_t doppler_min{-5000};
 
@@ -73,6 +74,9 @@ public:
     bool make_2_steps{false};
     bool use_automatic_resampler{false};
     bool enable_monitor_output{false};
+    bool enable_peak_refinement{false};
+    bool low_memory{false};
+    bool fixed_point{false};
 
 private:
     void SetDerivedParams();
@@ -0,0 +1,239 @@
+/*!
+ * \file acq_fixed_point_fft.cc
+ * \brief Block floating point FFT and spectral operations on 16-bit complex
+ * samples for the acquisition of low-bit signals.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_fixed_point_fft.h"
+#include "MATH_CONSTANTS.h"  // for TWO_PI
+#include <algorithm>         // for std::max, std::swap
+#include <cmath>             // for std::abs, std::cos, std::sin, std::ldexp
+#include <limits>            // for std::numeric_limits
+
+namespace
+{
+// Largest component for which the output of a radix-2 butterfly with a
+// unit twiddle factor, |a| + sqrt(2) |b|, still fits in 16 bits
+constexpr int32_t BLOCK_LIMIT = 13572;
+
+int32_t max_component(const std::complex<int16_t>* data, uint32_t length)
+{
+    int32_t maximum = 0;
+    for (uint32_t i = 0; i < length; i++)
+        {
+            maximum = std::max(maximum, std::max(std::abs(static_cast<int32_t>(data[i].real())), std::abs(static_cast<int32_t>(data[i].imag()))));
+        }
+    return maximum;
+}
+
+
+void shift_right(std::complex<int16_t>* data, uint32_t length, int32_t shift)
+{
+    const int32_t rounding = 1 << (shift - 1);
+    for (uint32_t i = 0; i < length; i++)
+        {
+            data[i] = std::complex<int16_t>(static_cast<int16_t>((data[i].real() + rounding) >> shift),
+                static_cast<int16_t>((data[i].imag() + rounding) >> shift));
+        }
+}
+
+
+int16_t saturate(int32_t value)
+{
+    return static_cast<int16_t>(std::min(std::max(value, static_cast<int32_t>(std::numeric_limits<int16_t>::min())), static_cast<int32_t>(std::numeric_limits<int16_t>::max())));
+}
+
+
+// Number of right shifts that bring maximum below BLOCK_LIMIT. It is
+// negative if the block can be shifted left.
+int32_t required_shift(int32_t maximum)
+{
+    int32_t shift = 0;
+    if (maximum == 0)
+        {
+            return shift;
+        }
+    while (maximum > BLOCK_LIMIT)
+        {
+            maximum >>= 1;
+            shift++;
+        }
+    while ((maximum << 1) <= BLOCK_LIMIT)
+        {
+            maximum <<= 1;
+            shift--;
+        }
+    return shift;
+}
+}  // namespace
+
+
+AcqFixedPointFft::AcqFixedPointFft(uint32_t size)
+    : twiddles_(size / 2),
+      bit_reverse_(size),
+      size_(size)
+{
+    for (uint32_t k = 0; k < size / 2; k++)
+        {
+            const double phase = -TWO_PI * static_cast<double>(k) / static_cast<double>(size);
+            twiddles_[k] = std::complex<int16_t>(static_cast<int16_t>(std::lround(std::min(std::cos(phase) * 32768.0, 32767.0))),
+                static_cast<int16_t>(std::lround(std::min(std::sin(phase) * 32768.0, 32767.0))));
+        }
+    uint32_t bits = 0;
+    while ((1U << bits) < size)
+        {
+            bits++;
+        }
+    for (uint32_t i = 0; i < size; i++)
+        {
+            uint32_t reversed = 0;
+            for (uint32_t b = 0; b < bits; b++)
+                {
+                    reversed |= ((i >> b) & 1U) << (bits - 1 - b);
+                }
+            bit_reverse_[i] = reversed;
+        }
+}
+
+
+bool AcqFixedPointFft::is_supported_size(uint32_t size)
+{
+    return size >= 2 && (size & (size - 1)) == 0;
+}
+
+
+int32_t AcqFixedPointFft::forward(std::complex<int16_t>* data) const
+{
+    return transform(data, false);
+}
+
+
+int32_t AcqFixedPointFft::inverse(std::complex<int16_t>* data) const
+{
+    return transform(data, true);
+}
+
+
+int32_t AcqFixedPointFft::transform(std::complex<int16_t>* data, bool inverse) const
+{
+    for (uint32_t i = 0; i < size_; i++)
+        {
+            if (i < bit_reverse_[i])
+                {
+                    std::swap(data[i], data[bit_reverse_[i]]);
+                }
+        }
+
+    int32_t exponent = fixed_point_normalize(data, size_);
+    for (uint32_t length = 2; length <= size_; length <<= 1)
+        {
+            const uint32_t half = length / 2;
+            const uint32_t step = size_ / length;
+            int32_t maximum = 0;
+            for (uint32_t start = 0; start < size_; start += length)
+                {
+                    for (uint32_t k = 0; k < half; k++)
+                        {
+                            const std::complex<int16_t> w = twiddles_[k * step];
+                            const int32_t w_real = w.real();
+                            const int32_t w_imag = (inverse ? -w.imag() : w.imag());
+                            const std::complex<int16_t> a = data[start + k];
+                            const std::complex<int16_t> b = data[start + k + half];
+                            const int32_t t_real = (b.real() * w_real - b.imag() * w_imag + (1 << 14)) >> 15;
+                            const int32_t t_imag = (b.real() * w_imag + b.imag() * w_real + (1 << 14)) >> 15;
+                            const int32_t u_real = a.real() + t_real;
+                            const int32_t u_imag = a.imag() + t_imag;
+                            const int32_t v_real = a.real() - t_real;
+                            const int32_t v_imag = a.imag() - t_imag;
+                            data[start + k] = std::complex<int16_t>(static_cast<int16_t>(u_real), static_cast<int16_t>(u_imag));
+                            data[start + k + half] = std::complex<int16_t>(static_cast<int16_t>(v_real), static_cast<int16_t>(v_imag));
+                            maximum = std::max(maximum, std::max(std::max(std::abs(u_real), std::abs(u_imag)), std::max(std::abs(v_real), std::abs(v_imag))));
+                        }
+                }
+            if (length < size_ && maximum > BLOCK_LIMIT)
+                {
+                    const int32_t shift = required_shift(maximum);
+                    shift_right(data, size_, shift);
+                    exponent += shift;
+                }
+        }
+    return exponent;
+}
+
+
+int32_t fixed_point_normalize(std::complex<int16_t>* data, uint32_t length)
+{
+    const int32_t shift = required_shift(max_component(data, length));
+    if (shift > 0)
+        {
+            shift_right(data, length, shift);
+        }
+    else if (shift < 0)
+        {
+            for (uint32_t i = 0; i < length; i++)
+                {
+                    data[i] = std::complex<int16_t>(static_cast<int16_t>(data[i].real() * (1 << -shift)),
+                        static_cast<int16_t>(data[i].imag() * (1 << -shift)));
+                }
+        }
+    return shift;
+}
+
+
+int32_t fixed_point_quantize(std::complex<int16_t>* out, const std::complex<float>* in, uint32_t length)
+{
+    float maximum = 0.0;
+    for (uint32_t i = 0; i < length; i++)
+        {
+            maximum = std::max(maximum, std::max(std::abs(in[i].real()), std::abs(in[i].imag())));
+        }
+    int32_t exponent = 0;
+    if (maximum > 0.0F)
+        {
+            // the largest component is between 2^14 and 2^15
+            exponent = static_cast<int32_t>(std::floor(std::log2(maximum))) - 14;
+        }
+    const float scale = std::ldexp(1.0F, -exponent);
+    for (uint32_t i = 0; i < length; i++)
+        {
+            out[i] = std::complex<int16_t>(static_cast<int16_t>(std::lround(std::min(in[i].real() * scale, 32767.0F))),
+                static_cast<int16_t>(std::lround(std::min(in[i].imag() * scale, 32767.0F))));
+        }
+    return exponent;
+}
+
+
+void fixed_point_multiply(std::complex<int16_t>* out, const std::complex<int16_t>* a, const std::complex<int16_t>* b, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++)
+        {
+            const int32_t a_real = a[i].real();
+            const int32_t a_imag = a[i].imag();
+            const int32_t b_real = b[i].real();
+            const int32_t b_imag = b[i].imag();
+            out[i] = std::complex<int16_t>(saturate((a_real * b_real - a_imag * b_imag + (1 << 14)) >> 15),
+                saturate((a_real * b_imag + a_imag * b_real + (1 << 14)) >> 15));
+        }
+}
+
+
+void fixed_point_magnitude_squared(float* out, const std::complex<int16_t>* in, uint32_t length, int32_t exponent)
+{
+    const float scale = std::ldexp(1.0F, 2 * exponent);
+    for (uint32_t i = 0; i < length; i++)
+        {
+            const int32_t real = in[i].real();
+            const int32_t imag = in[i].imag();
+            out[i] = static_cast<float>(real * real + imag * imag) * scale;
+        }
+}
@@ -0,0 +1,107 @@
+/*!
+ * \file acq_fixed_point_fft.h
+ * \brief Block floating point FFT and spectral operations on 16-bit complex
+ * samples for the acquisition of low-bit signals.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_FIXED_POINT_FFT_H
+#define GNSS_SDR_ACQ_FIXED_POINT_FFT_H
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Radix-2 FFT of 16-bit complex samples in block floating point.
+ *
+ * All the samples of a block share one exponent: a stored value x represents
+ * x * 2^exponent. The block is normalized to use the full 16-bit range before
+ * the first stage, and shifted right after any stage whose output could
+ * overflow the next one. The twiddle factors are in Q15. Like FFTW, the
+ * transforms are not normalized.
+ */
+class AcqFixedPointFft
+{
+public:
+    /*!
+     * \brief Creates the FFT of the given size, which must be a power of two
+     */
+    explicit AcqFixedPointFft(uint32_t size);
+
+    /*!
+     * \brief In-place forward transform. Returns the exponent of the output
+     * relative to the input.
+     */
+    int32_t forward(std::complex<int16_t>* data) const;
+
+    /*!
+     * \brief In-place inverse transform. Returns the exponent of the output
+     * relative to the input.
+     */
+    int32_t inverse(std::complex<int16_t>* data) const;
+
+    inline uint32_t size() const
+    {
+        return size_;
+    }
+
+    static bool is_supported_size(uint32_t size);
+
+private:
+    int32_t transform(std::complex<int16_t>* data, bool inverse) const;
+
+    std::vector<std::complex<int16_t>> twiddles_;  // exp(-j 2 pi k / size), Q15
+    std::vector<uint32_t> bit_reverse_;
+    uint32_t size_;
+};
+
+
+/*!
+ * \brief Shifts the block so that its largest component uses the 16-bit
+ * range with headroom for one radix-2 butterfly. Returns the exponent of the
+ * block after the shift relative to before.
+ */
+int32_t fixed_point_normalize(std::complex<int16_t>* data, uint32_t length);
+
+/*!
+ * \brief Quantizes a floating point spectrum to 16 bits. Returns the
+ * exponent of the quantized block.
+ */
+int32_t fixed_point_quantize(std::complex<int16_t>* out, const std::complex<float>* in, uint32_t length);
+
+/*!
+ * \brief Element-wise product of two blocks, shifted right by 15 bits. The
+ * exponent of the output is the sum of the exponents of the inputs plus 15.
+ * out may be a.
+ *
+ * The products fit in 16 bits if a is normalized with fixed_point_normalize
+ * and b is quantized with fixed_point_quantize. Otherwise, they may saturate.
+ */
+void fixed_point_multiply(std::complex<int16_t>* out, const std::complex<int16_t>* a, const std::complex<int16_t>* b, uint32_t length);
+
+/*!
+ * \brief Squared magnitude of a block with the given exponent, in floating
+ * point
+ */
+void fixed_point_magnitude_squared(float* out, const std::complex<int16_t>* in, uint32_t length, int32_t exponent);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_FIXED_POINT_FFT_H
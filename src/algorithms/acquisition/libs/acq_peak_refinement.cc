@@ -0,0 +1,99 @@
+/*!
+ * \file acq_peak_refinement.cc
+ * \brief Interpolation of the acquisition peak below the resolution of the
+ * search grid.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_peak_refinement.h"
+#include "MATH_CONSTANTS.h"  // for TWO_PI
+#include <algorithm>         // for std::min, std::max
+#include <array>             // for std::array
+#include <cmath>             // for std::abs, std::cos, std::sin
+
+namespace
+{
+// Number of blocks integrated coherently for the frequency estimation
+constexpr uint32_t NUM_BLOCKS = 16;
+// Number of frequencies evaluated in the search interval
+constexpr uint32_t NUM_FREQUENCIES = 33;
+}  // namespace
+
+
+float parabolic_peak_offset(float y_minus, float y_0, float y_plus)
+{
+    const float denominator = y_minus - 2.0F * y_0 + y_plus;
+    if (denominator >= 0.0F || y_0 < y_minus || y_0 < y_plus)
+        {
+            return 0.0F;
+        }
+    const float offset = 0.5F * (y_minus - y_plus) / denominator;
+    return std::max(std::min(offset, 0.5F), -0.5F);
+}
+
+
+bool estimate_residual_frequency(const std::complex<float>* signal,
+    uint32_t length,
+    double fs,
+    double max_freq_hz,
+    double& freq_hz)
+{
+    const uint32_t block_length = length / NUM_BLOCKS;
+    if (block_length == 0 || fs <= 0.0 || max_freq_hz <= 0.0)
+        {
+            return false;
+        }
+
+    std::array<std::complex<float>, NUM_BLOCKS> block_sums{};
+    for (uint32_t m = 0; m < NUM_BLOCKS; m++)
+        {
+            const std::complex<float>* block = signal + m * block_length;
+            std::complex<float> sum(0.0, 0.0);
+            for (uint32_t n = 0; n < block_length; n++)
+                {
+                    sum += block[n];
+                }
+            block_sums[m] = sum;
+        }
+
+    // Spectrum of the block sums, evaluated at NUM_FREQUENCIES points
+    const double block_period_s = static_cast<double>(block_length) / fs;
+    const double freq_step_hz = 2.0 * max_freq_hz / static_cast<double>(NUM_FREQUENCIES - 1);
+    std::array<float, NUM_FREQUENCIES> spectrum{};
+    uint32_t index_max = 0;
+    for (uint32_t k = 0; k < NUM_FREQUENCIES; k++)
+        {
+            const double freq = -max_freq_hz + static_cast<double>(k) * freq_step_hz;
+            const double phase_step = -TWO_PI * freq * block_period_s;
+            const std::complex<float> rotation(static_cast<float>(std::cos(phase_step)), static_cast<float>(std::sin(phase_step)));
+            std::complex<float> phasor(1.0, 0.0);
+            std::complex<float> sum(0.0, 0.0);
+            for (uint32_t m = 0; m < NUM_BLOCKS; m++)
+                {
+                    sum += block_sums[m] * phasor;
+                    phasor *= rotation;
+                }
+            spectrum[k] = std::abs(sum);
+            if (spectrum[k] > spectrum[index_max])
+                {
+                    index_max = k;
+                }
+        }
+    if (index_max == 0 || index_max == NUM_FREQUENCIES - 1)
+        {
+            return false;
+        }
+
+    const float offset = parabolic_peak_offset(spectrum[index_max - 1], spectrum[index_max], spectrum[index_max + 1]);
+    freq_hz = -max_freq_hz + (static_cast<double>(index_max) + offset) * freq_step_hz;
+    return true;
+}
@@ -0,0 +1,61 @@
+/*!
+ * \file acq_peak_refinement.h
+ * \brief Interpolation of the acquisition peak below the resolution of the
+ * search grid.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_PEAK_REFINEMENT_H
+#define GNSS_SDR_ACQ_PEAK_REFINEMENT_H
+
+#include <complex>
+#include <cstdint>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Returns the abscissa, in [-0.5, 0.5], of the vertex of the parabola
+ * through (-1, y_minus), (0, y_0) and (1, y_plus), where y_0 is a local
+ * maximum. Returns 0 if the points do not define a maximum.
+ */
+float parabolic_peak_offset(float y_minus, float y_0, float y_plus);
+
+/*!
+ * \brief Estimates the frequency of the residual carrier of a signal whose
+ * carrier and code have been wiped off.
+ *
+ * The signal is split into short blocks that are integrated coherently, and
+ * the spectrum of the block sums is evaluated over [-max_freq_hz, max_freq_hz]
+ * and interpolated around its maximum.
+ *
+ * \param signal - Carrier and code wiped-off samples
+ * \param length - Number of samples
+ * \param fs - Sampling rate [Hz]
+ * \param max_freq_hz - Half-width of the frequency search [Hz]
+ * \param freq_hz - Estimated frequency [Hz]
+ * \return false if the maximum is at the edge of the search, so the
+ * frequency is not reliable
+ */
+bool estimate_residual_frequency(const std::complex<float>* signal,
+    uint32_t length,
+    double fs,
+    double max_freq_hz,
+    double& freq_hz);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_PEAK_REFINEMENT_H
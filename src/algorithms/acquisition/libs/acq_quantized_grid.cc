@@ -0,0 +1,89 @@
+/*!
+ * \file acq_quantized_grid.cc
+ * \brief Search grid of the acquisition magnitudes stored with 16 bits per
+ * cell.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_quantized_grid.h"
+#include <algorithm>  // for std::fill
+#include <limits>     // for std::numeric_limits
+
+namespace
+{
+constexpr float MAX_CELL_VALUE = static_cast<float>(std::numeric_limits<uint16_t>::max());
+}  // namespace
+
+
+AcqQuantizedGrid::AcqQuantizedGrid(uint32_t rows, uint32_t cols)
+    : cells_(static_cast<size_t>(rows) * cols, 0U),
+      scale_(rows, 0.0F),
+      max_(rows, 0.0F),
+      sum_(rows, 0.0F),
+      argmax_(rows, 0U),
+      row_buffer_(cols, 0.0F),
+      rows_(rows),
+      cols_(cols)
+{
+}
+
+
+void AcqQuantizedGrid::store_row(uint32_t row, const float* values, bool accumulate)
+{
+    uint16_t* cells = &cells_[static_cast<size_t>(row) * cols_];
+    // The sum is accumulated from the input values, not from the quantized cells
+    float sum = (accumulate ? sum_[row] : 0.0F);
+    const float scale = (accumulate ? scale_[row] : 0.0F);
+    float maximum = 0.0;
+    uint32_t index = 0U;
+    for (uint32_t i = 0; i < cols_; i++)
+        {
+            sum += values[i];
+            row_buffer_[i] = static_cast<float>(cells[i]) * scale + values[i];
+            if (row_buffer_[i] > maximum)
+                {
+                    maximum = row_buffer_[i];
+                    index = i;
+                }
+        }
+
+    max_[row] = maximum;
+    argmax_[row] = index;
+    sum_[row] = sum;
+    scale_[row] = maximum / MAX_CELL_VALUE;
+    const float inv_scale = (maximum > 0.0F ? MAX_CELL_VALUE / maximum : 0.0F);
+    for (uint32_t i = 0; i < cols_; i++)
+        {
+            cells[i] = static_cast<uint16_t>(row_buffer_[i] * inv_scale + 0.5F);
+        }
+}
+
+
+void AcqQuantizedGrid::get_row(uint32_t row, float* out) const
+{
+    const uint16_t* cells = &cells_[static_cast<size_t>(row) * cols_];
+    const float scale = scale_[row];
+    for (uint32_t i = 0; i < cols_; i++)
+        {
+            out[i] = static_cast<float>(cells[i]) * scale;
+        }
+}
+
+
+void AcqQuantizedGrid::reset()
+{
+    std::fill(cells_.begin(), cells_.end(), 0U);
+    std::fill(scale_.begin(), scale_.end(), 0.0F);
+    std::fill(max_.begin(), max_.end(), 0.0F);
+    std::fill(sum_.begin(), sum_.end(), 0.0F);
+    std::fill(argmax_.begin(), argmax_.end(), 0U);
+}
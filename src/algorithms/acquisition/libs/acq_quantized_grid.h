@@ -0,0 +1,102 @@
+/*!
+ * \file acq_quantized_grid.h
+ * \brief Search grid of the acquisition magnitudes stored with 16 bits per
+ * cell.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_QUANTIZED_GRID_H
+#define GNSS_SDR_ACQ_QUANTIZED_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Grid of non-negative magnitudes, one row per Doppler bin, that
+ * stores each cell as a 16-bit fraction of the maximum of its row.
+ *
+ * The maximum of each row and its index are found before quantizing, and the
+ * sum of each row is accumulated from the input values, so the detection
+ * statistics built on them do not see the quantization of the last dwell.
+ * Each stored cell is within half a quantization step (2^-16 of the row
+ * maximum) per accumulated dwell.
+ */
+class AcqQuantizedGrid
+{
+public:
+    AcqQuantizedGrid() = default;
+    AcqQuantizedGrid(uint32_t rows, uint32_t cols);
+
+    /*!
+     * \brief Stores a row, or adds it to the stored one if accumulate is true
+     */
+    void store_row(uint32_t row, const float* values, bool accumulate);
+
+    /*!
+     * \brief Writes the cols values of a row to out
+     */
+    void get_row(uint32_t row, float* out) const;
+
+    void reset();
+
+    inline float value(uint32_t row, uint32_t col) const
+    {
+        return static_cast<float>(cells_[static_cast<size_t>(row) * cols_ + col]) * scale_[row];
+    }
+
+    inline float row_max(uint32_t row) const
+    {
+        return max_[row];
+    }
+
+    inline uint32_t row_argmax(uint32_t row) const
+    {
+        return argmax_[row];
+    }
+
+    inline float row_sum(uint32_t row) const
+    {
+        return sum_[row];
+    }
+
+    inline uint32_t rows() const
+    {
+        return rows_;
+    }
+
+    inline uint32_t cols() const
+    {
+        return cols_;
+    }
+
+private:
+    std::vector<uint16_t> cells_;
+    std::vector<float> scale_;
+    std::vector<float> max_;
+    std::vector<float> sum_;
+    std::vector<uint32_t> argmax_;
+    std::vector<float> row_buffer_;
+    uint32_t rows_{};
+    uint32_t cols_{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_QUANTIZED_GRID_H
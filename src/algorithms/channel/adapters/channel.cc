@@ -47,7 +47,8 @@ Channel::Channel(const ConfigurationInterface* configuration,
       glonass_extend_correlation_ms_(configuration->property("Tracking_1G.extend_correlation_ms", 0) + configuration->property("Tracking_2G.extend_correlation_ms", 0)),
       connected_(false),
       repeat_(configuration->property("Acquisition_" + signal_str + ".repeat_satellite", false)),
-      flag_enable_fpga_(configuration->property("GNSS-SDR.enable_FPGA", false))
+      flag_enable_fpga_(configuration->property("GNSS-SDR.enable_FPGA", false)),
+      doppler_window_ignored_logged_(false)
 {
     channel_fsm_ = std::make_shared<ChannelFsm>();
 
@@ -264,7 +265,18 @@ void Channel::stop_channel()
 
 void Channel::assist_acquisition_doppler(double Carrier_Doppler_hz)
 {
-    acq_->set_doppler_center(static_cast<int>(Carrier_Doppler_hz));
+    acq_->set_doppler_window(static_cast<int>(Carrier_Doppler_hz), 0);
+}
+
+
+void Channel::assist_acquisition_doppler(double Carrier_Doppler_hz, uint32_t doppler_max_hz)
+{
+    if (!acq_->set_doppler_window(static_cast<int>(Carrier_Doppler_hz), doppler_max_hz) && !doppler_window_ignored_logged_)
+        {
+            doppler_window_ignored_logged_ = true;
+            LOG(INFO) << "Channel " << channel_ << ": " << acq_->implementation()
+                      << " does not narrow its Doppler search to the predicted window, and keeps its configured grid";
+        }
 }
 
 
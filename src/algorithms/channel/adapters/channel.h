@@ -89,7 +89,8 @@ public:
     void stop_channel() override;                               //!< Stop the State Machine
     void set_signal(const Gnss_Signal& gnss_signal_) override;  //!< Sets the channel GNSS signal
 
-    void assist_acquisition_doppler(double Carrier_Doppler_hz) override;
+    void assist_acquisition_doppler(double Carrier_Doppler_hz) override;                           //!< Centers the full Doppler grid at Carrier_Doppler_hz
+    void assist_acquisition_doppler(double Carrier_Doppler_hz, uint32_t doppler_max_hz) override;  //!< Searches Carrier_Doppler_hz +/- doppler_max_hz, if the acquisition supports it
 
     inline std::shared_ptr<AcquisitionInterface> acquisition() const { return acq_; }
     inline std::shared_ptr<TrackingInterface> tracking() const { return trk_; }
@@ -111,6 +112,7 @@ private:
     bool connected_;
     bool repeat_;
     bool flag_enable_fpga_;
+    bool doppler_window_ignored_logged_;
 };
 
 
@@ -0,0 +1,107 @@
+/*!
+ * \file channelizer_signal_conditioner.cc
+ * \brief It holds blocks to change data type and to split the input data in
+ * several bands, one per output.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "channelizer_signal_conditioner.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+ChannelizerSignalConditioner::ChannelizerSignalConditioner(std::shared_ptr<GNSSBlockInterface> data_type_adapt,
+    std::shared_ptr<GNSSBlockInterface> in_filt,
+    std::string role) : data_type_adapt_(std::move(data_type_adapt)),
+                        in_filt_(std::move(in_filt)),
+                        role_(std::move(role)),
+                        connected_(false)
+{
+}
+
+
+int ChannelizerSignalConditioner::outputs() const
+{
+    if (in_filt_ == nullptr)
+        {
+            return 1;
+        }
+    return in_filt_->get_right_block()->output_signature()->max_streams();
+}
+
+
+void ChannelizerSignalConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (connected_)
+        {
+            LOG(WARNING) << "Signal conditioner already connected internally";
+            return;
+        }
+    if (data_type_adapt_ == nullptr)
+        {
+            throw std::invalid_argument("DataTypeAdapter implementation not defined");
+        }
+    if (in_filt_ == nullptr)
+        {
+            throw std::invalid_argument("InputFilter implementation not defined");
+        }
+    data_type_adapt_->connect(top_block);
+    in_filt_->connect(top_block);
+
+    const size_t data_type_adapter_output_size = data_type_adapt_->get_right_block()->output_signature()->sizeof_stream_item(0);
+    const size_t input_filter_input_size = in_filt_->get_left_block()->input_signature()->sizeof_stream_item(0);
+    if (data_type_adapter_output_size != input_filter_input_size)
+        {
+            throw std::invalid_argument("itemsize mismatch: Invalid input/output data type configuration for the DataTypeAdapter/InputFilter connection");
+        }
+
+    top_block->connect(data_type_adapt_->get_right_block(), 0, in_filt_->get_left_block(), 0);
+    DLOG(INFO) << "data_type_adapter -> input_filter with " << outputs() << " outputs";
+    connected_ = true;
+}
+
+
+void ChannelizerSignalConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (!connected_)
+        {
+            LOG(WARNING) << "Signal conditioner already disconnected internally";
+            return;
+        }
+
+    top_block->disconnect(data_type_adapt_->get_right_block(), 0,
+        in_filt_->get_left_block(), 0);
+
+    data_type_adapt_->disconnect(top_block);
+    in_filt_->disconnect(std::move(top_block));
+
+    connected_ = false;
+}
+
+
+gr::basic_block_sptr ChannelizerSignalConditioner::get_left_block()
+{
+    return data_type_adapt_->get_left_block();
+}
+
+
+gr::basic_block_sptr ChannelizerSignalConditioner::get_right_block()
+{
+    return in_filt_->get_right_block();
+}
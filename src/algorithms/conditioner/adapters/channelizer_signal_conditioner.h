@@ -0,0 +1,75 @@
+/*!
+ * \file channelizer_signal_conditioner.h
+ * \brief It holds blocks to change data type and to split the input data in
+ * several bands, one per output.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CHANNELIZER_SIGNAL_CONDITIONER_H
+#define GNSS_SDR_CHANNELIZER_SIGNAL_CONDITIONER_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_adapters
+ * \{ */
+
+
+/*!
+ * \brief This class wraps a data_type_adapter and a multi-output input_filter
+ * (such as the Pfb_Channelizer_Filter), so that one wideband signal source
+ * feeds several bands. Each output port of the right block is one band, and
+ * the flowgraph assigns them consecutive RF channel IDs.
+ */
+class ChannelizerSignalConditioner : public GNSSBlockInterface
+{
+public:
+    //! Constructor
+    ChannelizerSignalConditioner(std::shared_ptr<GNSSBlockInterface> data_type_adapt,
+        std::shared_ptr<GNSSBlockInterface> in_filt,
+        std::string role);
+
+    //! Destructor
+    ~ChannelizerSignalConditioner() = default;
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+    inline std::string role() override { return role_; }
+    //! Returns "Channelizer_Signal_Conditioner"
+    inline std::string implementation() override { return "Channelizer_Signal_Conditioner"; }
+    inline size_t item_size() override { return data_type_adapt_->item_size(); }
+
+    //! Number of bands, one per output port of the right block
+    int outputs() const;
+
+    inline std::shared_ptr<GNSSBlockInterface> data_type_adapter() { return data_type_adapt_; }
+    inline std::shared_ptr<GNSSBlockInterface> input_filter() { return in_filt_; }
+
+private:
+    std::shared_ptr<GNSSBlockInterface> data_type_adapt_;
+    std::shared_ptr<GNSSBlockInterface> in_filt_;
+    std::string role_;
+    bool connected_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CHANNELIZER_SIGNAL_CONDITIONER_H
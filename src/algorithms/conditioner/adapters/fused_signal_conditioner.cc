@@ -0,0 +1,121 @@
+/*!
+ * \file fused_signal_conditioner.cc
+ * \brief It converts the data type, translates the signal to baseband and
+ * decimates it in a single block, optionally followed by a resampler.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_signal_conditioner.h"
+#include "configuration_interface.h"
+#include "freq_xlating_fir_filter.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>  // for lv_16sc_t
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+FusedSignalConditioner::FusedSignalConditioner(const ConfigurationInterface* configuration,
+    std::shared_ptr<GNSSBlockInterface> res,
+    std::string role,
+    const std::string& role_data_type_adapter,
+    const std::string& role_input_filter) : res_(std::move(res)),
+                                            role_(std::move(role)),
+                                            input_item_size_(sizeof(int16_t)),
+                                            connected_(false)
+{
+    const std::string data_type_adapter = configuration->property(role_data_type_adapter + ".implementation", std::string("Ishort_To_Complex"));
+    if (data_type_adapter.rfind("Ibyte_To_", 0) == 0)
+        {
+            input_item_size_ = sizeof(int8_t);
+        }
+    else if (data_type_adapter.rfind("Ishort_To_", 0) != 0)
+        {
+            LOG(ERROR) << role_ << ": " << role_data_type_adapter << ".implementation=" << data_type_adapter
+                       << " is not supported, the input is assumed to be interleaved shorts";
+        }
+    const bool inverted_spectrum = configuration->property(role_data_type_adapter + ".inverted_spectrum", false);
+
+    const std::string output_item_type = configuration->property(role_input_filter + ".output_item_type", std::string("gr_complex"));
+    const size_t output_item_size = (output_item_type == "cshort") ? sizeof(lv_16sc_t) : sizeof(gr_complex);
+    const double intermediate_freq = configuration->property(role_input_filter + ".IF", 0.0);
+    const double sampling_freq = configuration->property(role_input_filter + ".sampling_frequency", 4000000.0);
+    const int decimation_factor = configuration->property(role_input_filter + ".decimation_factor", 1);
+    const std::vector<float> taps = FreqXlatingFirFilter::design_taps(configuration, role_input_filter);
+
+    fused_block_ = make_fused_xlating_decimator(input_item_size_, output_item_size, decimation_factor, taps, intermediate_freq, sampling_freq, inverted_spectrum);
+    LOG(INFO) << "Created fused_xlating_decimator with " << taps.size() << " taps, decimation factor " << decimation_factor
+              << " and output item type " << output_item_type;
+    DLOG(INFO) << "fused_xlating_decimator(" << fused_block_->unique_id() << ")";
+}
+
+
+void FusedSignalConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (connected_)
+        {
+            LOG(WARNING) << "Signal conditioner already connected internally";
+            return;
+        }
+    if (res_ != nullptr)
+        {
+            res_->connect(top_block);
+            const size_t fused_output_size = fused_block_->output_signature()->sizeof_stream_item(0);
+            const size_t resampler_input_size = res_->get_left_block()->input_signature()->sizeof_stream_item(0);
+            if (fused_output_size != resampler_input_size)
+                {
+                    throw std::invalid_argument("itemsize mismatch: Invalid input/output data type configuration for the InputFilter/Resampler connection");
+                }
+            top_block->connect(fused_block_, 0, res_->get_left_block(), 0);
+            DLOG(INFO) << "fused_xlating_decimator -> resampler";
+        }
+    connected_ = true;
+}
+
+
+void FusedSignalConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (!connected_)
+        {
+            LOG(WARNING) << "Signal conditioner already disconnected internally";
+            return;
+        }
+    if (res_ != nullptr)
+        {
+            top_block->disconnect(fused_block_, 0, res_->get_left_block(), 0);
+            res_->disconnect(std::move(top_block));
+        }
+    connected_ = false;
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_left_block()
+{
+    return fused_block_;
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_right_block()
+{
+    if (res_ != nullptr)
+        {
+            return res_->get_right_block();
+        }
+    return fused_block_;
+}
@@ -0,0 +1,78 @@
+/*!
+ * \file fused_signal_conditioner.h
+ * \brief It converts the data type, translates the signal to baseband and
+ * decimates it in a single block, optionally followed by a resampler.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+#define GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+
+#include "fused_xlating_decimator.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief This class replaces a Ibyte_To_Complex or Ishort_To_Complex data
+ * type adapter followed by a Freq_Xlating_Fir_Filter input filter with a
+ * single fused_xlating_decimator block, configured with the same options
+ * of the DataTypeAdapter and InputFilter roles. A resampler, if any, is
+ * connected after it.
+ */
+class FusedSignalConditioner : public GNSSBlockInterface
+{
+public:
+    //! Constructor
+    FusedSignalConditioner(const ConfigurationInterface* configuration,
+        std::shared_ptr<GNSSBlockInterface> res,
+        std::string role,
+        const std::string& role_data_type_adapter,
+        const std::string& role_input_filter);
+
+    //! Destructor
+    ~FusedSignalConditioner() = default;
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+    inline std::string role() override { return role_; }
+    //! Returns "Fused_Signal_Conditioner"
+    inline std::string implementation() override { return "Fused_Signal_Conditioner"; }
+    inline size_t item_size() override { return 2 * input_item_size_; }
+
+    inline std::shared_ptr<GNSSBlockInterface> resampler() { return res_; }
+
+private:
+    fused_xlating_decimator_sptr fused_block_;
+    std::shared_ptr<GNSSBlockInterface> res_;
+    std::string role_;
+    size_t input_item_size_;
+    bool connected_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
@@ -18,6 +18,7 @@
 #include "beamformer.h"
 #include "configuration_interface.h"
 #include <gnuradio/blocks/file_sink.h>
+#include <cstdint>
 #include <utility>
 
 #if USE_GLOG_AND_GFLAGS
@@ -39,10 +40,28 @@ BeamformerFilter::BeamformerFilter(
     item_type_ = configuration->property(role + ".item_type", default_item_type);
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
     DLOG(INFO) << "role " << role_;
+    const int channels = configuration->property(role + ".channels", GNSS_SDR_BEAMFORMER_CHANNELS);
+    const std::string algorithm = configuration->property(role + ".algorithm", std::string("Fixed"));
+    const int32_t snapshots = configuration->property(role + ".snapshots", static_cast<int32_t>(1024));
+    const int32_t update_period = configuration->property(role + ".update_period", static_cast<int32_t>(1000000));
+    const float diagonal_loading = configuration->property(role + ".diagonal_loading", static_cast<float>(0.01));
+    Beamformer_Algorithm beamformer_algorithm = Beamformer_Algorithm::Fixed;
+    if (algorithm == "Power_Inversion")
+        {
+            beamformer_algorithm = Beamformer_Algorithm::Power_Inversion;
+        }
+    else if (algorithm == "MVDR")
+        {
+            beamformer_algorithm = Beamformer_Algorithm::MVDR;
+        }
+    else if (algorithm != "Fixed")
+        {
+            LOG(WARNING) << algorithm << " unrecognized beamforming algorithm, using fixed weights";
+        }
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            beamformer_ = make_beamformer_sptr();
+            beamformer_ = make_beamformer_sptr(channels, beamformer_algorithm, snapshots, update_period, diagonal_loading);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "resampler(" << beamformer_->unique_id() << ")";
         }
@@ -58,9 +77,9 @@ BeamformerFilter::BeamformerFilter(
             file_sink_ = gr::blocks::file_sink::make(item_size_, dump_filename_.c_str());
             DLOG(INFO) << "file_sink(" << file_sink_->unique_id() << ")";
         }
-    if (in_stream_ > 8)
+    if (in_stream_ > static_cast<unsigned int>(channels))
         {
-            LOG(ERROR) << "This implementation only supports eight input streams";
+            LOG(ERROR) << "This implementation only supports " << channels << " input streams";
         }
     if (out_stream_ > 1)
         {
@@ -44,19 +44,8 @@ FreqXlatingFirFilter::FreqXlatingFirFilter(const ConfigurationInterface* configu
     const std::string default_dump_filename("./input_filter.dat");
     const double default_intermediate_freq = 0.0;
     const double default_sampling_freq = 4000000.0;
-    const int default_number_of_taps = 6;
-    const unsigned int default_number_of_bands = 2;
-    const std::vector<double> default_bands = {0.0, 0.4, 0.6, 1.0};
-    const std::vector<double> default_ampl = {1.0, 1.0, 0.0, 0.0};
-    const std::vector<double> default_error_w = {1.0, 1.0};
-    const std::string default_filter_type("bandpass");
-    const int default_grid_density = 16;
     const int default_decimation_factor = 1;
 
-    const int number_of_taps = configuration->property(role_ + ".number_of_taps", default_number_of_taps);
-    const unsigned int number_of_bands = configuration->property(role_ + ".number_of_bands", default_number_of_bands);
-    const std::string filter_type = configuration->property(role_ + ".filter_type", default_filter_type);
-
     dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
     input_item_type_ = configuration->property(role_ + ".input_item_type", default_input_item_type);
     output_item_type_ = configuration->property(role_ + ".output_item_type", default_output_item_type);
@@ -64,50 +53,7 @@ FreqXlatingFirFilter::FreqXlatingFirFilter(const ConfigurationInterface* configu
     intermediate_freq_ = configuration->property(role_ + ".IF", default_intermediate_freq);
     sampling_freq_ = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
     decimation_factor_ = configuration->property(role_ + ".decimation_factor", default_decimation_factor);
-
-    if (filter_type != "lowpass")
-        {
-            std::vector<double> bands;
-            std::vector<double> ampl;
-            std::vector<double> error_w;
-            std::string option;
-            double option_value;
-
-            for (unsigned int i = 0; i < number_of_bands; i++)
-                {
-                    option = ".band" + std::to_string(i + 1) + "_begin";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    bands.push_back(option_value);
-
-                    option = ".band" + std::to_string(i + 1) + "_end";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    bands.push_back(option_value);
-
-                    option = ".ampl" + std::to_string(i + 1) + "_begin";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    ampl.push_back(option_value);
-
-                    option = ".ampl" + std::to_string(i + 1) + "_end";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    ampl.push_back(option_value);
-
-                    option = ".band" + std::to_string(i + 1) + "_error";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    error_w.push_back(option_value);
-                }
-
-            const int grid_density = configuration->property(role_ + ".grid_density", default_grid_density);
-            const std::vector<double> taps_d = gr::filter::pm_remez(number_of_taps - 1, bands, ampl, error_w, filter_type, grid_density);
-            taps_ = std::vector<float>(taps_d.begin(), taps_d.end());
-        }
-    else
-        {
-            const double default_bw = (sampling_freq_ / decimation_factor_) / 2;
-            const double bw_ = configuration->property(role_ + ".bw", default_bw);
-            const double default_tw = bw_ / 10.0;
-            const double tw_ = configuration->property(role_ + ".tw", default_tw);
-            taps_ = gr::filter::firdes::low_pass(1.0, sampling_freq_, bw_, tw_);
-        }
+    taps_ = design_taps(configuration, role_);
 
     size_t item_size;
     DLOG(INFO) << "role " << role_;
@@ -185,6 +131,67 @@ FreqXlatingFirFilter::FreqXlatingFirFilter(const ConfigurationInterface* configu
 }
 
 
+std::vector<float> FreqXlatingFirFilter::design_taps(const ConfigurationInterface* configuration,
+    const std::string& role)
+{
+    const double default_sampling_freq = 4000000.0;
+    const int default_number_of_taps = 6;
+    const unsigned int default_number_of_bands = 2;
+    const std::vector<double> default_bands = {0.0, 0.4, 0.6, 1.0};
+    const std::string default_filter_type("bandpass");
+    const int default_grid_density = 16;
+    const int default_decimation_factor = 1;
+
+    const int number_of_taps = configuration->property(role + ".number_of_taps", default_number_of_taps);
+    const unsigned int number_of_bands = configuration->property(role + ".number_of_bands", default_number_of_bands);
+    const std::string filter_type = configuration->property(role + ".filter_type", default_filter_type);
+    const double sampling_freq = configuration->property(role + ".sampling_frequency", default_sampling_freq);
+    const int decimation_factor = configuration->property(role + ".decimation_factor", default_decimation_factor);
+
+    if (filter_type != "lowpass")
+        {
+            std::vector<double> bands;
+            std::vector<double> ampl;
+            std::vector<double> error_w;
+            std::string option;
+            double option_value;
+
+            for (unsigned int i = 0; i < number_of_bands; i++)
+                {
+                    option = ".band" + std::to_string(i + 1) + "_begin";
+                    option_value = configuration->property(role + option, default_bands[i]);
+                    bands.push_back(option_value);
+
+                    option = ".band" + std::to_string(i + 1) + "_end";
+                    option_value = configuration->property(role + option, default_bands[i]);
+                    bands.push_back(option_value);
+
+                    option = ".ampl" + std::to_string(i + 1) + "_begin";
+                    option_value = configuration->property(role + option, default_bands[i]);
+                    ampl.push_back(option_value);
+
+                    option = ".ampl" + std::to_string(i + 1) + "_end";
+                    option_value = configuration->property(role + option, default_bands[i]);
+                    ampl.push_back(option_value);
+
+                    option = ".band" + std::to_string(i + 1) + "_error";
+                    option_value = configuration->property(role + option, default_bands[i]);
+                    error_w.push_back(option_value);
+                }
+
+            const int grid_density = configuration->property(role + ".grid_density", default_grid_density);
+            const std::vector<double> taps_d = gr::filter::pm_remez(number_of_taps - 1, bands, ampl, error_w, filter_type, grid_density);
+            return std::vector<float>(taps_d.begin(), taps_d.end());
+        }
+
+    const double default_bw = (sampling_freq / decimation_factor) / 2;
+    const double bw = configuration->property(role + ".bw", default_bw);
+    const double default_tw = bw / 10.0;
+    const double tw = configuration->property(role + ".tw", default_tw);
+    return gr::filter::firdes::low_pass(1.0, sampling_freq, bw, tw);
+}
+
+
 void FreqXlatingFirFilter::connect(gr::top_block_sptr top_block)
 {
     if ((taps_item_type_ == "float") && (input_item_type_ == "gr_complex") && (output_item_type_ == "gr_complex"))
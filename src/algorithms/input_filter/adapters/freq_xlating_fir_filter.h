@@ -85,6 +85,13 @@ public:
     gr::basic_block_sptr get_left_block() override;
     gr::basic_block_sptr get_right_block() override;
 
+    /*!
+     * \brief Designs the taps from the filter_type, band and lowpass
+     * options of \p role, so that other blocks can share them
+     */
+    static std::vector<float> design_taps(const ConfigurationInterface* configuration,
+        const std::string& role);
+
 private:
     gr::filter::freq_xlating_fir_filter_ccf::sptr freq_xlating_fir_filter_ccf_;
     gr::filter::freq_xlating_fir_filter_fcf::sptr freq_xlating_fir_filter_fcf_;
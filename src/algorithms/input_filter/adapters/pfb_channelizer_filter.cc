@@ -0,0 +1,148 @@
+/*!
+ * \file pfb_channelizer_filter.cc
+ * \brief Adapts a polyphase filter bank channelizer to a GNSSBlockInterface
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pfb_channelizer_filter.h"
+#include "configuration_interface.h"
+#include <gnuradio/filter/firdes.h>
+#include <algorithm>  // for std::max
+#include <cmath>      // for std::abs, std::round
+#include <utility>    // for std::move
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+PfbChannelizerFilter::PfbChannelizerFilter(const ConfigurationInterface* configuration,
+    std::string role,
+    unsigned int in_streams,
+    unsigned int out_streams)
+    : role_(std::move(role)),
+      in_streams_(in_streams),
+      out_streams_(out_streams),
+      dump_(configuration->property(role_ + ".dump", false))
+{
+    const std::string default_dump_filename("./input_filter.dat");
+    const double default_sampling_freq = 4000000.0;
+    const int default_channels = 8;
+    const int default_bands = 1;
+
+    dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
+    const double sampling_freq = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
+    const int channels = configuration->property(role_ + ".channels", default_channels);
+    // Oversampled by two by default, so that a band between two channels of
+    // the filter bank still fits in the output bandwidth
+    const int default_decimation_factor = (channels % 2 == 0) ? channels / 2 : channels;
+    int decimation_factor = configuration->property(role_ + ".decimation_factor", default_decimation_factor);
+    if (decimation_factor < 1 || channels % decimation_factor != 0)
+        {
+            LOG(WARNING) << role_ << ".decimation_factor=" << decimation_factor << " does not divide "
+                         << role_ << ".channels=" << channels << ", using " << default_decimation_factor;
+            decimation_factor = default_decimation_factor;
+        }
+    const int bands = configuration->property(role_ + ".bands", default_bands);
+    const double channel_spacing = sampling_freq / channels;
+    double max_residual_freq = 0.0;
+    for (int b = 0; b < bands; b++)
+        {
+            band_if_.push_back(configuration->property(role_ + ".band" + std::to_string(b) + "_IF", 0.0));
+            const double residual_freq = band_if_.back() - std::round(band_if_.back() / channel_spacing) * channel_spacing;
+            max_residual_freq = std::max(max_residual_freq, std::abs(residual_freq));
+        }
+
+    // Prototype low-pass filter, with its cutoff in the middle of the
+    // transition band. Each band is taken from the closest channel and
+    // shifted by its residual frequency, so the passband must cover the
+    // largest residual plus half the bandwidth of the bands. After decimation,
+    // the passband and the transition band fold onto the band unless
+    // band_bw + tw + 2 * residual <= output_freq. By default, the bands take
+    // the largest bandwidth that meets it.
+    const double output_freq = sampling_freq / decimation_factor;
+    const double tw = configuration->property(role_ + ".tw", 0.1 * output_freq);
+    const double max_band_bw = output_freq - tw - 2.0 * max_residual_freq;
+    const double band_bw = configuration->property(role_ + ".band_bw", max_band_bw);
+    if (band_bw <= 0.0 || band_bw > max_band_bw)
+        {
+            LOG(WARNING) << role_ << ": a band " << max_residual_freq << " Hz away from the center of its channel only fits "
+                         << std::max(max_band_bw, 0.0) << " Hz of bandwidth without aliasing at " << output_freq
+                         << " sps. Decrease " << role_ << ".decimation_factor or " << role_ << ".tw";
+        }
+    const double bw = configuration->property(role_ + ".bw", max_residual_freq + 0.5 * (std::max(band_bw, 0.0) + tw));
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, sampling_freq, bw, tw);
+    DLOG(INFO) << role_ << ": " << channels << " channels, " << taps.size() << " taps, decimation factor " << decimation_factor;
+
+    channelizer_ = make_pfb_channelizer_cc(channels, decimation_factor, taps, band_if_, sampling_freq);
+    DLOG(INFO) << "pfb_channelizer(" << channelizer_->unique_id() << ")";
+
+    if (dump_)
+        {
+            for (int b = 0; b < bands; b++)
+                {
+                    const std::string filename = dump_filename_ + "_band" + std::to_string(b) + ".dat";
+                    DLOG(INFO) << "Dumping output into file " << filename;
+                    file_sinks_.push_back(gr::blocks::file_sink::make(sizeof(gr_complex), filename.c_str()));
+                }
+        }
+    if (in_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void PfbChannelizerFilter::connect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            for (size_t b = 0; b < file_sinks_.size(); b++)
+                {
+                    top_block->connect(channelizer_, b, file_sinks_[b], 0);
+                }
+        }
+    else
+        {
+            DLOG(INFO) << "nothing to connect internally";
+        }
+}
+
+
+void PfbChannelizerFilter::disconnect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            for (size_t b = 0; b < file_sinks_.size(); b++)
+                {
+                    top_block->disconnect(channelizer_, b, file_sinks_[b], 0);
+                }
+        }
+}
+
+
+gr::basic_block_sptr PfbChannelizerFilter::get_left_block()
+{
+    return channelizer_;
+}
+
+
+gr::basic_block_sptr PfbChannelizerFilter::get_right_block()
+{
+    return channelizer_;
+}
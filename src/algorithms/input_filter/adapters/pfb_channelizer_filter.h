@@ -0,0 +1,94 @@
+/*!
+ * \file pfb_channelizer_filter.h
+ * \brief Adapts a polyphase filter bank channelizer to a GNSSBlockInterface
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PFB_CHANNELIZER_FILTER_H
+#define GNSS_SDR_PFB_CHANNELIZER_FILTER_H
+
+#include "gnss_block_interface.h"
+#include "pfb_channelizer_cc.h"
+#include <gnuradio/blocks/file_sink.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Splits one wideband stream into several decimated bands with a
+ * polyphase filter bank. The output port b carries the band centered at
+ * role.band<b>_IF, sampled at role.sampling_frequency / role.decimation_factor.
+ * The decimation factor defaults to half of role.channels: a band centered
+ * between two channels of a critically sampled bank would lose up to half of
+ * its spectrum. The prototype filter passes the largest offset of a band from
+ * the center of its channel plus half of role.band_bw.
+ */
+class PfbChannelizerFilter : public GNSSBlockInterface
+{
+public:
+    PfbChannelizerFilter(const ConfigurationInterface* configuration,
+        std::string role,
+        unsigned int in_streams,
+        unsigned int out_streams);
+
+    ~PfbChannelizerFilter() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Pfb_Channelizer_Filter"
+    inline std::string implementation() override
+    {
+        return "Pfb_Channelizer_Filter";
+    }
+
+    inline size_t item_size() override
+    {
+        return sizeof(gr_complex);
+    }
+
+    //! Number of bands, one per output port of the right block
+    inline int bands() const
+    {
+        return static_cast<int>(band_if_.size());
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    pfb_channelizer_cc_sptr channelizer_;
+    std::vector<gr::blocks::file_sink::sptr> file_sinks_;
+    std::vector<double> band_if_;
+    std::string role_;
+    std::string dump_filename_;
+    unsigned int in_streams_;
+    unsigned int out_streams_;
+    bool dump_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PFB_CHANNELIZER_FILTER_H
@@ -1,7 +1,8 @@
 /*!
  * \file beamformer.cc
  *
- * \brief Unpacks byte samples to NSR 2 bits samples
+ * \brief Spatial filter using RAW array input and fixed or adaptive
+ * (power inversion or MVDR) beamforming coefficients
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
@@ -17,20 +18,109 @@
 
 #include "beamformer.h"
 #include <gnuradio/io_signature.h>
-#include <cstddef>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <complex>
 
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
 
-beamformer_sptr make_beamformer_sptr()
+
+beamformer_sptr make_beamformer_sptr(int channels,
+    Beamformer_Algorithm algorithm,
+    int32_t snapshots,
+    int32_t update_period,
+    float diagonal_loading)
 {
-    return beamformer_sptr(new beamformer());
+    return beamformer_sptr(new beamformer(channels, algorithm, snapshots, update_period, diagonal_loading));
 }
 
 
-beamformer::beamformer()
+beamformer::beamformer(int channels,
+    Beamformer_Algorithm algorithm,
+    int32_t snapshots,
+    int32_t update_period,
+    float diagonal_loading)
     : gr::sync_block("beamformer",
-          gr::io_signature::make(GNSS_SDR_BEAMFORMER_CHANNELS, GNSS_SDR_BEAMFORMER_CHANNELS, sizeof(gr_complex)),
-          gr::io_signature::make(1, 1, sizeof(gr_complex)))
+          gr::io_signature::make(channels, channels, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      covariance_(arma::zeros<arma::cx_mat>(channels, channels)),
+      weight_vector_(channels, gr_complex(1.0, 0.0)),
+      in_(channels, nullptr),
+      algorithm_(algorithm),
+      diagonal_loading_(diagonal_loading),
+      channels_(channels),
+      snapshots_(std::max(snapshots, 1)),
+      update_period_(std::max(update_period, snapshots_)),
+      collected_snapshots_(0),
+      samples_to_next_update_(0)
 {
+    const int alignment_multiple = volk_gnsssdr_get_alignment() / sizeof(gr_complex);
+    set_alignment(std::max(1, alignment_multiple));
+}
+
+
+void beamformer::estimate_covariance(const gr_vector_const_void_star &input_items, int start, int length)
+{
+    // R = E[x x^H], so that R(i, j) accumulates x_i conj(x_j). Only the upper
+    // triangle is computed, R is Hermitian.
+    lv_32fc_t element;
+    for (int i = 0; i < channels_; i++)
+        {
+            const auto *x_i = reinterpret_cast<const gr_complex *>(input_items[i]) + start;
+            for (int j = i; j < channels_; j++)
+                {
+                    const auto *x_j = reinterpret_cast<const gr_complex *>(input_items[j]) + start;
+                    volk_32fc_x2_conjugate_dot_prod_32fc(&element, x_i, x_j, length);
+                    covariance_(i, j) += std::complex<double>(element);
+                    if (j != i)
+                        {
+                            covariance_(j, i) += std::conj(std::complex<double>(element));
+                        }
+                }
+        }
+}
+
+
+void beamformer::update_weights()
+{
+    arma::cx_mat R = covariance_ / static_cast<double>(snapshots_);
+    covariance_.zeros();
+    R.diag() += static_cast<double>(diagonal_loading_) * std::real(arma::trace(R)) / static_cast<double>(channels_);
+
+    arma::cx_vec constraint;
+    if (algorithm_ == Beamformer_Algorithm::Power_Inversion)
+        {
+            constraint = arma::zeros<arma::cx_vec>(channels_);
+            constraint(0) = 1.0;
+        }
+    else
+        {
+            constraint = arma::ones<arma::cx_vec>(channels_);
+        }
+
+    arma::cx_vec R_inv_constraint;
+    if (!arma::solve(R_inv_constraint, R, constraint))
+        {
+            LOG(WARNING) << "Singular array covariance matrix, the beamforming weights are not updated";
+            return;
+        }
+    // Unit weight in the reference element (power inversion) or unit gain in
+    // the look direction (MVDR)
+    const std::complex<double> normalization = arma::cdot(constraint, R_inv_constraint);
+    if (std::abs(normalization) == 0.0)
+        {
+            return;
+        }
+    const arma::cx_vec w = R_inv_constraint / normalization;
+    for (int i = 0; i < channels_; i++)
+        {
+            weight_vector_[i] = gr_complex(std::conj(w(i)));
+        }
 }
 
 
@@ -38,28 +128,37 @@ int beamformer::work(int noutput_items, gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    // channel output buffers
-    //  gr_complex *ch1 = (gr_complex *) input_items[0];
-    //  gr_complex *ch2 = (gr_complex *) input_items[1];
-    //  gr_complex *ch3 = (gr_complex *) input_items[2];
-    //  gr_complex *ch4 = (gr_complex *) input_items[3];
-    //  gr_complex *ch5 = (gr_complex *) input_items[4];
-    //  gr_complex *ch6 = (gr_complex *) input_items[5];
-    //  gr_complex *ch7 = (gr_complex *) input_items[6];
-    //  gr_complex *ch8 = (gr_complex *) input_items[7];
-
-    // NON-VOLK beamforming operation
-    // TODO: Implement VOLK SIMD-accelerated beamformer!
-    gr_complex sum;
-    for (int n = 0; n < noutput_items; n++)
+
+    if (algorithm_ != Beamformer_Algorithm::Fixed)
         {
-            sum = gr_complex(0, 0);
-            for (size_t i = 0; i < weight_vector.size(); i++)
+            int sample = 0;
+            while (sample < noutput_items)
                 {
-                    sum = sum + (reinterpret_cast<const gr_complex *>(input_items[i]))[n] * weight_vector[i];
+                    if (samples_to_next_update_ > 0)
+                        {
+                            const int skipped = std::min(samples_to_next_update_, noutput_items - sample);
+                            samples_to_next_update_ -= skipped;
+                            sample += skipped;
+                            continue;
+                        }
+                    const int length = std::min(snapshots_ - collected_snapshots_, noutput_items - sample);
+                    estimate_covariance(input_items, sample, length);
+                    collected_snapshots_ += length;
+                    sample += length;
+                    if (collected_snapshots_ == snapshots_)
+                        {
+                            update_weights();
+                            collected_snapshots_ = 0;
+                            samples_to_next_update_ = update_period_ - snapshots_;
+                        }
                 }
-            out[n] = sum;
         }
 
+    for (int i = 0; i < channels_; i++)
+        {
+            in_[i] = reinterpret_cast<const gr_complex *>(input_items[i]);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc(out, in_.data(), weight_vector_.data(), channels_, noutput_items);
+
     return noutput_items;
 }
@@ -1,7 +1,8 @@
 /*!
  * \file beamformer.h
  *
- * \brief Simple spatial filter using RAW array input and beamforming coefficients
+ * \brief Spatial filter using RAW array input and fixed or adaptive
+ * (power inversion or MVDR) beamforming coefficients
  * \author Javier Arribas jarribas (at) cttc.es
  *
  * -----------------------------------------------------------------------------
@@ -19,7 +20,10 @@
 #define GNSS_SDR_BEAMFORMER_H
 
 #include "gnss_block_interface.h"
+#include <armadillo>
 #include <gnuradio/sync_block.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
 #include <vector>
 
 /** \addtogroup Input_Filter
@@ -32,12 +36,37 @@ class beamformer;
 
 using beamformer_sptr = gnss_shared_ptr<beamformer>;
 
-beamformer_sptr make_beamformer_sptr();
-
 const int GNSS_SDR_BEAMFORMER_CHANNELS = 8;
 
 /*!
- * \brief This class implements a real-time software-defined spatial filter using the CTTC GNSS experimental antenna array input and a set of dynamically reloadable weights
+ * \brief Computation of the beamforming weights
+ */
+enum class Beamformer_Algorithm
+{
+    Fixed,            //!< All the elements are added with unit weight
+    Power_Inversion,  //!< Minimizes the output power, with unit weight in the first element
+    MVDR              //!< Minimizes the output power, with unit gain towards the zenith
+};
+
+beamformer_sptr make_beamformer_sptr(
+    int channels = GNSS_SDR_BEAMFORMER_CHANNELS,
+    Beamformer_Algorithm algorithm = Beamformer_Algorithm::Fixed,
+    int32_t snapshots = 1024,
+    int32_t update_period = 1000000,
+    float diagonal_loading = 0.01);
+
+/*!
+ * \brief This class implements a real-time software-defined spatial filter
+ * for antenna arrays, such as the CTTC GNSS experimental antenna array. The
+ * output is the sum of the array elements, weighted by w^H.
+ *
+ * With the adaptive algorithms, the spatial covariance matrix R of the array
+ * is estimated from the first \p snapshots samples of every \p update_period
+ * samples, and the weights are recomputed from it: w = R^-1 e1 / (R^-1)_11
+ * for power inversion, which places nulls towards the interferences, and
+ * w = R^-1 a / (a^H R^-1 a) for MVDR, with a steering vector a towards the
+ * zenith (all ones, for a calibrated array). A fraction \p diagonal_loading
+ * of the mean element power is added to the diagonal of R before inversion.
  */
 class beamformer : public gr::sync_block
 {
@@ -47,9 +76,21 @@ public:
         gr_vector_void_star &output_items);
 
 private:
-    friend beamformer_sptr make_beamformer_sptr();
-    beamformer();
-    std::vector<gr_complex> weight_vector = std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+    friend beamformer_sptr make_beamformer_sptr(int channels, Beamformer_Algorithm algorithm, int32_t snapshots, int32_t update_period, float diagonal_loading);
+    beamformer(int channels, Beamformer_Algorithm algorithm, int32_t snapshots, int32_t update_period, float diagonal_loading);
+    void estimate_covariance(const gr_vector_const_void_star &input_items, int start, int length);
+    void update_weights();
+
+    arma::cx_mat covariance_;
+    volk_gnsssdr::vector<gr_complex> weight_vector_;  // conjugate of the weights w
+    std::vector<const gr_complex *> in_;
+    Beamformer_Algorithm algorithm_;
+    float diagonal_loading_;
+    int channels_;
+    int32_t snapshots_;
+    int32_t update_period_;
+    int32_t collected_snapshots_;
+    int32_t samples_to_next_update_;
 };
 
 
@@ -0,0 +1,130 @@
+/*!
+ * \file fused_xlating_decimator.cc
+ * \brief Converts interleaved byte or short samples to complex, translates
+ * them to baseband and decimates them in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_xlating_decimator.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+
+namespace
+{
+// Complex samples converted per block: 32 KB of gr_complex
+constexpr int FUSED_BLOCK_SAMPLES = 4096;
+}  // namespace
+
+
+fused_xlating_decimator_sptr make_fused_xlating_decimator(size_t input_item_size,
+    size_t output_item_size,
+    int decimation,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    bool inverted_spectrum)
+{
+    return fused_xlating_decimator_sptr(new fused_xlating_decimator(input_item_size, output_item_size, decimation, taps, intermediate_freq, sampling_freq, inverted_spectrum));
+}
+
+
+fused_xlating_decimator::fused_xlating_decimator(size_t input_item_size,
+    size_t output_item_size,
+    int decimation,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    bool inverted_spectrum)
+    : gr::sync_decimator("fused_xlating_decimator",
+          gr::io_signature::make(1, 1, input_item_size),
+          gr::io_signature::make(1, 1, output_item_size),
+          2 * decimation),
+      taps_(taps.size()),
+      phasor_(1.0, 0.0),
+      input_item_size_(input_item_size),
+      output_item_size_(output_item_size),
+      decimation_(decimation),
+      ntaps_(static_cast<int>(taps.size())),
+      block_outputs_(std::max(1, (FUSED_BLOCK_SAMPLES - static_cast<int>(taps.size())) / decimation + 1)),
+      inverted_spectrum_(inverted_spectrum)
+{
+    // Mixing each input sample x[n] by exp(-j w n) before filtering is the
+    // same as filtering with the band-pass taps h[k] exp(j w k) over the
+    // window starting at n0, and rotating the result by exp(-j w n0), up to
+    // a constant phase. The taps and the NCO are computed as in the GNU Radio
+    // freq_xlating_fir_filter, so that both give the same output.
+    const auto w = static_cast<float>(2.0 * M_PI * intermediate_freq / sampling_freq);
+    for (int i = 0; i < ntaps_; i++)
+        {
+            taps_[i] = taps[ntaps_ - 1 - i] * std::polar(1.0F, static_cast<float>(ntaps_ - 1 - i) * w);
+        }
+    phasor_step_ = std::polar(1.0F, -w * static_cast<float>(decimation_));
+    samples_.resize(static_cast<size_t>(block_outputs_ - 1) * decimation_ + ntaps_);
+    outputs_.resize(block_outputs_);
+
+    // ntaps - 1 past samples, with two items (I and Q) per sample
+    set_history(2 * (ntaps_ - 1) + 1);
+}
+
+
+int fused_xlating_decimator::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    for (int first = 0; first < noutput_items; first += block_outputs_)
+        {
+            const int outputs = std::min(block_outputs_, noutput_items - first);
+            const int samples = (outputs - 1) * decimation_ + ntaps_;
+            const size_t first_item = 2 * static_cast<size_t>(first) * decimation_;
+
+            // Conversion of the block to float, while it is in cache
+            auto *converted = reinterpret_cast<float *>(samples_.data());
+            if (input_item_size_ == sizeof(int8_t))
+                {
+                    volk_8i_s32f_convert_32f(converted, static_cast<const int8_t *>(input_items[0]) + first_item, 1.0F, 2 * samples);
+                }
+            else
+                {
+                    volk_16i_s32f_convert_32f(converted, static_cast<const int16_t *>(input_items[0]) + first_item, 1.0F, 2 * samples);
+                }
+            if (inverted_spectrum_)
+                {
+                    volk_32fc_conjugate_32fc(samples_.data(), samples_.data(), samples);
+                }
+
+            // Filter and NCO at the output rate
+            for (int m = 0; m < outputs; m++)
+                {
+                    gr_complex acc;
+                    volk_32fc_x2_dot_prod_32fc(&acc, samples_.data() + static_cast<size_t>(m) * decimation_, taps_.data(), ntaps_);
+                    outputs_[m] = acc * phasor_;
+                    phasor_ *= phasor_step_;
+                }
+
+            if (output_item_size_ == sizeof(gr_complex))
+                {
+                    std::copy_n(outputs_.data(), outputs, static_cast<gr_complex *>(output_items[0]) + first);
+                }
+            else
+                {
+                    volk_32f_s32f_convert_16i(static_cast<int16_t *>(output_items[0]) + 2 * static_cast<size_t>(first),
+                        reinterpret_cast<const float *>(outputs_.data()), 1.0F, 2 * outputs);
+                }
+        }
+
+    phasor_ /= std::abs(phasor_);
+    return noutput_items;
+}
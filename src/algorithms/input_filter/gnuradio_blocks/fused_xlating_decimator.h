@@ -0,0 +1,88 @@
+/*!
+ * \file fused_xlating_decimator.h
+ * \brief Converts interleaved byte or short samples to complex, translates
+ * them to baseband and decimates them in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_XLATING_DECIMATOR_H
+#define GNSS_SDR_FUSED_XLATING_DECIMATOR_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class fused_xlating_decimator;
+
+using fused_xlating_decimator_sptr = gnss_shared_ptr<fused_xlating_decimator>;
+
+/*!
+ * \brief Makes a fused_xlating_decimator. input_item_size is sizeof(int8_t)
+ * or sizeof(int16_t) (two items, I and Q, per sample), and
+ * output_item_size is sizeof(gr_complex) or sizeof(lv_16sc_t).
+ */
+fused_xlating_decimator_sptr make_fused_xlating_decimator(
+    size_t input_item_size,
+    size_t output_item_size,
+    int decimation,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    bool inverted_spectrum);
+
+/*!
+ * \brief Does the work of a data type adapter, a frequency translating FIR
+ * filter and an optional conversion to std::complex<short> without
+ * intermediate full-rate buffers.
+ *
+ * The input is processed in blocks that fit in the L1 data cache: each block
+ * is converted to float once, and the filter is only evaluated at the
+ * decimated output instants. As in the GNU Radio freq_xlating_fir_filter, the
+ * frequency translation is folded into complex band-pass taps, so the NCO
+ * runs at the output rate.
+ */
+class fused_xlating_decimator : public gr::sync_decimator
+{
+public:
+    ~fused_xlating_decimator() = default;
+    int work(int noutput_items, gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend fused_xlating_decimator_sptr make_fused_xlating_decimator(size_t input_item_size, size_t output_item_size, int decimation, const std::vector<float> &taps, double intermediate_freq, double sampling_freq, bool inverted_spectrum);
+    fused_xlating_decimator(size_t input_item_size, size_t output_item_size, int decimation, const std::vector<float> &taps, double intermediate_freq, double sampling_freq, bool inverted_spectrum);
+
+    volk_gnsssdr::vector<gr_complex> taps_;     // band-pass taps, in the order of the input window
+    volk_gnsssdr::vector<gr_complex> samples_;  // converted input of one block
+    volk_gnsssdr::vector<gr_complex> outputs_;  // filter outputs of one block
+    gr_complex phasor_;                         // NCO at the first sample of the next window
+    gr_complex phasor_step_;                    // NCO rotation between output samples
+    size_t input_item_size_;
+    size_t output_item_size_;
+    int decimation_;
+    int ntaps_;
+    int block_outputs_;
+    bool inverted_spectrum_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_XLATING_DECIMATOR_H
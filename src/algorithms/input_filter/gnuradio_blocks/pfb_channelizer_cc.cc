@@ -0,0 +1,135 @@
+/*!
+ * \file pfb_channelizer_cc.cc
+ * \brief Polyphase filter bank channelizer that extracts several decimated
+ * bands from one wideband stream of complex samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pfb_channelizer_cc.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+pfb_channelizer_cc_sptr make_pfb_channelizer_cc(int channels,
+    int decimation,
+    const std::vector<float> &taps,
+    const std::vector<double> &band_if,
+    double sampling_freq)
+{
+    return pfb_channelizer_cc_sptr(new pfb_channelizer_cc(channels, decimation, taps, band_if, sampling_freq));
+}
+
+
+pfb_channelizer_cc::pfb_channelizer_cc(int channels,
+    int decimation,
+    const std::vector<float> &taps,
+    const std::vector<double> &band_if,
+    double sampling_freq)
+    : gr::sync_decimator("pfb_channelizer_cc",
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(static_cast<int>(band_if.size()), static_cast<int>(band_if.size()), sizeof(gr_complex)),
+          decimation),
+      fft_(gnss_fft_rev_make_unique(channels)),
+      accumulator_(2 * channels),
+      twiddles_(channels),
+      phasors_(band_if.size(), gr_complex(1.0, 0.0)),
+      phasor_steps_(band_if.size()),
+      bins_(band_if.size()),
+      channels_(channels),
+      decimation_(decimation),
+      taps_per_branch_(static_cast<int>((taps.size() + channels - 1) / channels)),
+      time_index_(decimation - 1)
+{
+    // Zero padding of the prototype filter up to a multiple of the number of
+    // branches, reversed so that it multiplies the input window in order
+    const int length = taps_per_branch_ * channels_;
+    taps_ = volk_gnsssdr::vector<float>(2 * length, 0.0);
+    for (size_t l = 0; l < taps.size(); l++)
+        {
+            taps_[2 * (length - 1 - l)] = taps[l];
+            taps_[2 * (length - 1 - l) + 1] = taps[l];
+        }
+    set_history(length);
+
+    for (int q = 0; q < channels_; q++)
+        {
+            twiddles_[q] = std::polar(1.0F, static_cast<float>(-2.0 * M_PI * q / channels_));
+        }
+
+    const double channel_spacing = sampling_freq / channels_;
+    const double output_freq = sampling_freq / decimation_;
+    for (size_t b = 0; b < band_if.size(); b++)
+        {
+            const auto bin = static_cast<int>(std::lround(band_if[b] / channel_spacing));
+            const double residual_freq = band_if[b] - bin * channel_spacing;
+            bins_[b] = ((bin % channels_) + channels_) % channels_;
+            phasor_steps_[b] = std::polar(1.0F, static_cast<float>(-2.0 * M_PI * residual_freq / output_freq));
+            DLOG(INFO) << "Channelizer band " << b << " at " << band_if[b] << " Hz: channel " << bins_[b]
+                       << ", residual frequency " << residual_freq << " Hz";
+        }
+}
+
+
+int pfb_channelizer_cc::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    // Interleaved I and Q, so that the polyphase filtering is a real
+    // multiply-accumulate of contiguous vectors
+    const auto *in = reinterpret_cast<const float *>(input_items[0]);
+    const int branch_length = 2 * channels_;
+    gr_complex *fft_in = fft_->get_inbuf();
+    const gr_complex *fft_out = fft_->get_outbuf();
+    const auto *branch_outputs = reinterpret_cast<const gr_complex *>(accumulator_.data());
+
+    for (int m = 0; m < noutput_items; m++)
+        {
+            const float *window = in + 2 * (m * decimation_ + decimation_ - 1);
+            std::fill(accumulator_.begin(), accumulator_.end(), 0.0F);
+            for (int p = 0; p < taps_per_branch_; p++)
+                {
+                    const float *x = window + p * branch_length;
+                    const float *h = taps_.data() + p * branch_length;
+                    for (int i = 0; i < branch_length; i++)
+                        {
+                            accumulator_[i] += h[i] * x[i];
+                        }
+                }
+            for (int r = 0; r < channels_; r++)
+                {
+                    fft_in[r] = branch_outputs[channels_ - 1 - r];
+                }
+            fft_->execute();
+
+            for (size_t b = 0; b < bins_.size(); b++)
+                {
+                    const int bin = bins_[b];
+                    static_cast<gr_complex *>(output_items[b])[m] = fft_out[bin] * twiddles_[(bin * time_index_) % channels_] * phasors_[b];
+                    phasors_[b] *= phasor_steps_[b];
+                }
+            time_index_ = (time_index_ + decimation_) % channels_;
+        }
+
+    for (auto &phasor : phasors_)
+        {
+            phasor /= std::abs(phasor);
+        }
+    return noutput_items;
+}
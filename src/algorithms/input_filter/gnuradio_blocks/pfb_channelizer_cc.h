@@ -0,0 +1,83 @@
+/*!
+ * \file pfb_channelizer_cc.h
+ * \brief Polyphase filter bank channelizer that extracts several decimated
+ * bands from one wideband stream of complex samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PFB_CHANNELIZER_CC_H
+#define GNSS_SDR_PFB_CHANNELIZER_CC_H
+
+#include "gnss_block_interface.h"
+#include "gnss_sdr_fft.h"
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class pfb_channelizer_cc;
+
+using pfb_channelizer_cc_sptr = gnss_shared_ptr<pfb_channelizer_cc>;
+
+pfb_channelizer_cc_sptr make_pfb_channelizer_cc(
+    int channels,
+    int decimation,
+    const std::vector<float> &taps,
+    const std::vector<double> &band_if,
+    double sampling_freq);
+
+/*!
+ * \brief Uniform DFT filter bank with \p channels channels spaced
+ * sampling_freq / channels apart. The prototype low-pass filter \p taps is
+ * split into \p channels polyphase branches, and one FFT per output sample
+ * translates all the channels to baseband at once, so that the cost of
+ * adding one band is a single FFT bin.
+ *
+ * Each output b is the channel nearest to band_if[b], decimated by
+ * \p decimation (which must divide \p channels; decimation < channels gives
+ * oversampled channels). The remaining offset between band_if[b] and the
+ * center of the channel is removed at the output rate, so that band_if[b]
+ * is at 0 Hz in output b.
+ */
+class pfb_channelizer_cc : public gr::sync_decimator
+{
+public:
+    ~pfb_channelizer_cc() = default;
+    int work(int noutput_items, gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend pfb_channelizer_cc_sptr make_pfb_channelizer_cc(int channels, int decimation, const std::vector<float> &taps, const std::vector<double> &band_if, double sampling_freq);
+    pfb_channelizer_cc(int channels, int decimation, const std::vector<float> &taps, const std::vector<double> &band_if, double sampling_freq);
+
+    gnss_fft_rev_unique_ptr<gnss_fft_complex_rev> fft_;
+    volk_gnsssdr::vector<float> taps_;         // reversed prototype filter, each tap repeated for I and Q
+    volk_gnsssdr::vector<float> accumulator_;  // polyphase branch outputs, in reverse order
+    std::vector<gr_complex> twiddles_;         // exp(-j 2 pi q / channels)
+    std::vector<gr_complex> phasors_;          // residual frequency correction of each band
+    std::vector<gr_complex> phasor_steps_;
+    std::vector<int> bins_;
+    int channels_;
+    int decimation_;
+    int taps_per_branch_;
+    int time_index_;  // index of the newest input sample, modulo channels_
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PFB_CHANNELIZER_CC_H
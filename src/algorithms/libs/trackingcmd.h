@@ -28,14 +28,17 @@
 class TrackingCmd
 {
 public:
-    TrackingCmd();
+    TrackingCmd() = default;
 
     bool enable_carrier_nco_cmd = false;
     bool enable_code_nco_cmd = false;
     double code_freq_chips = 0.0;
     double carrier_freq_hz = 0.0;
     double carrier_freq_rate_hz_s = 0.0;
-    uint64_t sample_counter = 0UL;
+    double pseudorange_rate_m_s = 0.0;  //!< Pseudorange rate predicted by the PVT solution [m/s]
+    uint64_t sample_counter = 0UL;      //!< Tracking sample counter of the epoch of the command
+    uint32_t channel_id = 0U;           //!< Channel to which the command is addressed
+    uint32_t prn = 0U;                  //!< PRN of the satellite tracked by that channel
 };
 
 /** \} */
@@ -1,13 +1,13 @@
 /*!
  * \file volk_gnsssdr_alloc.h
  * \author Carles Fernandez, 2019. cfernandez(at)cttc.es
- * \brief C++11 allocator using volk_gnsssdr_malloc and volk_gnsssdr_free.
- * Based on https://github.com/gnuradio/volk/pull/284/ by hcab14
+ * \brief C++11 allocator using volk_gnsssdr_buffer_malloc and
+ * volk_gnsssdr_buffer_free. Based on https://github.com/gnuradio/volk/pull/284/ by hcab14
  *
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
@@ -23,10 +23,13 @@
 namespace volk_gnsssdr
 {
 /*!
- * \brief C++11 allocator using volk_gnsssdr_malloc and volk_gnsssdr_free
+ * \brief C++11 allocator using volk_gnsssdr_buffer_malloc and
+ * volk_gnsssdr_buffer_free
  *
  * \details
  *   adapted from https://en.cppreference.com/w/cpp/named_req/Alloc
+ *   Buffers are aligned to the cache line, and may be backed by hugepages
+ *   or reused from a pool, see volk_gnsssdr_set_buffer_policy.
  */
 template <class T>
 struct alloc
@@ -42,13 +45,13 @@ struct alloc
     {
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_alloc();
 
-        if (auto p = static_cast<T*>(volk_gnsssdr_malloc(n * sizeof(T), volk_gnsssdr_get_alignment())))
+        if (auto p = static_cast<T*>(volk_gnsssdr_buffer_malloc(n * sizeof(T), volk_gnsssdr_get_alignment())))
             return p;
 
         throw std::bad_alloc();
     }
 
-    void deallocate(T* p, std::size_t) noexcept { volk_gnsssdr_free(p); }
+    void deallocate(T* p, std::size_t) noexcept { volk_gnsssdr_buffer_free(p); }
 };
 
 template <class T, class U>
@@ -63,7 +66,7 @@ bool operator!=(alloc<T> const&, alloc<U> const&) { return false; }
  *
  * \details
  * example code:
- *   volk_gnsssdr::vector<float> v(100); // vector using volk_gnsssdr_malloc, volk_gnsssdr_free
+ *   volk_gnsssdr::vector<float> v(100); // vector using volk_gnsssdr_buffer_malloc, volk_gnsssdr_buffer_free
  */
 template <class T>
 using vector = std::vector<T, alloc<T> >;
@@ -61,6 +61,85 @@ VOLK_API void *volk_gnsssdr_malloc(size_t size, size_t alignment);
  */
 VOLK_API void volk_gnsssdr_free(void *aptr);
 
+
+/*!
+ * \brief Flags of volk_gnsssdr_set_buffer_policy.
+ *
+ * VOLK_GNSSSDR_BUFFER_HUGEPAGES backs buffers with transparent hugepages.
+ * Buffers of at least half a hugepage get their own mapping, and smaller
+ * ones are slots of hugepage slabs, split in power-of-two size classes.
+ * Freed slots are reused by the next buffers of the same class, and a slab
+ * is unmapped once it is empty, except for one spare slab per class.
+ * VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES uses the hugepages reserved
+ * in /proc/sys/vm/nr_hugepages instead, and falls back to regular pages
+ * when there are none left.
+ * VOLK_GNSSSDR_BUFFER_POOLED keeps freed buffers of their own mapping, so
+ * that the next buffer of the same number of hugepages reuses them. Alone,
+ * it uses the same mappings with regular pages.
+ * Without flags, buffers are plain aligned allocations, which take no lock
+ * and are not counted in the statistics.
+ */
+#define VOLK_GNSSSDR_BUFFER_HUGEPAGES 0x1U
+#define VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES 0x2U
+#define VOLK_GNSSSDR_BUFFER_POOLED 0x4U
+
+#define VOLK_GNSSSDR_HUGEPAGE_SIZE (2UL * 1024UL * 1024UL)
+
+/*!
+ * \brief Statistics of the buffers allocated with
+ * volk_gnsssdr_buffer_malloc.
+ */
+typedef struct
+{
+    size_t allocations;           /*!< buffers allocated */
+    size_t deallocations;         /*!< buffers freed */
+    size_t bytes_in_use;          /*!< bytes of the buffers in use, rounded up to their size class */
+    size_t peak_bytes_in_use;     /*!< maximum of bytes_in_use */
+    size_t hugepage_allocations;  /*!< buffers backed by hugepages */
+    size_t pool_hits;             /*!< allocations served from the pool or from freed slots */
+    size_t pooled_bytes;          /*!< bytes kept in the pool */
+    size_t mapped_bytes;          /*!< bytes mapped for buffers and slabs */
+} volk_gnsssdr_buffer_stats_t;
+
+/*!
+ * \brief Sets how volk_gnsssdr_buffer_malloc allocates the next buffers.
+ *
+ * \details
+ * Hugepages and the pool are only available on Linux, and the flags are
+ * ignored elsewhere. Buffers already allocated keep their backing. Setting
+ * the flags to 0 also unmaps the empty slabs.
+ *
+ * \param flags Combination of the VOLK_GNSSSDR_BUFFER_* flags, 0 for plain
+ * aligned allocations.
+ * \param pool_capacity Maximum number of bytes kept in the pool. If the
+ * pool is disabled, the buffers that it holds are released.
+ */
+VOLK_API void volk_gnsssdr_set_buffer_policy(unsigned int flags, size_t pool_capacity);
+
+/*!
+ * \brief Allocate \p size bytes of data aligned to \p alignment and to the
+ * cache line, following the policy set by volk_gnsssdr_set_buffer_policy.
+ * Buffers must be freed with volk_gnsssdr_buffer_free.
+ *
+ * \param size The number of bytes to allocate.
+ * \param alignment The byte alignment of the allocated memory.
+ * \return pointer to aligned memory, NULL on failure.
+ */
+VOLK_API void *volk_gnsssdr_buffer_malloc(size_t size, size_t alignment);
+
+/*!
+ * \brief Frees, or keeps in the pool, a buffer allocated by
+ * volk_gnsssdr_buffer_malloc.
+ *
+ * \param ptr The pointer returned by volk_gnsssdr_buffer_malloc.
+ */
+VOLK_API void volk_gnsssdr_buffer_free(void *ptr);
+
+/*!
+ * \brief Copies the statistics of the buffers in \p stats.
+ */
+VOLK_API void volk_gnsssdr_get_buffer_stats(volk_gnsssdr_buffer_stats_t *stats);
+
 __VOLK_DECL_END
 
 #endif /* INCLUDED_VOLK_GNSSSDR_MALLOC_H */
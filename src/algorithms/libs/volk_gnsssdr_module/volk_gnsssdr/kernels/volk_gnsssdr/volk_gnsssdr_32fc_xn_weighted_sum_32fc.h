@@ -0,0 +1,292 @@
+/*!
+ * \file volk_gnsssdr_32fc_xn_weighted_sum_32fc.h
+ * \brief VOLK_GNSSSDR kernel: multiplies N complex (32-bit float per component)
+ * vectors by one complex weight each, and adds them in one output vector.
+ *
+ * VOLK_GNSSSDR kernel that computes the sample-by-sample weighted sum of N
+ * 32 bits complex vectors. It is optimized to apply the weights of a
+ * beamformer to the channels of an antenna array.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_xn_weighted_sum_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies each of an arbitrary number of complex vectors by its own complex
+ * weight and adds the results, sample by sample:
+ * result[n] = weights[0] * in_a[0][n] + ... + weights[N-1] * in_a[N-1][n]
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_xn_weighted_sum_32fc(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a:          Pointer to an array of pointers to the vectors to be weighted and added.
+ * \li weights:       Complex weight of each vector.
+ * \li num_a_vectors: Number of vectors.
+ * \li num_points:    Number of complex values in each vector.
+ *
+ * \b Outputs
+ * \li result:        Weighted sum of the vectors, with \p num_points complex values.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_generic(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t sum;
+    int n_vec;
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    sum += weights[n_vec] * in_a[n_vec][n];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_sse3(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 2;
+    const lv_32fc_t** _in_a = in_a;
+    lv_32fc_t* _result = result;
+    __m128 a, yl, yh, tmp1, tmp2, acc;
+    int n_vec;
+    unsigned int number;
+    unsigned int n;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            acc = _mm_setzero_ps();
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    yl = _mm_set1_ps(lv_creal(weights[n_vec]));  // Load yl with wr,wr,wr,wr
+                    yh = _mm_set1_ps(lv_cimag(weights[n_vec]));  // Load yh with wi,wi,wi,wi
+                    a = _mm_loadu_ps((const float*)&(_in_a[n_vec][number * 2]));
+                    tmp1 = _mm_mul_ps(a, yl);
+                    a = _mm_shuffle_ps(a, a, 0xB1);
+                    tmp2 = _mm_mul_ps(a, yh);
+                    acc = _mm_add_ps(acc, _mm_addsub_ps(tmp1, tmp2));
+                }
+            _mm_storeu_ps((float*)_result, acc);
+            _result += 2;
+        }
+
+    for (n = sse_iters * 2; n < num_points; n++)
+        {
+            result[n] = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    result[n] += weights[n_vec] * in_a[n_vec][n];
+                }
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_a_sse3(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 2;
+    const lv_32fc_t** _in_a = in_a;
+    lv_32fc_t* _result = result;
+    __m128 a, yl, yh, tmp1, tmp2, acc;
+    int n_vec;
+    unsigned int number;
+    unsigned int n;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            acc = _mm_setzero_ps();
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    yl = _mm_set1_ps(lv_creal(weights[n_vec]));
+                    yh = _mm_set1_ps(lv_cimag(weights[n_vec]));
+                    a = _mm_load_ps((const float*)&(_in_a[n_vec][number * 2]));
+                    tmp1 = _mm_mul_ps(a, yl);
+                    a = _mm_shuffle_ps(a, a, 0xB1);
+                    tmp2 = _mm_mul_ps(a, yh);
+                    acc = _mm_add_ps(acc, _mm_addsub_ps(tmp1, tmp2));
+                }
+            _mm_store_ps((float*)_result, acc);
+            _result += 2;
+        }
+
+    for (n = sse_iters * 2; n < num_points; n++)
+        {
+            result[n] = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    result[n] += weights[n_vec] * in_a[n_vec][n];
+                }
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 4;
+    const lv_32fc_t** _in_a = in_a;
+    lv_32fc_t* _result = result;
+    __m256 a, yl, yh, tmp1, tmp2, acc;
+    int n_vec;
+    unsigned int number;
+    unsigned int n;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            acc = _mm256_setzero_ps();
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    yl = _mm256_set1_ps(lv_creal(weights[n_vec]));
+                    yh = _mm256_set1_ps(lv_cimag(weights[n_vec]));
+                    a = _mm256_loadu_ps((const float*)&(_in_a[n_vec][number * 4]));
+                    tmp1 = _mm256_mul_ps(a, yl);
+                    a = _mm256_shuffle_ps(a, a, 0xB1);
+                    tmp2 = _mm256_mul_ps(a, yh);
+                    acc = _mm256_add_ps(acc, _mm256_addsub_ps(tmp1, tmp2));
+                }
+            _mm256_storeu_ps((float*)_result, acc);
+            _result += 4;
+        }
+    _mm256_zeroupper();
+
+    for (n = avx_iters * 4; n < num_points; n++)
+        {
+            result[n] = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    result[n] += weights[n_vec] * in_a[n_vec][n];
+                }
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_a_avx(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 4;
+    const lv_32fc_t** _in_a = in_a;
+    lv_32fc_t* _result = result;
+    __m256 a, yl, yh, tmp1, tmp2, acc;
+    int n_vec;
+    unsigned int number;
+    unsigned int n;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            acc = _mm256_setzero_ps();
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    yl = _mm256_set1_ps(lv_creal(weights[n_vec]));
+                    yh = _mm256_set1_ps(lv_cimag(weights[n_vec]));
+                    a = _mm256_load_ps((const float*)&(_in_a[n_vec][number * 4]));
+                    tmp1 = _mm256_mul_ps(a, yl);
+                    a = _mm256_shuffle_ps(a, a, 0xB1);
+                    tmp2 = _mm256_mul_ps(a, yh);
+                    acc = _mm256_add_ps(acc, _mm256_addsub_ps(tmp1, tmp2));
+                }
+            _mm256_store_ps((float*)_result, acc);
+            _result += 4;
+        }
+    _mm256_zeroupper();
+
+    for (n = avx_iters * 4; n < num_points; n++)
+        {
+            result[n] = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    result[n] += weights[n_vec] * in_a[n_vec][n];
+                }
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_neon(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    const lv_32fc_t** _in_a = in_a;
+    lv_32fc_t* _result = result;
+    float32x4x2_t a_val, acc;
+    float32x4_t wr, wi;
+    int n_vec;
+    unsigned int number;
+    unsigned int n;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            acc.val[0] = vdupq_n_f32(0.0f);
+            acc.val[1] = vdupq_n_f32(0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    wr = vdupq_n_f32(lv_creal(weights[n_vec]));
+                    wi = vdupq_n_f32(lv_cimag(weights[n_vec]));
+                    a_val = vld2q_f32((const float32_t*)&(_in_a[n_vec][number * 4]));
+                    __VOLK_GNSSSDR_PREFETCH(&(_in_a[n_vec][number * 4 + 8]));
+                    acc.val[0] = vmlaq_f32(acc.val[0], a_val.val[0], wr);
+                    acc.val[0] = vmlsq_f32(acc.val[0], a_val.val[1], wi);
+                    acc.val[1] = vmlaq_f32(acc.val[1], a_val.val[0], wi);
+                    acc.val[1] = vmlaq_f32(acc.val[1], a_val.val[1], wr);
+                }
+            vst2q_f32((float32_t*)_result, acc);
+            _result += 4;
+        }
+
+    for (n = neon_iters * 4; n < num_points; n++)
+        {
+            result[n] = lv_cmake(0.0f, 0.0f);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    result[n] += weights[n_vec] * in_a[n_vec][n];
+                }
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H */
@@ -0,0 +1,188 @@
+/*!
+ * \file volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc.h
+ * \brief VOLK_GNSSSDR puppet for the multiple vector weighted sum kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the multiple vector weighted sum kernel
+ * into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_xn_weighted_sum_32fc.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <string.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_generic(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_generic(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // Generic
+
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_u_sse3(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_sse3(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // SSE3
+
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_a_sse3(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_a_sse3(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // SSE3
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_u_avx(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // AVX
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_a_avx(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_a_avx(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // AVX
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_neon(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    int n;
+    int num_a_vectors = 3;
+    lv_32fc_t weights[3];
+    weights[0] = lv_cmake(0.5f, 0.1f);
+    weights[1] = lv_cmake(-0.2f, 0.3f);
+    weights[2] = lv_cmake(0.7f, -0.4f);
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memcpy((lv_32fc_t*)in_a[n], (lv_32fc_t*)in, sizeof(lv_32fc_t) * num_points);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_neon(result, (const lv_32fc_t**)in_a, weights, num_a_vectors, num_points);
+
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+#endif  // NEON
+
+#endif  // INCLUDED_volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc_H
@@ -0,0 +1,296 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bit_16i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks bytes holding four 2-bit samples each
+ * into 16-bit samples.
+ *
+ * VOLK_GNSSSDR kernel that decodes a vector of bytes, each one holding four
+ * 2-bit signed samples, into a vector of 16-bit integers, with the order of
+ * the samples within the byte given by a parameter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack2bit_16i
+ *
+ * \b Overview
+ *
+ * Same as volk_gnsssdr_8u_unpack2bit_8i, with 16-bit output samples. It
+ * unpacks front-ends delivering 2-bit I and Q samples directly into
+ * interleaved 16-bit complex samples.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack2bit_16i(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed bytes
+ * \li sample_order: Field of each of the four output samples of a byte
+ * \li num_bytes: Number of bytes to be unpacked
+ *
+ * \b Outputs
+ * \li result: Unpacked samples, four per input byte
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bit_16i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bit_16i_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_generic(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const int16_t levels[4] = {1, 3, -3, -1};
+    unsigned int shifts[4];
+    unsigned int k;
+    unsigned int n;
+    for (k = 0; k < 4; k++)
+        {
+            shifts[k] = 2 * ((sample_order >> (2 * k)) & 3);
+        }
+    for (n = 0; n < num_bytes; n++)
+        {
+            const uint8_t byte = packed[n];
+            for (k = 0; k < 4; k++)
+                {
+                    *result++ = levels[(byte >> shifts[k]) & 3];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_u_ssse3(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i samples[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+    unsigned int k;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_loadu_si128((const __m128i*)packed);
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            samples[0] = _mm_unpacklo_epi16(lo01, lo23);
+            samples[1] = _mm_unpackhi_epi16(lo01, lo23);
+            samples[2] = _mm_unpacklo_epi16(hi01, hi23);
+            samples[3] = _mm_unpackhi_epi16(hi01, hi23);
+            // Sign extension to 16 bits
+            for (k = 0; k < 4; k++)
+                {
+                    _mm_storeu_si128((__m128i*)result, _mm_srai_epi16(_mm_unpacklo_epi8(samples[k], samples[k]), 8));
+                    _mm_storeu_si128((__m128i*)(result + 8), _mm_srai_epi16(_mm_unpackhi_epi8(samples[k], samples[k]), 8));
+                    result += 16;
+                }
+            packed += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_a_ssse3(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i samples[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+    unsigned int k;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_load_si128((const __m128i*)packed);
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            samples[0] = _mm_unpacklo_epi16(lo01, lo23);
+            samples[1] = _mm_unpackhi_epi16(lo01, lo23);
+            samples[2] = _mm_unpacklo_epi16(hi01, hi23);
+            samples[3] = _mm_unpackhi_epi16(hi01, hi23);
+            for (k = 0; k < 4; k++)
+                {
+                    _mm_store_si128((__m128i*)result, _mm_srai_epi16(_mm_unpacklo_epi8(samples[k], samples[k]), 8));
+                    _mm_store_si128((__m128i*)(result + 8), _mm_srai_epi16(_mm_unpackhi_epi8(samples[k], samples[k]), 8));
+                    result += 16;
+                }
+            packed += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_u_avx2(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm_loadu_si128((const __m128i*)packed);
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            // Sign extension of 16 samples at once
+            _mm256_storeu_si256((__m256i*)result, _mm256_cvtepi8_epi16(_mm_unpacklo_epi16(lo01, lo23)));
+            _mm256_storeu_si256((__m256i*)(result + 16), _mm256_cvtepi8_epi16(_mm_unpackhi_epi16(lo01, lo23)));
+            _mm256_storeu_si256((__m256i*)(result + 32), _mm256_cvtepi8_epi16(_mm_unpacklo_epi16(hi01, hi23)));
+            _mm256_storeu_si256((__m256i*)(result + 48), _mm256_cvtepi8_epi16(_mm_unpackhi_epi16(hi01, hi23)));
+            packed += 16;
+            result += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_bytes - avx2_iters * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_a_avx2(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm_load_si128((const __m128i*)packed);
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            _mm256_store_si256((__m256i*)result, _mm256_cvtepi8_epi16(_mm_unpacklo_epi16(lo01, lo23)));
+            _mm256_store_si256((__m256i*)(result + 16), _mm256_cvtepi8_epi16(_mm_unpackhi_epi16(lo01, lo23)));
+            _mm256_store_si256((__m256i*)(result + 32), _mm256_cvtepi8_epi16(_mm_unpacklo_epi16(hi01, hi23)));
+            _mm256_store_si256((__m256i*)(result + 48), _mm256_cvtepi8_epi16(_mm_unpackhi_epi16(hi01, hi23)));
+            packed += 16;
+            result += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_bytes - avx2_iters * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_16i_neon(int16_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int neon_iters = num_bytes / 8;
+    const int8_t levels_array[8] = {1, 3, -3, -1, 0, 0, 0, 0};
+    const int8x8_t levels = vld1_s8(levels_array);
+    const uint8x8_t mask = vdup_n_u8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    int8x8_t fields[4];
+    int16x8x4_t samples;
+    uint8x8_t x;
+    unsigned int i;
+
+    for (i = 0; i < neon_iters; i++)
+        {
+            x = vld1_u8(packed);
+            __VOLK_GNSSSDR_PREFETCH(packed + 16);
+            fields[0] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(x, mask)));
+            fields[1] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(vshr_n_u8(x, 2), mask)));
+            fields[2] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(vshr_n_u8(x, 4), mask)));
+            fields[3] = vtbl1_s8(levels, vreinterpret_s8_u8(vshr_n_u8(x, 6)));
+            samples.val[0] = vmovl_s8(fields[order0]);
+            samples.val[1] = vmovl_s8(fields[order1]);
+            samples.val[2] = vmovl_s8(fields[order2]);
+            samples.val[3] = vmovl_s8(fields[order3]);
+            vst4q_s16(result, samples);
+            packed += 8;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_bytes - neon_iters * 8);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bit_16i_H */
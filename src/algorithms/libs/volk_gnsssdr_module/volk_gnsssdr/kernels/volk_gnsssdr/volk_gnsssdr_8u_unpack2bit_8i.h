@@ -0,0 +1,299 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks bytes holding four 2-bit samples each
+ * into 8-bit samples.
+ *
+ * VOLK_GNSSSDR kernel that decodes a vector of bytes, each one holding four
+ * 2-bit signed samples, into a vector of 8-bit integers, with the order of the
+ * samples within the byte given by a parameter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack2bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding four 2-bit samples each. The 2-bit field number k of
+ * a byte is made of its bits 2k and 2k+1, and it is read as a signed integer
+ * s in [-2, 1], which is decoded as the odd level 2s+1 (that is, 1, 3, -3 or
+ * -1). The four samples of each byte are written in the order given by
+ * sample_order: output sample k takes the field (sample_order >> 2k) & 3. For
+ * instance, 0xE4 writes the fields from the least significant to the most
+ * significant one, and 0x1B writes them in reverse order.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack2bit_8i(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed bytes
+ * \li sample_order: Field of each of the four output samples of a byte
+ * \li num_bytes: Number of bytes to be unpacked
+ *
+ * \b Outputs
+ * \li result: Unpacked samples, four per input byte
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_generic(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const int8_t levels[4] = {1, 3, -3, -1};
+    unsigned int shifts[4];
+    unsigned int k;
+    unsigned int n;
+    for (k = 0; k < 4; k++)
+        {
+            shifts[k] = 2 * ((sample_order >> (2 * k)) & 3);
+        }
+    for (n = 0; n < num_bytes; n++)
+        {
+            const uint8_t byte = packed[n];
+            for (k = 0; k < 4; k++)
+                {
+                    *result++ = levels[(byte >> shifts[k]) & 3];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_u_ssse3(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_loadu_si128((const __m128i*)packed);
+            // Decoded level of each field, through the lookup table
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            // Interleaving of the four samples of each byte
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            _mm_storeu_si128((__m128i*)result, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_storeu_si128((__m128i*)(result + 16), _mm_unpackhi_epi16(lo01, lo23));
+            _mm_storeu_si128((__m128i*)(result + 32), _mm_unpacklo_epi16(hi01, hi23));
+            _mm_storeu_si128((__m128i*)(result + 48), _mm_unpackhi_epi16(hi01, hi23));
+            packed += 16;
+            result += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_generic(result, packed, sample_order, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_a_ssse3(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask = _mm_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m128i fields[4];
+    __m128i x, lo01, hi01, lo23, hi23;
+    unsigned int i;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_load_si128((const __m128i*)packed);
+            fields[0] = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            fields[1] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 2), mask));
+            fields[2] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            fields[3] = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 6), mask));
+            lo01 = _mm_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm_unpackhi_epi8(fields[order2], fields[order3]);
+            _mm_store_si128((__m128i*)result, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_store_si128((__m128i*)(result + 16), _mm_unpackhi_epi16(lo01, lo23));
+            _mm_store_si128((__m128i*)(result + 32), _mm_unpacklo_epi16(hi01, hi23));
+            _mm_store_si128((__m128i*)(result + 48), _mm_unpackhi_epi16(hi01, hi23));
+            packed += 16;
+            result += 64;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_generic(result, packed, sample_order, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_u_avx2(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 32;
+    const __m256i levels = _mm256_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask = _mm256_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m256i fields[4];
+    __m256i x, lo01, hi01, lo23, hi23, out0, out1, out2, out3;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm256_loadu_si256((const __m256i*)packed);
+            fields[0] = _mm256_shuffle_epi8(levels, _mm256_and_si256(x, mask));
+            fields[1] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 2), mask));
+            fields[2] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+            fields[3] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 6), mask));
+            lo01 = _mm256_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm256_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm256_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm256_unpackhi_epi8(fields[order2], fields[order3]);
+            // The unpacking works within each 128-bit lane, so the lanes of
+            // the results hold the bytes [0-3|16-19], [4-7|20-23], [8-11|24-27] and [12-15|28-31]
+            out0 = _mm256_unpacklo_epi16(lo01, lo23);
+            out1 = _mm256_unpackhi_epi16(lo01, lo23);
+            out2 = _mm256_unpacklo_epi16(hi01, hi23);
+            out3 = _mm256_unpackhi_epi16(hi01, hi23);
+            _mm256_storeu_si256((__m256i*)result, _mm256_permute2x128_si256(out0, out1, 0x20));
+            _mm256_storeu_si256((__m256i*)(result + 32), _mm256_permute2x128_si256(out2, out3, 0x20));
+            _mm256_storeu_si256((__m256i*)(result + 64), _mm256_permute2x128_si256(out0, out1, 0x31));
+            _mm256_storeu_si256((__m256i*)(result + 96), _mm256_permute2x128_si256(out2, out3, 0x31));
+            packed += 32;
+            result += 128;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_generic(result, packed, sample_order, num_bytes - avx2_iters * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_a_avx2(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 32;
+    const __m256i levels = _mm256_setr_epi8(1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask = _mm256_set1_epi8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    __m256i fields[4];
+    __m256i x, lo01, hi01, lo23, hi23, out0, out1, out2, out3;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm256_load_si256((const __m256i*)packed);
+            fields[0] = _mm256_shuffle_epi8(levels, _mm256_and_si256(x, mask));
+            fields[1] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 2), mask));
+            fields[2] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+            fields[3] = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 6), mask));
+            lo01 = _mm256_unpacklo_epi8(fields[order0], fields[order1]);
+            hi01 = _mm256_unpackhi_epi8(fields[order0], fields[order1]);
+            lo23 = _mm256_unpacklo_epi8(fields[order2], fields[order3]);
+            hi23 = _mm256_unpackhi_epi8(fields[order2], fields[order3]);
+            out0 = _mm256_unpacklo_epi16(lo01, lo23);
+            out1 = _mm256_unpackhi_epi16(lo01, lo23);
+            out2 = _mm256_unpacklo_epi16(hi01, hi23);
+            out3 = _mm256_unpackhi_epi16(hi01, hi23);
+            _mm256_store_si256((__m256i*)result, _mm256_permute2x128_si256(out0, out1, 0x20));
+            _mm256_store_si256((__m256i*)(result + 32), _mm256_permute2x128_si256(out2, out3, 0x20));
+            _mm256_store_si256((__m256i*)(result + 64), _mm256_permute2x128_si256(out0, out1, 0x31));
+            _mm256_store_si256((__m256i*)(result + 96), _mm256_permute2x128_si256(out2, out3, 0x31));
+            packed += 32;
+            result += 128;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_generic(result, packed, sample_order, num_bytes - avx2_iters * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_8i_neon(int8_t* result, const uint8_t* packed, unsigned int sample_order, unsigned int num_bytes)
+{
+    const unsigned int neon_iters = num_bytes / 8;
+    const int8_t levels_array[8] = {1, 3, -3, -1, 0, 0, 0, 0};
+    const int8x8_t levels = vld1_s8(levels_array);
+    const uint8x8_t mask = vdup_n_u8(3);
+    const unsigned int order0 = sample_order & 3;
+    const unsigned int order1 = (sample_order >> 2) & 3;
+    const unsigned int order2 = (sample_order >> 4) & 3;
+    const unsigned int order3 = (sample_order >> 6) & 3;
+    int8x8_t fields[4];
+    int8x8x4_t samples;
+    uint8x8_t x;
+    unsigned int i;
+
+    for (i = 0; i < neon_iters; i++)
+        {
+            x = vld1_u8(packed);
+            __VOLK_GNSSSDR_PREFETCH(packed + 16);
+            fields[0] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(x, mask)));
+            fields[1] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(vshr_n_u8(x, 2), mask)));
+            fields[2] = vtbl1_s8(levels, vreinterpret_s8_u8(vand_u8(vshr_n_u8(x, 4), mask)));
+            fields[3] = vtbl1_s8(levels, vreinterpret_s8_u8(vshr_n_u8(x, 6)));
+            // The interleaved store writes the four samples of each byte together
+            samples.val[0] = fields[order0];
+            samples.val[1] = fields[order1];
+            samples.val[2] = fields[order2];
+            samples.val[3] = fields[order3];
+            vst4_s8(result, samples);
+            packed += 8;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_8i_generic(result, packed, sample_order, num_bytes - neon_iters * 8);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bit_8i_H */
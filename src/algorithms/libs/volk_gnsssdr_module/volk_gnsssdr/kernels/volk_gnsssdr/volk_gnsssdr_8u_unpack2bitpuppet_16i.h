@@ -0,0 +1,84 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bitpuppet_16i.h
+ * \brief VOLK_GNSSSDR puppet for the 2-bit unpacking kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the 2-bit unpacking kernel into the
+ * test system. num_points is the number of output samples.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bitpuppet_16i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bitpuppet_16i_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_unpack2bit_16i.h"
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_generic(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_generic(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_u_ssse3(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_u_ssse3(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_a_ssse3(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_a_ssse3(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_u_avx2(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_u_avx2(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_a_avx2(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_a_avx2(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_8u_unpack2bitpuppet_16i_neon(int16_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    // I and Q samples in swapped pairs, as in some front-ends
+    const unsigned int sample_order = 0x4E;
+    volk_gnsssdr_8u_unpack2bit_16i_neon(result, packed, sample_order, num_points / 4);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bitpuppet_16i_H */
@@ -0,0 +1,218 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack4bit_16i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks bytes holding two 4-bit samples each
+ * into 16-bit samples.
+ *
+ * VOLK_GNSSSDR kernel that decodes a vector of bytes, each one holding two
+ * 4-bit signed samples, into a vector of 16-bit integers.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack4bit_16i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding two 4-bit samples each, the least significant nibble
+ * first. Each nibble is read as a signed integer s in [-8, 7], which is
+ * decoded as the odd level 2s+1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack4bit_16i(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed bytes
+ * \li num_bytes: Number of bytes to be unpacked
+ *
+ * \b Outputs
+ * \li result: Unpacked samples, two per input byte
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack4bit_16i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack4bit_16i_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_generic(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    unsigned int n;
+    for (n = 0; n < num_bytes; n++)
+        {
+            const int low = packed[n] & 0x0F;
+            const int high = packed[n] >> 4;
+            *result++ = (int16_t)(2 * (low >= 8 ? low - 16 : low) + 1);
+            *result++ = (int16_t)(2 * (high >= 8 ? high - 16 : high) + 1);
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_u_ssse3(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i x, low, high, lo, hi;
+    unsigned int i;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_loadu_si128((const __m128i*)packed);
+            low = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            high = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            lo = _mm_unpacklo_epi8(low, high);
+            hi = _mm_unpackhi_epi8(low, high);
+            // Sign extension to 16 bits
+            _mm_storeu_si128((__m128i*)result, _mm_srai_epi16(_mm_unpacklo_epi8(lo, lo), 8));
+            _mm_storeu_si128((__m128i*)(result + 8), _mm_srai_epi16(_mm_unpackhi_epi8(lo, lo), 8));
+            _mm_storeu_si128((__m128i*)(result + 16), _mm_srai_epi16(_mm_unpacklo_epi8(hi, hi), 8));
+            _mm_storeu_si128((__m128i*)(result + 24), _mm_srai_epi16(_mm_unpackhi_epi8(hi, hi), 8));
+            packed += 16;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_16i_generic(result, packed, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_a_ssse3(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    const unsigned int sse_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i x, low, high, lo, hi;
+    unsigned int i;
+
+    for (i = 0; i < sse_iters; i++)
+        {
+            x = _mm_load_si128((const __m128i*)packed);
+            low = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            high = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            lo = _mm_unpacklo_epi8(low, high);
+            hi = _mm_unpackhi_epi8(low, high);
+            _mm_store_si128((__m128i*)result, _mm_srai_epi16(_mm_unpacklo_epi8(lo, lo), 8));
+            _mm_store_si128((__m128i*)(result + 8), _mm_srai_epi16(_mm_unpackhi_epi8(lo, lo), 8));
+            _mm_store_si128((__m128i*)(result + 16), _mm_srai_epi16(_mm_unpacklo_epi8(hi, hi), 8));
+            _mm_store_si128((__m128i*)(result + 24), _mm_srai_epi16(_mm_unpackhi_epi8(hi, hi), 8));
+            packed += 16;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_16i_generic(result, packed, num_bytes - sse_iters * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_u_avx2(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i x, low, high;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm_loadu_si128((const __m128i*)packed);
+            low = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            high = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            _mm256_storeu_si256((__m256i*)result, _mm256_cvtepi8_epi16(_mm_unpacklo_epi8(low, high)));
+            _mm256_storeu_si256((__m256i*)(result + 16), _mm256_cvtepi8_epi16(_mm_unpackhi_epi8(low, high)));
+            packed += 16;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_16i_generic(result, packed, num_bytes - avx2_iters * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_a_avx2(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    const unsigned int avx2_iters = num_bytes / 16;
+    const __m128i levels = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i x, low, high;
+    unsigned int i;
+
+    for (i = 0; i < avx2_iters; i++)
+        {
+            x = _mm_load_si128((const __m128i*)packed);
+            low = _mm_shuffle_epi8(levels, _mm_and_si128(x, mask));
+            high = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+            _mm256_store_si256((__m256i*)result, _mm256_cvtepi8_epi16(_mm_unpacklo_epi8(low, high)));
+            _mm256_store_si256((__m256i*)(result + 16), _mm256_cvtepi8_epi16(_mm_unpackhi_epi8(low, high)));
+            packed += 16;
+            result += 32;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_16i_generic(result, packed, num_bytes - avx2_iters * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_16i_neon(int16_t* result, const uint8_t* packed, unsigned int num_bytes)
+{
+    const unsigned int neon_iters = num_bytes / 8;
+    const int8_t levels_array[16] = {1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1};
+    int8x8x2_t levels;
+    const uint8x8_t mask = vdup_n_u8(0x0F);
+    int16x8x2_t samples;
+    uint8x8_t x;
+    unsigned int i;
+
+    levels.val[0] = vld1_s8(levels_array);
+    levels.val[1] = vld1_s8(levels_array + 8);
+    for (i = 0; i < neon_iters; i++)
+        {
+            x = vld1_u8(packed);
+            __VOLK_GNSSSDR_PREFETCH(packed + 16);
+            samples.val[0] = vmovl_s8(vtbl2_s8(levels, vreinterpret_s8_u8(vand_u8(x, mask))));
+            samples.val[1] = vmovl_s8(vtbl2_s8(levels, vreinterpret_s8_u8(vshr_n_u8(x, 4))));
+            vst2q_s16(result, samples);
+            packed += 8;
+            result += 16;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_16i_generic(result, packed, num_bytes - neon_iters * 8);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack4bit_16i_H */
@@ -87,6 +87,10 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_x2_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn, test_params_inacc))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, test_params_inacc));
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_high_dynamic_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpack2bitpuppet_8i, volk_gnsssdr_8u_unpack2bit_8i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpack2bitpuppet_16i, volk_gnsssdr_8u_unpack2bit_16i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpack4bitpuppet_16i, volk_gnsssdr_8u_unpack4bit_16i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_xn_weightedsumpuppet_32fc, volk_gnsssdr_32fc_xn_weighted_sum_32fc, test_params_inacc))
 
     return test_cases;
 }
@@ -7,10 +7,20 @@
  *
  */
 
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE  // for MAP_ANONYMOUS, MAP_HUGETLB and MADV_HUGEPAGE
+#endif
+
 #include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 /*
  * C11 features:
@@ -85,3 +95,500 @@ void volk_gnsssdr_free(void *ptr)
     free(ptr);
 #endif
 }
+
+
+/*
+ * Buffers of volk_gnsssdr_buffer_malloc.
+ *
+ * Without a buffer policy, or outside Linux, buffers are plain aligned
+ * allocations, without locks or headers.
+ *
+ * With a policy, buffers live in mapped regions: one regular page, which
+ * holds the descriptor of the region, followed by a body that starts at a
+ * hugepage boundary. Buffers of at least half a hugepage get a region of
+ * their own, whose body is the buffer rounded up to whole hugepages. Smaller
+ * buffers are slots of slabs: regions of one hugepage split in slots of a
+ * power-of-two size class, which are aligned to their size. Freed slots are
+ * reused by the next buffers of the same class, and a slab is unmapped once
+ * all its slots are free, except for one spare empty slab per class. Freed
+ * buffers with a region of their own can be kept in a pool, and are reused
+ * by buffers of the same number of hugepages.
+ *
+ * volk_gnsssdr_buffer_free finds the region of a buffer in a table sorted by
+ * address. If there are no regions, it frees the buffer without the lock.
+ */
+
+#define VOLK_GNSSSDR_CACHE_LINE_SIZE 64
+
+#if defined(__linux__)
+
+#define VOLK_GNSSSDR_SLAB_CLASSES 15 /* slots of 64 bytes to half a hugepage */
+
+typedef struct volk_gnsssdr_region
+{
+    struct volk_gnsssdr_region *prev; /* previous slab of the class with free slots */
+    struct volk_gnsssdr_region *next; /* next slab of the class with free slots, or next region in the pool */
+    char *body;                       /* first byte of the body, at a hugepage boundary */
+    size_t body_length;               /* bytes of the body */
+    size_t size;                      /* bytes requested, for a region of its own */
+    size_t slot_size;                 /* size class of a slab, 0 for a region of its own */
+    size_t slots;                     /* number of slots of a slab */
+    size_t used_slots;                /* slots in use */
+    size_t carved_slots;              /* slots handed out at least once */
+    void *free_slots;                 /* list of freed slots */
+    int slab_class;                   /* index of the size class of a slab */
+    int hugepages;                    /* backed by hugepages */
+} volk_gnsssdr_region_t;
+
+static volk_gnsssdr_region_t **volk_gnsssdr_regions = NULL; /* sorted by body address */
+static size_t volk_gnsssdr_region_count = 0;                /* read without the lock by volk_gnsssdr_buffer_free */
+static size_t volk_gnsssdr_region_capacity = 0;
+static volk_gnsssdr_region_t *volk_gnsssdr_slabs[VOLK_GNSSSDR_SLAB_CLASSES]; /* slabs with free slots */
+static int volk_gnsssdr_empty_slabs[VOLK_GNSSSDR_SLAB_CLASSES];
+static volk_gnsssdr_region_t *volk_gnsssdr_buffer_pool = NULL;
+static size_t volk_gnsssdr_buffer_pool_capacity = 0;
+static unsigned int volk_gnsssdr_buffer_flags = 0; /* read without the lock by volk_gnsssdr_buffer_malloc */
+static volk_gnsssdr_buffer_stats_t volk_gnsssdr_buffer_stats;
+static pthread_mutex_t volk_gnsssdr_buffer_lock = PTHREAD_MUTEX_INITIALIZER;
+
+
+/*
+ * Maps length bytes, a multiple of the hugepage size, starting at a hugepage
+ * boundary, preceded by head_length bytes, a multiple of the page size, of
+ * regular pages. The body is backed by transparent hugepages if
+ * VOLK_GNSSSDR_BUFFER_HUGEPAGES is set in flags, and by the reserved
+ * hugepages if VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES is. Returns the start
+ * of the mapping.
+ */
+static char *volk_gnsssdr_map_region(size_t length, size_t head_length, unsigned int flags)
+{
+    const uintptr_t hugepage_size = VOLK_GNSSSDR_HUGEPAGE_SIZE;
+    const size_t reserved = head_length + length + hugepage_size;
+    char *region;
+    char *aligned;
+    char *start;
+
+    // Transparent hugepages only back regions aligned to the hugepage size
+    region = (char *)mmap(NULL, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void *)region == MAP_FAILED)
+        {
+            return NULL;
+        }
+    aligned = (char *)(((uintptr_t)region + head_length + hugepage_size - 1) & ~(hugepage_size - 1));
+    start = aligned - head_length;
+    if (start > region)
+        {
+            munmap(region, (size_t)(start - region));
+        }
+    if (region + reserved > aligned + length)
+        {
+            munmap(aligned + length, (size_t)(region + reserved - (aligned + length)));
+        }
+#ifdef MAP_HUGETLB
+    if (flags & VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES)
+        {
+            // Replaces the regular pages after the head. If there are no
+            // hugepages left, they are mapped again as regular pages.
+            if (mmap(aligned, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0) != MAP_FAILED)
+                {
+                    return start;
+                }
+            if (mmap(aligned, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)
+                {
+                    munmap(start, head_length + length);
+                    return NULL;
+                }
+        }
+#endif
+#ifdef MADV_HUGEPAGE
+    if (flags & (VOLK_GNSSSDR_BUFFER_HUGEPAGES | VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES))
+        {
+            madvise(aligned, length, MADV_HUGEPAGE);
+        }
+#endif
+    return start;
+}
+
+
+/*
+ * Maps a region with a body of body_length bytes, and adds it to the table.
+ * Called with the lock held.
+ */
+static volk_gnsssdr_region_t *volk_gnsssdr_region_create(size_t body_length, unsigned int flags)
+{
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    volk_gnsssdr_region_t *region;
+    char *start;
+    size_t n;
+
+    if (volk_gnsssdr_region_count == volk_gnsssdr_region_capacity)
+        {
+            const size_t capacity = volk_gnsssdr_region_capacity ? 2 * volk_gnsssdr_region_capacity : 64;
+            volk_gnsssdr_region_t **regions = (volk_gnsssdr_region_t **)realloc(volk_gnsssdr_regions, capacity * sizeof(volk_gnsssdr_region_t *));
+            if (regions == NULL)
+                {
+                    return NULL;
+                }
+            volk_gnsssdr_regions = regions;
+            volk_gnsssdr_region_capacity = capacity;
+        }
+    start = volk_gnsssdr_map_region(body_length, page_size, flags);
+    if (start == NULL)
+        {
+            return NULL;
+        }
+    region = (volk_gnsssdr_region_t *)start;
+    memset(region, 0, sizeof(volk_gnsssdr_region_t));
+    region->body = start + page_size;
+    region->body_length = body_length;
+    region->hugepages = (flags & (VOLK_GNSSSDR_BUFFER_HUGEPAGES | VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES)) != 0;
+
+    n = volk_gnsssdr_region_count;
+    while (n > 0 && volk_gnsssdr_regions[n - 1]->body > region->body)
+        {
+            volk_gnsssdr_regions[n] = volk_gnsssdr_regions[n - 1];
+            n--;
+        }
+    volk_gnsssdr_regions[n] = region;
+    __atomic_store_n(&volk_gnsssdr_region_count, volk_gnsssdr_region_count + 1, __ATOMIC_RELEASE);
+    volk_gnsssdr_buffer_stats.mapped_bytes += page_size + body_length;
+    return region;
+}
+
+
+/*
+ * Removes a region from the table and unmaps it. Called with the lock held.
+ */
+static void volk_gnsssdr_region_destroy(volk_gnsssdr_region_t *region)
+{
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t length = page_size + region->body_length;
+    size_t n = 0;
+    while (volk_gnsssdr_regions[n] != region)
+        {
+            n++;
+        }
+    for (; n + 1 < volk_gnsssdr_region_count; n++)
+        {
+            volk_gnsssdr_regions[n] = volk_gnsssdr_regions[n + 1];
+        }
+    __atomic_store_n(&volk_gnsssdr_region_count, volk_gnsssdr_region_count - 1, __ATOMIC_RELEASE);
+    volk_gnsssdr_buffer_stats.mapped_bytes -= length;
+    munmap(region->body - page_size, length);
+}
+
+
+/*
+ * Returns the region that holds ptr, or NULL. Called with the lock held.
+ */
+static volk_gnsssdr_region_t *volk_gnsssdr_region_find(const char *ptr)
+{
+    size_t low = 0;
+    size_t high = volk_gnsssdr_region_count;
+    while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            if (volk_gnsssdr_regions[middle]->body <= ptr)
+                {
+                    low = middle + 1;
+                }
+            else
+                {
+                    high = middle;
+                }
+        }
+    if (low > 0 && ptr < volk_gnsssdr_regions[low - 1]->body + volk_gnsssdr_regions[low - 1]->body_length)
+        {
+            return volk_gnsssdr_regions[low - 1];
+        }
+    return NULL;
+}
+
+
+static void volk_gnsssdr_slab_unlink(volk_gnsssdr_region_t *slab)
+{
+    if (slab->prev != NULL)
+        {
+            slab->prev->next = slab->next;
+        }
+    else
+        {
+            volk_gnsssdr_slabs[slab->slab_class] = slab->next;
+        }
+    if (slab->next != NULL)
+        {
+            slab->next->prev = slab->prev;
+        }
+    slab->prev = NULL;
+    slab->next = NULL;
+}
+
+
+static void volk_gnsssdr_slab_link(volk_gnsssdr_region_t *slab)
+{
+    slab->prev = NULL;
+    slab->next = volk_gnsssdr_slabs[slab->slab_class];
+    if (slab->next != NULL)
+        {
+            slab->next->prev = slab;
+        }
+    volk_gnsssdr_slabs[slab->slab_class] = slab;
+}
+
+
+/*
+ * Takes a slot of the given class, mapping a new slab if no slab of the class
+ * has free slots. Called with the lock held.
+ */
+static void *volk_gnsssdr_slab_take(int slab_class, unsigned int flags)
+{
+    volk_gnsssdr_region_t *slab = volk_gnsssdr_slabs[slab_class];
+    void *slot;
+    if (slab == NULL)
+        {
+            slab = volk_gnsssdr_region_create(VOLK_GNSSSDR_HUGEPAGE_SIZE, flags);
+            if (slab == NULL)
+                {
+                    return NULL;
+                }
+            slab->slab_class = slab_class;
+            slab->slot_size = (size_t)VOLK_GNSSSDR_CACHE_LINE_SIZE << slab_class;
+            slab->slots = VOLK_GNSSSDR_HUGEPAGE_SIZE / slab->slot_size;
+            volk_gnsssdr_slab_link(slab);
+        }
+    else if (slab->used_slots == 0)
+        {
+            volk_gnsssdr_empty_slabs[slab_class]--;
+        }
+    if (slab->free_slots != NULL)
+        {
+            slot = slab->free_slots;
+            slab->free_slots = *(void **)slot;
+            volk_gnsssdr_buffer_stats.pool_hits++;
+        }
+    else
+        {
+            slot = slab->body + slab->carved_slots * slab->slot_size;
+            slab->carved_slots++;
+        }
+    slab->used_slots++;
+    if (slab->used_slots == slab->slots)
+        {
+            volk_gnsssdr_slab_unlink(slab);
+        }
+    volk_gnsssdr_buffer_stats.allocations++;
+    volk_gnsssdr_buffer_stats.hugepage_allocations += (size_t)slab->hugepages;
+    volk_gnsssdr_buffer_stats.bytes_in_use += slab->slot_size;
+    return slot;
+}
+
+
+/*
+ * Returns a slot to its slab, and unmaps the slab if it is empty and there
+ * is already a spare empty slab of its class. Called with the lock held.
+ */
+static void volk_gnsssdr_slab_give(volk_gnsssdr_region_t *slab, void *slot)
+{
+    if (slab->used_slots == slab->slots)
+        {
+            volk_gnsssdr_slab_link(slab);
+        }
+    *(void **)slot = slab->free_slots;
+    slab->free_slots = slot;
+    slab->used_slots--;
+    volk_gnsssdr_buffer_stats.deallocations++;
+    volk_gnsssdr_buffer_stats.bytes_in_use -= slab->slot_size;
+    if (slab->used_slots == 0)
+        {
+            if (volk_gnsssdr_empty_slabs[slab->slab_class] > 0)
+                {
+                    volk_gnsssdr_slab_unlink(slab);
+                    volk_gnsssdr_region_destroy(slab);
+                }
+            else
+                {
+                    volk_gnsssdr_empty_slabs[slab->slab_class]++;
+                }
+        }
+}
+
+
+/*
+ * Releases the spare empty slabs and the pooled regions that exceed the pool
+ * capacity. Called with the lock held.
+ */
+static void volk_gnsssdr_buffer_trim(void)
+{
+    int slab_class;
+    if (volk_gnsssdr_buffer_stats.pooled_bytes > volk_gnsssdr_buffer_pool_capacity)
+        {
+            while (volk_gnsssdr_buffer_pool != NULL)
+                {
+                    volk_gnsssdr_region_t *region = volk_gnsssdr_buffer_pool;
+                    volk_gnsssdr_buffer_pool = region->next;
+                    volk_gnsssdr_region_destroy(region);
+                }
+            volk_gnsssdr_buffer_stats.pooled_bytes = 0;
+        }
+    if (volk_gnsssdr_buffer_flags == 0)
+        {
+            for (slab_class = 0; slab_class < VOLK_GNSSSDR_SLAB_CLASSES; slab_class++)
+                {
+                    volk_gnsssdr_region_t *slab = volk_gnsssdr_slabs[slab_class];
+                    while (slab != NULL)
+                        {
+                            volk_gnsssdr_region_t *next = slab->next;
+                            if (slab->used_slots == 0)
+                                {
+                                    volk_gnsssdr_slab_unlink(slab);
+                                    volk_gnsssdr_region_destroy(slab);
+                                }
+                            slab = next;
+                        }
+                    volk_gnsssdr_empty_slabs[slab_class] = 0;
+                }
+        }
+}
+#endif
+
+
+void volk_gnsssdr_set_buffer_policy(unsigned int flags, size_t pool_capacity)
+{
+#if defined(__linux__)
+    pthread_mutex_lock(&volk_gnsssdr_buffer_lock);
+    __atomic_store_n(&volk_gnsssdr_buffer_flags, flags, __ATOMIC_RELEASE);
+    volk_gnsssdr_buffer_pool_capacity = (flags & VOLK_GNSSSDR_BUFFER_POOLED) ? pool_capacity : 0;
+    volk_gnsssdr_buffer_trim();
+    pthread_mutex_unlock(&volk_gnsssdr_buffer_lock);
+#else
+    (void)flags;
+    (void)pool_capacity;
+#endif
+}
+
+
+void *volk_gnsssdr_buffer_malloc(size_t size, size_t alignment)
+{
+    const size_t buffer_alignment = alignment > VOLK_GNSSSDR_CACHE_LINE_SIZE ? alignment : VOLK_GNSSSDR_CACHE_LINE_SIZE;
+#if defined(__linux__)
+    const unsigned int flags = __atomic_load_n(&volk_gnsssdr_buffer_flags, __ATOMIC_ACQUIRE);
+    void *ptr = NULL;
+    if ((flags != 0) && (size != 0) && (alignment != 0) && (buffer_alignment <= VOLK_GNSSSDR_HUGEPAGE_SIZE) && (size <= SIZE_MAX / 2))
+        {
+            pthread_mutex_lock(&volk_gnsssdr_buffer_lock);
+            if ((size < VOLK_GNSSSDR_HUGEPAGE_SIZE / 2) && (buffer_alignment < VOLK_GNSSSDR_HUGEPAGE_SIZE / 2))
+                {
+                    int slab_class = 0;
+                    while (((size_t)VOLK_GNSSSDR_CACHE_LINE_SIZE << slab_class) < size || ((size_t)VOLK_GNSSSDR_CACHE_LINE_SIZE << slab_class) < buffer_alignment)
+                        {
+                            slab_class++;
+                        }
+                    ptr = volk_gnsssdr_slab_take(slab_class, flags);
+                }
+            else
+                {
+                    // A region of its own, from the pool if there is one of
+                    // the same length
+                    const size_t body_length = size + (VOLK_GNSSSDR_HUGEPAGE_SIZE - size % VOLK_GNSSSDR_HUGEPAGE_SIZE) % VOLK_GNSSSDR_HUGEPAGE_SIZE;
+                    volk_gnsssdr_region_t **link = &volk_gnsssdr_buffer_pool;
+                    volk_gnsssdr_region_t *region = NULL;
+                    while (*link != NULL && (*link)->body_length != body_length)
+                        {
+                            link = &(*link)->next;
+                        }
+                    if (*link != NULL)
+                        {
+                            region = *link;
+                            *link = region->next;
+                            volk_gnsssdr_buffer_stats.pooled_bytes -= body_length;
+                            volk_gnsssdr_buffer_stats.pool_hits++;
+                        }
+                    else
+                        {
+                            region = volk_gnsssdr_region_create(body_length, flags);
+                        }
+                    if (region != NULL)
+                        {
+                            region->next = NULL;
+                            region->size = size;
+                            volk_gnsssdr_buffer_stats.allocations++;
+                            volk_gnsssdr_buffer_stats.hugepage_allocations += (size_t)region->hugepages;
+                            volk_gnsssdr_buffer_stats.bytes_in_use += size;
+                            ptr = region->body;
+                        }
+                }
+            if (volk_gnsssdr_buffer_stats.bytes_in_use > volk_gnsssdr_buffer_stats.peak_bytes_in_use)
+                {
+                    volk_gnsssdr_buffer_stats.peak_bytes_in_use = volk_gnsssdr_buffer_stats.bytes_in_use;
+                }
+            pthread_mutex_unlock(&volk_gnsssdr_buffer_lock);
+            if (ptr != NULL)
+                {
+                    return ptr;
+                }
+        }
+#endif
+    if ((size == 0) || (alignment == 0))
+        {
+            fprintf(stderr, "VOLK_GNSSSDR: Error allocating memory: either size or alignment is 0");
+            return NULL;
+        }
+    return volk_gnsssdr_malloc(size, buffer_alignment);
+}
+
+
+void volk_gnsssdr_buffer_free(void *ptr)
+{
+#if defined(__linux__)
+    if ((ptr != NULL) && (__atomic_load_n(&volk_gnsssdr_region_count, __ATOMIC_ACQUIRE) != 0))
+        {
+            volk_gnsssdr_region_t *region;
+            pthread_mutex_lock(&volk_gnsssdr_buffer_lock);
+            region = volk_gnsssdr_region_find((const char *)ptr);
+            if (region != NULL)
+                {
+                    if (region->slot_size != 0)
+                        {
+                            volk_gnsssdr_slab_give(region, ptr);
+                        }
+                    else
+                        {
+                            volk_gnsssdr_buffer_stats.deallocations++;
+                            volk_gnsssdr_buffer_stats.bytes_in_use -= region->size;
+                            if (volk_gnsssdr_buffer_stats.pooled_bytes + region->body_length <= volk_gnsssdr_buffer_pool_capacity)
+                                {
+                                    region->next = volk_gnsssdr_buffer_pool;
+                                    volk_gnsssdr_buffer_pool = region;
+                                    volk_gnsssdr_buffer_stats.pooled_bytes += region->body_length;
+                                }
+                            else
+                                {
+                                    volk_gnsssdr_region_destroy(region);
+                                }
+                        }
+                }
+            pthread_mutex_unlock(&volk_gnsssdr_buffer_lock);
+            if (region != NULL)
+                {
+                    return;
+                }
+        }
+#endif
+    volk_gnsssdr_free(ptr);
+}
+
+
+void volk_gnsssdr_get_buffer_stats(volk_gnsssdr_buffer_stats_t *stats)
+{
+    if (stats == NULL)
+        {
+            return;
+        }
+#if defined(__linux__)
+    pthread_mutex_lock(&volk_gnsssdr_buffer_lock);
+    *stats = volk_gnsssdr_buffer_stats;
+    pthread_mutex_unlock(&volk_gnsssdr_buffer_lock);
+#else
+    memset(stats, 0, sizeof(volk_gnsssdr_buffer_stats_t));
+#endif
+}
@@ -729,8 +729,9 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             // ************ end time tags **************
             for (int32_t m = 0; m < ninput_items[n]; m++)
                 {
-                    // Push the valid tracking Gnss_Synchros to their corresponding deque
-                    if (in[n][m].Flag_valid_word)
+                    // Push the valid tracking Gnss_Synchros to their corresponding deque.
+                    // Symbols of channels that lost the lock or coast without it are not valid.
+                    if (in[n][m].Flag_valid_word && in[n][m].Flag_valid_symbol_output)
                         {
                             if (std::string(in[n][m].Signal, 2) == std::string("E6"))
                                 {
@@ -0,0 +1,131 @@
+/*!
+ * \file polyphase_resampler_conditioner.cc
+ * \brief Implementation of an adapter of a polyphase resampler conditioner
+ * block to a SignalConditionerInterface
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_resampler_conditioner.h"
+#include "configuration_interface.h"
+#include "polyphase_resampler.h"
+#include <gnuradio/blocks/file_sink.h>
+#include <volk/volk.h>  // for lv_16sc_t
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+PolyphaseResamplerConditioner::PolyphaseResamplerConditioner(
+    const ConfigurationInterface* configuration,
+    const std::string& role,
+    unsigned int in_stream,
+    unsigned int out_stream)
+    : role_(role),
+      in_stream_(in_stream),
+      out_stream_(out_stream),
+      dump_(configuration->property(role + ".dump", false))
+{
+    const std::string default_item_type("gr_complex");
+    const std::string default_dump_file("./resampler.dat");
+    const double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000.0);
+    const double fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+    item_type_ = configuration->property(role + ".item_type", default_item_type);
+    dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
+    sample_freq_in_ = configuration->property(role_ + ".sample_freq_in", 4000000.0);
+    sample_freq_out_ = configuration->property(role_ + ".sample_freq_out", fs_in);
+    const int phases = configuration->property(role_ + ".phases", 32);
+    const int taps_per_phase = configuration->property(role_ + ".taps_per_phase", 0);
+    const double pass_band = configuration->property(role_ + ".pass_band", 0.8);
+
+    if (std::fabs(fs_in - sample_freq_out_) > std::numeric_limits<double>::epsilon())
+        {
+            std::string aux_warn = "CONFIGURATION WARNING: Parameters GNSS-SDR.internal_fs_sps and " + role_ + ".sample_freq_out are not set to the same value!";
+            LOG(WARNING) << aux_warn;
+            std::cout << aux_warn << '\n';
+        }
+
+    if (item_type_ == "cshort")
+        {
+            item_size_ = sizeof(lv_16sc_t);
+        }
+    else
+        {
+            if (item_type_ != "gr_complex")
+                {
+                    LOG(WARNING) << item_type_ << " unrecognized item type for resampler, using gr_complex";
+                }
+            item_size_ = sizeof(gr_complex);
+        }
+
+    const auto resampler = make_polyphase_resampler(item_size_, sample_freq_in_, sample_freq_out_, phases, taps_per_phase, pass_band);
+    std::cout << "Enabled polyphase resampler with " << phases << " phases of " << resampler->taps_per_phase() << " taps\n";
+    resampler_ = resampler;
+    DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
+    DLOG(INFO) << "sample_freq_out " << sample_freq_out_;
+    DLOG(INFO) << "Item size " << item_size_;
+    DLOG(INFO) << "resampler(" << resampler_->unique_id() << ")";
+
+    if (dump_)
+        {
+            DLOG(INFO) << "Dumping output into file " << dump_filename_;
+            file_sink_ = gr::blocks::file_sink::make(item_size_, dump_filename_.c_str());
+            DLOG(INFO) << "file_sink(" << file_sink_->unique_id() << ")";
+        }
+    if (in_stream_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_stream_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void PolyphaseResamplerConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            top_block->connect(resampler_, 0, file_sink_, 0);
+            DLOG(INFO) << "connected resampler to file sink";
+        }
+    else
+        {
+            DLOG(INFO) << "nothing to connect internally";
+        }
+}
+
+
+void PolyphaseResamplerConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (dump_)
+        {
+            top_block->disconnect(resampler_, 0, file_sink_, 0);
+        }
+}
+
+
+gr::basic_block_sptr PolyphaseResamplerConditioner::get_left_block()
+{
+    return resampler_;
+}
+
+
+gr::basic_block_sptr PolyphaseResamplerConditioner::get_right_block()
+{
+    return resampler_;
+}
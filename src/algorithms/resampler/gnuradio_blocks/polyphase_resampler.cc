@@ -0,0 +1,199 @@
+/*!
+ * \file polyphase_resampler.cc
+ * \brief Arbitrary ratio polyphase resampler with gr_complex or
+ *        std::complex<short> input and output
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_resampler.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+// Modified Bessel function of the first kind and order zero
+double bessel_i0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50; k++)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+            if (term < 1e-12 * sum)
+                {
+                    break;
+                }
+        }
+    return sum;
+}
+}  // namespace
+
+
+polyphase_resampler_sptr make_polyphase_resampler(
+    size_t item_size,
+    double sample_freq_in,
+    double sample_freq_out,
+    int phases,
+    int taps_per_phase,
+    double pass_band)
+{
+    return polyphase_resampler_sptr(
+        new polyphase_resampler(item_size,
+            sample_freq_in,
+            sample_freq_out,
+            phases,
+            taps_per_phase,
+            pass_band));
+}
+
+
+polyphase_resampler::polyphase_resampler(
+    size_t item_size,
+    double sample_freq_in,
+    double sample_freq_out,
+    int phases,
+    int taps_per_phase,
+    double pass_band)
+    : gr::block("polyphase_resampler",
+          gr::io_signature::make(1, 1, item_size),
+          gr::io_signature::make(1, 1, item_size)),
+      d_sample_freq_in(sample_freq_in),
+      d_sample_freq_out(sample_freq_out),
+      d_step(sample_freq_in / sample_freq_out),
+      d_mu(0.0),
+      d_offset(0),
+      d_item_size(item_size),
+      d_phases(std::max(phases, 1)),
+      d_taps_per_phase(taps_per_phase)
+{
+    // Frequencies normalized to the input sampling rate. The transition band
+    // ends where its alias would reach the pass band of the output.
+    const double ratio = std::min(1.0, sample_freq_out / sample_freq_in);
+    const double pass_edge = 0.5 * pass_band * ratio;
+    const double transition = ratio - 2.0 * pass_edge;
+    const double cutoff = 0.5 * ratio;
+    const double attenuation_db = 60.0;
+    const double beta = 0.1102 * (attenuation_db - 8.7);
+    if (d_taps_per_phase <= 0)
+        {
+            d_taps_per_phase = static_cast<int>(std::ceil((attenuation_db - 8.0) / (2.285 * 2.0 * M_PI * transition)));
+        }
+    d_taps_per_phase = std::max(4, d_taps_per_phase + (d_taps_per_phase % 2));
+
+    // Prototype sampled at phases times the input rate, with an odd number of
+    // taps so that it is symmetric around the center tap
+    const int length = d_taps_per_phase * d_phases + 1;
+    const double center = 0.5 * (length - 1);
+    std::vector<double> prototype(length);
+    for (int j = 0; j < length; j++)
+        {
+            const double t = (j - center) / d_phases;
+            const double x = 2.0 * cutoff * t;
+            const double sinc = (std::abs(x) < 1e-12) ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+            const double w = (j - center) / center;
+            prototype[j] = 2.0 * cutoff * sinc * bessel_i0(beta * std::sqrt(std::max(0.0, 1.0 - w * w))) / bessel_i0(beta);
+        }
+
+    // Phase p holds the taps for an output located p / phases input samples
+    // after the window, reversed so that they multiply the window in order.
+    // Each phase is normalized to unit gain at DC.
+    d_taps.resize(static_cast<size_t>(d_phases + 1) * d_taps_per_phase);
+    for (int p = 0; p <= d_phases; p++)
+        {
+            double sum = 0.0;
+            for (int k = 0; k < d_taps_per_phase; k++)
+                {
+                    sum += prototype[(d_taps_per_phase - 1 - k) * d_phases + p];
+                }
+            for (int k = 0; k < d_taps_per_phase; k++)
+                {
+                    d_taps[p * d_taps_per_phase + k] = static_cast<float>(prototype[(d_taps_per_phase - 1 - k) * d_phases + p] / sum);
+                }
+        }
+
+#ifdef GR_GREATER_38
+    this->set_relative_rate(static_cast<uint64_t>(sample_freq_out), static_cast<uint64_t>(sample_freq_in));
+#else
+    this->set_relative_rate(sample_freq_out / sample_freq_in);
+#endif
+}
+
+
+void polyphase_resampler::forecast(int noutput_items,
+    gr_vector_int &ninput_items_required)
+{
+    const int nreqd = static_cast<int>(std::ceil((noutput_items - 1) * d_step + d_mu)) + static_cast<int>(d_offset) + d_taps_per_phase;
+    std::fill(ninput_items_required.begin(), ninput_items_required.end(), nreqd);
+}
+
+
+int polyphase_resampler::resample(const gr_complex *in, int ninput_items, gr_complex *out, int noutput_items)
+{
+    const int64_t last_window = static_cast<int64_t>(ninput_items) - d_taps_per_phase;
+    int64_t window = d_offset;
+    int produced = 0;
+    lv_32fc_t y0;
+    lv_32fc_t y1;
+    while (produced < noutput_items && window <= last_window)
+        {
+            const double position = d_mu * d_phases;
+            const auto phase = static_cast<int>(position);
+            const auto frac = static_cast<float>(position - phase);
+            const float *taps = d_taps.data() + static_cast<size_t>(phase) * d_taps_per_phase;
+            volk_32fc_32f_dot_prod_32fc(&y0, in + window, taps, d_taps_per_phase);
+            volk_32fc_32f_dot_prod_32fc(&y1, in + window, taps + d_taps_per_phase, d_taps_per_phase);
+            out[produced++] = y0 + frac * (y1 - y0);
+
+            d_mu += d_step;
+            const double advance = std::floor(d_mu);
+            window += static_cast<int64_t>(advance);
+            d_mu -= advance;
+        }
+
+    // The samples of the next window stay in the buffer
+    const int64_t consumed = std::min(window, static_cast<int64_t>(ninput_items));
+    d_offset = window - consumed;
+    consume_each(static_cast<int>(consumed));
+    return produced;
+}
+
+
+int polyphase_resampler::general_work(int noutput_items,
+    gr_vector_int &ninput_items, gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    if (d_item_size == sizeof(gr_complex))
+        {
+            return resample(reinterpret_cast<const gr_complex *>(input_items[0]), ninput_items[0],
+                reinterpret_cast<gr_complex *>(output_items[0]), noutput_items);
+        }
+
+    // std::complex<short> items: convert the whole input and output once
+    if (d_input_buffer.size() < static_cast<size_t>(ninput_items[0]))
+        {
+            d_input_buffer.resize(ninput_items[0]);
+        }
+    if (d_output_buffer.size() < static_cast<size_t>(noutput_items))
+        {
+            d_output_buffer.resize(noutput_items);
+        }
+    volk_16i_s32f_convert_32f(reinterpret_cast<float *>(d_input_buffer.data()),
+        reinterpret_cast<const int16_t *>(input_items[0]), 1.0F, 2 * ninput_items[0]);
+    const int produced = resample(d_input_buffer.data(), ninput_items[0], d_output_buffer.data(), noutput_items);
+    volk_32f_s32f_convert_16i(reinterpret_cast<int16_t *>(output_items[0]),
+        reinterpret_cast<const float *>(d_output_buffer.data()), 1.0F, 2 * produced);
+    return produced;
+}
@@ -0,0 +1,123 @@
+/*!
+ * \file polyphase_resampler.h
+ * \brief Arbitrary ratio polyphase resampler with gr_complex or
+ *        std::complex<short> input and output
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_POLYPHASE_RESAMPLER_H
+#define GNSS_SDR_POLYPHASE_RESAMPLER_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <gnuradio/gr_complex.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+class polyphase_resampler;
+
+using polyphase_resampler_sptr = gnss_shared_ptr<polyphase_resampler>;
+
+/*!
+ * \brief Makes a polyphase resampler. item_size is either sizeof(gr_complex)
+ * or sizeof(lv_16sc_t). If taps_per_phase is zero, it is computed from the
+ * ratio and pass_band (fraction of the lowest Nyquist band that is kept)
+ * for 60 dB of stopband attenuation.
+ */
+polyphase_resampler_sptr make_polyphase_resampler(
+    size_t item_size,
+    double sample_freq_in,
+    double sample_freq_out,
+    int phases = 32,
+    int taps_per_phase = 0,
+    double pass_band = 0.8);
+
+/*!
+ * \brief This class implements a polyphase resampler for any ratio, rational
+ * or not.
+ *
+ * The low-pass prototype filter (Kaiser window) is split in phases + 1 sets of
+ * taps, computed at construction. Each output sample is the linear
+ * interpolation (first order Farrow structure) of the dot products of the
+ * input window with the two closest phases. With std::complex<short> items,
+ * the input is converted to float once per call and the output is rounded
+ * back with saturation.
+ */
+class polyphase_resampler : public gr::block
+{
+public:
+    ~polyphase_resampler() = default;
+
+    inline double sample_freq_in() const
+    {
+        return d_sample_freq_in;
+    }
+
+    inline double sample_freq_out() const
+    {
+        return d_sample_freq_out;
+    }
+
+    inline int taps_per_phase() const
+    {
+        return d_taps_per_phase;
+    }
+
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend polyphase_resampler_sptr make_polyphase_resampler(
+        size_t item_size,
+        double sample_freq_in,
+        double sample_freq_out,
+        int phases,
+        int taps_per_phase,
+        double pass_band);
+
+    polyphase_resampler(
+        size_t item_size,
+        double sample_freq_in,
+        double sample_freq_out,
+        int phases,
+        int taps_per_phase,
+        double pass_band);
+
+    int resample(const gr_complex *in, int ninput_items, gr_complex *out, int noutput_items);
+
+    std::vector<float> d_taps;  // (phases + 1) x taps_per_phase
+    std::vector<gr_complex> d_input_buffer;
+    std::vector<gr_complex> d_output_buffer;
+    double d_sample_freq_in;
+    double d_sample_freq_out;
+    double d_step;  // input samples per output sample
+    double d_mu;    // fractional position of the next output, in [0, 1)
+    int64_t d_offset;
+    size_t d_item_size;
+    int d_phases;
+    int d_taps_per_phase;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_POLYPHASE_RESAMPLER_H
@@ -18,6 +18,8 @@
 #include "custom_udp_signal_source.h"
 #include "configuration_interface.h"
 #include "gnss_sdr_string_literals.h"
+#include "gr_complex_udp_batch_source.h"
+#include <cstdint>
 #include <iostream>
 #include <utility>
 
@@ -61,14 +63,35 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
     const std::string sample_type = configuration->property(role + ".sample_type", default_sample_type);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
 
-    udp_gnss_rx_source_ = Gr_Complex_Ip_Packet_Source::make(capture_device,
-        address,
-        port,
-        payload_bytes,
-        channels_in_udp_,
-        sample_type,
-        item_size_,
-        IQ_swap_);
+    const std::string default_capture_mode("pcap");
+    const std::string capture_mode = configuration->property(role + ".capture_mode", default_capture_mode);
+    if (capture_mode == "recvmmsg" || capture_mode == "pcap_file")
+        {
+            const std::string pcap_filename = configuration->property(role + ".pcap_filename", std::string("./data/capture.pcap"));
+            const bool packet_counter = configuration->property(role + ".packet_counter", false);
+            const uint64_t ring_buffer_bytes = configuration->property(role + ".ring_buffer_bytes", static_cast<uint64_t>(64 * 1024 * 1024));
+            const int socket_buffer_bytes = configuration->property(role + ".socket_buffer_bytes", 64 * 1024 * 1024);
+            udp_gnss_rx_source_ = Gr_Complex_Udp_Batch_Source::make(capture_mode,
+                pcap_filename,
+                port,
+                channels_in_udp_,
+                sample_type,
+                IQ_swap_,
+                packet_counter,
+                ring_buffer_bytes,
+                socket_buffer_bytes);
+        }
+    else
+        {
+            udp_gnss_rx_source_ = Gr_Complex_Ip_Packet_Source::make(capture_device,
+                address,
+                port,
+                payload_bytes,
+                channels_in_udp_,
+                sample_type,
+                item_size_,
+                IQ_swap_);
+        }
 
     if (channels_in_udp_ >= RF_channels_)
         {
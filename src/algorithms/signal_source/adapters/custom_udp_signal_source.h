@@ -39,6 +39,10 @@ class ConfigurationInterface;
 /*!
  * \brief This class reads from UDP packets, which streams interleaved
  * I/Q samples over a network.
+ *
+ * The packets are captured with libpcap (capture_mode=pcap), received in
+ * batches from an UDP socket (capture_mode=recvmmsg), or replayed from a pcap
+ * file (capture_mode=pcap_file).
  */
 class CustomUDPSignalSource : public SignalSourceBase
 {
@@ -61,7 +65,7 @@ public:
     gr::basic_block_sptr get_right_block(int RF_channel) override;
 
 private:
-    Gr_Complex_Ip_Packet_Source::sptr udp_gnss_rx_source_;
+    gr::block_sptr udp_gnss_rx_source_;
     std::vector<gnss_shared_ptr<gr::block>> null_sinks_;
     std::vector<gnss_shared_ptr<gr::block>> file_sink_;
 
@@ -0,0 +1,86 @@
+/*!
+ * \file gnss_synchro_replay_signal_source.cc
+ * \brief Signal source that replays a Gnss_Synchro capture file into the
+ * Observables and PVT blocks
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_replay_signal_source.h"
+#include "configuration_interface.h"
+#include "gnss_sdr_string_literals.h"
+#include "gnss_synchro.h"
+#include <stdexcept>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+using namespace std::string_literals;
+
+GnssSynchroReplaySignalSource::GnssSynchroReplaySignalSource(ConfigurationInterface const* configuration,
+    std::string const& role, unsigned int in_streams, unsigned int out_streams,
+    Concurrent_Queue<pmt::pmt_t>* queue)
+    : SignalSourceBase(configuration, role, "Gnss_Synchro_Replay_Signal_Source"s),
+      filename_(configuration->property(role + ".filename", "./gnss_synchro.dat"s)),
+      replay_source_(gnss_synchro_make_replay_source(filename_, queue))
+{
+    if (replay_source_->tap() != Gnss_Synchro_Record_Tap::TELEMETRY)
+        {
+            throw std::invalid_argument(filename_ + " was not captured at the Observables inputs (GnssSynchroRecorder.tap=telemetry) and cannot be replayed");
+        }
+
+    if (in_streams > 0)
+        {
+            LOG(ERROR) << "A signal source does not have an input stream";
+        }
+    if (out_streams > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void GnssSynchroReplaySignalSource::connect(gr::top_block_sptr top_block __attribute__((unused)))
+{
+    // The outputs are connected to the Observables block by the flow graph
+}
+
+
+void GnssSynchroReplaySignalSource::disconnect(gr::top_block_sptr top_block __attribute__((unused)))
+{
+}
+
+
+size_t GnssSynchroReplaySignalSource::item_size()
+{
+    return sizeof(Gnss_Synchro);
+}
+
+
+gr::basic_block_sptr GnssSynchroReplaySignalSource::get_right_block()
+{
+    return replay_source_;
+}
+
+
+size_t GnssSynchroReplaySignalSource::getRfChannels() const
+{
+    return 0;
+}
+
+
+int GnssSynchroReplaySignalSource::n_streams() const
+{
+    return replay_source_->output_signature()->max_streams();
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file gnss_synchro_replay_signal_source.h
+ * \brief Signal source that replays a Gnss_Synchro capture file into the
+ * Observables and PVT blocks
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_REPLAY_SIGNAL_SOURCE_H
+#define GNSS_SDR_GNSS_SYNCHRO_REPLAY_SIGNAL_SOURCE_H
+
+#include "concurrent_queue.h"
+#include "gnss_synchro_replay_source.h"
+#include "signal_source_base.h"
+#include <pmt/pmt.h>
+#include <cstddef>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_adapters
+ * \{ */
+
+// forward declaration to avoid include in header
+class ConfigurationInterface;
+
+//! \brief Class that replays a capture of the Gnss_Synchro streams taken at
+//! the inputs of the Observables block (GnssSynchroRecorder.tap=telemetry).
+//!
+//! Acquisition, tracking and telemetry decoding are not run. The receiver
+//! connects each output of this source straight to the corresponding input
+//! of the Observables block, so the number of channels in the configuration
+//! must match the one of the recorded run. Navigation data is not part of the
+//! capture: use the assistance files stored by the recorded run
+//! (GNSS-SDR.AGNSS_XML_enabled=true) to feed the PVT block.
+//!
+//! This class supports the following properties:
+//!
+//!   .filename - the path to the capture file
+//!
+class GnssSynchroReplaySignalSource : public SignalSourceBase
+{
+public:
+    GnssSynchroReplaySignalSource(const ConfigurationInterface* configuration, const std::string& role,
+        unsigned int in_streams, unsigned int out_streams,
+        Concurrent_Queue<pmt::pmt_t>* queue);
+
+    ~GnssSynchroReplaySignalSource() = default;
+
+    //! override methods from GNSSBlockInterface
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    size_t item_size() override;
+    gr::basic_block_sptr get_right_block() override;
+
+    //! There are no RF channels, hence no signal conditioners
+    size_t getRfChannels() const override;
+
+    //! Number of recorded streams: one per channel, plus the sample counter
+    int n_streams() const;
+
+private:
+    const std::string filename_;
+    const gnss_synchro_replay_source_sptr replay_source_;
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_REPLAY_SIGNAL_SOURCE_H
@@ -0,0 +1,174 @@
+/*!
+ * \file gnss_synchro_replay_source.cc
+ * \brief GNU Radio block that reads a Gnss_Synchro capture file and delivers
+ * each recorded stream in its own output
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_replay_source.h"
+#include "command_event.h"
+#include "gnss_synchro.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for std::fill, std::stable_sort
+#include <fcntl.h>    // for open, O_RDONLY
+#include <fstream>
+#include <iostream>
+#include <numeric>  // for std::iota
+#include <stdexcept>
+#include <sys/mman.h>  // for mmap, munmap, madvise
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+gnss_synchro_replay_source_sptr gnss_synchro_make_replay_source(
+    const std::string &filename,
+    Concurrent_Queue<pmt::pmt_t> *queue)
+{
+    Gnss_Synchro_Record_File_Header header{};
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open the Gnss_Synchro capture file " + filename);
+        }
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (file.gcount() != static_cast<std::streamsize>(sizeof(header)) || !gnss_synchro_record_file_header_is_valid(header))
+        {
+            throw std::runtime_error(filename + " is not a Gnss_Synchro capture file supported by this version of GNSS-SDR");
+        }
+    return gnss_synchro_replay_source_sptr(new gnss_synchro_replay_source(filename, header, queue));
+}
+
+
+gnss_synchro_replay_source::gnss_synchro_replay_source(const std::string &filename,
+    const Gnss_Synchro_Record_File_Header &header,
+    Concurrent_Queue<pmt::pmt_t> *queue)
+    : gr::block("gnss_synchro_replay_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(static_cast<int>(header.n_streams), static_cast<int>(header.n_streams), sizeof(Gnss_Synchro))),
+      d_produced(header.n_streams, 0),
+      d_filename(filename),
+      d_queue(queue),
+      d_map(MAP_FAILED),
+      d_records(nullptr),
+      d_map_size(0),
+      d_nrecords(0),
+      d_next_record(0),
+      d_tap(static_cast<Gnss_Synchro_Record_Tap>(header.tap)),
+      d_nstreams(static_cast<int32_t>(header.n_streams)),
+      d_fd(-1)
+{
+    d_fd = open(d_filename.c_str(), O_RDONLY);
+    struct stat file_status;
+    if (d_fd < 0 || fstat(d_fd, &file_status) != 0)
+        {
+            if (d_fd >= 0)
+                {
+                    close(d_fd);
+                }
+            throw std::runtime_error("Unable to open the Gnss_Synchro capture file " + d_filename);
+        }
+    d_map_size = static_cast<size_t>(file_status.st_size);
+    d_map = mmap(nullptr, d_map_size, PROT_READ, MAP_PRIVATE, d_fd, 0);
+    if (d_map == MAP_FAILED)
+        {
+            close(d_fd);
+            d_fd = -1;
+            throw std::runtime_error("Unable to map the Gnss_Synchro capture file " + d_filename);
+        }
+    madvise(d_map, d_map_size, MADV_SEQUENTIAL);
+
+    d_records = reinterpret_cast<const Gnss_Synchro_Record *>(static_cast<const char *>(d_map) + header.header_size);
+    d_nrecords = (d_map_size - header.header_size) / sizeof(Gnss_Synchro_Record);
+    if ((d_map_size - header.header_size) % sizeof(Gnss_Synchro_Record) != 0)
+        {
+            LOG(WARNING) << "The last record of " << d_filename << " is incomplete and will be ignored";
+        }
+
+    // Streams can fall behind each other in the capture, so the records are
+    // delivered by sample counter, keeping the capture order for equal ones
+    d_order.resize(d_nrecords);
+    std::iota(d_order.begin(), d_order.end(), 0);
+    std::stable_sort(d_order.begin(), d_order.end(), [this](uint64_t a, uint64_t b) {
+        return d_records[a].Tracking_sample_counter < d_records[b].Tracking_sample_counter;
+    });
+    LOG(INFO) << "Replaying " << d_nrecords << " Gnss_Synchro objects in " << d_nstreams << " streams from " << d_filename;
+}
+
+
+gnss_synchro_replay_source::~gnss_synchro_replay_source()
+{
+    if (d_map != MAP_FAILED)
+        {
+            munmap(d_map, d_map_size);
+        }
+    if (d_fd >= 0)
+        {
+            close(d_fd);
+        }
+}
+
+
+Gnss_Synchro_Record_Tap gnss_synchro_replay_source::tap() const
+{
+    return d_tap;
+}
+
+
+int gnss_synchro_replay_source::general_work(int noutput_items,
+    gr_vector_int &ninput_items __attribute__((unused)),
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    std::fill(d_produced.begin(), d_produced.end(), 0);
+
+    // Deliver records by sample counter until one of the outputs is full, so
+    // that the relative order of the streams is preserved.
+    int total_produced = 0;
+    while (d_next_record < d_nrecords)
+        {
+            const Gnss_Synchro_Record &record = d_records[d_order[d_next_record]];
+            if (record.stream >= static_cast<uint32_t>(d_nstreams))
+                {
+                    d_next_record++;
+                    continue;
+                }
+            int &produced = d_produced[record.stream];
+            if (produced == noutput_items)
+                {
+                    break;
+                }
+            gnss_synchro_from_record(record, out[record.stream][produced]);
+            produced++;
+            total_produced++;
+            d_next_record++;
+        }
+
+    if (total_produced == 0 && d_next_record == d_nrecords)
+        {
+            std::cout << "End of file reached, Gnss_Synchro replay stop.\n";
+            d_queue->push(pmt::make_any(command_event_make(200, 0)));
+            return WORK_DONE;
+        }
+
+    for (int32_t stream = 0; stream < d_nstreams; stream++)
+        {
+            produce(stream, d_produced[stream]);
+        }
+    return WORK_CALLED_PRODUCE;
+}
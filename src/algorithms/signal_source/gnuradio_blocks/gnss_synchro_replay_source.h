@@ -0,0 +1,93 @@
+/*!
+ * \file gnss_synchro_replay_source.h
+ * \brief GNU Radio block that reads a Gnss_Synchro capture file and delivers
+ * each recorded stream in its own output
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_REPLAY_SOURCE_H
+#define GNSS_SDR_GNSS_SYNCHRO_REPLAY_SOURCE_H
+
+#include "concurrent_queue.h"
+#include "gnss_block_interface.h"
+#include "gnss_synchro_record.h"
+#include <gnuradio/block.h>
+#include <pmt/pmt.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+class gnss_synchro_replay_source;
+
+using gnss_synchro_replay_source_sptr = gnss_shared_ptr<gnss_synchro_replay_source>;
+
+/*!
+ * \brief Returns a replay block for filename. Throws std::runtime_error if
+ * the file cannot be opened or it is not a valid Gnss_Synchro capture.
+ */
+gnss_synchro_replay_source_sptr gnss_synchro_make_replay_source(
+    const std::string &filename,
+    Concurrent_Queue<pmt::pmt_t> *queue);
+
+/*!
+ * \brief This class memory-maps a file written by gnss_synchro_recorder and
+ * delivers its records as Gnss_Synchro objects, one output per recorded
+ * stream, sorted by Tracking_sample_counter across all the streams. There is no throttling: the
+ * file is replayed as fast as the downstream blocks can process it.
+ */
+class gnss_synchro_replay_source : public gr::block
+{
+public:
+    ~gnss_synchro_replay_source();
+
+    int general_work(int noutput_items,
+        gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+    //! Point of the flow graph where the capture was taken
+    Gnss_Synchro_Record_Tap tap() const;
+
+private:
+    friend gnss_synchro_replay_source_sptr gnss_synchro_make_replay_source(
+        const std::string &filename,
+        Concurrent_Queue<pmt::pmt_t> *queue);
+
+    gnss_synchro_replay_source(const std::string &filename,
+        const Gnss_Synchro_Record_File_Header &header,
+        Concurrent_Queue<pmt::pmt_t> *queue);
+
+    std::vector<int> d_produced;
+    std::vector<uint64_t> d_order;  // indices of the records, sorted by sample counter
+    std::string d_filename;
+    Concurrent_Queue<pmt::pmt_t> *d_queue;
+    void *d_map;
+    const Gnss_Synchro_Record *d_records;
+    size_t d_map_size;
+    uint64_t d_nrecords;
+    uint64_t d_next_record;
+    Gnss_Synchro_Record_Tap d_tap;
+    int32_t d_nstreams;
+    int d_fd;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_REPLAY_SOURCE_H
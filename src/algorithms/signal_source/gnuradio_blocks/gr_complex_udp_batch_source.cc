@@ -0,0 +1,736 @@
+/*!
+ * \file gr_complex_udp_batch_source.cc
+ *
+ * \brief Receives UDP packets containing samples in batches with recvmmsg(),
+ * or replays them from a pcap capture file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "gr_complex_udp_batch_source.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pcap.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+constexpr int RECVMMSG_BATCH = 64;           // datagrams per recvmmsg() call
+constexpr size_t MAX_DATAGRAM_BYTES = 9216;  // jumbo frames
+constexpr uint32_t MAX_ZERO_FILLED_PACKETS = 100000;
+constexpr uint32_t REORDER_WINDOW = 8;  // packets held while waiting for a late one
+constexpr auto POLLING_PERIOD = std::chrono::microseconds(100);
+
+
+// Finds the payload of an UDP datagram sent to udp_port in an Ethernet frame
+bool find_udp_payload(const uint8_t *packet, size_t length, int udp_port, const uint8_t **payload, size_t *bytes)
+{
+    size_t offset = 14;  // Ethernet header
+    if (length < offset + 20)
+        {
+            return false;
+        }
+    uint16_t ether_type = (packet[12] << 8) | packet[13];
+    if (ether_type == 0x8100)  // IEEE 802.1Q VLAN tag
+        {
+            offset += 4;
+            if (length < offset + 20)
+                {
+                    return false;
+                }
+            ether_type = (packet[16] << 8) | packet[17];
+        }
+    const uint8_t *ip_header = packet + offset;
+    const size_t ip_header_bytes = (ip_header[0] & 0x0F) * 4;
+    if (ether_type != 0x0800 || ip_header[9] != IPPROTO_UDP || length < offset + ip_header_bytes + 8)
+        {
+            return false;
+        }
+    const uint8_t *udp_header = ip_header + ip_header_bytes;
+    const size_t udp_bytes = (udp_header[4] << 8) | udp_header[5];
+    if (((udp_header[2] << 8) | udp_header[3]) != udp_port || udp_bytes < 8 || length < offset + ip_header_bytes + udp_bytes)
+        {
+            return false;
+        }
+    *payload = udp_header + 8;
+    *bytes = udp_bytes - 8;
+    return true;
+}
+
+
+void swap_iq(gr_complex *samples, int n_samples)
+{
+    for (int n = 0; n < n_samples; n++)
+        {
+            samples[n] = gr_complex(samples[n].imag(), samples[n].real());
+        }
+}
+
+
+int two_bit_level(int bits)
+{
+    return 2 * (bits >= 2 ? bits - 4 : bits) + 1;
+}
+
+
+int four_bit_level(int bits)
+{
+    return 2 * (bits >= 8 ? bits - 16 : bits) + 1;
+}
+}  // namespace
+
+
+Gr_Complex_Udp_Batch_Source::sptr Gr_Complex_Udp_Batch_Source::make(const std::string &capture_mode,
+    const std::string &pcap_filename,
+    int udp_port,
+    int n_baseband_channels,
+    const std::string &wire_sample_type,
+    bool IQ_swap,
+    bool packet_counter,
+    size_t ring_buffer_bytes,
+    int socket_buffer_bytes)
+{
+    return gnuradio::get_initial_sptr(new Gr_Complex_Udp_Batch_Source(capture_mode,
+        pcap_filename,
+        udp_port,
+        n_baseband_channels,
+        wire_sample_type,
+        IQ_swap,
+        packet_counter,
+        ring_buffer_bytes,
+        socket_buffer_bytes));
+}
+
+
+Gr_Complex_Udp_Batch_Source::Gr_Complex_Udp_Batch_Source(const std::string &capture_mode,
+    const std::string &pcap_filename,
+    int udp_port,
+    int n_baseband_channels,
+    const std::string &wire_sample_type,
+    bool IQ_swap,
+    bool packet_counter,
+    size_t ring_buffer_bytes,
+    int socket_buffer_bytes)
+    : gr::sync_block("gr_complex_udp_batch_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, n_baseband_channels, sizeof(gr_complex))),
+      ring_(std::max(ring_buffer_bytes, 16 * MAX_DATAGRAM_BYTES)),
+      pcap_filename_(pcap_filename),
+      udp_port_(udp_port),
+      n_baseband_channels_(n_baseband_channels),
+      socket_buffer_bytes_(socket_buffer_bytes),
+      from_file_(capture_mode == "pcap_file"),
+      packet_counter_(packet_counter)
+{
+    // The IQ order of each wire sample type is the one of Gr_Complex_Ip_Packet_Source
+    frame_samples_ = 1;
+    if (wire_sample_type == "cbyte")
+        {
+            channel_bytes_ = 2;
+            convert_ = IQ_swap ? &Gr_Complex_Udp_Batch_Source::convert_cbyte<true> : &Gr_Complex_Udp_Batch_Source::convert_cbyte<false>;
+        }
+    else if (wire_sample_type == "ishort")
+        {
+            channel_bytes_ = 4;
+            convert_ = IQ_swap ? &Gr_Complex_Udp_Batch_Source::convert_ishort<true> : &Gr_Complex_Udp_Batch_Source::convert_ishort<false>;
+        }
+    else if (wire_sample_type == "cfloat")
+        {
+            channel_bytes_ = 8;
+            convert_ = IQ_swap ? &Gr_Complex_Udp_Batch_Source::convert_cfloat<true> : &Gr_Complex_Udp_Batch_Source::convert_cfloat<false>;
+        }
+    else if (wire_sample_type == "c4bits")
+        {
+            // Real part in the least significant nibble
+            channel_bytes_ = 1;
+            convert_ = &Gr_Complex_Udp_Batch_Source::convert_c4bits;
+            for (int byte = 0; byte < 256; byte++)
+                {
+                    const auto low = static_cast<float>(four_bit_level(byte & 0x0F));
+                    const auto high = static_cast<float>(four_bit_level(byte >> 4));
+                    byte_4bit_samples_[byte] = IQ_swap ? gr_complex(high, low) : gr_complex(low, high);
+                }
+        }
+    else if (wire_sample_type == "c2bits")
+        {
+            // Two samples per byte, the first one in the most significant
+            // nibble. Bit order in each nibble: Q1 Q0 I1 I0
+            channel_bytes_ = 1;
+            frame_samples_ = 2;
+            convert_ = &Gr_Complex_Udp_Batch_Source::convert_c2bits;
+            for (int byte = 0; byte < 256; byte++)
+                {
+                    for (int n = 0; n < 2; n++)
+                        {
+                            const int nibble = (byte >> (4 - 4 * n)) & 0x0F;
+                            const auto real = static_cast<float>(two_bit_level(nibble & 3));
+                            const auto imag = static_cast<float>(two_bit_level(nibble >> 2));
+                            byte_2bit_samples_[byte][n] = IQ_swap ? gr_complex(real, imag) : gr_complex(imag, real);
+                        }
+                }
+        }
+    else
+        {
+            throw std::invalid_argument("Unknown wire sample type " + wire_sample_type);
+        }
+    frame_bytes_ = channel_bytes_ * n_baseband_channels_;
+    wrap_frame_.resize(frame_bytes_);
+    held_packets_.resize(REORDER_WINDOW);
+    for (auto &packet : held_packets_)
+        {
+            packet.reserve(MAX_DATAGRAM_BYTES);
+        }
+    held_.resize(REORDER_WINDOW, false);
+
+    std::cout << "UDP batch source: " << (from_file_ ? "replaying " + pcap_filename_ : "receiving on port " + std::to_string(udp_port_)) << '\n';
+    std::cout << "Overflow events will be indicated by o's\n";
+}
+
+
+Gr_Complex_Udp_Batch_Source::~Gr_Complex_Udp_Batch_Source()
+{
+    if (receiver_thread_.joinable())
+        {
+            stop_requested_.store(true);
+            receiver_thread_.join();
+        }
+    if (socket_ != -1)
+        {
+            close(socket_);
+        }
+}
+
+
+bool Gr_Complex_Udp_Batch_Source::start()
+{
+    stop_requested_.store(false);
+    producer_done_.store(false);
+    first_packet_ = true;
+    pending_zero_bytes_ = 0;
+    std::fill(held_.begin(), held_.end(), false);
+    if (from_file_)
+        {
+            receiver_thread_ = std::thread([this] { replay_pcap_file(); });
+            return true;
+        }
+    if (!open_socket())
+        {
+            return false;
+        }
+    receiver_thread_ = std::thread([this] { receive_datagrams(); });
+    return true;
+}
+
+
+bool Gr_Complex_Udp_Batch_Source::stop()
+{
+    stop_requested_.store(true);
+    if (receiver_thread_.joinable())
+        {
+            receiver_thread_.join();
+        }
+    if (socket_ != -1)
+        {
+            close(socket_);
+            socket_ = -1;
+        }
+    if (lost_packets_ > 0 || overflows_ > 0 || late_packets_ > 0)
+        {
+            LOG(WARNING) << "UDP batch source: " << lost_packets_ << " lost packets and "
+                         << overflows_ << " packets that did not fit in the ring buffer replaced by zeros, "
+                         << late_packets_ << " late packets discarded";
+        }
+    return true;
+}
+
+
+bool Gr_Complex_Udp_Batch_Source::open_socket()
+{
+    socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_ == -1)
+        {
+            std::cout << "Error opening UDP socket\n";
+            return false;
+        }
+    const int enable = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    // A large socket buffer absorbs the bursts of datagrams that arrive while
+    // the receiving thread is not scheduled. The kernel limits it to
+    // net.core.rmem_max.
+    setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &socket_buffer_bytes_, sizeof(socket_buffer_bytes_));
+    int actual_buffer_bytes = 0;
+    socklen_t option_length = sizeof(actual_buffer_bytes);
+    getsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &actual_buffer_bytes, &option_length);
+    if (actual_buffer_bytes < socket_buffer_bytes_)
+        {
+            LOG(WARNING) << "UDP socket receive buffer of " << actual_buffer_bytes << " bytes instead of "
+                         << socket_buffer_bytes_ << ". Consider increasing net.core.rmem_max";
+        }
+#if defined(__linux__)
+    // Report the count of datagrams dropped by the kernel with each datagram
+    setsockopt(socket_, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable));
+#endif
+    // Wake up the receiving thread periodically to check if it has to stop
+    struct timeval timeout{};
+    timeout.tv_usec = 100000;
+    setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    struct sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(udp_port_);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(socket_, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) == -1)
+        {
+            std::cout << "Error binding UDP socket to port " << udp_port_ << ": " << strerror(errno) << '\n';
+            close(socket_);
+            socket_ = -1;
+            return false;
+        }
+    return true;
+}
+
+
+void Gr_Complex_Udp_Batch_Source::receive_datagrams()
+{
+    std::vector<uint8_t> datagrams(RECVMMSG_BATCH * MAX_DATAGRAM_BYTES);
+#if defined(__linux__)
+    const size_t control_bytes = CMSG_SPACE(sizeof(uint32_t));
+    std::vector<char> controls(RECVMMSG_BATCH * control_bytes);
+    std::array<struct mmsghdr, RECVMMSG_BATCH> messages{};
+    std::array<struct iovec, RECVMMSG_BATCH> iovecs{};
+    uint32_t kernel_drops_total = 0;
+    while (!stop_requested_.load(std::memory_order_relaxed))
+        {
+            for (int i = 0; i < RECVMMSG_BATCH; i++)
+                {
+                    iovecs[i].iov_base = &datagrams[i * MAX_DATAGRAM_BYTES];
+                    iovecs[i].iov_len = MAX_DATAGRAM_BYTES;
+                    messages[i].msg_hdr = msghdr{};
+                    messages[i].msg_hdr.msg_iov = &iovecs[i];
+                    messages[i].msg_hdr.msg_iovlen = 1;
+                    messages[i].msg_hdr.msg_control = &controls[i * control_bytes];
+                    messages[i].msg_hdr.msg_controllen = control_bytes;
+                }
+            // Returns as soon as one datagram is available, with all the ones
+            // already queued up to the batch size
+            const int received = recvmmsg(socket_, messages.data(), RECVMMSG_BATCH, MSG_WAITFORONE, nullptr);
+            if (received < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                        {
+                            continue;
+                        }
+                    LOG(ERROR) << "recvmmsg() failed: " << strerror(errno);
+                    break;
+                }
+            for (int i = 0; i < received; i++)
+                {
+                    uint32_t kernel_drops = 0;
+                    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&messages[i].msg_hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&messages[i].msg_hdr, cmsg))
+                        {
+                            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+                                {
+                                    uint32_t drops;
+                                    memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+                                    kernel_drops = drops - kernel_drops_total;
+                                    kernel_drops_total = drops;
+                                }
+                        }
+                    push_payload(&datagrams[i * MAX_DATAGRAM_BYTES], messages[i].msg_len, kernel_drops);
+                }
+        }
+#else
+    while (!stop_requested_.load(std::memory_order_relaxed))
+        {
+            const ssize_t received = recv(socket_, datagrams.data(), MAX_DATAGRAM_BYTES, 0);
+            if (received < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                        {
+                            continue;
+                        }
+                    LOG(ERROR) << "recv() failed: " << strerror(errno);
+                    break;
+                }
+            push_payload(datagrams.data(), received, 0);
+        }
+#endif
+    producer_done_.store(true, std::memory_order_release);
+}
+
+
+void Gr_Complex_Udp_Batch_Source::replay_pcap_file()
+{
+    std::array<char, PCAP_ERRBUF_SIZE> errbuf{};
+    pcap_t *pcap_file = pcap_open_offline(pcap_filename_.c_str(), errbuf.data());
+    if (pcap_file == nullptr)
+        {
+            std::cout << "Error opening pcap file " << pcap_filename_ << ": " << std::string(errbuf.data()) << '\n';
+            producer_done_.store(true, std::memory_order_release);
+            return;
+        }
+    if (pcap_datalink(pcap_file) != DLT_EN10MB)
+        {
+            std::cout << "The pcap file " << pcap_filename_ << " does not contain Ethernet frames\n";
+        }
+    else
+        {
+            struct pcap_pkthdr *header;
+            const u_char *packet;
+            while (!stop_requested_.load(std::memory_order_relaxed) && pcap_next_ex(pcap_file, &header, &packet) == 1)
+                {
+                    const uint8_t *payload;
+                    size_t bytes;
+                    if (find_udp_payload(packet, header->caplen, udp_port_, &payload, &bytes))
+                        {
+                            push_payload(payload, bytes, 0);
+                        }
+                }
+            release_held_packets();
+        }
+    pcap_close(pcap_file);
+    producer_done_.store(true, std::memory_order_release);
+}
+
+
+void Gr_Complex_Udp_Batch_Source::push_payload(const uint8_t *payload, size_t bytes, uint32_t kernel_drops)
+{
+    if (!packet_counter_)
+        {
+            // Assumes that the dropped datagrams had the same size as this one
+            lost_packets_ += kernel_drops;
+            pending_zero_bytes_ += static_cast<uint64_t>(kernel_drops) * bytes;
+            write_packet(payload, bytes);
+            return;
+        }
+    if (bytes < 4)
+        {
+            return;
+        }
+    const uint32_t counter = (static_cast<uint32_t>(payload[0]) << 24) | (static_cast<uint32_t>(payload[1]) << 16) |
+                             (static_cast<uint32_t>(payload[2]) << 8) | static_cast<uint32_t>(payload[3]);
+    payload += 4;
+    bytes -= 4;
+    // Lost packets are assumed to have the same size as this one
+    last_payload_bytes_ = bytes;
+    if (first_packet_)
+        {
+            expected_counter_ = counter;
+            first_packet_ = false;
+        }
+
+    // Position relative to the next packet in order, modulo 2^32
+    auto distance = static_cast<int32_t>(counter - expected_counter_);
+    if (distance > static_cast<int32_t>(MAX_ZERO_FILLED_PACKETS) || distance < -static_cast<int32_t>(MAX_ZERO_FILLED_PACKETS))
+        {
+            // The sender restarted the count
+            LOG(WARNING) << "UDP batch source: packet counter jumped by " << distance << ", not filled with zeros";
+            release_held_packets();
+            expected_counter_ = counter;
+            distance = 0;
+        }
+    if (distance < 0)
+        {
+            // Its place has already been filled with zeros
+            late_packets_++;
+            return;
+        }
+
+    // Packets missing for a whole window are lost
+    for (int32_t n = 0; n <= distance - static_cast<int32_t>(REORDER_WINDOW); n++)
+        {
+            release_next_packet();
+        }
+    if (counter == expected_counter_)
+        {
+            write_packet(payload, bytes);
+            expected_counter_++;
+        }
+    else
+        {
+            const uint32_t slot = counter % REORDER_WINDOW;
+            held_packets_[slot].assign(payload, payload + bytes);
+            held_[slot] = true;
+        }
+    while (held_[expected_counter_ % REORDER_WINDOW])
+        {
+            release_next_packet();
+        }
+}
+
+
+void Gr_Complex_Udp_Batch_Source::release_next_packet()
+{
+    const uint32_t slot = expected_counter_ % REORDER_WINDOW;
+    if (held_[slot])
+        {
+            write_packet(held_packets_[slot].data(), held_packets_[slot].size());
+            held_[slot] = false;
+        }
+    else
+        {
+            lost_packets_++;
+            pending_zero_bytes_ += last_payload_bytes_;
+        }
+    expected_counter_++;
+}
+
+
+void Gr_Complex_Udp_Batch_Source::release_held_packets()
+{
+    // Up to the last held packet, with zeros in place of the missing ones
+    for (uint32_t n = 0; n < REORDER_WINDOW && std::find(held_.begin(), held_.end(), true) != held_.end(); n++)
+        {
+            release_next_packet();
+        }
+}
+
+
+void Gr_Complex_Udp_Batch_Source::write_packet(const uint8_t *data, size_t bytes)
+{
+    // The zeros of previous lost packets and overflows go first, to keep
+    // the time of the samples
+    write_pending_zeros();
+    if (pending_zero_bytes_ == 0 && wait_for_space(bytes) && ring_.write(data, bytes))
+        {
+            return;
+        }
+    overflows_++;
+    pending_zero_bytes_ += bytes;
+    std::cout << "o" << std::flush;
+}
+
+
+void Gr_Complex_Udp_Batch_Source::write_pending_zeros()
+{
+    while (pending_zero_bytes_ > 0)
+        {
+            // Whole frames, so that the ring buffer always holds whole frames
+            const size_t space = ring_.write_space();
+            const auto bytes = static_cast<size_t>(std::min(pending_zero_bytes_, static_cast<uint64_t>(space - space % frame_bytes_)));
+            if (bytes == 0)
+                {
+                    if (!wait_for_space(std::min(pending_zero_bytes_, static_cast<uint64_t>(frame_bytes_))))
+                        {
+                            return;
+                        }
+                    continue;
+                }
+            ring_.write_zeros(bytes);
+            pending_zero_bytes_ -= bytes;
+        }
+}
+
+
+bool Gr_Complex_Udp_Batch_Source::wait_for_space(size_t bytes) const
+{
+    if (from_file_)
+        {
+            // Replay without losses
+            while (ring_.write_space() < bytes)
+                {
+                    if (stop_requested_.load(std::memory_order_relaxed))
+                        {
+                            return false;
+                        }
+                    std::this_thread::sleep_for(POLLING_PERIOD);
+                }
+        }
+    return ring_.write_space() >= bytes;
+}
+
+
+template <bool IQ_SWAP>
+void Gr_Complex_Udp_Batch_Source::convert_cbyte(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const
+{
+    const auto *samples = reinterpret_cast<const int8_t *>(in);
+    if (n_baseband_channels_ == 1)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[0]) + first_frame;
+            volk_8i_s32f_convert_32f(reinterpret_cast<float *>(out), samples, 1.0F, 2 * n_frames);
+            if (!IQ_SWAP)
+                {
+                    swap_iq(out, n_frames);
+                }
+            return;
+        }
+    for (size_t channel = 0; channel < output_items.size(); channel++)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[channel]) + first_frame;
+            const int8_t *sample = samples + channel * channel_bytes_;
+            for (int n = 0; n < n_frames; n++)
+                {
+                    out[n] = IQ_SWAP ? gr_complex(sample[0], sample[1]) : gr_complex(sample[1], sample[0]);
+                    sample += frame_bytes_;
+                }
+        }
+}
+
+
+template <bool IQ_SWAP>
+void Gr_Complex_Udp_Batch_Source::convert_ishort(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const
+{
+    const auto *samples = reinterpret_cast<const int16_t *>(in);
+    if (n_baseband_channels_ == 1)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[0]) + first_frame;
+            volk_16i_s32f_convert_32f(reinterpret_cast<float *>(out), samples, 1.0F, 2 * n_frames);
+            if (!IQ_SWAP)
+                {
+                    swap_iq(out, n_frames);
+                }
+            return;
+        }
+    for (size_t channel = 0; channel < output_items.size(); channel++)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[channel]) + first_frame;
+            const int16_t *sample = samples + channel * 2;
+            for (int n = 0; n < n_frames; n++)
+                {
+                    out[n] = IQ_SWAP ? gr_complex(sample[0], sample[1]) : gr_complex(sample[1], sample[0]);
+                    sample += 2 * n_baseband_channels_;
+                }
+        }
+}
+
+
+template <bool IQ_SWAP>
+void Gr_Complex_Udp_Batch_Source::convert_cfloat(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const
+{
+    for (size_t channel = 0; channel < output_items.size(); channel++)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[channel]) + first_frame;
+            if (n_baseband_channels_ == 1)
+                {
+                    memcpy(out, in, n_frames * sizeof(gr_complex));
+                    if (!IQ_SWAP)
+                        {
+                            swap_iq(out, n_frames);
+                        }
+                    return;
+                }
+            const auto *sample = reinterpret_cast<const float *>(in) + channel * 2;
+            for (int n = 0; n < n_frames; n++)
+                {
+                    out[n] = IQ_SWAP ? gr_complex(sample[0], sample[1]) : gr_complex(sample[1], sample[0]);
+                    sample += 2 * n_baseband_channels_;
+                }
+        }
+}
+
+
+void Gr_Complex_Udp_Batch_Source::convert_c4bits(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const
+{
+    for (size_t channel = 0; channel < output_items.size(); channel++)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[channel]) + first_frame;
+            const uint8_t *byte = in + channel;
+            for (int n = 0; n < n_frames; n++)
+                {
+                    out[n] = byte_4bit_samples_[*byte];
+                    byte += frame_bytes_;
+                }
+        }
+}
+
+
+void Gr_Complex_Udp_Batch_Source::convert_c2bits(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const
+{
+    for (size_t channel = 0; channel < output_items.size(); channel++)
+        {
+            auto *out = static_cast<gr_complex *>(output_items[channel]) + 2 * first_frame;
+            const uint8_t *byte = in + channel;
+            for (int n = 0; n < n_frames; n++)
+                {
+                    const auto &samples = byte_2bit_samples_[*byte];
+                    out[2 * n] = samples[0];
+                    out[2 * n + 1] = samples[1];
+                    byte += frame_bytes_;
+                }
+        }
+}
+
+
+int Gr_Complex_Udp_Batch_Source::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    const size_t requested_frames = noutput_items / frame_samples_;
+    if (requested_frames == 0)
+        {
+            return 0;
+        }
+    // Wait a little for the receiving thread instead of returning 0 items,
+    // which makes the scheduler call work() again immediately
+    size_t available_frames = 0;
+    for (int polls = 0; polls < 10; polls++)
+        {
+            const bool done = producer_done_.load(std::memory_order_acquire);
+            available_frames = ring_.read_available() / frame_bytes_;
+            if (available_frames > 0)
+                {
+                    break;
+                }
+            if (done)
+                {
+                    return WORK_DONE;
+                }
+            std::this_thread::sleep_for(POLLING_PERIOD);
+        }
+    if (available_frames == 0)
+        {
+            return 0;
+        }
+
+    // Convert straight from the ring buffer, in up to two parts if the frames
+    // wrap around its end
+    const size_t n_frames = std::min(requested_frames, available_frames);
+    size_t converted_frames = 0;
+    while (converted_frames < n_frames)
+        {
+            size_t contiguous_bytes = 0;
+            const uint8_t *in = ring_.read_pointer(contiguous_bytes);
+            const size_t frames = std::min(n_frames - converted_frames, contiguous_bytes / frame_bytes_);
+            if (frames > 0)
+                {
+                    (this->*convert_)(in, output_items, static_cast<int>(converted_frames), static_cast<int>(frames));
+                    ring_.advance_read(frames * frame_bytes_);
+                    converted_frames += frames;
+                }
+            else
+                {
+                    // A frame split by the end of the ring buffer
+                    ring_.read(wrap_frame_.data(), frame_bytes_);
+                    (this->*convert_)(wrap_frame_.data(), output_items, static_cast<int>(converted_frames), 1);
+                    converted_frames++;
+                }
+        }
+    return static_cast<int>(n_frames) * frame_samples_;
+}
@@ -0,0 +1,147 @@
+/*!
+ * \file gr_complex_udp_batch_source.h
+ *
+ * \brief Receives UDP packets containing samples in batches with recvmmsg(),
+ * or replays them from a pcap capture file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_GR_COMPLEX_UDP_BATCH_SOURCE_H
+#define GNSS_SDR_GR_COMPLEX_UDP_BATCH_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include "spsc_byte_ring.h"
+#include <gnuradio/sync_block.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Network sample source for high sample rates.
+ *
+ * A receiving thread reads UDP datagrams in batches with recvmmsg() (capture
+ * mode "recvmmsg"), or replays the UDP packets stored in a pcap file without
+ * losses (capture mode "pcap_file"), and pushes their payload into a lock-free
+ * ring buffer. work() converts the payload to gr_complex in bulk, with a
+ * conversion function for the wire sample type selected at construction.
+ *
+ * Lost packets are replaced by zeros, so that the time of the output samples
+ * is kept. Losses are detected with a 32-bit big-endian packet counter at the
+ * start of each payload, if enabled, or otherwise with the count of datagrams
+ * dropped by the kernel (SO_RXQ_OVFL, only in Linux). With the counter,
+ * packets that arrive out of order within a window of a few packets are put
+ * back in order, and later ones are discarded. Packets that do not fit in
+ * the ring buffer are also replaced by zeros, written as soon as there is
+ * space again.
+ */
+class Gr_Complex_Udp_Batch_Source : public gr::sync_block
+{
+public:
+    using sptr = gnss_shared_ptr<Gr_Complex_Udp_Batch_Source>;
+    static sptr make(const std::string &capture_mode,
+        const std::string &pcap_filename,
+        int udp_port,
+        int n_baseband_channels,
+        const std::string &wire_sample_type,
+        bool IQ_swap,
+        bool packet_counter,
+        size_t ring_buffer_bytes,
+        int socket_buffer_bytes);
+
+    ~Gr_Complex_Udp_Batch_Source();
+
+    // Called by gnuradio to start the receiving thread
+    bool start() override;
+
+    // Called by gnuradio to stop the receiving thread
+    bool stop() override;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items) override;
+
+private:
+    using Conversion_Function = void (Gr_Complex_Udp_Batch_Source::*)(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+
+    Gr_Complex_Udp_Batch_Source(const std::string &capture_mode,
+        const std::string &pcap_filename,
+        int udp_port,
+        int n_baseband_channels,
+        const std::string &wire_sample_type,
+        bool IQ_swap,
+        bool packet_counter,
+        size_t ring_buffer_bytes,
+        int socket_buffer_bytes);
+
+    bool open_socket();
+    void receive_datagrams();
+    void replay_pcap_file();
+    void push_payload(const uint8_t *payload, size_t bytes, uint32_t kernel_drops);
+    void release_next_packet();
+    void release_held_packets();
+    void write_packet(const uint8_t *data, size_t bytes);
+    void write_pending_zeros();
+    bool wait_for_space(size_t bytes) const;
+
+    template <bool IQ_SWAP>
+    void convert_cbyte(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+    template <bool IQ_SWAP>
+    void convert_ishort(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+    template <bool IQ_SWAP>
+    void convert_cfloat(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+    void convert_c4bits(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+    void convert_c2bits(const uint8_t *in, gr_vector_void_star &output_items, int first_frame, int n_frames) const;
+
+    Spsc_Byte_Ring ring_;
+    std::vector<uint8_t> wrap_frame_;                 // a frame split by the end of the ring
+    std::vector<std::vector<uint8_t>> held_packets_;  // packets that arrived before the expected one
+    std::vector<bool> held_;
+    std::array<gr_complex, 256> byte_4bit_samples_{};
+    std::array<std::array<gr_complex, 2>, 256> byte_2bit_samples_{};
+    std::thread receiver_thread_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<bool> producer_done_{false};
+    std::string pcap_filename_;
+    Conversion_Function convert_;
+    uint64_t overflows_{0};
+    uint64_t lost_packets_{0};
+    uint64_t late_packets_{0};
+    uint64_t pending_zero_bytes_{0};  // of lost packets and overflows, not written yet
+    size_t last_payload_bytes_{0};
+    uint32_t expected_counter_{0};
+    int udp_port_;
+    int n_baseband_channels_;
+    int socket_buffer_bytes_;
+    int socket_{-1};
+    int channel_bytes_;  // bytes of one frame of one channel
+    int frame_bytes_;    // bytes of one frame of all the channels
+    int frame_samples_;  // samples per channel in one frame
+    bool from_file_;
+    bool packet_counter_;
+    bool first_packet_{true};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GR_COMPLEX_UDP_BATCH_SOURCE_H
@@ -18,6 +18,7 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 struct byte_2bit_struct
 {
@@ -117,6 +118,17 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     bool big_endian_bytes_system = systemBytesAreBigEndian();
 
     swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
+
+    // Bit pair of the byte (0 for the two least significant bits) of each of
+    // the four output samples, two bits per sample
+    if (!reverse_interleaving_)
+        {
+            sample_order_ = swap_endian_bytes_ ? 0x1B : 0xE4;  // 3, 2, 1, 0 or 0, 1, 2, 3
+        }
+    else
+        {
+            sample_order_ = swap_endian_bytes_ ? 0x4E : 0xB1;  // 2, 3, 0, 1 or 1, 0, 3, 2
+        }
 }
 
 
@@ -133,78 +145,23 @@ int unpack_2bit_samples::work(int noutput_items,
     // Handle endian swap if needed
     if (swap_endian_items_)
         {
-            work_buffer_ = std::vector<int8_t>(ninput_bytes);
+            // The buffer is only reallocated when it grows
+            if (work_buffer_.size() < ninput_bytes)
+                {
+                    work_buffer_.resize(ninput_bytes);
+                }
             swapEndianness(in, work_buffer_, item_size_, ninput_items);
 
-            in = const_cast<signed char const *>(&work_buffer_[0]);
+            in = const_cast<signed char const *>(work_buffer_.data());
         }
 
     // Here the in pointer can be interpreted as a stream of bytes to be
     // converted. But we now have two possibilities:
     // 1) The samples in a byte are in big endian order
     // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
-                }
-        }
-    else
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
-                }
-        }
+    // Both cases, as well as the reverse interleaving, are handled by the
+    // sample order given to the kernel
+    volk_gnsssdr_8u_unpack2bit_8i(out, reinterpret_cast<const uint8_t *>(in), sample_order_, static_cast<unsigned int>(ninput_bytes));
 
     return noutput_items;
 }
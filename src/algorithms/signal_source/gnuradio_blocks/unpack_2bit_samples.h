@@ -108,6 +108,7 @@ private:
     bool big_endian_items_;
     bool swap_endian_items_;
     bool swap_endian_bytes_;
+    unsigned int sample_order_;
     bool reverse_interleaving_;
 };
 
@@ -40,29 +40,16 @@ int unpack_intspir_1bit_samples::work(int noutput_items,
     const auto *in = reinterpret_cast<const signed int *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
+    // For historical reasons, values are float versions of short int limits
+    // (32767). Bit 0 holds the I sample and bit 1 the Q sample of channel 1.
+    const float levels[4][2] = {{-32767.0F, -32767.0F}, {32767.0F, -32767.0F}, {-32767.0F, 32767.0F}, {32767.0F, 32767.0F}};
     int n = 0;
-    int channel = 1;
     for (int i = 0; i < noutput_items / 2; i++)
         {
-            // Read packed input sample (1 byte = 1 complex sample)
-            // For historical reasons, values are float versions of short int limits (32767)
-            signed int val = in[i];
-            if (((val >> ((channel - 1) * 2)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
-            if (((val >> (2 * channel - 1)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
+            // Read packed input sample (1 int = 1 complex sample)
+            const float *sample = levels[in[i] & 3];
+            out[n++] = sample[0];
+            out[n++] = sample[1];
         }
     return noutput_items;
 }
@@ -18,7 +18,7 @@
 
 #include "unpack_spir_gss6450_samples.h"
 #include <gnuradio/io_signature.h>
-#include <cmath>
+#include <cstdint>
 
 unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples(int adc_nbit_)
 {
@@ -33,72 +33,45 @@ unpack_spir_gss6450_samples::unpack_spir_gss6450_samples(int adc_nbit)
       adc_bits(adc_nbit),
       samples_per_int(16 / adc_bits)
 {
+    // Decoding of every possible byte of the input words. With 2 bits, a byte
+    // holds two complex samples (2 I + 2 Q bits each, least significant
+    // nibble first), stored in reverse order as they are in the output. With 4
+    // bits, a byte holds one complex sample (4 I + 4 Q bits).
+    const auto to_signed = [](int value, int bits) {
+        return static_cast<float>(value >= (1 << (bits - 1)) ? value - (1 << bits) : value);
+    };
+    for (int byte = 0; byte < 256; byte++)
+        {
+            for (int nibble = 0; nibble < 2; nibble++)
+                {
+                    const int value = (byte >> (4 * nibble)) & 0x0F;
+                    byte_2bit_samples_[byte][1 - nibble] = gr_complex(to_signed(value & 3, 2), to_signed(value >> 2, 2));
+                }
+            byte_4bit_samples_[byte] = gr_complex(to_signed(byte & 0x0F, 4), to_signed(byte >> 4, 4));
+        }
 }
 
 
 void unpack_spir_gss6450_samples::decode_4bits_word(uint32_t input_uint32, gr_complex* out, int adc_bits_)
 {
-    int8_t tmp_char;
-    float Q;
-    float I;
     switch (adc_bits_)
         {
         case 2:
             // four bits per complex sample (2 I + 2 Q), 8 samples per int32[s0,s1,s2,s3,s4,s5,s6,s7]
-            for (int i = 0; i < 8; i++)
+            for (int i = 0; i < 4; i++)
                 {
-                    tmp_char = input_uint32 & 3;
-
-                    if (tmp_char >= 2)
-                        {
-                            I = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-                    tmp_char = input_uint32 & 3;
-                    if (tmp_char >= 2)
-                        {
-                            Q = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-
-                    out[7 - i] = gr_complex(I, Q);
+                    const auto& samples = byte_2bit_samples_[input_uint32 & 0xFF];
+                    input_uint32 = input_uint32 >> 8;
+                    out[6 - 2 * i] = samples[0];
+                    out[7 - 2 * i] = samples[1];
                 }
             break;
         case 4:
             // eight bits per complex sample (4 I + 4 Q), 4 samples per int32= [s0,s1,s2,s3]
             for (int i = 0; i < 4; i++)
                 {
-                    tmp_char = input_uint32 & 0x0F;
-
-                    if (tmp_char >= 8)
-                        {
-                            I = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-                    tmp_char = input_uint32 & 0x0F;
-                    if (tmp_char >= 8)
-                        {
-                            Q = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-
-                    out[3 - i] = gr_complex(I, Q);
+                    out[3 - i] = byte_4bit_samples_[input_uint32 & 0xFF];
+                    input_uint32 = input_uint32 >> 8;
                 }
             break;
         }
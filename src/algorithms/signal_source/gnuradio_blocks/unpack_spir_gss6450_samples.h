@@ -20,6 +20,7 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <array>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -45,6 +46,8 @@ public:
 
 private:
     friend unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples_sptr(int adc_nbit);
+    std::array<std::array<gr_complex, 2>, 256> byte_2bit_samples_{};
+    std::array<gr_complex, 256> byte_4bit_samples_{};
     int adc_bits;
     int samples_per_int;
 };
@@ -0,0 +1,119 @@
+/*!
+ * \file spsc_byte_ring.cc
+ * \brief Lock-free ring buffer of bytes for one producer thread and one
+ * consumer thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "spsc_byte_ring.h"
+#include <algorithm>  // for std::min
+#include <cstring>    // for memcpy, memset
+
+
+namespace
+{
+size_t next_power_of_two(size_t value)
+{
+    size_t power = 1;
+    while (power < value)
+        {
+            power <<= 1U;
+        }
+    return power;
+}
+}  // namespace
+
+
+Spsc_Byte_Ring::Spsc_Byte_Ring(size_t capacity_bytes)
+    : buffer_(next_power_of_two(std::max(capacity_bytes, static_cast<size_t>(2))), 0),
+      mask_(buffer_.size() - 1),
+      write_position_(0),
+      read_position_(0)
+{
+}
+
+
+size_t Spsc_Byte_Ring::write_space() const
+{
+    const uint64_t read_position = read_position_.load(std::memory_order_acquire);
+    const uint64_t write_position = write_position_.load(std::memory_order_relaxed);
+    return buffer_.size() - static_cast<size_t>(write_position - read_position);
+}
+
+
+size_t Spsc_Byte_Ring::read_available() const
+{
+    const uint64_t write_position = write_position_.load(std::memory_order_acquire);
+    const uint64_t read_position = read_position_.load(std::memory_order_relaxed);
+    return static_cast<size_t>(write_position - read_position);
+}
+
+
+bool Spsc_Byte_Ring::write(const uint8_t* data, size_t bytes)
+{
+    if (bytes > write_space())
+        {
+            return false;
+        }
+    const uint64_t write_position = write_position_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(write_position) & mask_;
+    const size_t first_part = std::min(bytes, buffer_.size() - offset);
+    memcpy(&buffer_[offset], data, first_part);
+    memcpy(buffer_.data(), data + first_part, bytes - first_part);
+    write_position_.store(write_position + bytes, std::memory_order_release);
+    return true;
+}
+
+
+bool Spsc_Byte_Ring::write_zeros(size_t bytes)
+{
+    if (bytes > write_space())
+        {
+            return false;
+        }
+    const uint64_t write_position = write_position_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(write_position) & mask_;
+    const size_t first_part = std::min(bytes, buffer_.size() - offset);
+    memset(&buffer_[offset], 0, first_part);
+    memset(buffer_.data(), 0, bytes - first_part);
+    write_position_.store(write_position + bytes, std::memory_order_release);
+    return true;
+}
+
+
+size_t Spsc_Byte_Ring::read(uint8_t* data, size_t bytes)
+{
+    bytes = std::min(bytes, read_available());
+    const uint64_t read_position = read_position_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(read_position) & mask_;
+    const size_t first_part = std::min(bytes, buffer_.size() - offset);
+    memcpy(data, &buffer_[offset], first_part);
+    memcpy(data + first_part, buffer_.data(), bytes - first_part);
+    read_position_.store(read_position + bytes, std::memory_order_release);
+    return bytes;
+}
+
+
+const uint8_t* Spsc_Byte_Ring::read_pointer(size_t& bytes) const
+{
+    const uint64_t read_position = read_position_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(read_position) & mask_;
+    bytes = std::min(read_available(), buffer_.size() - offset);
+    return &buffer_[offset];
+}
+
+
+void Spsc_Byte_Ring::advance_read(size_t bytes)
+{
+    const uint64_t read_position = read_position_.load(std::memory_order_relaxed);
+    read_position_.store(read_position + std::min(bytes, read_available()), std::memory_order_release);
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file spsc_byte_ring.h
+ * \brief Lock-free ring buffer of bytes for one producer thread and one
+ * consumer thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_SPSC_BYTE_RING_H
+#define GNSS_SDR_SPSC_BYTE_RING_H
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_libs
+ * \{ */
+
+
+/*!
+ * \brief Ring buffer of bytes between a receiving thread (the producer) and
+ * the work() function of a signal source (the consumer).
+ *
+ * The write and read positions are atomic counters that only grow, each one
+ * modified by a single thread, so neither side takes a lock. The capacity is
+ * rounded up to a power of two. Writes are all-or-nothing, so that a packet
+ * is never split by an overflow.
+ */
+class Spsc_Byte_Ring
+{
+public:
+    explicit Spsc_Byte_Ring(size_t capacity_bytes);
+
+    size_t capacity() const { return buffer_.size(); }
+
+    /*!
+     * \brief Bytes that can be written without overflow (producer side)
+     */
+    size_t write_space() const;
+
+    /*!
+     * \brief Bytes available for reading (consumer side)
+     */
+    size_t read_available() const;
+
+    /*!
+     * \brief Writes \p bytes bytes, or nothing if they do not fit (producer side)
+     */
+    bool write(const uint8_t* data, size_t bytes);
+
+    /*!
+     * \brief Writes \p bytes zeros, or nothing if they do not fit (producer side)
+     */
+    bool write_zeros(size_t bytes);
+
+    /*!
+     * \brief Reads up to \p bytes bytes, and returns the number of bytes read
+     * (consumer side)
+     */
+    size_t read(uint8_t* data, size_t bytes);
+
+    /*!
+     * \brief Returns the address of the oldest unread byte, and in \p bytes
+     * the number of unread bytes that follow it in memory, up to the end of
+     * the buffer (consumer side)
+     */
+    const uint8_t* read_pointer(size_t& bytes) const;
+
+    /*!
+     * \brief Releases \p bytes bytes already read through read_pointer()
+     * (consumer side)
+     */
+    void advance_read(size_t bytes);
+
+private:
+    std::vector<uint8_t> buffer_;
+    size_t mask_;
+    // In different cache lines, so that each thread only writes its own
+    alignas(64) std::atomic<uint64_t> write_position_;
+    alignas(64) std::atomic<uint64_t> read_position_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_SPSC_BYTE_RING_H
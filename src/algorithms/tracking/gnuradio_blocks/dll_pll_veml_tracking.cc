@@ -45,6 +45,7 @@
 #include "gps_sdr_signal_replica.h"
 #include "lock_detectors.h"
 #include "tracking_discriminators.h"
+#include "trackingcmd.h"
 #include <gnuradio/io_signature.h>   // for io_signature
 #include <gnuradio/thread/thread.h>  // for scoped_lock
 #include <matio.h>                   // for Mat_VarCreate
@@ -79,6 +80,13 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
+namespace
+{
+// Maximum time between the primary and a secondary band channel for the
+// multi-band aiding [s]
+constexpr double MULTIBAND_AIDING_MAX_AGE_S = 0.1;
+}  // namespace
+
 dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 {
     return dll_pll_veml_tracking_sptr(new dll_pll_veml_tracking(conf_));
@@ -86,7 +94,7 @@ dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 
 
 dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
-    : gr::block("dll_pll_veml_tracking", gr::io_signature::make(1, 1, sizeof(gr_complex)),
+    : gr::block("dll_pll_veml_tracking", gr::io_signature::make(1, 1, conf_.item_type == "cshort" ? sizeof(lv_16sc_t) : sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(Gnss_Synchro))),
       d_trk_parameters(conf_),
       d_acquisition_gnss_synchro(nullptr),
@@ -109,6 +117,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
       d_code_phase_step_chips(0.0),
       d_code_phase_rate_step_chips(0.0),
       d_rem_code_phase_samples(0.0),  // Residual code phase (in chips)
+      d_multiband_aiding_doppler_hz(0.0),
       d_acq_sample_stamp(0ULL),
       d_rem_carr_phase_rad(0.0),  // Residual carrier phase
       d_state(0),                 // initial state: standby
@@ -129,7 +138,11 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
       d_dump(d_trk_parameters.dump),
       d_dump_mat(d_trk_parameters.dump_mat && d_dump),
       d_acc_carrier_phase_initialized(false),
-      d_Flag_PLL_180_deg_phase_locked(false)
+      d_Flag_PLL_180_deg_phase_locked(false),
+      d_vector_tracking_coasting(false),
+      d_multiband_primary(false),
+      d_multiband_aided(false),
+      d_cshort_input(d_trk_parameters.item_type == "cshort")
 {
 #if GNURADIO_GREATER_THAN_38
     this->set_relative_rate(1, static_cast<uint64_t>(d_trk_parameters.vector_length));
@@ -156,6 +169,24 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
 #endif
 #endif
 
+    // Vector tracking: Doppler predictions from the PVT block. The flowgraph
+    // connects this port only if it is registered.
+    if (d_trk_parameters.enable_vector_tracking)
+        {
+            this->message_port_register_in(pmt::mp("pvt_to_trk"));
+            this->set_msg_handler(
+                pmt::mp("pvt_to_trk"),
+#if HAS_GENERIC_LAMBDA
+                [this](auto &&PH1) { msg_handler_pvt_to_trk(PH1); });
+#else
+#if USE_BOOST_BIND_PLACEHOLDERS
+                boost::bind(&dll_pll_veml_tracking::msg_handler_pvt_to_trk, this, boost::placeholders::_1));
+#else
+                boost::bind(&dll_pll_veml_tracking::msg_handler_pvt_to_trk, this, _1));
+#endif
+#endif
+        }
+
     // initialize internal vars
     d_dll_filt_history.set_capacity(1000);
     d_signal_type = std::string(d_trk_parameters.signal);
@@ -466,6 +497,15 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     // Initial code frequency basis of NCO
     d_code_freq_chips = d_code_chip_rate;
 
+    // Optional pre-decimation of the wiped-off signal for narrow-band codes
+    const int32_t decimation_factor = Carrier_Wipeoff_Decimator::compute_decimation_factor(d_trk_parameters.fs_in, d_code_chip_rate, d_trk_parameters.predecimation_samples_per_chip);
+    d_wipeoff_decimator.init(static_cast<int>(2 * d_trk_parameters.vector_length), decimation_factor);
+    if (decimation_factor > 1)
+        {
+            LOG(INFO) << d_systemName << " " << d_signal_pretty_name << " correlators run at " << d_trk_parameters.fs_in / decimation_factor
+                      << " sps after a pre-decimation by " << decimation_factor;
+        }
+
     // Initialize tracking  ==========================================
     d_code_loop_filter = Tracking_loop_filter(static_cast<float>(d_code_period), d_trk_parameters.dll_bw_hz, d_trk_parameters.dll_filter_order, false);
     d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_hz, d_trk_parameters.pll_filter_order);
@@ -515,7 +555,14 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
             d_prompt_data_shift = &d_local_code_shift_chips[1];
         }
 
-    d_multicorrelator_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), d_n_correlator_taps);
+    if (d_cshort_input and d_wipeoff_decimator.decimation_factor() == 1)
+        {
+            d_multicorrelator_cpu_16sc.init(static_cast<int>(2 * d_trk_parameters.vector_length), d_n_correlator_taps);
+        }
+    else
+        {
+            d_multicorrelator_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), d_n_correlator_taps);
+        }
 
     if (d_trk_parameters.extend_correlation_symbols > 1)
         {
@@ -531,14 +578,30 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     if (d_trk_parameters.track_pilot)
         {
             // Extra correlator for the data component
-            d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
-            d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+            if (d_cshort_input and d_wipeoff_decimator.decimation_factor() == 1)
+                {
+                    d_correlator_data_cpu_16sc.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
+                    d_correlator_data_cpu_16sc.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+                }
+            else
+                {
+                    d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
+                    d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+                }
             d_data_code.resize(2 * d_code_length_chips, 0.0);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    d_multicorrelator_cpu_16sc.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    if (d_wipeoff_decimator.decimation_factor() > 1)
+        {
+            // The carrier rate is removed before decimation, and the code rate
+            // is folded into the code phase step of the correlation
+            d_multicorrelator_cpu.set_high_dynamics_resampler(false);
+            d_correlator_data_cpu.set_high_dynamics_resampler(false);
+        }
 
     // CN0 estimation and lock detector buffers
     d_Prompt_buffer = volk_gnsssdr::vector<gr_complex>(d_trk_parameters.cn0_samples);
@@ -604,6 +667,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
                 }
         }
     d_last_timetag_samplecounter = 0;
+    d_vector_tracking_coast_start = 0;
     d_timetag_waiting = false;
     set_tag_propagation_policy(TPP_DONT);  // no tag propagation, the time tag will be adjusted and regenerated in work()
 }
@@ -645,6 +709,28 @@ void dll_pll_veml_tracking::msg_handler_telemetry_to_trk(const pmt::pmt_t &msg)
 }
 
 
+void dll_pll_veml_tracking::msg_handler_pvt_to_trk(const pmt::pmt_t &msg)
+{
+    try
+        {
+            if (pmt::any_ref(msg).type().hash_code() == typeid(const std::shared_ptr<TrackingCmd>).hash_code())
+                {
+                    const auto cmd = wht::any_cast<const std::shared_ptr<TrackingCmd>>(pmt::any_ref(msg));
+                    gr::thread::scoped_lock lock(d_setlock);
+                    // The channel may have been assigned to another satellite since the command was sent
+                    if (d_state != 0 && cmd->channel_id == d_channel && cmd->prn == d_acquisition_gnss_synchro->PRN)
+                        {
+                            d_vector_tracking_aiding.update(cmd->sample_counter, cmd->pseudorange_rate_m_s);
+                        }
+                }
+        }
+    catch (const wht::bad_any_cast &e)
+        {
+            LOG(WARNING) << "msg_handler_pvt_to_trk Bad any_cast: " << e.what();
+        }
+}
+
+
 void dll_pll_veml_tracking::start_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
@@ -839,6 +925,15 @@ void dll_pll_veml_tracking::start_tracking()
         }
 
     d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    if (d_cshort_input)
+        {
+            // int16 copies of the local codes generated above
+            d_multicorrelator_cpu_16sc.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+            if (d_trk_parameters.track_pilot)
+                {
+                    d_correlator_data_cpu_16sc.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                }
+        }
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
@@ -873,6 +968,18 @@ void dll_pll_veml_tracking::start_tracking()
     // DLL/PLL filter initialization
     d_carrier_loop_filter.initialize(static_cast<float>(d_acq_carrier_doppler_hz));  // initialize the carrier filter
     d_code_loop_filter.initialize();                                                 // initialize the code filter
+    d_vector_tracking_aiding.configure(d_signal_carrier_freq, d_trk_parameters.fs_in, d_trk_parameters.vector_tracking_max_age_s);
+    d_vector_tracking_coasting = false;
+
+    // Multi-band aiding: the channel of the primary band drives the channels
+    // of the secondary bands of the same satellite
+    if (d_trk_parameters.enable_multiband_aiding)
+        {
+            d_multiband_group = Multiband_Tracking_Group::join(d_acquisition_gnss_synchro->System, d_acquisition_gnss_synchro->PRN);
+            d_multiband_primary = Multiband_Tracking_Group::is_primary_signal(d_signal_type);
+        }
+    d_multiband_aided = false;
+    d_multiband_aiding_doppler_hz = 0.0;
 
     // DEBUG OUTPUT
     std::cout << "Tracking of " << d_systemName << " " << d_signal_pretty_name << " signal started on channel " << d_channel << " for satellite " << Gnss_Satellite(d_systemName, d_acquisition_gnss_synchro->PRN) << '\n';
@@ -917,8 +1024,10 @@ dll_pll_veml_tracking::~dll_pll_veml_tracking()
             if (d_trk_parameters.track_pilot)
                 {
                     d_correlator_data_cpu.free();
+                    d_correlator_data_cpu_16sc.free();
                 }
             d_multicorrelator_cpu.free();
+            d_multicorrelator_cpu_16sc.free();
         }
     catch (const std::exception &ex)
         {
@@ -1021,6 +1130,26 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
         }
     if (d_carrier_lock_fail_counter > d_trk_parameters.max_carrier_lock_fail or d_code_lock_fail_counter > d_trk_parameters.max_code_lock_fail)
         {
+            // With the Doppler predicted by the PVT solution, the channel
+            // coasts through a blockage instead of going back to acquisition.
+            // Its observables are marked as not valid while it coasts.
+            double predicted_doppler_hz = 0.0;
+            if (d_trk_parameters.enable_vector_tracking && d_vector_tracking_aiding.get_doppler(this->nitems_read(0), predicted_doppler_hz))
+                {
+                    if (!d_vector_tracking_coasting)
+                        {
+                            d_vector_tracking_coasting = true;
+                            d_vector_tracking_coast_start = this->nitems_read(0);
+                            LOG(INFO) << "Channel " << d_channel << " coasting with the Doppler predicted by the PVT solution";
+                        }
+                    if (static_cast<double>(this->nitems_read(0) - d_vector_tracking_coast_start) < d_trk_parameters.vector_tracking_max_coast_s * d_trk_parameters.fs_in)
+                        {
+                            d_carrier_lock_fail_counter = std::min(d_carrier_lock_fail_counter, d_trk_parameters.max_carrier_lock_fail);
+                            d_code_lock_fail_counter = std::min(d_code_lock_fail_counter, d_trk_parameters.max_code_lock_fail);
+                            return true;
+                        }
+                }
+            d_vector_tracking_coasting = false;
             std::cout << "Loss of lock in channel " << d_channel << "!\n";
             LOG(INFO) << "Loss of lock in channel " << d_channel
                       << " (carrier_lock_fail_counter:" << d_carrier_lock_fail_counter
@@ -1030,6 +1159,7 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
             d_code_lock_fail_counter = 0;
             return false;
         }
+    d_vector_tracking_coasting = false;
     return true;
 }
 
@@ -1039,29 +1169,118 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
 // - updated remnant code phase in samples (d_rem_code_phase_samples)
 // - d_code_freq_chips
 // - d_carrier_doppler_hz
-void dll_pll_veml_tracking::do_correlation_step(const gr_complex *input_samples)
+void dll_pll_veml_tracking::do_correlation_step(const void *input_samples)
 {
+    const auto rem_code_phase_samples = static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip);
+    const auto code_phase_step_samples = static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip);
+    const auto code_phase_rate_step_samples = static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip);
+
     // ################# CARRIER WIPEOFF AND CORRELATORS ##############################
     // perform carrier wipe-off and compute Early, Prompt and Late correlation
-    d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), input_samples);
+    const int32_t decimation_factor = d_wipeoff_decimator.decimation_factor();
+    if (decimation_factor > 1)
+        {
+            int decimated_samples;
+            if (d_cshort_input)
+                {
+                    decimated_samples = d_wipeoff_decimator.wipeoff_and_decimate(static_cast<const lv_16sc_t *>(input_samples),
+                        d_rem_carr_phase_rad, static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                        d_trk_parameters.vector_length);
+                }
+            else
+                {
+                    decimated_samples = d_wipeoff_decimator.wipeoff_and_decimate(static_cast<const gr_complex *>(input_samples),
+                        d_rem_carr_phase_rad, static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                        d_trk_parameters.vector_length);
+                }
+
+            // Code phase at the centre of each full group of input samples, with
+            // the code rate approximated by a mean code phase step
+            const double center = 0.5 * static_cast<double>(decimation_factor - 1);
+            const double decimated_rem_code_phase = rem_code_phase_samples - code_phase_step_samples * center - code_phase_rate_step_samples * center * center;
+            const double decimated_code_phase_step = decimation_factor * (code_phase_step_samples + 2.0 * code_phase_rate_step_samples * center) +
+                                                     code_phase_rate_step_samples * decimation_factor * decimation_factor * decimated_samples;
+
+            // A shorter last group is centred earlier than the full ones, so
+            // it is correlated on its own, with the code phase at its centre
+            const int32_t last_group_samples = d_wipeoff_decimator.last_group_samples();
+            const int32_t full_groups = (last_group_samples == decimation_factor) ? decimated_samples : decimated_samples - 1;
+
+            d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), d_wipeoff_decimator.output());
+            d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(0.0, 0.0, 0.0,
+                static_cast<float>(decimated_rem_code_phase), static_cast<float>(decimated_code_phase_step), 0.0,
+                full_groups);
+
+            // DATA CORRELATOR (if tracking tracks the pilot signal)
+            if (d_trk_parameters.track_pilot)
+                {
+                    d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), d_wipeoff_decimator.output());
+                    d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(0.0, 0.0, 0.0,
+                        static_cast<float>(decimated_rem_code_phase), static_cast<float>(decimated_code_phase_step), 0.0,
+                        full_groups);
+                }
+
+            if (full_groups < decimated_samples)
+                {
+                    const double n = static_cast<double>(full_groups) * decimation_factor + 0.5 * static_cast<double>(last_group_samples - 1);
+                    const double code_phase = code_phase_step_samples * n + code_phase_rate_step_samples * n * n - rem_code_phase_samples;
+                    const gr_complex last_sample = d_wipeoff_decimator.output()[full_groups];
+                    const int32_t code_length_samples = d_code_samples_per_chip * d_code_length_chips;
+                    const auto code_index = [code_length_samples](double phase) {
+                        const auto index = static_cast<int32_t>(std::floor(phase)) % code_length_samples;
+                        return (index < 0) ? index + code_length_samples : index;
+                    };
+                    for (int32_t i = 0; i < d_n_correlator_taps; i++)
+                        {
+                            d_correlator_outs[i] += last_sample * d_tracking_code[code_index(code_phase + d_local_code_shift_chips[i])];
+                        }
+                    if (d_trk_parameters.track_pilot)
+                        {
+                            d_Prompt_Data[0] += last_sample * d_data_code[code_index(code_phase + *d_prompt_data_shift)];
+                        }
+                }
+            return;
+        }
+
+    if (d_cshort_input)
+        {
+            const auto *in = static_cast<const lv_16sc_t *>(input_samples);
+            d_multicorrelator_cpu_16sc.set_input_output_vectors(d_correlator_outs.data(), in);
+            d_multicorrelator_cpu_16sc.Carrier_wipeoff_multicorrelator_resampler(
+                d_rem_carr_phase_rad,
+                static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                rem_code_phase_samples, code_phase_step_samples, code_phase_rate_step_samples,
+                d_trk_parameters.vector_length);
+
+            // DATA CORRELATOR (if tracking tracks the pilot signal)
+            if (d_trk_parameters.track_pilot)
+                {
+                    d_correlator_data_cpu_16sc.set_input_output_vectors(d_Prompt_Data.data(), in);
+                    d_correlator_data_cpu_16sc.Carrier_wipeoff_multicorrelator_resampler(
+                        d_rem_carr_phase_rad,
+                        static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+                        rem_code_phase_samples, code_phase_step_samples, code_phase_rate_step_samples,
+                        d_trk_parameters.vector_length);
+                }
+            return;
+        }
+
+    const auto *in = static_cast<const gr_complex *>(input_samples);
+    d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), in);
     d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(
         d_rem_carr_phase_rad,
         static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-        static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-        static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-        static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+        rem_code_phase_samples, code_phase_step_samples, code_phase_rate_step_samples,
         d_trk_parameters.vector_length);
 
     // DATA CORRELATOR (if tracking tracks the pilot signal)
     if (d_trk_parameters.track_pilot)
         {
-            d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), input_samples);
+            d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), in);
             d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(
                 d_rem_carr_phase_rad,
                 static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-                static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
+                rem_code_phase_samples, code_phase_step_samples, code_phase_rate_step_samples,
                 d_trk_parameters.vector_length);
         }
 }
@@ -1110,6 +1329,20 @@ void dll_pll_veml_tracking::run_dll_pll()
 
     // New carrier Doppler frequency estimation
     d_carrier_doppler_hz = d_carr_error_filt_hz;
+    if (d_multiband_group)
+        {
+            run_multiband_aiding();
+        }
+
+    // Vector tracking: if the carrier is not locked, the Doppler predicted by
+    // the PVT solution drives the carrier NCO and aids the code loop
+    double predicted_doppler_hz = 0.0;
+    if (d_trk_parameters.enable_vector_tracking && !d_multiband_aided && !d_pull_in_transitory && d_carrier_lock_test < d_carrier_lock_threshold &&
+        d_vector_tracking_aiding.get_doppler(this->nitems_read(0), predicted_doppler_hz))
+        {
+            d_carrier_loop_filter.initialize(static_cast<float>(predicted_doppler_hz));
+            d_carrier_doppler_hz = predicted_doppler_hz;
+        }
 
     //    std::cout << "d_carrier_doppler_hz: " << d_carrier_doppler_hz << '\n';
     //    std::cout << "d_CN0_SNV_dB_Hz: " << this->d_CN0_SNV_dB_Hz << '\n';
@@ -1722,6 +1955,61 @@ void dll_pll_veml_tracking::stop_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
     d_state = 0;
+    if (d_multiband_group && d_multiband_primary)
+        {
+            d_multiband_group->withdraw();
+        }
+    d_multiband_group.reset();
+}
+
+
+void dll_pll_veml_tracking::run_multiband_aiding()
+{
+    const double rx_time_s = static_cast<double>(this->nitems_read(0)) / d_trk_parameters.fs_in;
+    if (d_multiband_primary)
+        {
+            if (!d_pull_in_transitory && d_carrier_lock_test >= d_carrier_lock_threshold)
+                {
+                    d_multiband_group->publish(rx_time_s, d_carrier_doppler_hz, d_signal_carrier_freq);
+                }
+            else
+                {
+                    d_multiband_group->withdraw();
+                }
+            return;
+        }
+
+    // Secondary band: the carrier filter only tracks the residual of the
+    // Doppler of the primary band scaled to this carrier frequency. The code
+    // frequency follows through the carrier aiding of the DLL.
+    double aiding_doppler_hz = 0.0;
+    if (d_multiband_group->get_doppler(rx_time_s, d_signal_carrier_freq, MULTIBAND_AIDING_MAX_AGE_S, aiding_doppler_hz))
+        {
+            if (!d_multiband_aided)
+                {
+                    d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_narrow_hz, d_trk_parameters.pll_filter_order);
+                    d_carrier_loop_filter.initialize(static_cast<float>(d_carr_error_filt_hz - aiding_doppler_hz));
+                    d_code_loop_filter.set_noise_bandwidth(d_trk_parameters.dll_bw_narrow_hz);
+                    d_carr_error_filt_hz -= aiding_doppler_hz;
+                    d_multiband_aided = true;
+                    DLOG(INFO) << "Channel " << d_channel << " aided by the primary band of satellite " << Gnss_Satellite(d_systemName, d_acquisition_gnss_synchro->PRN);
+                }
+            d_multiband_aiding_doppler_hz = aiding_doppler_hz;
+            d_carrier_doppler_hz = d_multiband_aiding_doppler_hz + d_carr_error_filt_hz;
+        }
+    else if (d_multiband_aided)
+        {
+            // Back to a standalone loop, starting from the last aided Doppler
+            d_carrier_doppler_hz = d_multiband_aiding_doppler_hz + d_carr_error_filt_hz;
+            if (d_state != 3)
+                {
+                    d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_hz, d_trk_parameters.pll_filter_order);
+                    d_code_loop_filter.set_noise_bandwidth(d_trk_parameters.dll_bw_hz);
+                }
+            d_carrier_loop_filter.initialize(static_cast<float>(d_carrier_doppler_hz));
+            d_multiband_aided = false;
+            DLOG(INFO) << "Channel " << d_channel << " no longer aided by the primary band of satellite " << Gnss_Satellite(d_systemName, d_acquisition_gnss_synchro->PRN);
+        }
 }
 
 
@@ -1737,7 +2025,7 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
     gr::thread::scoped_lock l(d_setlock);
-    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    const void *in = input_items[0];
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
     Gnss_Synchro current_synchro_data = Gnss_Synchro();
     current_synchro_data.Flag_valid_symbol_output = false;
@@ -2072,7 +2360,9 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
         {
             current_synchro_data.fs = static_cast<int64_t>(d_trk_parameters.fs_in);
             current_synchro_data.Tracking_sample_counter = this->nitems_read(0);
-            current_synchro_data.Flag_valid_symbol_output = !loss_of_lock;
+            // A channel coasting on the Doppler predicted by the PVT solution
+            // keeps its symbols flowing, but its observables are not valid
+            current_synchro_data.Flag_valid_symbol_output = !loss_of_lock && !d_vector_tracking_coasting;
             current_synchro_data.Flag_PLL_180_deg_phase_locked = d_Flag_PLL_180_deg_phase_locked;
 
             // generate new tag associated with gnss-synchro object
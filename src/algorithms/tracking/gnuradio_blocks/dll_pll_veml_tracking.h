@@ -18,13 +18,17 @@
 #ifndef GNSS_SDR_DLL_PLL_VEML_TRACKING_H
 #define GNSS_SDR_DLL_PLL_VEML_TRACKING_H
 
+#include "carrier_wipeoff_decimator.h"
 #include "cpu_multicorrelator_real_codes.h"
+#include "cpu_multicorrelator_real_codes_16sc.h"
 #include "dll_pll_conf.h"
 #include "exponential_smoother.h"
 #include "gnss_block_interface.h"
 #include "gnss_time.h"                // for timetags produced by File_Timestamp_Signal_Source
+#include "multiband_tracking_group.h"  // for multi-band aiding
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
+#include "vector_tracking_aiding.h"   // for PVT aiding
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>                   // for block
 #include <gnuradio/gr_complex.h>              // for gr_complex
@@ -34,6 +38,7 @@
 #include <cstddef>                            // for size_t
 #include <cstdint>                            // for int32_t
 #include <fstream>                            // for ofstream
+#include <memory>                             // for shared_ptr
 #include <string>                             // for string
 #include <typeinfo>                           // for typeid
 #include <utility>                            // for pair
@@ -75,8 +80,10 @@ private:
     explicit dll_pll_veml_tracking(const Dll_Pll_Conf &conf_);
 
     void msg_handler_telemetry_to_trk(const pmt::pmt_t &msg);
-    void do_correlation_step(const gr_complex *input_samples);
+    void msg_handler_pvt_to_trk(const pmt::pmt_t &msg);
+    void do_correlation_step(const void *input_samples);
     void run_dll_pll();
+    void run_multiband_aiding();
     void check_carrier_phase_coherent_initialization();
     void update_tracking_vars();
     void clear_tracking_vars();
@@ -89,6 +96,10 @@ private:
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
     Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
+    // for cshort input samples
+    Cpu_Multicorrelator_Real_Codes_16sc d_multicorrelator_cpu_16sc;
+    Cpu_Multicorrelator_Real_Codes_16sc d_correlator_data_cpu_16sc;
+    Carrier_Wipeoff_Decimator d_wipeoff_decimator;  // for pre-decimation
 
     Dll_Pll_Conf d_trk_parameters;
 
@@ -97,6 +108,8 @@ private:
 
     Tracking_loop_filter d_code_loop_filter;
     Tracking_FLL_PLL_filter d_carrier_loop_filter;
+    Vector_Tracking_Aiding d_vector_tracking_aiding;
+    std::shared_ptr<Multiband_Tracking_Group> d_multiband_group;
 
     Gnss_Synchro *d_acquisition_gnss_synchro;
 
@@ -141,6 +154,7 @@ private:
     double d_code_phase_step_chips;
     double d_code_phase_rate_step_chips;
     double d_rem_code_phase_samples;
+    double d_multiband_aiding_doppler_hz;
 
     gr_complex *d_Very_Early;
     gr_complex *d_Early;
@@ -169,6 +183,7 @@ private:
     uint64_t d_acq_sample_stamp;
     GnssTime d_last_timetag{};
     uint64_t d_last_timetag_samplecounter;
+    uint64_t d_vector_tracking_coast_start;
     bool d_timetag_waiting;
 
     float *d_prompt_data_shift;
@@ -204,6 +219,10 @@ private:
     bool d_acc_carrier_phase_initialized;
     bool d_enable_extended_integration;
     bool d_Flag_PLL_180_deg_phase_locked;
+    bool d_vector_tracking_coasting;
+    bool d_multiband_primary;
+    bool d_multiband_aided;
+    bool d_cshort_input;
 };
 
 
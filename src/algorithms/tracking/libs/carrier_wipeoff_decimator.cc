@@ -0,0 +1,109 @@
+/*!
+ * \file carrier_wipeoff_decimator.cc
+ * \brief Carrier wipe-off followed by an integrate-and-dump decimation of the
+ * input of a tracking channel
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "carrier_wipeoff_decimator.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+
+namespace
+{
+// Output samples between regenerations of the carrier phase
+constexpr int WIPEOFF_BLOCK_OUTPUTS = 64;
+}  // namespace
+
+
+void Carrier_Wipeoff_Decimator::init(int max_signal_length_samples, int decimation)
+{
+    d_decimation_factor = std::max(decimation, 1);
+    d_output = volk_gnsssdr::vector<gr_complex>(max_signal_length_samples / d_decimation_factor + 1);
+    d_wiped = volk_gnsssdr::vector<gr_complex>(max_signal_length_samples);
+    d_last_group_samples = d_decimation_factor;
+}
+
+
+int32_t Carrier_Wipeoff_Decimator::compute_decimation_factor(double fs_in, double code_chip_rate, double min_samples_per_chip)
+{
+    if (min_samples_per_chip <= 0.0 || code_chip_rate <= 0.0)
+        {
+            return 1;
+        }
+    return std::max(1, static_cast<int32_t>(std::floor(fs_in / (code_chip_rate * min_samples_per_chip))));
+}
+
+
+int Carrier_Wipeoff_Decimator::wipeoff_and_decimate(const gr_complex *sig_in, float rem_carrier_phase_rad, float phase_step_rad, float phase_rate_step_rad, int signal_length_samples)
+{
+    signal_length_samples = std::min(signal_length_samples, static_cast<int>(d_wiped.size()));
+    wipeoff(sig_in, rem_carrier_phase_rad, phase_step_rad, phase_rate_step_rad, signal_length_samples);
+    return decimate(signal_length_samples);
+}
+
+
+int Carrier_Wipeoff_Decimator::wipeoff_and_decimate(const lv_16sc_t *sig_in, float rem_carrier_phase_rad, float phase_step_rad, float phase_rate_step_rad, int signal_length_samples)
+{
+    // The samples are converted to float once, and rotated in place
+    signal_length_samples = std::min(signal_length_samples, static_cast<int>(d_wiped.size()));
+    volk_gnsssdr_16ic_convert_32fc(d_wiped.data(), sig_in, signal_length_samples);
+    wipeoff(d_wiped.data(), rem_carrier_phase_rad, phase_step_rad, phase_rate_step_rad, signal_length_samples);
+    return decimate(signal_length_samples);
+}
+
+
+void Carrier_Wipeoff_Decimator::wipeoff(const gr_complex *sig_in, double rem_carrier_phase_rad, double phase_step_rad, double phase_rate_step_rad, int signal_length_samples)
+{
+    // The rotator runs with the mean phase step of each block of samples, and
+    // the phase is regenerated from the carrier model at the start of every
+    // block, so that the phase rate is followed without accumulating errors
+    const int block_samples = WIPEOFF_BLOCK_OUTPUTS * d_decimation_factor;
+    for (int n0 = 0; n0 < signal_length_samples; n0 += block_samples)
+        {
+            const int samples = std::min(block_samples, signal_length_samples - n0);
+            const auto n = static_cast<double>(n0);
+            const double block_phase = rem_carrier_phase_rad + phase_step_rad * n + phase_rate_step_rad * n * (n - 1.0) / 2.0;
+            const double block_step = phase_step_rad + phase_rate_step_rad * (n + 0.5 * (samples - 1));
+            lv_32fc_t phase = std::polar(1.0F, static_cast<float>(-std::fmod(block_phase, 2.0 * M_PI)));
+            const lv_32fc_t phase_inc = std::polar(1.0F, static_cast<float>(-block_step));
+#if VOLK_EQUAL_OR_GREATER_31
+            volk_32fc_s32fc_x2_rotator2_32fc(d_wiped.data() + n0, sig_in + n0, &phase_inc, &phase, samples);
+#else
+            volk_32fc_s32fc_x2_rotator_32fc(d_wiped.data() + n0, sig_in + n0, phase_inc, &phase, samples);
+#endif
+        }
+}
+
+
+int Carrier_Wipeoff_Decimator::decimate(int signal_length_samples)
+{
+    const int factor = d_decimation_factor;
+    const int outputs = std::min((signal_length_samples + factor - 1) / factor, static_cast<int>(d_output.size()));
+    d_last_group_samples = factor;
+    for (int k = 0; k < outputs; k++)
+        {
+            const int n = k * factor;
+            const int samples = std::min(factor, signal_length_samples - n);
+            gr_complex acc(0.0, 0.0);
+            for (int j = 0; j < samples; j++)
+                {
+                    acc += d_wiped[n + j];
+                }
+            d_output[k] = acc;
+            d_last_group_samples = samples;
+        }
+    return outputs;
+}
@@ -0,0 +1,84 @@
+/*!
+ * \file carrier_wipeoff_decimator.h
+ * \brief Carrier wipe-off followed by an integrate-and-dump decimation of the
+ * input of a tracking channel
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CARRIER_WIPEOFF_DECIMATOR_H
+#define GNSS_SDR_CARRIER_WIPEOFF_DECIMATOR_H
+
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>        // for lv_16sc_t
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Removes the carrier of the samples of a correlation interval and
+ * sums groups of decimation_factor consecutive samples, so that the
+ * correlators of narrow-band signals can run at a fraction of the input
+ * sample rate.
+ *
+ * The carrier phase follows the same model as the correlators:
+ * rem_carrier_phase_rad + phase_step_rad * n + phase_rate_step_rad * n * (n - 1) / 2
+ * at input sample n, and is removed with the volk rotator kernel. Output
+ * sample k is centred at input sample k * decimation_factor +
+ * (decimation_factor - 1) / 2, except the last one, which sums only
+ * last_group_samples() samples when the signal length is not a multiple of
+ * the decimation factor, and is centred at
+ * k * decimation_factor + (last_group_samples() - 1) / 2.
+ */
+class Carrier_Wipeoff_Decimator
+{
+public:
+    Carrier_Wipeoff_Decimator() = default;
+    ~Carrier_Wipeoff_Decimator() = default;
+
+    void init(int max_signal_length_samples, int decimation);
+
+    /*!
+     * \brief Returns the decimation factor that keeps at least
+     * min_samples_per_chip samples per chip of a code with the given chip
+     * rate, or 1 if min_samples_per_chip is not positive.
+     */
+    static int32_t compute_decimation_factor(double fs_in, double code_chip_rate, double min_samples_per_chip);
+
+    //! Returns the number of output samples
+    int wipeoff_and_decimate(const gr_complex *sig_in, float rem_carrier_phase_rad, float phase_step_rad, float phase_rate_step_rad, int signal_length_samples);
+    int wipeoff_and_decimate(const lv_16sc_t *sig_in, float rem_carrier_phase_rad, float phase_step_rad, float phase_rate_step_rad, int signal_length_samples);
+
+    inline const gr_complex *output() const { return d_output.data(); }
+    inline int decimation_factor() const { return d_decimation_factor; }
+
+    //! Returns the number of input samples summed in the last output sample
+    inline int last_group_samples() const { return d_last_group_samples; }
+
+private:
+    void wipeoff(const gr_complex *sig_in, double rem_carrier_phase_rad, double phase_step_rad, double phase_rate_step_rad, int signal_length_samples);
+    int decimate(int signal_length_samples);
+
+    volk_gnsssdr::vector<gr_complex> d_output;
+    volk_gnsssdr::vector<gr_complex> d_wiped;  // input samples after the carrier wipe-off
+    int d_decimation_factor{1};
+    int d_last_group_samples{1};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CARRIER_WIPEOFF_DECIMATOR_H
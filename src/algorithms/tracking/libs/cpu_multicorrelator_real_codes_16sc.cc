@@ -0,0 +1,221 @@
+/*!
+ * \file cpu_multicorrelator_real_codes_16sc.cc
+ * \brief CPU vector multiTAP correlator class using real-valued local codes
+ * and 16-bit complex input samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "cpu_multicorrelator_real_codes_16sc.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::init(
+    int max_signal_length_samples,
+    int n_correlators)
+{
+    d_scaled_input = volk_gnsssdr::vector<lv_16sc_t>(max_signal_length_samples);
+    // Only one chunk of the resampled codes is kept
+    d_local_codes_resampled = volk_gnsssdr::vector<int16_t>(static_cast<size_t>(n_correlators) * CHUNK_SAMPLES);
+    d_chunk_corr_out = volk_gnsssdr::vector<lv_16sc_t>(n_correlators);
+    d_chunk_codes = std::vector<int16_t*>(n_correlators);
+    for (int n = 0; n < n_correlators; n++)
+        {
+            d_chunk_codes[n] = d_local_codes_resampled.data() + static_cast<size_t>(n) * CHUNK_SAMPLES;
+        }
+    d_n_correlators = n_correlators;
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::set_local_code_and_taps(
+    int code_length_chips,
+    const float* local_code_in,
+    float* shifts_chips)
+{
+    d_local_code.resize(code_length_chips);
+    d_local_code_peak = 1;
+    for (int i = 0; i < code_length_chips; i++)
+        {
+            d_local_code[i] = static_cast<int16_t>(std::lround(local_code_in[i]));
+            d_local_code_peak = std::max(d_local_code_peak, std::abs(static_cast<int>(d_local_code[i])));
+        }
+    d_shifts_chips = shifts_chips;
+    d_code_length_chips = code_length_chips;
+
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::set_input_output_vectors(std::complex<float>* corr_out, const lv_16sc_t* sig_in)
+{
+    d_sig_in = sig_in;
+    d_corr_out = corr_out;
+    return true;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes_16sc::correlate(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+    std::fill_n(d_corr_out, d_n_correlators, std::complex<float>(0.0, 0.0));
+    // Regenerate phase at each call in order to avoid numerical issues
+    lv_32fc_t phase_offset_as_complex[1];
+    phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
+
+    // The 16-bit accumulators of a chunk cannot overflow if CHUNK_SAMPLES
+    // times the largest product stays within the int16 range. After the
+    // carrier wipe-off, each component of a sample is bounded by |I| + |Q|
+    // (plus one for the rounding). Louder inputs are scaled down once, by a
+    // power of two, so that the chunks keep their length: the samples are
+    // dominated by noise, and the rounding adds a negligible noise to it.
+    int input_peak = 0;
+    for (int m = 0; m < signal_length_samples; m++)
+        {
+            input_peak = std::max(input_peak, std::abs(static_cast<int>(d_sig_in[m].real())) + std::abs(static_cast<int>(d_sig_in[m].imag())));
+        }
+    const int max_product = std::numeric_limits<int16_t>::max() / CHUNK_SAMPLES;
+    const bool use_16sc = 2 * d_local_code_peak <= max_product;
+    int shift = 0;
+    // The rounding of each component adds at most one to the scaled peak
+    while (use_16sc && (((input_peak + (1 << shift) - 1) >> shift) + 2) * d_local_code_peak > max_product)
+        {
+            shift++;
+        }
+    const lv_16sc_t* sig_in = d_sig_in;
+    if (shift > 0)
+        {
+            if (static_cast<int>(d_scaled_input.size()) < signal_length_samples)
+                {
+                    d_scaled_input.resize(signal_length_samples);
+                }
+            const int half = 1 << (shift - 1);
+            for (int m = 0; m < signal_length_samples; m++)
+                {
+                    d_scaled_input[m] = lv_16sc_t(static_cast<int16_t>((d_sig_in[m].real() + half) >> shift), static_cast<int16_t>((d_sig_in[m].imag() + half) >> shift));
+                }
+            sig_in = d_scaled_input.data();
+        }
+    const auto scale = static_cast<float>(1 << shift);
+
+    for (int first = 0; first < signal_length_samples; first += CHUNK_SAMPLES)
+        {
+            const int samples = std::min(CHUNK_SAMPLES, signal_length_samples - first);
+            const double n0 = static_cast<double>(first);
+
+            // Code phase at the first sample of the chunk, and mean code and
+            // carrier phase steps over the chunk
+            const double chunk_rem_code_phase = std::fmod(static_cast<double>(rem_code_phase_chips) - code_phase_step_chips * n0 - code_phase_rate_step_chips * n0 * n0, static_cast<double>(d_code_length_chips));
+            const double chunk_code_phase_step = code_phase_step_chips + code_phase_rate_step_chips * (2.0 * n0 + samples);
+            const double chunk_phase_step = phase_step_rad + phase_rate_step_rad * (n0 + 0.5 * (samples - 1));
+
+            volk_gnsssdr_16i_xn_resampler_16i_xn(d_chunk_codes.data(),
+                d_local_code.data(),
+                static_cast<float>(chunk_rem_code_phase),
+                static_cast<float>(chunk_code_phase_step),
+                d_shifts_chips,
+                d_code_length_chips,
+                d_n_correlators,
+                samples);
+
+            const lv_32fc_t phase_inc = std::exp(lv_32fc_t(0.0, static_cast<float>(-chunk_phase_step)));
+            if (use_16sc)
+                {
+                    // call VOLK_GNSSSDR kernel, which keeps the carrier phase between chunks
+                    volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn(d_chunk_corr_out.data(), sig_in + first, phase_inc, phase_offset_as_complex, const_cast<const int16_t**>(d_chunk_codes.data()), d_n_correlators, samples);
+                    for (int n = 0; n < d_n_correlators; n++)
+                        {
+                            d_corr_out[n] += scale * std::complex<float>(d_chunk_corr_out[n].real(), d_chunk_corr_out[n].imag());
+                        }
+                }
+            else
+                {
+                    correlate_chunk_float(first, samples, phase_offset_as_complex[0], phase_inc);
+                }
+        }
+}
+
+
+void Cpu_Multicorrelator_Real_Codes_16sc::correlate_chunk_float(int first, int samples, lv_32fc_t& phase, lv_32fc_t phase_inc)
+{
+    for (int m = 0; m < samples; m++)
+        {
+            const lv_32fc_t sample = lv_32fc_t(d_sig_in[first + m].real(), d_sig_in[first + m].imag()) * phase;
+            for (int n = 0; n < d_n_correlators; n++)
+                {
+                    d_corr_out[n] += sample * static_cast<float>(d_chunk_codes[n][m]);
+                }
+            phase *= phase_inc;
+        }
+    phase /= std::abs(phase);
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::Carrier_wipeoff_multicorrelator_resampler(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float phase_rate_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+    if (d_use_high_dynamics_resampler)
+        {
+            correlate(rem_carrier_phase_in_rad, phase_step_rad, phase_rate_step_rad, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, signal_length_samples);
+        }
+    else
+        {
+            correlate(rem_carrier_phase_in_rad, phase_step_rad, 0.0, rem_code_phase_chips, code_phase_step_chips, 0.0, signal_length_samples);
+        }
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::Carrier_wipeoff_multicorrelator_resampler(
+    float rem_carrier_phase_in_rad,
+    float phase_step_rad,
+    float rem_code_phase_chips,
+    float code_phase_step_chips,
+    float code_phase_rate_step_chips,
+    int signal_length_samples)
+{
+    correlate(rem_carrier_phase_in_rad, phase_step_rad, 0.0, rem_code_phase_chips, code_phase_step_chips, d_use_high_dynamics_resampler ? code_phase_rate_step_chips : 0.0F, signal_length_samples);
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes_16sc::free()
+{
+    d_local_codes_resampled.clear();
+    d_local_codes_resampled.shrink_to_fit();
+    d_chunk_codes.clear();
+    d_scaled_input.clear();
+    d_scaled_input.shrink_to_fit();
+    d_n_correlators = 0;
+    return true;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes_16sc::set_high_dynamics_resampler(
+    bool use_high_dynamics_resampler)
+{
+    d_use_high_dynamics_resampler = use_high_dynamics_resampler;
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file cpu_multicorrelator_real_codes_16sc.h
+ * \brief CPU vector multiTAP correlator class using real-valued local codes
+ * and 16-bit complex input samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CPU_MULTICORRELATOR_REAL_CODES_16SC_H
+#define GNSS_SDR_CPU_MULTICORRELATOR_REAL_CODES_16SC_H
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Class that implements carrier wipe-off and correlators for
+ * std::complex<short> input samples, with the same interface as
+ * Cpu_Multicorrelator_Real_Codes.
+ *
+ * The local codes are resampled to int16 and correlated with the
+ * volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn kernel. That kernel
+ * accumulates with 16-bit saturation, so the integration is split in chunks
+ * of CHUNK_SAMPLES samples whose partial results are added in float. If the
+ * peak of the input samples could overflow the accumulators within a chunk,
+ * the input is first scaled down by the smallest power of two that avoids
+ * it, and the results are scaled back. Only a local code too large for any
+ * input is integrated in float. The resampled codes of a chunk stay
+ * in the L1 data cache. In the high dynamics mode, the code and carrier
+ * rates are applied per chunk.
+ */
+class Cpu_Multicorrelator_Real_Codes_16sc
+{
+public:
+    Cpu_Multicorrelator_Real_Codes_16sc() = default;
+    ~Cpu_Multicorrelator_Real_Codes_16sc() = default;
+    void set_high_dynamics_resampler(bool use_high_dynamics_resampler);
+    bool init(int max_signal_length_samples, int n_correlators);
+    //! Stores an int16 copy of the real-valued local code
+    bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
+    bool set_input_output_vectors(std::complex<float> *corr_out, const lv_16sc_t *sig_in);
+    bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    bool free();
+
+    static constexpr int CHUNK_SAMPLES = 64;
+
+private:
+    void correlate(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    void correlate_chunk_float(int first, int samples, lv_32fc_t &phase, lv_32fc_t phase_inc);  // advances the phase
+
+    volk_gnsssdr::vector<int16_t> d_local_code;             // int16 copy of the local code
+    volk_gnsssdr::vector<int16_t> d_local_codes_resampled;  // one chunk per correlator
+    volk_gnsssdr::vector<lv_16sc_t> d_chunk_corr_out;
+    volk_gnsssdr::vector<lv_16sc_t> d_scaled_input;  // input scaled down to the headroom of a chunk
+    std::vector<int16_t *> d_chunk_codes;
+    const lv_16sc_t *d_sig_in{nullptr};
+    std::complex<float> *d_corr_out{nullptr};
+    float *d_shifts_chips{nullptr};
+    int d_code_length_chips{0};
+    int d_local_code_peak{1};  // largest absolute value of the int16 local code
+    int d_n_correlators{0};
+    bool d_use_high_dynamics_resampler{true};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CPU_MULTICORRELATOR_REAL_CODES_16SC_H
@@ -58,6 +58,7 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
     double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", fs_in);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     high_dyn = configuration->property(role + ".high_dyn", high_dyn);
+    predecimation_samples_per_chip = configuration->property(role + ".predecimation_samples_per_chip", predecimation_samples_per_chip);
     dump = configuration->property(role + ".dump", dump);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
     dump_mat = configuration->property(role + ".dump_mat", dump_mat);
@@ -136,6 +137,10 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
     max_carrier_lock_fail = configuration->property(role + ".max_carrier_lock_fail", max_carrier_lock_fail);
     carrier_lock_th = configuration->property(role + ".carrier_lock_th", carrier_lock_th);
     carrier_aiding = configuration->property(role + ".carrier_aiding", carrier_aiding);
+    enable_vector_tracking = configuration->property(role + ".enable_vector_tracking", enable_vector_tracking);
+    vector_tracking_max_age_s = configuration->property(role + ".vector_tracking_max_age_s", vector_tracking_max_age_s);
+    vector_tracking_max_coast_s = configuration->property(role + ".vector_tracking_max_coast_s", vector_tracking_max_coast_s);
+    enable_multiband_aiding = configuration->property(role + ".enable_multiband_aiding", enable_multiband_aiding);
 
     // tracking lock tests smoother parameters
     cn0_smoother_samples = configuration->property(role + ".cn0_smoother_samples", cn0_smoother_samples);
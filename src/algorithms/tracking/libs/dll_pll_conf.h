@@ -40,6 +40,8 @@ public:
     std::string dump_filename{"./dll_pll_dump.dat"};
     double fs_in{2000000.0};
     double carrier_lock_th{0.0};
+    double vector_tracking_max_age_s{1.0};
+    double vector_tracking_max_coast_s{10.0};
     float pll_pull_in_bw_hz{50.0};
     float dll_pull_in_bw_hz{3.0};
     float fll_bw_hz{35.0};
@@ -56,6 +58,7 @@ public:
     float y_intercept{1.0};
     float cn0_smoother_alpha{0.002};
     float carrier_lock_test_smoother_alpha{0.002};
+    float predecimation_samples_per_chip{0.0};
     uint32_t pull_in_time_s{10U};
     uint32_t bit_synchronization_time_limit_s{20U};
     uint32_t vector_length{0U};
@@ -78,6 +81,8 @@ public:
     bool enable_doppler_correction{false};
     bool carrier_aiding{true};
     bool high_dyn{false};
+    bool enable_vector_tracking{false};
+    bool enable_multiband_aiding{false};
     bool dump{false};
     bool dump_mat{true};
 };
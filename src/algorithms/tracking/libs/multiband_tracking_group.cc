@@ -0,0 +1,103 @@
+/*!
+ * \file multiband_tracking_group.cc
+ * \brief Carrier dynamics shared by the tracking channels of the signals of
+ * the same satellite in different frequency bands.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "multiband_tracking_group.h"
+#include "MATH_CONSTANTS.h"  // for SPEED_OF_LIGHT_M_S
+#include <cmath>             // for std::abs
+#include <map>               // for std::map
+#include <utility>           // for std::pair
+
+
+std::shared_ptr<Multiband_Tracking_Group> Multiband_Tracking_Group::join(char system, uint32_t prn)
+{
+    // The channels of a receiver are created and restarted independently,
+    // so the groups are kept in a registry indexed by satellite
+    static std::mutex registry_mutex;
+    static std::map<std::pair<char, uint32_t>, std::weak_ptr<Multiband_Tracking_Group>> registry;
+
+    const std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto it = registry.begin(); it != registry.end();)
+        {
+            if (it->second.expired())
+                {
+                    it = registry.erase(it);
+                }
+            else
+                {
+                    ++it;
+                }
+        }
+
+    auto& entry = registry[std::make_pair(system, prn)];
+    std::shared_ptr<Multiband_Tracking_Group> group = entry.lock();
+    if (!group)
+        {
+            group = std::make_shared<Multiband_Tracking_Group>();
+            entry = group;
+        }
+    return group;
+}
+
+
+bool Multiband_Tracking_Group::is_primary_signal(const std::string& signal)
+{
+    return signal == "1C" || signal == "1B" || signal == "B1";
+}
+
+
+void Multiband_Tracking_Group::publish(double rx_time_s, double carrier_doppler_hz, double carrier_freq_hz)
+{
+    const double pseudorange_rate_m_s = -carrier_doppler_hz * SPEED_OF_LIGHT_M_S / carrier_freq_hz;
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (!valid_ || rx_time_s < anchor_rx_time_s_)
+        {
+            anchor_rx_time_s_ = rx_time_s;
+            anchor_pseudorange_rate_m_s_ = pseudorange_rate_m_s;
+            pseudorange_accel_m_s2_ = 0.0;
+        }
+    else if (rx_time_s - anchor_rx_time_s_ >= RATE_INTERVAL_S)
+        {
+            // The Doppler of a single integration is too noisy to be differentiated
+            pseudorange_accel_m_s2_ = (pseudorange_rate_m_s - anchor_pseudorange_rate_m_s_) / (rx_time_s - anchor_rx_time_s_);
+            anchor_rx_time_s_ = rx_time_s;
+            anchor_pseudorange_rate_m_s_ = pseudorange_rate_m_s;
+        }
+    rx_time_s_ = rx_time_s;
+    pseudorange_rate_m_s_ = pseudorange_rate_m_s;
+    valid_ = true;
+}
+
+
+void Multiband_Tracking_Group::withdraw()
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    valid_ = false;
+}
+
+
+bool Multiband_Tracking_Group::get_doppler(double rx_time_s, double carrier_freq_hz, double max_age_s, double& doppler_hz) const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    // The secondary channels can be ahead of, or behind, the primary one
+    const double age_s = rx_time_s - rx_time_s_;
+    if (!valid_ || std::abs(age_s) > max_age_s)
+        {
+            return false;
+        }
+    const double pseudorange_rate_m_s = pseudorange_rate_m_s_ + pseudorange_accel_m_s2_ * age_s;
+    doppler_hz = -pseudorange_rate_m_s * carrier_freq_hz / SPEED_OF_LIGHT_M_S;
+    return true;
+}
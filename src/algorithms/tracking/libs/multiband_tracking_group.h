@@ -0,0 +1,95 @@
+/*!
+ * \file multiband_tracking_group.h
+ * \brief Carrier dynamics shared by the tracking channels of the signals of
+ * the same satellite in different frequency bands.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_MULTIBAND_TRACKING_GROUP_H
+#define GNSS_SDR_MULTIBAND_TRACKING_GROUP_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*! \brief
+ * Class that shares the carrier dynamics of a satellite among the tracking
+ * channels of its signals in different frequency bands.
+ *
+ * The channel of the primary band (L1 / E1 / B1) publishes its carrier
+ * Doppler as a pseudorange rate, which is common to all the bands. The
+ * channels of the secondary bands scale it to their own carrier frequency
+ * and only track the residual with narrow loops. The rate of change of the
+ * pseudorange rate is estimated over RATE_INTERVAL_S, so that the prediction
+ * can be propagated to the time of the secondary channels, which are not
+ * synchronized with the primary one.
+ */
+class Multiband_Tracking_Group
+{
+public:
+    Multiband_Tracking_Group() = default;
+
+    /*!
+     * \brief Returns the group of the satellite, shared by all the channels
+     * that join it. The group is released when its last channel leaves.
+     */
+    static std::shared_ptr<Multiband_Tracking_Group> join(char system, uint32_t prn);
+
+    /*!
+     * \brief Returns true if the signal is the one of the primary band of
+     * its system, that is, the one that drives the group
+     */
+    static bool is_primary_signal(const std::string& signal);
+
+    /*!
+     * \brief Publishes the carrier Doppler [Hz] of the primary channel at
+     * the receiver time rx_time_s [s]
+     */
+    void publish(double rx_time_s, double carrier_doppler_hz, double carrier_freq_hz);
+
+    /*!
+     * \brief Invalidates the published dynamics, for instance when the
+     * primary channel loses the carrier lock
+     */
+    void withdraw();
+
+    /*!
+     * \brief Gets the carrier Doppler [Hz] at the given carrier frequency
+     * [Hz] and receiver time [s]. Returns false if nothing was published, or
+     * if the last publication is more than max_age_s away.
+     */
+    bool get_doppler(double rx_time_s, double carrier_freq_hz, double max_age_s, double& doppler_hz) const;
+
+    static constexpr double RATE_INTERVAL_S = 0.02;
+
+private:
+    mutable std::mutex mutex_;
+    double rx_time_s_{0.0};
+    double pseudorange_rate_m_s_{0.0};
+    double pseudorange_accel_m_s2_{0.0};
+    double anchor_rx_time_s_{0.0};
+    double anchor_pseudorange_rate_m_s_{0.0};
+    bool valid_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MULTIBAND_TRACKING_GROUP_H
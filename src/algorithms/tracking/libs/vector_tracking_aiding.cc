@@ -0,0 +1,70 @@
+/*!
+ * \file vector_tracking_aiding.cc
+ * \brief Carrier Doppler predicted by the PVT solution for the aiding of a
+ * tracking channel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "vector_tracking_aiding.h"
+#include "MATH_CONSTANTS.h"  // for SPEED_OF_LIGHT_M_S
+
+
+void Vector_Tracking_Aiding::configure(double carrier_freq_hz, double fs_in, double max_age_s)
+{
+    carrier_freq_hz_ = carrier_freq_hz;
+    fs_in_ = fs_in;
+    max_age_samples_ = max_age_s * fs_in;
+    reset();
+}
+
+
+void Vector_Tracking_Aiding::update(uint64_t sample_counter, double pseudorange_rate_m_s)
+{
+    const double doppler_hz = -pseudorange_rate_m_s * carrier_freq_hz_ / SPEED_OF_LIGHT_M_S;
+    doppler_rate_hz_s_ = 0.0;
+    if (valid_ && sample_counter > sample_counter_)
+        {
+            const auto elapsed_samples = static_cast<double>(sample_counter - sample_counter_);
+            if (elapsed_samples <= max_age_samples_)
+                {
+                    doppler_rate_hz_s_ = (doppler_hz - doppler_hz_) * fs_in_ / elapsed_samples;
+                }
+        }
+    doppler_hz_ = doppler_hz;
+    sample_counter_ = sample_counter;
+    valid_ = true;
+}
+
+
+bool Vector_Tracking_Aiding::get_doppler(uint64_t sample_counter, double& doppler_hz) const
+{
+    if (!valid_ || sample_counter < sample_counter_)
+        {
+            return false;
+        }
+    const auto age_samples = static_cast<double>(sample_counter - sample_counter_);
+    if (age_samples > max_age_samples_)
+        {
+            return false;
+        }
+    doppler_hz = doppler_hz_ + doppler_rate_hz_s_ * age_samples / fs_in_;
+    return true;
+}
+
+
+void Vector_Tracking_Aiding::reset()
+{
+    doppler_hz_ = 0.0;
+    doppler_rate_hz_s_ = 0.0;
+    sample_counter_ = 0ULL;
+    valid_ = false;
+}
@@ -0,0 +1,74 @@
+/*!
+ * \file vector_tracking_aiding.h
+ * \brief Carrier Doppler predicted by the PVT solution for the aiding of a
+ * tracking channel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_VECTOR_TRACKING_AIDING_H
+#define GNSS_SDR_VECTOR_TRACKING_AIDING_H
+
+#include <cstdint>
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*! \brief
+ * Class that keeps the pseudorange rate predicted by the PVT solution for
+ * the satellite of a tracking channel, and propagates it to the current
+ * sample as a carrier Doppler.
+ *
+ * The rate of change of the Doppler is estimated from consecutive
+ * predictions. A prediction older than the maximum age is not used.
+ */
+class Vector_Tracking_Aiding
+{
+public:
+    Vector_Tracking_Aiding() = default;
+
+    /*!
+     * \brief Sets the carrier frequency of the tracked signal [Hz], the
+     * sampling rate [Hz], and the maximum age of a prediction [s]
+     */
+    void configure(double carrier_freq_hz, double fs_in, double max_age_s);
+
+    /*!
+     * \brief Stores the pseudorange rate [m/s] predicted for the given sample
+     */
+    void update(uint64_t sample_counter, double pseudorange_rate_m_s);
+
+    /*!
+     * \brief Gets the carrier Doppler [Hz] predicted at the given sample.
+     * Returns false if there is no prediction, or if it is too old.
+     */
+    bool get_doppler(uint64_t sample_counter, double& doppler_hz) const;
+
+    void reset();
+
+private:
+    double carrier_freq_hz_{0.0};
+    double fs_in_{0.0};
+    double max_age_samples_{0.0};
+    double doppler_hz_{0.0};
+    double doppler_rate_hz_s_{0.0};
+    uint64_t sample_counter_{0ULL};
+    bool valid_{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_VECTOR_TRACKING_AIDING_H
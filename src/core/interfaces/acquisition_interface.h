@@ -60,6 +60,12 @@ public:
     {
         return;
     }
+    // Returns false if the implementation cannot resize the grid and keeps the configured one
+    virtual bool set_doppler_window(int doppler_center, unsigned int doppler_max __attribute__((unused)))
+    {
+        set_doppler_center(doppler_center);
+        return false;
+    }
     virtual void init() = 0;
     virtual void set_local_code() = 0;
     virtual void set_state(int state) = 0;
@@ -25,6 +25,7 @@
 #include "reed_solomon.h"           // for ReedSolomon
 #include <gnuradio/io_signature.h>  // for gr::io_signature::make
 #include <algorithm>                // for std::find, std::count
+#include <array>                    // for std::array
 #include <cmath>                    // for std::remainder
 #include <cstddef>                  // for size_t
 #include <iterator>                 // for std::back_inserter
@@ -307,26 +308,29 @@ int galileo_e6_has_msg_receiver::decode_message_type1(uint8_t message_id, uint8_
     DLOG(INFO) << "Start decoding of a HAS message";
     constexpr int32_t max_erasure_positions = GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK - GALILEO_CNAV_INFORMATION_VECTOR_LENGTH;  // 223 Maximum erasure positions ( = number of parity symbols in a block)
 
-    // Compute erasure positions
-    std::vector<int> erasure_positions;
-    erasure_positions.reserve(max_erasure_positions);
-
-    for (uint8_t i = 1; i < message_size + 1; i++)  // we know that from message_size to 32, the value is 0
+    // Compute the positions of the known symbols. There is no need to search
+    // the list of received PIDs for each position.
+    std::array<bool, GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK + 1> received_pid{};
+    for (auto pid : d_received_pids[message_id])
         {
-            if (std::find(d_received_pids[message_id].begin(), d_received_pids[message_id].end(), i) == d_received_pids[message_id].end())
-                {
-                    erasure_positions.push_back(i - 1);
-                }
+            received_pid[pid] = true;
         }
-    for (int i = GALILEO_CNAV_INFORMATION_VECTOR_LENGTH + 1; i < GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK + 1; i++)  // from 33 to 255
+    std::vector<int> known_positions;
+    known_positions.reserve(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK);
+    int32_t n_erasures = 0;
+    for (int i = 1; i < GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK + 1; i++)
         {
-            if (std::find(d_received_pids[message_id].begin(), d_received_pids[message_id].end(), static_cast<uint8_t>(i)) == d_received_pids[message_id].end())
+            if (received_pid[i] || (i > message_size && i < GALILEO_CNAV_INFORMATION_VECTOR_LENGTH + 1))  // we know that from message_size to 32, the value is 0
+                {
+                    known_positions.push_back(i - 1);
+                }
+            else
                 {
-                    erasure_positions.push_back(i - 1);
+                    n_erasures++;
                 }
         }
 
-    if (erasure_positions.size() > static_cast<size_t>(max_erasure_positions))
+    if (n_erasures > max_erasure_positions)
         {
             // This should not happen! Maybe message_size < PID < 33 ?
             // Don't even try to decode
@@ -345,38 +349,17 @@ int galileo_e6_has_msg_receiver::decode_message_type1(uint8_t message_id, uint8_
         }
 
     DLOG(INFO) << debug_print_vector("List of received PIDs", d_received_pids[message_id]);
-    DLOG(INFO) << debug_print_vector("erasure_positions", erasure_positions);
+    DLOG(INFO) << debug_print_vector("known_positions", known_positions);
     DLOG(INFO) << debug_print_matrix("C_matrix", d_C_matrix[message_id]);
 
-    // Reset HAS decoded message matrix
-    d_M_matrix = std::vector<std::vector<uint8_t>>(GALILEO_CNAV_INFORMATION_VECTOR_LENGTH, std::vector<uint8_t>(GALILEO_CNAV_OCTETS_IN_SUBPAGE));
-
-    // Vertical decoding of d_C_matrix
-    for (int col = 0; col < GALILEO_CNAV_OCTETS_IN_SUBPAGE; col++)
+    // Vertical decoding of d_C_matrix. All the columns share the same
+    // erasure pattern, so they are decoded at once into d_M_matrix.
+    if (d_rs->decode_erasures(d_C_matrix[message_id], known_positions, d_M_matrix) < 0)
         {
-            std::vector<uint8_t> C_column(GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK);
-            for (auto pid : d_received_pids[message_id])
-                {
-                    C_column[pid - 1] = d_C_matrix[message_id][pid - 1][col];
-                }
-
-            int result = d_rs->decode(C_column, erasure_positions);
-
-            if (result < 0)
-                {
-                    DLOG(ERROR) << "Decoding of HAS page failed";
-                    return -1;
-                }
-
-            std::vector<uint8_t> M_column(C_column.begin(), C_column.begin() + GALILEO_CNAV_INFORMATION_VECTOR_LENGTH);
-            for (int i = 0; i < GALILEO_CNAV_INFORMATION_VECTOR_LENGTH; i++)
-                {
-                    d_M_matrix[i][col] = M_column[i];
-                }
-
-            DLOG(INFO) << debug_print_vector("C_column entering the decoder", C_column);
-            DLOG(INFO) << "Successful HAS page decoding";
+            DLOG(ERROR) << "Decoding of HAS page failed";
+            return -1;
         }
+    DLOG(INFO) << "Successful HAS page decoding";
 
     DLOG(INFO) << debug_print_matrix("M_matrix", d_M_matrix);
 
@@ -19,6 +19,7 @@
 #include "gnss_crypto.h"
 #include "Galileo_OSNMA.h"
 #include <pugixml.hpp>
+#include <array>
 #include <cstddef>
 #include <cstring>
 #include <fstream>
@@ -474,15 +475,20 @@ bool Gnss_Crypto::verify_signature_ecdsa_p521(const std::vector<uint8_t>& messag
 
 std::vector<uint8_t> Gnss_Crypto::compute_SHA_256(const std::vector<uint8_t>& input) const
 {
-    std::vector<uint8_t> output(32);  // SHA256 hash size
+    std::array<uint8_t, 32> output{};  // SHA256 hash size
+    compute_SHA_256(input.data(), input.size(), output);
+    return std::vector<uint8_t>(output.begin(), output.end());
+}
+
+
+void Gnss_Crypto::compute_SHA_256(const uint8_t* input, size_t input_length, std::array<uint8_t, 32>& output) const
+{
+    output.fill(0);
 #if USE_GNUTLS_FALLBACK
-    std::vector<uint8_t> output_aux(32);
     gnutls_hash_hd_t hashHandle;
     gnutls_hash_init(&hashHandle, GNUTLS_DIG_SHA256);
-    gnutls_hash(hashHandle, input.data(), input.size());
-    gnutls_hash_output(hashHandle, output_aux.data());
-    output = output_aux;
-    gnutls_hash_deinit(hashHandle, output_aux.data());
+    gnutls_hash(hashHandle, input, input_length);
+    gnutls_hash_deinit(hashHandle, output.data());
 #else  // OpenSSL
 #if USE_OPENSSL_3
     unsigned int mdLen;
@@ -491,46 +497,50 @@ std::vector<uint8_t> Gnss_Crypto::compute_SHA_256(const std::vector<uint8_t>& in
         {
             // LOG(WARNING) << "OSNMA SHA-256: Message digest initialization failed.";
             EVP_MD_CTX_free(mdCtx);
-            return output;
+            return;
         }
-    if (!EVP_DigestUpdate(mdCtx, input.data(), input.size()))
+    if (!EVP_DigestUpdate(mdCtx, input, input_length))
         {
             // LOG(WARNING) << "OSNMA SHA-256: Message digest update failed.";
             EVP_MD_CTX_free(mdCtx);
-            return output;
+            return;
         }
     if (!EVP_DigestFinal_ex(mdCtx, output.data(), &mdLen))
         {
             // LOG(WARNING) << "OSNMA SHA-256: Message digest finalization failed.";
             EVP_MD_CTX_free(mdCtx);
-            return output;
+            return;
         }
     EVP_MD_CTX_free(mdCtx);
 #else  // OpenSSL 1.x
     SHA256_CTX sha256Context;
     SHA256_Init(&sha256Context);
-    SHA256_Update(&sha256Context, input.data(), input.size());
+    SHA256_Update(&sha256Context, input, input_length);
     SHA256_Final(output.data(), &sha256Context);
 #endif
 #endif
-    return output;
 }
 
 
 std::vector<uint8_t> Gnss_Crypto::compute_SHA3_256(const std::vector<uint8_t>& input) const
 {
-    std::vector<uint8_t> output(32);  // SHA256 hash size
+    std::array<uint8_t, 32> output{};  // SHA256 hash size
+    compute_SHA3_256(input.data(), input.size(), output);
+    return std::vector<uint8_t>(output.begin(), output.end());
+}
+
+
+void Gnss_Crypto::compute_SHA3_256(const uint8_t* input, size_t input_length, std::array<uint8_t, 32>& output) const
+{
+    output.fill(0);
 #if USE_GNUTLS_FALLBACK
 #if HAVE_GNUTLS_DIG_SHA3_256
-    std::vector<uint8_t> output_aux(32);
     gnutls_hash_hd_t hashHandle;
     gnutls_hash_init(&hashHandle, GNUTLS_DIG_SHA3_256);
-    gnutls_hash(hashHandle, input.data(), input.size());
-    gnutls_hash_output(hashHandle, output_aux.data());
-    output = output_aux;
-    gnutls_hash_deinit(hashHandle, output_aux.data());
+    gnutls_hash(hashHandle, input, input_length);
+    gnutls_hash_deinit(hashHandle, output.data());
 #else
-    if (input.empty())
+    if (input_length == 0 || input == nullptr)
         {
             // do nothing
         }
@@ -541,18 +551,17 @@ std::vector<uint8_t> Gnss_Crypto::compute_SHA3_256(const std::vector<uint8_t>& i
     const EVP_MD* md = EVP_sha3_256();
 
     EVP_DigestInit_ex(mdctx, md, nullptr);
-    EVP_DigestUpdate(mdctx, input.data(), input.size());
+    EVP_DigestUpdate(mdctx, input, input_length);
     EVP_DigestFinal_ex(mdctx, output.data(), nullptr);
     EVP_MD_CTX_free(mdctx);
 #else  // OpenSSL 1.x
     // SHA3-256 not implemented in OpenSSL 1.0, it was introduced in OpenSSL 1.1.1
-    if (!input.empty())
+    if (input_length == 0 || input == nullptr)
         {
             // do nothing
         }
 #endif
 #endif
-    return output;
 }
 
 
@@ -787,6 +796,105 @@ std::vector<uint8_t> Gnss_Crypto::compute_CMAC_AES(const std::vector<uint8_t>& k
 }
 
 
+std::vector<std::vector<uint8_t>> Gnss_Crypto::compute_HMAC_SHA_256(const std::vector<uint8_t>& key, const std::vector<std::vector<uint8_t>>& inputs) const
+{
+    std::vector<std::vector<uint8_t>> outputs;
+    outputs.reserve(inputs.size());
+#if USE_OPENSSL_3 && !USE_GNUTLS_FALLBACK
+    // Fetch the algorithm and set the key once, then compute each MAC on a
+    // copy of the keyed context.
+    EVP_MAC* mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
+    EVP_MAC_CTX* keyed_ctx = mac ? EVP_MAC_CTX_new(mac) : nullptr;
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_ALG_PARAM_DIGEST, const_cast<char*>("SHA256"), 0),
+        OSSL_PARAM_construct_end()};
+    if (!keyed_ctx || EVP_MAC_init(keyed_ctx, key.data(), key.size(), params) <= 0)
+        {
+            EVP_MAC_CTX_free(keyed_ctx);
+            EVP_MAC_free(mac);
+            LOG(WARNING) << "OSNMA HMAC_SHA_256 computation failed to initialize HMAC context";
+            outputs.resize(inputs.size(), std::vector<uint8_t>(32));
+            return outputs;
+        }
+    std::array<uint8_t, EVP_MAX_MD_SIZE> hmac{};
+    for (const auto& input : inputs)
+        {
+            std::vector<uint8_t> output(32);
+            size_t output_length = 0;
+            EVP_MAC_CTX* ctx = EVP_MAC_CTX_dup(keyed_ctx);
+            if (ctx && EVP_MAC_update(ctx, input.data(), input.size()) > 0 && EVP_MAC_final(ctx, hmac.data(), &output_length, hmac.size()) > 0)
+                {
+                    output.assign(hmac.begin(), hmac.begin() + output_length);
+                }
+            else
+                {
+                    LOG(WARNING) << "OSNMA HMAC_SHA_256 computation failed";
+                }
+            EVP_MAC_CTX_free(ctx);
+            outputs.push_back(std::move(output));
+        }
+    EVP_MAC_CTX_free(keyed_ctx);
+    EVP_MAC_free(mac);
+#else
+    for (const auto& input : inputs)
+        {
+            outputs.push_back(compute_HMAC_SHA_256(key, input));
+        }
+#endif
+    return outputs;
+}
+
+
+std::vector<std::vector<uint8_t>> Gnss_Crypto::compute_CMAC_AES(const std::vector<uint8_t>& key, const std::vector<std::vector<uint8_t>>& inputs) const
+{
+    std::vector<std::vector<uint8_t>> outputs;
+    outputs.reserve(inputs.size());
+#if USE_OPENSSL_3 && !USE_GNUTLS_FALLBACK
+    // Fetch the algorithm and set the key once, then compute each MAC on a
+    // copy of the keyed context.
+    EVP_MAC* mac = EVP_MAC_fetch(nullptr, "CMAC", nullptr);
+    EVP_MAC_CTX* keyed_ctx = mac ? EVP_MAC_CTX_new(mac) : nullptr;
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_CIPHER, const_cast<char*>("AES-128-CBC"), 0),
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<unsigned char*>(key.data()), key.size()),
+        OSSL_PARAM_construct_end()};
+    if (!keyed_ctx || EVP_MAC_init(keyed_ctx, nullptr, 0, params) <= 0)
+        {
+            EVP_MAC_CTX_free(keyed_ctx);
+            EVP_MAC_free(mac);
+            LOG(WARNING) << "OSNMA CMAC-AES: Failed to initialize CMAC context";
+            outputs.resize(inputs.size(), std::vector<uint8_t>(16));
+            return outputs;
+        }
+    std::array<uint8_t, EVP_MAX_MD_SIZE> aux{};
+    for (const auto& input : inputs)
+        {
+            std::vector<uint8_t> output(16);
+            size_t output_length = 0;
+            EVP_MAC_CTX* ctx = EVP_MAC_CTX_dup(keyed_ctx);
+            if (ctx && EVP_MAC_update(ctx, input.data(), input.size()) > 0 && EVP_MAC_final(ctx, aux.data(), &output_length, aux.size()) > 0)
+                {
+                    output.assign(aux.begin(), aux.begin() + output_length);
+                }
+            else
+                {
+                    LOG(WARNING) << "OSNMA CMAC-AES: Failed to compute CMAC";
+                }
+            EVP_MAC_CTX_free(ctx);
+            outputs.push_back(std::move(output));
+        }
+    EVP_MAC_CTX_free(keyed_ctx);
+    EVP_MAC_free(mac);
+#else
+    for (const auto& input : inputs)
+        {
+            outputs.push_back(compute_CMAC_AES(key, input));
+        }
+#endif
+    return outputs;
+}
+
+
 std::vector<uint8_t> Gnss_Crypto::get_merkle_root() const
 {
     return d_x_4_0;
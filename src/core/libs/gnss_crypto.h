@@ -19,6 +19,8 @@
 #ifndef GNSS_SDR_GNSS_CRYPTO_H
 #define GNSS_SDR_GNSS_CRYPTO_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -66,6 +68,19 @@ public:
     std::vector<uint8_t> compute_HMAC_SHA_256(const std::vector<uint8_t>& key, const std::vector<uint8_t>& input) const;  //!< Computes HMAC-SHA-256 message authentication code
     std::vector<uint8_t> compute_CMAC_AES(const std::vector<uint8_t>& key, const std::vector<uint8_t>& input) const;      //!< Computes CMAC-AES message authentication code
 
+    void compute_SHA_256(const uint8_t* input, size_t input_length, std::array<uint8_t, 32>& output) const;   //!< Computes SHA-256 hash into a caller-provided buffer
+    void compute_SHA3_256(const uint8_t* input, size_t input_length, std::array<uint8_t, 32>& output) const;  //!< Computes SHA3-256 hash into a caller-provided buffer
+
+    /*!
+     * Computes the HMAC-SHA-256 of several messages authenticated with the same key. The MAC context is set up only once.
+     */
+    std::vector<std::vector<uint8_t>> compute_HMAC_SHA_256(const std::vector<uint8_t>& key, const std::vector<std::vector<uint8_t>>& inputs) const;
+
+    /*!
+     * Computes the CMAC-AES of several messages authenticated with the same key. The MAC context is set up only once.
+     */
+    std::vector<std::vector<uint8_t>> compute_CMAC_AES(const std::vector<uint8_t>& key, const std::vector<std::vector<uint8_t>>& inputs) const;
+
     std::vector<uint8_t> get_merkle_root() const;  //!< Gets the Merkle Tree root node (\f$ x_{4,0} \f$)
     std::string get_public_key_type() const;       //!< Gets the ECDSA Public Key type (ECDSA P-256 / ECDSA P-521 / Unknown)
 
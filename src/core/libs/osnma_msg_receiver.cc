@@ -25,6 +25,7 @@
 #include "gnss_sdr_make_unique.h"   // for std::make_unique in C++11
 #include "osnma_dsm_reader.h"       // for OSNMA_DSM_Reader
 #include "osnma_helper.h"           // for Osnma_Helper
+#include "osnma_tesla_chain.h"      // for OSNMA_TESLA_Chain
 #include <gnuradio/io_signature.h>  // for gr::io_signature::make
 #include <algorithm>
 #include <cmath>
@@ -61,6 +62,42 @@ namespace wht = std;
 #endif
 
 
+namespace
+{
+// trunc(l_t, mac): the l_t most significant bits of the MAC, for the tag sizes of Table 11
+uint64_t truncate_mac(const std::vector<uint8_t>& mac, uint8_t lt_bits)
+{
+    uint64_t computed_mac = static_cast<uint64_t>(mac[0]) << (lt_bits - 8);
+    computed_mac += (static_cast<uint64_t>(mac[1]) << (lt_bits - 16));
+    if (lt_bits == 20)
+        {
+            computed_mac += (static_cast<uint64_t>(mac[1] & 0xF0) >> 4);
+        }
+    else if (lt_bits == 24)
+        {
+            computed_mac += static_cast<uint64_t>(mac[2]);
+        }
+    else if (lt_bits == 28)
+        {
+            computed_mac += (static_cast<uint64_t>(mac[2]) << 4);
+            computed_mac += (static_cast<uint64_t>(mac[3] & 0xF0) >> 4);
+        }
+    else if (lt_bits == 32)
+        {
+            computed_mac += (static_cast<uint64_t>(mac[2]) << 8);
+            computed_mac += static_cast<uint64_t>(mac[3]);
+        }
+    else if (lt_bits == 40)
+        {
+            computed_mac += (static_cast<uint64_t>(mac[2]) << 16);
+            computed_mac += (static_cast<uint64_t>(mac[3]) << 8);
+            computed_mac += static_cast<uint64_t>(mac[4]);
+        }
+    return computed_mac;
+}
+}  // namespace
+
+
 osnma_msg_receiver_sptr osnma_msg_receiver_make(const std::string& pemFilePath, const std::string& merkleFilePath, bool strict_mode)
 {
     return osnma_msg_receiver_sptr(new osnma_msg_receiver(pemFilePath, merkleFilePath, strict_mode));
@@ -78,6 +115,7 @@ osnma_msg_receiver::osnma_msg_receiver(const std::string& crtFilePath,
     d_crypto = std::make_unique<Gnss_Crypto>(crtFilePath, merkleFilePath);
     d_helper = std::make_unique<Osnma_Helper>();
     d_nav_data_manager = std::make_unique<OSNMA_NavDataManager>();
+    d_tesla_chain = std::make_unique<OSNMA_TESLA_Chain>(TESLAFILE_DEFAULT);
 
     if (d_crypto->have_public_key())
         {  // Hot start is enabled
@@ -283,6 +321,7 @@ void osnma_msg_receiver::process_osnma_message(const std::shared_ptr<OSNMA_msg>&
             d_public_key_verified = false;
             d_kroot_verified = false;
             d_tesla_key_verified = false;
+            d_tesla_chain->reset();
             d_GST_PKR_PKREV_start = d_helper->compute_gst(osnma_msg->WN_sf0, osnma_msg->TOW_sf0);
             LOG(INFO) << "Galileo OSNMA: Public Key Revocation :: Start at GST=[" << osnma_msg->WN_sf0 << " " << osnma_msg->TOW_sf0 << "]";
             std::cout << "Galileo OSNMA: Public Key Revocation :: Start at GST=[" << osnma_msg->WN_sf0 << " " << osnma_msg->TOW_sf0 << "]" << std::endl;
@@ -328,6 +367,7 @@ void osnma_msg_receiver::process_osnma_message(const std::shared_ptr<OSNMA_msg>&
                       << ", Duration=" << duration_hours << "h" << std::endl;
             d_osnma_data.d_dsm_kroot_message = d_osnma_data.d_dsm_kroot_new_message;  // set new kroot as the one to use from now on
             d_tesla_key_verified = false;                                             // force the verification up to the Kroot due to chain change
+            d_tesla_chain->reset();                                                   // keys of the old chain cannot be used as checkpoints
         }
 
     if (d_osnma_data.d_nma_header.nmas == 3 /* DU */ && d_osnma_data.d_nma_header.cpks == 3 /* CREV */ && d_GST_chain_revocation_start == 0)
@@ -337,6 +377,7 @@ void osnma_msg_receiver::process_osnma_message(const std::shared_ptr<OSNMA_msg>&
             // d_public_key_verified = false;
             d_kroot_verified = false;
             d_tesla_key_verified = false;
+            d_tesla_chain->reset();
             d_GST_chain_revocation_start = d_helper->compute_gst(osnma_msg->WN_sf0, osnma_msg->TOW_sf0);
             LOG(INFO) << "Galileo OSNMA: Chain revocation :: Start at GST=[" << osnma_msg->WN_sf0 << " " << osnma_msg->TOW_sf0 << "]";
             std::cout << "Galileo OSNMA: Chain revocation :: Start at GST=[" << osnma_msg->WN_sf0 << " " << osnma_msg->TOW_sf0 << "]" << std::endl;
@@ -1156,68 +1197,13 @@ void osnma_msg_receiver::process_mack_message()
     // add current received MACK to the container to be verified in the next iteration (on this one no key available)
     d_macks_awaiting_MACSEQ_verification.push_back(d_osnma_data.d_mack_message);
 
-    // Tag verification
+    // Tag verification: the tags with key and navigation data available are verified together
+    std::vector<Tag*> ready_tags;
     for (auto& it : d_tags_awaiting_verify)
         {
-            bool ret;
             if (tag_has_key_available(it.second) && d_nav_data_manager->have_nav_data(it.second))  // tag_has_nav_data_available(it.second))
                 {
-                    ret = verify_tag(it.second);
-                    /* TODO - take into account:
-                     * - COP: if
-                     * - ADKD type
-                     * - OSNMA_NavData the tag verifies (min. number of bits verified to consider OSNMA_NavData OK)
-                     * */
-                    if (ret)
-                        {
-                            d_count_successful_tags++;
-                            it.second.status = Tag::SUCCESS;
-                            LOG(INFO) << "Galileo OSNMA: Tag verification :: SUCCESS for tag Id="
-                                      << it.second.tag_id
-                                      << ", value=0x" << std::setfill('0') << std::setw(10) << std::hex << std::uppercase
-                                      << it.second.received_tag << std::dec
-                                      << ", TOW="
-                                      << it.second.TOW
-                                      << ", ADKD="
-                                      << static_cast<unsigned>(it.second.ADKD)
-                                      << ", PRNa="
-                                      << static_cast<unsigned>(it.second.PRNa)
-                                      << ", PRNd="
-                                      << static_cast<unsigned>(it.second.PRN_d);
-                            std::cout << "Galileo OSNMA: Tag verification :: SUCCESS for tag ADKD="
-                                      << static_cast<unsigned>(it.second.ADKD)
-                                      << ", PRNa="
-                                      << static_cast<unsigned>(it.second.PRNa)
-                                      << ", PRNd="
-                                      << static_cast<unsigned>(it.second.PRN_d) << std::endl;
-                        }
-                    /* TODO notify PVT via pmt
-                     * have_new_data() true
-                     * signal which one is verified
-                     * communicate to PVT*/
-                    else
-                        {
-                            d_count_failed_tags++;
-                            it.second.status = Tag::FAIL;
-                            LOG(WARNING) << "Galileo OSNMA: Tag verification :: FAILURE for tag Id="
-                                         << it.second.tag_id
-                                         << ", value=0x" << std::setfill('0') << std::setw(10) << std::hex << std::uppercase
-                                         << it.second.received_tag << std::dec
-                                         << ", TOW="
-                                         << it.second.TOW
-                                         << ", ADKD="
-                                         << static_cast<unsigned>(it.second.ADKD)
-                                         << ", PRNa="
-                                         << static_cast<unsigned>(it.second.PRNa)
-                                         << ", PRNd="
-                                         << static_cast<unsigned>(it.second.PRN_d);
-                            std::cerr << "Galileo OSNMA: Tag verification :: FAILURE for tag ADKD="
-                                      << static_cast<unsigned>(it.second.ADKD)
-                                      << ", PRNa="
-                                      << static_cast<unsigned>(it.second.PRNa)
-                                      << ", PRNd="
-                                      << static_cast<unsigned>(it.second.PRN_d) << std::endl;
-                        }
+                    ready_tags.push_back(&it.second);
                 }
             else if (it.second.TOW > d_osnma_data.d_nav_data.get_tow_sf0())
                 {
@@ -1241,6 +1227,66 @@ void osnma_msg_receiver::process_mack_message()
                                  << ". Key available (" << tag_has_key_available(it.second) << "),  navData (" << tag_has_nav_data_available(it.second) << "). ";
                 }
         }
+    const std::vector<bool> verified = verify_tags(ready_tags);
+    for (size_t i = 0; i < ready_tags.size(); i++)
+        {
+            Tag& tag = *ready_tags[i];
+            /* TODO - take into account:
+             * - COP: if
+             * - ADKD type
+             * - OSNMA_NavData the tag verifies (min. number of bits verified to consider OSNMA_NavData OK)
+             * */
+            if (verified[i])
+                {
+                    d_count_successful_tags++;
+                    tag.status = Tag::SUCCESS;
+                    LOG(INFO) << "Galileo OSNMA: Tag verification :: SUCCESS for tag Id="
+                              << tag.tag_id
+                              << ", value=0x" << std::setfill('0') << std::setw(10) << std::hex << std::uppercase
+                              << tag.received_tag << std::dec
+                              << ", TOW="
+                              << tag.TOW
+                              << ", ADKD="
+                              << static_cast<unsigned>(tag.ADKD)
+                              << ", PRNa="
+                              << static_cast<unsigned>(tag.PRNa)
+                              << ", PRNd="
+                              << static_cast<unsigned>(tag.PRN_d);
+                    std::cout << "Galileo OSNMA: Tag verification :: SUCCESS for tag ADKD="
+                              << static_cast<unsigned>(tag.ADKD)
+                              << ", PRNa="
+                              << static_cast<unsigned>(tag.PRNa)
+                              << ", PRNd="
+                              << static_cast<unsigned>(tag.PRN_d) << std::endl;
+                }
+            /* TODO notify PVT via pmt
+             * have_new_data() true
+             * signal which one is verified
+             * communicate to PVT*/
+            else
+                {
+                    d_count_failed_tags++;
+                    tag.status = Tag::FAIL;
+                    LOG(WARNING) << "Galileo OSNMA: Tag verification :: FAILURE for tag Id="
+                                 << tag.tag_id
+                                 << ", value=0x" << std::setfill('0') << std::setw(10) << std::hex << std::uppercase
+                                 << tag.received_tag << std::dec
+                                 << ", TOW="
+                                 << tag.TOW
+                                 << ", ADKD="
+                                 << static_cast<unsigned>(tag.ADKD)
+                                 << ", PRNa="
+                                 << static_cast<unsigned>(tag.PRNa)
+                                 << ", PRNd="
+                                 << static_cast<unsigned>(tag.PRN_d);
+                    std::cerr << "Galileo OSNMA: Tag verification :: FAILURE for tag ADKD="
+                              << static_cast<unsigned>(tag.ADKD)
+                              << ", PRNa="
+                              << static_cast<unsigned>(tag.PRNa)
+                              << ", PRNd="
+                              << static_cast<unsigned>(tag.PRN_d) << std::endl;
+                }
+        }
     uint8_t tag_size = 0;
     const auto it = OSNMA_TABLE_11.find(d_osnma_data.d_dsm_kroot_message.ts);
     if (it != OSNMA_TABLE_11.cend())
@@ -1335,54 +1381,23 @@ std::vector<uint8_t> osnma_msg_receiver::get_merkle_tree_leaves(const DSM_PKR_me
 
 bool osnma_msg_receiver::verify_tag(Tag& tag) const
 {
-    // Debug
-    //    LOG(INFO) << "Galileo OSNMA: Tag verification :: Start for tag Id= "
-    //              << tag.tag_id
-    //              << ", value=0x" << std::setfill('0') << std::setw(10) << std::hex << std::uppercase
-    //              << tag.received_tag << std::dec;
-    // build message
-    std::vector<uint8_t> m = build_message(tag);
+    return verify_tags({&tag})[0];
+}
 
-    std::vector<uint8_t> mac;
-    std::vector<uint8_t> applicable_key;
-    if (tag.ADKD == 0 || tag.ADKD == 4)
-        {
-            const auto it = d_tesla_keys.find(tag.TOW + 30);
-            if (it != d_tesla_keys.cend())
-                {
-                    applicable_key = it->second;
-                }
-            else
-                {
-                    return false;
-                }
-            // LOG(INFO) << "|---> Galileo OSNMA :: applicable key: 0x" << d_helper->convert_to_hex_string(applicable_key) << "TOW="<<static_cast<int>(tag.TOW + 30);
-        }
-    else  // ADKD 12
-        {
-            const auto it = d_tesla_keys.find(tag.TOW + 330);
-            if (it != d_tesla_keys.cend())
-                {
-                    applicable_key = it->second;
-                }
-            else
-                {
-                    return false;
-                }
-            // LOG(INFO) << "|---> Galileo OSNMA :: applicable key: 0x" << d_helper->convert_to_hex_string(applicable_key) << "TOW="<<static_cast<int>(tag.TOW + 330);
-        }
 
-    if (d_osnma_data.d_dsm_kroot_message.mf == 0)  // C: HMAC-SHA-256
-        {
-            mac = d_crypto->compute_HMAC_SHA_256(applicable_key, m);
-        }
-    else if (d_osnma_data.d_dsm_kroot_message.mf == 1)  // C: CMAC-AES
-        {
-            mac = d_crypto->compute_CMAC_AES(applicable_key, m);
-        }
+/**
+ * \brief Verifies a set of tags, computing one batch of MACs per TESLA key.
+ *
+ * \param tags The tags to be verified. Their computed_tag member is updated.
+ *
+ * \return A vector with the verification result of each tag, in the same order.
+ */
+std::vector<bool> osnma_msg_receiver::verify_tags(const std::vector<Tag*>& tags) const
+{
+    std::vector<bool> verified(tags.size(), false);
 
     // truncate the computed mac: trunc(l_t, mac(K,m)) Eq. 23 ICD
-    uint8_t lt_bits = 0;  // TODO - remove this duplication of code.
+    uint8_t lt_bits = 0;
     const auto it2 = OSNMA_TABLE_11.find(d_osnma_data.d_dsm_kroot_message.ts);
     if (it2 != OSNMA_TABLE_11.cend())
         {
@@ -1390,42 +1405,57 @@ bool osnma_msg_receiver::verify_tag(Tag& tag) const
         }
     if (lt_bits < 16)
         {
-            return false;
-        }
-    uint64_t computed_mac = static_cast<uint64_t>(mac[0]) << (lt_bits - 8);
-    computed_mac += (static_cast<uint64_t>(mac[1]) << (lt_bits - 16));
-    if (lt_bits == 20)
-        {
-            computed_mac += (static_cast<uint64_t>(mac[1] & 0xF0) >> 4);
-        }
-    else if (lt_bits == 24)
-        {
-            computed_mac += static_cast<uint64_t>(mac[2]);
-        }
-    else if (lt_bits == 28)
-        {
-            computed_mac += (static_cast<uint64_t>(mac[2]) << 4);
-            computed_mac += (static_cast<uint64_t>(mac[3] & 0xF0) >> 4);
+            return verified;
         }
-    else if (lt_bits == 32)
-        {
-            computed_mac += (static_cast<uint64_t>(mac[2]) << 8);
-            computed_mac += static_cast<uint64_t>(mac[3]);
-        }
-    else if (lt_bits == 40)
+
+    // Tags sharing the applicable key are verified with a single keyed context
+    std::map<uint32_t, std::vector<size_t>> tags_per_key;  // key TOW -> indexes in tags
+    for (size_t i = 0; i < tags.size(); i++)
         {
-            computed_mac += (static_cast<uint64_t>(mac[2]) << 16);
-            computed_mac += (static_cast<uint64_t>(mac[3]) << 8);
-            computed_mac += static_cast<uint64_t>(mac[4]);
+            const uint32_t key_TOW = (tags[i]->ADKD == 0 || tags[i]->ADKD == 4) ? tags[i]->TOW + 30 : tags[i]->TOW + 330;  // ADKD 12 uses the key transmitted 10 subframes later
+            tags_per_key[key_TOW].push_back(i);
         }
 
-    tag.computed_tag = computed_mac;  // update with computed value
-    // Compare computed tag with received one truncated
-    if (tag.received_tag == computed_mac)
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<std::vector<uint8_t>> macs;
+    for (const auto& group : tags_per_key)
         {
-            return true;
+            const auto key_it = d_tesla_keys.find(group.first);
+            if (key_it == d_tesla_keys.cend())
+                {
+                    continue;
+                }
+            const std::vector<uint8_t>& applicable_key = key_it->second;
+            messages.clear();
+            for (size_t i : group.second)
+                {
+                    messages.push_back(build_message(*tags[i]));
+                }
+            if (d_osnma_data.d_dsm_kroot_message.mf == 0)  // C: HMAC-SHA-256
+                {
+                    macs = d_crypto->compute_HMAC_SHA_256(applicable_key, messages);
+                }
+            else if (d_osnma_data.d_dsm_kroot_message.mf == 1)  // C: CMAC-AES
+                {
+                    macs = d_crypto->compute_CMAC_AES(applicable_key, messages);
+                }
+            else
+                {
+                    continue;
+                }
+            for (size_t k = 0; k < group.second.size(); k++)
+                {
+                    if (macs[k].size() < 5)
+                        {
+                            continue;
+                        }
+                    Tag& tag = *tags[group.second[k]];
+                    tag.computed_tag = truncate_mac(macs[k], lt_bits);  // update with computed value
+                    // Compare computed tag with received one truncated
+                    verified[group.second[k]] = (tag.received_tag == tag.computed_tag);
+                }
         }
-    return false;
+    return verified;
 }
 
 
@@ -1510,35 +1540,11 @@ void osnma_msg_receiver::display_data()
 
 bool osnma_msg_receiver::verify_tesla_key(std::vector<uint8_t>& key, uint32_t TOW)
 {
-    uint32_t num_of_hashes_needed;
-    uint32_t GST_SFi = d_GST_Sf - 30;  // GST of target key is to be used.
-    std::vector<uint8_t> hash;
-    const uint8_t lk_bytes = d_dsm_reader->get_lk_bits(d_osnma_data.d_dsm_kroot_message.ks) / 8;
-    std::vector<uint8_t> validated_key;
-    if (d_tesla_key_verified)
-        {  // have to go up to last verified key
-            validated_key = d_tesla_keys.rbegin()->second;
-            num_of_hashes_needed = (d_GST_Sf - d_last_verified_key_GST) / 30;  // Eq. 19 ICD modified
-            LOG(INFO) << "Galileo OSNMA: TESLA verification (" << num_of_hashes_needed << " hashes) need to be performed up to closest verified TESLA key";
-
-            hash = hash_chain(num_of_hashes_needed, key, GST_SFi, lk_bytes);
-        }
-    else
-        {  // have to go until Kroot
-            validated_key = d_osnma_data.d_dsm_kroot_message.kroot;
-            num_of_hashes_needed = (d_GST_Sf - d_GST_0) / 30 + 1;  // Eq. 19 IC
-            LOG(INFO) << "Galileo OSNMA: TESLA verification (" << num_of_hashes_needed << " hashes) need to be performed up to Kroot";
-
-            hash = hash_chain(num_of_hashes_needed, key, GST_SFi, lk_bytes);
-        }
-    // truncate hash
-    std::vector<uint8_t> computed_key;
-    computed_key.reserve(key.size());
-    for (size_t i = 0; i < key.size(); i++)
-        {
-            computed_key.push_back(hash[i]);
-        }
-    if (computed_key == validated_key && num_of_hashes_needed > 0)
+    // The chain goes down to the closest verified TESLA key, or to the Kroot
+    const uint32_t num_of_hashes_needed = d_tesla_chain->verify_key(*d_crypto, d_osnma_data.d_dsm_kroot_message, d_GST_0, key, d_GST_Sf) ? d_tesla_chain->get_last_number_of_hashes() : 0;
+    LOG(INFO) << "Galileo OSNMA: TESLA verification (" << num_of_hashes_needed << " hashes) performed up to closest verified TESLA key";
+    const bool verified = num_of_hashes_needed > 0;  // a key is never taken as authentic without hashing it
+    if (verified)
         {
             LOG(INFO) << "Galileo OSNMA: TESLA key verification :: SUCCESS!";
             std::cout << "Galileo OSNMA: TESLA key verification :: SUCCESS!" << std::endl;
@@ -1546,12 +1552,12 @@ bool osnma_msg_receiver::verify_tesla_key(std::vector<uint8_t>& key, uint32_t TO
             d_tesla_key_verified = true;
             d_last_verified_key_GST = d_GST_Sf;
         }
-    else if (num_of_hashes_needed > 0)
+    else
         {
             LOG(WARNING) << "Galileo OSNMA: TESLA key verification :: FAILED";
             std::cerr << "Galileo OSNMA: TESLA key verification :: FAILED" << std::endl;
         }
-    return d_tesla_key_verified;
+    return verified;
 }
 
 
@@ -1815,79 +1821,6 @@ bool osnma_msg_receiver::tag_has_key_available(const Tag& t) const
 }
 
 
-std::vector<uint8_t> osnma_msg_receiver::hash_chain(uint32_t num_of_hashes_needed, const std::vector<uint8_t>& key, uint32_t GST_SFi, const uint8_t lk_bytes) const
-{
-    std::vector<uint8_t> K_II = key;
-    std::vector<uint8_t> K_I;  // result of the recursive hash operations
-    std::vector<uint8_t> msg;
-    // compute the tesla key for current SF (GST_SFi and K_II change in each iteration)
-    for (uint32_t i = 1; i <= num_of_hashes_needed; i++)
-        {
-            // build message digest m = (K_I+1 || GST_SFi || alpha)
-            msg.reserve(K_II.size() + sizeof(GST_SFi) + sizeof(d_osnma_data.d_dsm_kroot_message.alpha));
-            std::copy(K_II.begin(), K_II.end(), std::back_inserter(msg));
-
-            msg.push_back((GST_SFi & 0xFF000000) >> 24);
-            msg.push_back((GST_SFi & 0x00FF0000) >> 16);
-            msg.push_back((GST_SFi & 0x0000FF00) >> 8);
-            msg.push_back(GST_SFi & 0x000000FF);
-            // extract alpha
-            //            d_osnma_data.d_dsm_kroot_message.alpha = 0xa06221261ad9;
-            for (int k = 5; k >= 0; k--)
-                {
-                    // TODO: static extracts the MSB in case from larger to shorter int?
-                    msg.push_back(static_cast<uint8_t>((d_osnma_data.d_dsm_kroot_message.alpha >> (k * 8)) & 0xFF));  // extract first 6 bytes of alpha.
-                }
-            // compute hash
-            std::vector<uint8_t> hash;
-            if (d_osnma_data.d_dsm_kroot_message.hf == 0)  // Table 8.
-                {
-                    hash = d_crypto->compute_SHA_256(msg);
-                }
-            else if (d_osnma_data.d_dsm_kroot_message.hf == 2)
-                {
-                    hash = d_crypto->compute_SHA3_256(msg);
-                }
-            else
-                {
-                    hash = std::vector<uint8_t>(32);
-                }
-            // truncate hash
-            K_I.reserve(lk_bytes);  // TODO - case hash function has 512 bits
-            for (int k = 0; k < lk_bytes; k++)
-                {
-                    K_I.push_back(hash[k]);
-                }
-            // set parameters for next iteration
-            GST_SFi -= 30;  // next SF time is the actual minus 30 seconds
-            K_II = K_I;     // next key is the actual one
-            K_I.clear();    // empty the actual one for a new computation
-            msg.clear();
-        }
-
-    // check that the final time matches the Kroot time
-    bool check;
-    if (!d_tesla_key_verified)
-        {
-            check = GST_SFi + 30 == d_GST_0 - 30;
-        }
-    else
-        {
-            check = GST_SFi + 30 == d_last_verified_key_GST;
-        }
-    if (!check)
-        {
-            LOG(WARNING) << "Galileo OSNMA: TESLA key chain verification error: KROOT time mismatch!";  // ICD. Eq. 18
-            std::cerr << "Galileo OSNMA: TESLA key chain verification error: KROOT time mismatch!" << std::endl;
-        }
-    else
-        {
-            LOG(INFO) << "Galileo OSNMA: TESLA key chain verification: KROOT time matches.";  // ICD. Eq. 18
-        }
-    return K_II;
-}
-
-
 /**
  * @brief Verifies the MAC sequence of a received MACK message.
  *
@@ -1904,12 +1837,9 @@ std::vector<MACK_tag_and_info> osnma_msg_receiver::verify_macseq_new(const MACK_
 
     // MACSEQ verification
     uint32_t GST_Sfi = d_GST_Sf - 30;  // time of the start of SF containing MACSEQ
-    std::vector<uint8_t> applicable_key;
+    const std::vector<uint8_t> no_key{};
     const auto key_it = d_tesla_keys.find(mack.TOW + 30);  // current tesla key ie transmitted in the next subframe
-    if (key_it != d_tesla_keys.cend())
-        {
-            applicable_key = key_it->second;
-        }
+    const std::vector<uint8_t>& applicable_key = key_it != d_tesla_keys.cend() ? key_it->second : no_key;
     std::vector<std::string> sq1{};
     std::vector<std::string> sq2{};
     std::vector<std::string> applicable_sequence;
@@ -46,6 +46,7 @@
 class OSNMA_DSM_Reader;
 class Gnss_Crypto;
 class Osnma_Helper;
+class OSNMA_TESLA_Chain;
 class osnma_msg_receiver;
 
 using osnma_msg_receiver_sptr = gnss_shared_ptr<osnma_msg_receiver>;
@@ -88,6 +89,7 @@ private:
 
     bool verify_tesla_key(std::vector<uint8_t>& key, uint32_t TOW);
     bool verify_tag(Tag& tag) const;
+    std::vector<bool> verify_tags(const std::vector<Tag*>& tags) const;
     bool tag_has_nav_data_available(const Tag& t) const;
     bool tag_has_key_available(const Tag& t) const;
     bool verify_macseq(const MACK_message& mack);
@@ -98,7 +100,6 @@ private:
     std::vector<uint8_t> get_merkle_tree_leaves(const DSM_PKR_message& dsm_pkr_message) const;
     std::vector<uint8_t> compute_merkle_root(const DSM_PKR_message& dsm_pkr_message, const std::vector<uint8_t>& m_i) const;
     std::vector<uint8_t> build_message(Tag& tag) const;
-    std::vector<uint8_t> hash_chain(uint32_t num_of_hashes_needed, const std::vector<uint8_t>& key, uint32_t GST_SFi, const uint8_t lk_bytes) const;
     std::vector<MACK_tag_and_info> verify_macseq_new(const MACK_message& mack);
 
     std::map<uint32_t, std::map<uint32_t, OSNMA_NavData>> d_satellite_nav_data;  // map holding OSNMA_NavData sorted by SVID (first key) and TOW (second key).
@@ -118,6 +119,7 @@ private:
     std::unique_ptr<OSNMA_DSM_Reader> d_dsm_reader;            // osnma parameters parser
     std::unique_ptr<Osnma_Helper> d_helper;                    // helper class with auxiliary functions
     std::unique_ptr<OSNMA_NavDataManager> d_nav_data_manager;  // refactor for holding and processing navigation data
+    std::unique_ptr<OSNMA_TESLA_Chain> d_tesla_chain;          // verified TESLA keys of the current chain
 
     OSNMA_data d_osnma_data{};
 
@@ -0,0 +1,303 @@
+/*!
+ * \file osnma_tesla_chain.cc
+ * \brief Class for the verification of Galileo OSNMA TESLA keys against the
+ * nearest verified key of the chain
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "osnma_tesla_chain.h"
+#include "Galileo_OSNMA.h"
+#include "gnss_crypto.h"
+#include <algorithm>  // for std::copy, std::max
+#include <array>
+#include <fstream>  // for std::ifstream and std::ofstream
+#include <utility>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+namespace
+{
+constexpr size_t MAX_KEY_BYTES = 32;  // OSNMA User ICD, Table 10: up to 256 bits
+constexpr size_t GST_BYTES = 4;
+constexpr size_t ALPHA_BYTES = 6;
+}  // namespace
+
+
+OSNMA_TESLA_Chain::OSNMA_TESLA_Chain(const std::string& checkpoints_file) : d_checkpoints_file(checkpoints_file)
+{
+}
+
+
+bool OSNMA_TESLA_Chain::verify_key(const Gnss_Crypto& crypto,
+    const DSM_KROOT_message& kroot,
+    uint32_t GST_0,
+    const std::vector<uint8_t>& key,
+    uint32_t GST_Sf)
+{
+    d_last_number_of_hashes = 0;
+    const size_t lk_bytes = key.size();
+    if (lk_bytes == 0 || lk_bytes > MAX_KEY_BYTES || lk_bytes != kroot.kroot.size())
+        {
+            LOG(WARNING) << "Galileo OSNMA: TESLA key size does not match the KROOT size";
+            return false;
+        }
+    if (kroot.kroot != d_kroot || kroot.alpha != d_alpha || kroot.hf != d_hf || GST_0 != d_GST_0)
+        {
+            set_kroot(kroot, GST_0);
+        }
+
+    // The KROOT is the key of the subframe before its applicability time
+    const uint32_t GST_kroot = d_GST_0 - 30;
+    if (GST_Sf <= GST_kroot || (GST_Sf - GST_kroot) % 30 != 0)
+        {
+            LOG(WARNING) << "Galileo OSNMA: TESLA key chain verification error: KROOT time mismatch!";  // ICD. Eq. 18
+            return false;
+        }
+
+    // Nearest verified key transmitted before GST_Sf. The KROOT is always
+    // there, so there is one, and at least one hash is computed even if the
+    // key was already verified.
+    auto anchor = d_checkpoints.lower_bound(GST_Sf);
+    --anchor;
+    uint32_t num_of_hashes_needed = (GST_Sf - anchor->first) / 30;  // Eq. 19 ICD modified
+
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> new_checkpoints;
+    std::vector<uint8_t> anchor_key = hash_down(crypto, key, GST_Sf, num_of_hashes_needed, &new_checkpoints);
+    d_last_number_of_hashes = num_of_hashes_needed;
+
+    if (anchor_key != anchor->second && !d_stored_GSTs.empty())
+        {
+            // The checkpoints read from the file may be stale or corrupted.
+            // They are dropped, with the keys verified against them, and the
+            // key is hashed down to the KROOT.
+            LOG(WARNING) << "Galileo OSNMA: TESLA key of GST " << GST_Sf << " does not match the keys read from file " << d_checkpoints_file << ". They are discarded";
+            d_checkpoints.clear();
+            d_checkpoints[GST_kroot] = d_kroot;
+            d_latest_GST = GST_kroot;
+            d_stored_GSTs.clear();
+            anchor = d_checkpoints.begin();
+            num_of_hashes_needed = (GST_Sf - GST_kroot) / 30;
+            new_checkpoints.clear();
+            anchor_key = hash_down(crypto, key, GST_Sf, num_of_hashes_needed, &new_checkpoints);
+            d_last_number_of_hashes += num_of_hashes_needed;
+        }
+    if (anchor_key != anchor->second)
+        {
+            return false;
+        }
+
+    // All the intermediate keys are authentic now
+    const bool store = (is_checkpoint(GST_Sf) && d_checkpoints.count(GST_Sf) == 0) || !new_checkpoints.empty();
+    for (auto& checkpoint : new_checkpoints)
+        {
+            d_checkpoints.insert(std::move(checkpoint));
+        }
+    if (GST_Sf > d_latest_GST)
+        {
+            if (!is_checkpoint(d_latest_GST))
+                {
+                    d_checkpoints.erase(d_latest_GST);
+                }
+            d_latest_GST = GST_Sf;
+            d_checkpoints[GST_Sf] = key;
+        }
+    else if (is_checkpoint(GST_Sf))
+        {
+            d_checkpoints[GST_Sf] = key;
+        }
+    if (store)
+        {
+            store_checkpoints();
+        }
+    return true;
+}
+
+
+void OSNMA_TESLA_Chain::reset()
+{
+    d_checkpoints.clear();
+    d_kroot.clear();
+    d_alpha = 0;
+    d_GST_0 = 0;
+    d_latest_GST = 0;
+    d_hf = 0;
+    d_stored_GSTs.clear();
+}
+
+
+uint32_t OSNMA_TESLA_Chain::get_last_number_of_hashes() const
+{
+    return d_last_number_of_hashes;
+}
+
+
+size_t OSNMA_TESLA_Chain::get_number_of_checkpoints() const
+{
+    return d_checkpoints.size();
+}
+
+
+void OSNMA_TESLA_Chain::set_kroot(const DSM_KROOT_message& kroot, uint32_t GST_0)
+{
+    d_kroot = kroot.kroot;
+    d_alpha = kroot.alpha;
+    d_hf = kroot.hf;
+    d_GST_0 = GST_0;
+    d_latest_GST = GST_0 - 30;
+    d_checkpoints.clear();
+    d_checkpoints[d_latest_GST] = d_kroot;
+    d_stored_GSTs.clear();
+    read_checkpoints();
+}
+
+
+std::vector<uint8_t> OSNMA_TESLA_Chain::hash_down(const Gnss_Crypto& crypto,
+    const std::vector<uint8_t>& key,
+    uint32_t GST_Sf,
+    uint32_t num_of_hashes,
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>>* checkpoints) const
+{
+    // The message m = (K_i+1 || GST_SFi || alpha) is built in place: the
+    // truncated hash overwrites the key for the next iteration.
+    const size_t lk_bytes = key.size();
+    std::array<uint8_t, MAX_KEY_BYTES + GST_BYTES + ALPHA_BYTES> msg{};
+    std::array<uint8_t, 32> hash{};
+    const size_t msg_size = lk_bytes + GST_BYTES + ALPHA_BYTES;
+    std::copy(key.begin(), key.end(), msg.begin());
+    for (size_t k = 0; k < ALPHA_BYTES; k++)
+        {
+            msg[lk_bytes + GST_BYTES + k] = static_cast<uint8_t>((d_alpha >> ((ALPHA_BYTES - 1 - k) * 8)) & 0xFF);
+        }
+
+    uint32_t GST_SFi = GST_Sf - 30;
+    for (uint32_t i = 1; i <= num_of_hashes; i++)
+        {
+            msg[lk_bytes] = static_cast<uint8_t>((GST_SFi & 0xFF000000) >> 24);
+            msg[lk_bytes + 1] = static_cast<uint8_t>((GST_SFi & 0x00FF0000) >> 16);
+            msg[lk_bytes + 2] = static_cast<uint8_t>((GST_SFi & 0x0000FF00) >> 8);
+            msg[lk_bytes + 3] = static_cast<uint8_t>(GST_SFi & 0x000000FF);
+            if (d_hf == 0)  // Table 8.
+                {
+                    crypto.compute_SHA_256(msg.data(), msg_size, hash);
+                }
+            else if (d_hf == 2)
+                {
+                    crypto.compute_SHA3_256(msg.data(), msg_size, hash);
+                }
+            else
+                {
+                    hash.fill(0);
+                }
+            // truncate hash: this is the key of subframe GST_SFi
+            std::copy(hash.begin(), hash.begin() + lk_bytes, msg.begin());
+            if (checkpoints != nullptr && i < num_of_hashes && is_checkpoint(GST_SFi))
+                {
+                    checkpoints->emplace_back(GST_SFi, std::vector<uint8_t>(msg.begin(), msg.begin() + lk_bytes));
+                }
+            GST_SFi -= 30;
+        }
+    return std::vector<uint8_t>(msg.begin(), msg.begin() + lk_bytes);
+}
+
+
+bool OSNMA_TESLA_Chain::is_checkpoint(uint32_t GST) const
+{
+    return ((GST - (d_GST_0 - 30)) / 30) % OSNMA_TESLA_CHECKPOINT_INTERVAL == 0;
+}
+
+
+/**
+ * \brief Reads the checkpoints stored in d_checkpoints_file, if they belong to
+ * the current chain.
+ *
+ * The file contains hf (1 byte), the key length in bytes (1 byte), alpha
+ * (8 bytes), GST_0 (4 bytes) and the KROOT, followed by pairs of GST (4 bytes)
+ * and key, in the byte order of the machine that wrote it.
+ *
+ * The keys are only used if the header matches the KROOT, which has been
+ * verified with the public key, and its alpha, hash function and GST_0. They
+ * are then trusted without hashing them, like the KROOT and the public key
+ * stored by the receiver, until a key fails to hash down to one of them.
+ */
+void OSNMA_TESLA_Chain::read_checkpoints()
+{
+    if (d_checkpoints_file.empty())
+        {
+            return;
+        }
+    std::ifstream file(d_checkpoints_file, std::ios::binary | std::ios::in);
+    if (!file)
+        {
+            return;
+        }
+    uint8_t hf = 0;
+    uint8_t lk_bytes = 0;
+    uint64_t alpha = 0;
+    uint32_t GST_0 = 0;
+    file.read(reinterpret_cast<char*>(&hf), sizeof(hf));
+    file.read(reinterpret_cast<char*>(&lk_bytes), sizeof(lk_bytes));
+    file.read(reinterpret_cast<char*>(&alpha), sizeof(alpha));
+    file.read(reinterpret_cast<char*>(&GST_0), sizeof(GST_0));
+    std::vector<uint8_t> kroot(lk_bytes);
+    file.read(reinterpret_cast<char*>(kroot.data()), lk_bytes);
+    if (!file || hf != d_hf || alpha != d_alpha || GST_0 != d_GST_0 || kroot != d_kroot)
+        {
+            return;  // checkpoints of another chain
+        }
+
+    const uint32_t GST_kroot = d_GST_0 - 30;
+    uint32_t GST = 0;
+    std::vector<uint8_t> key(lk_bytes);
+    while (file.read(reinterpret_cast<char*>(&GST), sizeof(GST)) && file.read(reinterpret_cast<char*>(key.data()), lk_bytes))
+        {
+            if (GST > GST_kroot && (GST - GST_kroot) % 30 == 0)
+                {
+                    d_checkpoints[GST] = key;
+                    d_stored_GSTs.insert(GST);
+                    d_latest_GST = std::max(d_latest_GST, GST);
+                }
+        }
+    LOG(INFO) << "Galileo OSNMA: " << d_checkpoints.size() - 1 << " TESLA keys of the current chain read from file " << d_checkpoints_file;
+}
+
+
+void OSNMA_TESLA_Chain::store_checkpoints() const
+{
+    if (d_checkpoints_file.empty())
+        {
+            return;
+        }
+    std::ofstream file(d_checkpoints_file, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+        {
+            LOG(WARNING) << "Galileo OSNMA: Unable to store TESLA keys in file " << d_checkpoints_file;
+            return;
+        }
+    const auto lk_bytes = static_cast<uint8_t>(d_kroot.size());
+    file.write(reinterpret_cast<const char*>(&d_hf), sizeof(d_hf));
+    file.write(reinterpret_cast<const char*>(&lk_bytes), sizeof(lk_bytes));
+    file.write(reinterpret_cast<const char*>(&d_alpha), sizeof(d_alpha));
+    file.write(reinterpret_cast<const char*>(&d_GST_0), sizeof(d_GST_0));
+    file.write(reinterpret_cast<const char*>(d_kroot.data()), lk_bytes);
+    for (const auto& checkpoint : d_checkpoints)
+        {
+            if (checkpoint.first != d_GST_0 - 30)
+                {
+                    file.write(reinterpret_cast<const char*>(&checkpoint.first), sizeof(checkpoint.first));
+                    file.write(reinterpret_cast<const char*>(checkpoint.second.data()), lk_bytes);
+                }
+        }
+}
@@ -0,0 +1,102 @@
+/*!
+ * \file osnma_tesla_chain.h
+ * \brief Class for the verification of Galileo OSNMA TESLA keys against the
+ * nearest verified key of the chain
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_OSNMA_TESLA_CHAIN_H
+#define GNSS_SDR_OSNMA_TESLA_CHAIN_H
+
+#include "osnma_data.h"  // for DSM_KROOT_message
+#include <cstddef>       // for size_t
+#include <cstdint>       // for uint32_t
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+class Gnss_Crypto;
+
+/*!
+ * \brief Class that verifies TESLA keys by hashing them down to the nearest
+ * key of the chain that is already known to be authentic.
+ *
+ * The KROOT, the latest verified key and one key every
+ * OSNMA_TESLA_CHECKPOINT_INTERVAL subframes (checkpoints) are kept, so a key
+ * received after a gap or after a restart does not need to be hashed all the
+ * way down to the KROOT. Checkpoints are bound to the KROOT they descend
+ * from. If a file name is provided, they are stored in that file and read
+ * back when the same KROOT is used again (e.g., in a hot start). Keys read
+ * from the file are trusted until a key fails to hash down to them, and
+ * then discarded.
+ */
+class OSNMA_TESLA_Chain
+{
+public:
+    OSNMA_TESLA_Chain() = default;
+    explicit OSNMA_TESLA_Chain(const std::string& checkpoints_file);
+
+    /*!
+     * \brief Verifies the TESLA key received in the subframe starting at
+     * GST_Sf, for the chain defined by kroot and its applicability time
+     * GST_0. Returns true if the key belongs to the chain. The key is always
+     * hashed down to a key transmitted earlier, even if it was already
+     * verified.
+     */
+    bool verify_key(const Gnss_Crypto& crypto,
+        const DSM_KROOT_message& kroot,
+        uint32_t GST_0,
+        const std::vector<uint8_t>& key,
+        uint32_t GST_Sf);
+
+    /*!
+     * \brief Forgets the chain and its checkpoints (e.g., after a chain
+     * renewal or revocation). The next call to verify_key starts again
+     * from the KROOT.
+     */
+    void reset();
+
+    uint32_t get_last_number_of_hashes() const;  //!< Hashes computed in the last call to verify_key
+    size_t get_number_of_checkpoints() const;    //!< Number of verified keys kept, including the KROOT
+
+private:
+    void set_kroot(const DSM_KROOT_message& kroot, uint32_t GST_0);
+    std::vector<uint8_t> hash_down(const Gnss_Crypto& crypto,
+        const std::vector<uint8_t>& key,
+        uint32_t GST_Sf,
+        uint32_t num_of_hashes,
+        std::vector<std::pair<uint32_t, std::vector<uint8_t>>>* checkpoints) const;
+    bool is_checkpoint(uint32_t GST) const;
+    void read_checkpoints();
+    void store_checkpoints() const;
+
+    std::map<uint32_t, std::vector<uint8_t>> d_checkpoints;  // verified keys, sorted by the GST of the subframe in which they were transmitted
+    std::set<uint32_t> d_stored_GSTs;                        // GST of the keys read from d_checkpoints_file
+    std::vector<uint8_t> d_kroot;
+    std::string d_checkpoints_file;
+    uint64_t d_alpha{};
+    uint32_t d_GST_0{};
+    uint32_t d_latest_GST{};  // GST of the latest verified key
+    uint32_t d_last_number_of_hashes{};
+    uint8_t d_hf{};
+};
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_OSNMA_TESLA_CHAIN_H
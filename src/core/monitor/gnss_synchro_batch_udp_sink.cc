@@ -0,0 +1,297 @@
+/*!
+ * \file gnss_synchro_batch_udp_sink.cc
+ * \brief Sends batches of Gnss_Synchro objects in a fixed-layout binary
+ * format over UDP, from a dedicated thread
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_batch_udp_sink.h"
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+// Room for the IPv6 (40 bytes) and UDP (8 bytes) headers
+constexpr int IP_UDP_HEADERS_SIZE = 48;
+constexpr size_t MAX_UDP_PAYLOAD = 65507;
+constexpr size_t MAX_DATAGRAMS_PER_CALL = 32;
+constexpr size_t QUEUED_DATAGRAMS = 4 * MAX_DATAGRAMS_PER_CALL;
+}  // namespace
+
+
+bool gnss_synchro_batch_decode(const char* datagram, size_t size, std::vector<Gnss_Synchro>& gnss_synchro)
+{
+    Gnss_Synchro_Batch_Header header{};
+    if (size < sizeof(header))
+        {
+            return false;
+        }
+    std::memcpy(&header, datagram, sizeof(header));
+    if (header.magic != GNSS_SYNCHRO_BATCH_MAGIC ||
+        header.version != GNSS_SYNCHRO_BATCH_VERSION ||
+        header.record_size != sizeof(Gnss_Synchro_Record) ||
+        size < sizeof(header) + header.n_records * sizeof(Gnss_Synchro_Record))
+        {
+            return false;
+        }
+    Gnss_Synchro_Record record{};
+    Gnss_Synchro gs{};
+    for (size_t i = 0; i < header.n_records; i++)
+        {
+            std::memcpy(&record, datagram + sizeof(header) + i * sizeof(Gnss_Synchro_Record), sizeof(record));
+            gnss_synchro_from_record(record, gs);
+            gnss_synchro.push_back(gs);
+        }
+    return true;
+}
+
+
+Gnss_Synchro_Batch_Udp_Sink::Gnss_Synchro_Batch_Udp_Sink(
+    const std::vector<std::string>& addresses,
+    const std::vector<std::string>& ports,
+    int mtu,
+    int max_latency_ms)
+    : d_socket_v4{d_io_context},
+      d_socket_v6{d_io_context},
+      d_datagram_slots(MAX_DATAGRAMS_PER_CALL),
+      d_dropped(0),
+      d_sequence(0),
+      d_max_latency_ms(std::max(max_latency_ms, 1)),
+      d_stop(false)
+{
+    const size_t payload = std::min(static_cast<size_t>(std::max(mtu - IP_UDP_HEADERS_SIZE, 0)), MAX_UDP_PAYLOAD);
+    d_records_per_datagram = payload > sizeof(Gnss_Synchro_Batch_Header) ? (payload - sizeof(Gnss_Synchro_Batch_Header)) / sizeof(Gnss_Synchro_Record) : 0;
+    d_records_per_datagram = std::max<size_t>(d_records_per_datagram, 1);
+    d_datagram_size = sizeof(Gnss_Synchro_Batch_Header) + d_records_per_datagram * sizeof(Gnss_Synchro_Record);
+    d_max_pending = d_records_per_datagram * QUEUED_DATAGRAMS;
+
+    boost::system::error_code error;
+    for (const auto& address : addresses)
+        {
+            for (const auto& port : ports)
+                {
+                    boost::asio::ip::udp::endpoint endpoint(
+#if BOOST_ASIO_USE_FROM_STRING
+                        boost::asio::ip::address::from_string(address, error),
+#else
+                        boost::asio::ip::make_address(address, error),
+#endif
+                        boost::lexical_cast<int>(port));
+                    if (endpoint.protocol() == boost::asio::ip::udp::v4())
+                        {
+                            d_endpoints_v4.push_back(endpoint);
+                        }
+                    else
+                        {
+                            d_endpoints_v6.push_back(endpoint);
+                        }
+                }
+        }
+
+    // Sockets are opened once and kept open for the lifetime of the sink
+    if (!d_endpoints_v4.empty())
+        {
+            d_socket_v4.open(boost::asio::ip::udp::v4(), error);  // NOLINT(bugprone-unused-return-value)
+        }
+    if (!d_endpoints_v6.empty())
+        {
+            d_socket_v6.open(boost::asio::ip::udp::v6(), error);  // NOLINT(bugprone-unused-return-value)
+        }
+
+    d_pending.reserve(d_max_pending);
+    d_sending.reserve(d_max_pending);
+    d_datagrams = std::vector<char>(d_datagram_slots * d_datagram_size, 0);
+    d_datagram_sizes = std::vector<size_t>(d_datagram_slots, 0);
+#if defined(__linux__)
+    d_iovecs = std::vector<iovec>(d_datagram_slots);
+    for (size_t slot = 0; slot < d_datagram_slots; slot++)
+        {
+            d_iovecs[slot].iov_base = &d_datagrams[slot * d_datagram_size];
+            d_iovecs[slot].iov_len = 0;
+        }
+    d_msgs.reserve(d_datagram_slots * std::max(d_endpoints_v4.size(), d_endpoints_v6.size()));
+#endif
+
+    d_worker = std::thread(&Gnss_Synchro_Batch_Udp_Sink::run, this);
+}
+
+
+Gnss_Synchro_Batch_Udp_Sink::~Gnss_Synchro_Batch_Udp_Sink()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_cv.notify_one();
+    if (d_worker.joinable())
+        {
+            d_worker.join();
+        }
+}
+
+
+size_t Gnss_Synchro_Batch_Udp_Sink::records_per_datagram() const
+{
+    return d_records_per_datagram;
+}
+
+
+uint64_t Gnss_Synchro_Batch_Udp_Sink::dropped() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_dropped;
+}
+
+
+void Gnss_Synchro_Batch_Udp_Sink::write_gnss_synchro(const Gnss_Synchro& gnss_synchro, uint32_t stream)
+{
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (d_pending.size() == d_max_pending)
+            {
+                d_dropped++;
+                return;
+            }
+        d_pending.push_back(Queued_Gnss_Synchro{gnss_synchro, stream});
+        notify = (d_pending.size() % d_records_per_datagram == 0);
+    }
+    if (notify)
+        {
+            d_cv.notify_one();
+        }
+}
+
+
+void Gnss_Synchro_Batch_Udp_Sink::run()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (!d_stop)
+        {
+            d_cv.wait_for(lock, std::chrono::milliseconds(d_max_latency_ms), [this] { return d_stop || d_pending.size() >= d_records_per_datagram; });
+            if (d_pending.empty())
+                {
+                    continue;
+                }
+            std::swap(d_pending, d_sending);
+            lock.unlock();
+            send_batch();
+            d_sending.clear();
+            lock.lock();
+        }
+
+    // Flush whatever is left
+    std::swap(d_pending, d_sending);
+    lock.unlock();
+    send_batch();
+    d_sending.clear();
+}
+
+
+void Gnss_Synchro_Batch_Udp_Sink::send_batch()
+{
+    Gnss_Synchro_Batch_Header header{};
+    header.magic = GNSS_SYNCHRO_BATCH_MAGIC;
+    header.version = GNSS_SYNCHRO_BATCH_VERSION;
+    header.record_size = sizeof(Gnss_Synchro_Record);
+
+    size_t next = 0;
+    while (next < d_sending.size())
+        {
+            size_t n_datagrams = 0;
+            while (n_datagrams < d_datagram_slots && next < d_sending.size())
+                {
+                    char* datagram = &d_datagrams[n_datagrams * d_datagram_size];
+                    const size_t n_records = std::min(d_records_per_datagram, d_sending.size() - next);
+                    header.n_records = static_cast<uint16_t>(n_records);
+                    header.sequence = d_sequence++;
+                    std::memcpy(datagram, &header, sizeof(header));
+                    auto* records = reinterpret_cast<Gnss_Synchro_Record*>(datagram + sizeof(header));
+                    for (size_t i = 0; i < n_records; i++)
+                        {
+                            gnss_synchro_to_record(d_sending[next + i].gnss_synchro, d_sending[next + i].stream, records[i]);
+                        }
+                    d_datagram_sizes[n_datagrams] = sizeof(header) + n_records * sizeof(Gnss_Synchro_Record);
+                    next += n_records;
+                    n_datagrams++;
+                }
+            send_datagrams(n_datagrams);
+        }
+}
+
+
+void Gnss_Synchro_Batch_Udp_Sink::send_datagrams(size_t n_datagrams)
+{
+    if (!d_endpoints_v4.empty())
+        {
+            send_datagrams(d_socket_v4, d_endpoints_v4, n_datagrams);
+        }
+    if (!d_endpoints_v6.empty())
+        {
+            send_datagrams(d_socket_v6, d_endpoints_v6, n_datagrams);
+        }
+}
+
+
+void Gnss_Synchro_Batch_Udp_Sink::send_datagrams(boost::asio::ip::udp::socket& socket,
+    const std::vector<boost::asio::ip::udp::endpoint>& endpoints,
+    size_t n_datagrams)
+{
+    if (!socket.is_open())
+        {
+            return;
+        }
+#if defined(__linux__)
+    // All the datagrams to all the endpoints in a single system call
+    d_msgs.clear();
+    for (size_t slot = 0; slot < n_datagrams; slot++)
+        {
+            d_iovecs[slot].iov_len = d_datagram_sizes[slot];
+            for (const auto& endpoint : endpoints)
+                {
+                    mmsghdr msg{};
+                    msg.msg_hdr.msg_name = const_cast<void*>(static_cast<const void*>(endpoint.data()));
+                    msg.msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+                    msg.msg_hdr.msg_iov = &d_iovecs[slot];
+                    msg.msg_hdr.msg_iovlen = 1;
+                    d_msgs.push_back(msg);
+                }
+        }
+    size_t sent = 0;
+    while (sent < d_msgs.size())
+        {
+            const int ret = sendmmsg(socket.native_handle(), &d_msgs[sent], static_cast<unsigned int>(d_msgs.size() - sent), 0);
+            if (ret <= 0)
+                {
+                    // Skip the message that failed (e.g., unreachable endpoint) and go on
+                    sent++;
+                }
+            else
+                {
+                    sent += static_cast<size_t>(ret);
+                }
+        }
+#else
+    boost::system::error_code error;
+    for (size_t slot = 0; slot < n_datagrams; slot++)
+        {
+            for (const auto& endpoint : endpoints)
+                {
+                    socket.send_to(boost::asio::buffer(&d_datagrams[slot * d_datagram_size], d_datagram_sizes[slot]), endpoint, 0, error);  // NOLINT(bugprone-unused-return-value)
+                }
+        }
+#endif
+}
@@ -0,0 +1,143 @@
+/*!
+ * \file gnss_synchro_batch_udp_sink.h
+ * \brief Sends batches of Gnss_Synchro objects in a fixed-layout binary
+ * format over UDP, from a dedicated thread
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_BATCH_UDP_SINK_H
+#define GNSS_SDR_GNSS_SYNCHRO_BATCH_UDP_SINK_H
+
+#include "gnss_synchro.h"
+#include "gnss_synchro_record.h"
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <sys/socket.h>  // for mmsghdr
+#include <sys/uio.h>     // for iovec
+#endif
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+constexpr uint32_t GNSS_SYNCHRO_BATCH_MAGIC = 0x31425347;  // "GSB1" in little-endian byte order
+constexpr uint16_t GNSS_SYNCHRO_BATCH_VERSION = 1;
+
+/*!
+ * \brief Header of each datagram sent by Gnss_Synchro_Batch_Udp_Sink. It is
+ * followed by n_records Gnss_Synchro_Record objects, in the byte order of
+ * the sender. The stream member of each record holds the index of the
+ * monitor input the object was received from.
+ */
+struct Gnss_Synchro_Batch_Header
+{
+    uint32_t magic;        //!< GNSS_SYNCHRO_BATCH_MAGIC
+    uint16_t version;      //!< GNSS_SYNCHRO_BATCH_VERSION
+    uint16_t n_records;    //!< Number of records in this datagram
+    uint32_t sequence;     //!< Datagram counter, to detect losses
+    uint32_t record_size;  //!< sizeof(Gnss_Synchro_Record)
+};
+
+static_assert(sizeof(Gnss_Synchro_Batch_Header) == 16, "Unexpected Gnss_Synchro_Batch_Header layout");
+
+
+/*!
+ * \brief Decodes a datagram sent by Gnss_Synchro_Batch_Udp_Sink. Appends the
+ * objects to gnss_synchro and returns false if the datagram is malformed.
+ */
+bool gnss_synchro_batch_decode(const char* datagram, size_t size, std::vector<Gnss_Synchro>& gnss_synchro);
+
+
+/*!
+ * \brief This class sends Gnss_Synchro objects over UDP to one or multiple
+ * endpoints, packing as many objects per datagram as the MTU allows.
+ *
+ * write_gnss_synchro() only copies the object into a preallocated queue, so
+ * it is cheap enough to be called from the flow graph thread. A worker
+ * thread converts the objects to the wire format and sends every datagram to
+ * every endpoint with a single sendmmsg() call when available, through
+ * sockets that are opened once. A datagram is sent as soon as it is full,
+ * or when max_latency_ms elapses. If the worker cannot keep up, new objects
+ * are dropped instead of blocking the caller.
+ */
+class Gnss_Synchro_Batch_Udp_Sink
+{
+public:
+    Gnss_Synchro_Batch_Udp_Sink(const std::vector<std::string>& addresses,
+        const std::vector<std::string>& ports,
+        int mtu,
+        int max_latency_ms);
+    ~Gnss_Synchro_Batch_Udp_Sink();
+
+    void write_gnss_synchro(const Gnss_Synchro& gnss_synchro, uint32_t stream);
+
+    size_t records_per_datagram() const;  //!< Number of Gnss_Synchro objects packed in a full datagram
+    uint64_t dropped() const;             //!< Number of objects dropped because the queue was full
+
+private:
+    struct Queued_Gnss_Synchro
+    {
+        Gnss_Synchro gnss_synchro;
+        uint32_t stream;
+    };
+
+    void run();
+    void send_batch();
+    void send_datagrams(size_t n_datagrams);
+    void send_datagrams(boost::asio::ip::udp::socket& socket, const std::vector<boost::asio::ip::udp::endpoint>& endpoints, size_t n_datagrams);
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+    boost::asio::io_context d_io_context;
+#else
+    boost::asio::io_service d_io_context;
+#endif
+    boost::asio::ip::udp::socket d_socket_v4;
+    boost::asio::ip::udp::socket d_socket_v6;
+    std::vector<boost::asio::ip::udp::endpoint> d_endpoints_v4;
+    std::vector<boost::asio::ip::udp::endpoint> d_endpoints_v6;
+
+    std::vector<Queued_Gnss_Synchro> d_pending;  // filled by the caller
+    std::vector<Queued_Gnss_Synchro> d_sending;  // drained by the worker thread
+    std::vector<char> d_datagrams;               // preallocated wire buffers, one per datagram slot
+    std::vector<size_t> d_datagram_sizes;
+#if defined(__linux__)
+    std::vector<iovec> d_iovecs;  // one per datagram slot
+    std::vector<mmsghdr> d_msgs;  // one per datagram slot and endpoint
+#endif
+
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::thread d_worker;
+
+    size_t d_datagram_size;
+    size_t d_records_per_datagram;
+    size_t d_max_pending;
+    size_t d_datagram_slots;
+    uint64_t d_dropped;
+    uint32_t d_sequence;
+    int d_max_latency_ms;
+    bool d_stop;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_BATCH_UDP_SINK_H
@@ -28,20 +28,29 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     const std::vector<std::string>& udp_ports,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    bool enable_batching,
+    int mtu,
+    int max_latency_ms)
 {
     return gnss_synchro_monitor_sptr(new gnss_synchro_monitor(n_channels,
         decimation_factor,
         udp_ports,
         udp_addresses,
-        enable_protobuf));
+        enable_protobuf,
+        enable_batching,
+        mtu,
+        max_latency_ms));
 }
 
 gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
     int decimation_factor,
     const std::vector<std::string>& udp_ports,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    bool enable_batching,
+    int mtu,
+    int max_latency_ms)
     : gr::block("gnss_synchro_monitor",
           gr::io_signature::make(n_channels, n_channels, sizeof(Gnss_Synchro)),
           gr::io_signature::make(0, 0, 0)),
@@ -49,7 +58,15 @@ gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
       d_nchannels(n_channels),
       d_decimation_factor(decimation_factor)
 {
-    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_ports, enable_protobuf);
+    if (enable_batching)
+        {
+            batch_udp_sink_ptr = std::make_unique<Gnss_Synchro_Batch_Udp_Sink>(udp_addresses, udp_ports, mtu, max_latency_ms);
+        }
+    else
+        {
+            udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_ports, enable_protobuf);
+            stocks = std::vector<Gnss_Synchro>(1);
+        }
 }
 
 
@@ -79,16 +96,22 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                     count++;
                     if (count >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
-                            std::vector<Gnss_Synchro> stocks;
-                            stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            if (batch_udp_sink_ptr)
+                                {
+                                    // Only queues the object, the worker thread of the sink does the rest
+                                    batch_udp_sink_ptr->write_gnss_synchro(in[channel_index][item_index], static_cast<uint32_t>(channel_index));
+                                }
+                            else
+                                {
+                                    stocks[0] = in[channel_index][item_index];
+                                    udp_sink_ptr->write_gnss_synchro(stocks);
+                                }
                             // Reset count variable
                             count = 0;
-                            // Consume the number of items for the input stream channel
-                            consume(channel_index, ninput_items[channel_index]);
                         }
                 }
+            // Consume the number of items for the input stream channel
+            consume(channel_index, ninput_items[channel_index]);
         }
 
     // Not producing any outputs
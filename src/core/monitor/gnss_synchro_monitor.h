@@ -21,6 +21,8 @@
 #define GNSS_SDR_GNSS_SYNCHRO_MONITOR_H
 
 #include "gnss_block_interface.h"
+#include "gnss_synchro.h"
+#include "gnss_synchro_batch_udp_sink.h"
 #include "gnss_synchro_udp_sink.h"
 #include <gnuradio/block.h>
 #include <gnuradio/runtime_types.h>  // for gr_vector_void_star
@@ -43,12 +45,19 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     const std::vector<std::string>& udp_ports,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf);
+    bool enable_protobuf,
+    bool enable_batching,
+    int mtu,
+    int max_latency_ms);
 
 /*!
  * \brief This class implements a monitoring block which allows sending
  * a data stream with the receiver internal parameters (Gnss_Synchro objects)
  * to local or remote clients over UDP.
+ *
+ * If enable_batching is true, objects are sent in the fixed-layout format of
+ * Gnss_Synchro_Batch_Udp_Sink, packing several of them per datagram of at
+ * most mtu bytes, and enable_protobuf is ignored.
  */
 class gnss_synchro_monitor : public gr::block
 {
@@ -63,15 +72,23 @@ private:
         int decimation_factor,
         const std::vector<std::string>& udp_ports,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        bool enable_batching,
+        int mtu,
+        int max_latency_ms);
 
     gnss_synchro_monitor(int n_channels,
         int decimation_factor,
         const std::vector<std::string>& udp_ports,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        bool enable_batching,
+        int mtu,
+        int max_latency_ms);
 
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
+    std::unique_ptr<Gnss_Synchro_Batch_Udp_Sink> batch_udp_sink_ptr;
+    std::vector<Gnss_Synchro> stocks;
     int count;
     int d_nchannels;
     int d_decimation_factor;
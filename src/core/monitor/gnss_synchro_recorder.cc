@@ -0,0 +1,141 @@
+/*!
+ * \file gnss_synchro_recorder.cc
+ * \brief GNU Radio block that writes Gnss_Synchro streams to a compact
+ * binary capture file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_recorder.h"
+#include "gnss_synchro.h"
+#include <gnuradio/io_signature.h>
+#include <exception>
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+gnss_synchro_recorder_sptr gnss_synchro_make_recorder(int n_streams,
+    Gnss_Synchro_Record_Tap tap,
+    const std::string& filename)
+{
+    return gnss_synchro_recorder_sptr(new gnss_synchro_recorder(n_streams,
+        tap,
+        filename));
+}
+
+
+gnss_synchro_recorder::gnss_synchro_recorder(int n_streams,
+    Gnss_Synchro_Record_Tap tap,
+    const std::string& filename)
+    : gr::block("gnss_synchro_recorder",
+          gr::io_signature::make(n_streams, n_streams, sizeof(Gnss_Synchro)),
+          gr::io_signature::make(0, 0, 0)),
+      d_filename(filename),
+      d_nrecords(0),
+      d_nstreams(n_streams)
+{
+    d_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    try
+        {
+            d_file.open(d_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+            const Gnss_Synchro_Record_File_Header header = gnss_synchro_record_file_header(static_cast<uint32_t>(n_streams), tap);
+            d_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            LOG(INFO) << "Recording " << n_streams << " Gnss_Synchro streams to " << d_filename;
+        }
+    catch (const std::exception& e)
+        {
+            LOG(WARNING) << "Unable to open the Gnss_Synchro capture file " << d_filename << ": " << e.what();
+            d_file.close();
+        }
+}
+
+
+gnss_synchro_recorder::~gnss_synchro_recorder()
+{
+    DLOG(INFO) << "Gnss_Synchro recorder destructor called";
+    if (d_file.is_open())
+        {
+            try
+                {
+                    d_file.close();
+                    LOG(INFO) << d_nrecords << " Gnss_Synchro objects written to " << d_filename;
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << "Problem closing the Gnss_Synchro capture file " << d_filename << ": " << e.what();
+                }
+        }
+}
+
+
+void gnss_synchro_recorder::forecast(int noutput_items __attribute__((unused)), gr_vector_int& ninput_items_required)
+{
+    for (int32_t stream = 0; stream < d_nstreams; stream++)
+        {
+            // Do not wait for the other streams, so that the capture keeps the arrival order
+            ninput_items_required[stream] = 0;
+        }
+}
+
+
+int gnss_synchro_recorder::general_work(int noutput_items __attribute__((unused)), gr_vector_int& ninput_items,
+    gr_vector_const_void_star& input_items, gr_vector_void_star& output_items __attribute__((unused)))
+{
+    const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);
+
+    // Merge the available items of all the streams by sample counter, which
+    // grows within each stream, and write them in a single call
+    d_records.clear();
+    d_next_item.assign(d_nstreams, 0);
+    for (int32_t stream = 0; stream < d_nstreams; stream++)
+        {
+            if (ninput_items[stream] > 0)
+                {
+                    d_streams_by_sample_counter.emplace(in[stream][0].Tracking_sample_counter, stream);
+                }
+        }
+    while (!d_streams_by_sample_counter.empty())
+        {
+            const int32_t stream = d_streams_by_sample_counter.top().second;
+            d_streams_by_sample_counter.pop();
+            d_records.emplace_back();
+            gnss_synchro_to_record(in[stream][d_next_item[stream]], static_cast<uint32_t>(stream), d_records.back());
+            if (++d_next_item[stream] < ninput_items[stream])
+                {
+                    d_streams_by_sample_counter.emplace(in[stream][d_next_item[stream]].Tracking_sample_counter, stream);
+                }
+        }
+    for (int32_t stream = 0; stream < d_nstreams; stream++)
+        {
+            consume(stream, ninput_items[stream]);
+        }
+
+    if (d_file.is_open() && !d_records.empty())
+        {
+            try
+                {
+                    d_file.write(reinterpret_cast<const char*>(d_records.data()), static_cast<std::streamsize>(d_records.size() * sizeof(Gnss_Synchro_Record)));
+                    d_nrecords += d_records.size();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << "Exception writing the Gnss_Synchro capture file " << d_filename << ": " << e.what();
+                    d_file.close();
+                }
+        }
+
+    // Not producing any outputs
+    return 0;
+}
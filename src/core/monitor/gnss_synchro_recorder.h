@@ -0,0 +1,88 @@
+/*!
+ * \file gnss_synchro_recorder.h
+ * \brief GNU Radio block that writes Gnss_Synchro streams to a compact
+ * binary capture file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_RECORDER_H
+#define GNSS_SDR_GNSS_SYNCHRO_RECORDER_H
+
+#include "gnss_block_interface.h"
+#include "gnss_synchro_record.h"
+#include <gnuradio/block.h>
+#include <gnuradio/runtime_types.h>  // for gr_vector_void_star
+#include <cstdint>
+#include <fstream>
+#include <functional>  // for std::greater
+#include <queue>       // for std::priority_queue
+#include <string>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+class gnss_synchro_recorder;
+
+using gnss_synchro_recorder_sptr = gnss_shared_ptr<gnss_synchro_recorder>;
+
+gnss_synchro_recorder_sptr gnss_synchro_make_recorder(int n_streams,
+    Gnss_Synchro_Record_Tap tap,
+    const std::string& filename);
+
+/*!
+ * \brief This class implements a sink block that stores every Gnss_Synchro
+ * object received in any of its inputs in a capture file.
+ *
+ * The file starts with a Gnss_Synchro_Record_File_Header and continues with
+ * a Gnss_Synchro_Record per object, which holds the index of the input it
+ * came from. The objects available in each call are merged by
+ * Tracking_sample_counter, but a stream that falls behind the others can
+ * still deliver older objects in a later call, so the file is only sorted
+ * within each stream, and the replay sorts it again. A capture taken at the
+ * inputs of the Observables block can be replayed with the
+ * Gnss_Synchro_Replay_Signal_Source.
+ */
+class gnss_synchro_recorder : public gr::block
+{
+public:
+    ~gnss_synchro_recorder();
+    void forecast(int noutput_items, gr_vector_int& ninput_items_required);
+    int general_work(int noutput_items, gr_vector_int& ninput_items,
+        gr_vector_const_void_star& input_items, gr_vector_void_star& output_items);
+
+private:
+    friend gnss_synchro_recorder_sptr gnss_synchro_make_recorder(int n_streams,
+        Gnss_Synchro_Record_Tap tap,
+        const std::string& filename);
+
+    gnss_synchro_recorder(int n_streams,
+        Gnss_Synchro_Record_Tap tap,
+        const std::string& filename);
+
+    std::vector<Gnss_Synchro_Record> d_records;
+    std::vector<int> d_next_item;
+    std::priority_queue<std::pair<uint64_t, int32_t>, std::vector<std::pair<uint64_t, int32_t>>, std::greater<>> d_streams_by_sample_counter;  // sample counter of the next item of each stream, empty between calls
+    std::ofstream d_file;
+    std::string d_filename;
+    uint64_t d_nrecords;
+    int32_t d_nstreams;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_RECORDER_H
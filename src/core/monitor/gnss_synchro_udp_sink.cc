@@ -47,6 +47,11 @@ Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(
                     endpoints.push_back(endpoint);
                 }
         }
+    // Open the socket once instead of on every write
+    if (!endpoints.empty())
+        {
+            socket.open(endpoints.front().protocol(), error);  // NOLINT(bugprone-unused-return-value)
+        }
 }
 
 
@@ -69,8 +74,6 @@ bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>&
         {
             for (const auto& endpoint : endpoints)
                 {
-                    socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
-
                     if (socket.send_to(boost::asio::buffer(outbound_data), endpoint) == 0)  // this can throw
                         {
                             return false;
@@ -0,0 +1,345 @@
+/*!
+ * \file acquisition_scheduler.cc
+ * \brief Class that predicts the elevation and the Doppler shift of every
+ * satellite from ephemerides, almanacs and the latest PVT fix, in order to
+ * skip satellites below the horizon and to narrow the acquisition Doppler
+ * search.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_scheduler.h"
+#include "MATH_CONSTANTS.h"      // for SPEED_OF_LIGHT_M_S, R2D
+#include "gnss_frequencies.h"    // for FREQ1, FREQ2, FREQ5, FREQ6, FREQ7
+#include "rtklib.h"              // for gtime_t, eph_t, alm_t
+#include "rtklib_conversions.h"  // for eph_to_rtklib, alm_to_rtklib
+#include "rtklib_ephemeris.h"    // for eph2pos, alm2pos
+#include "rtklib_rtkcmn.h"       // for gpst2time, timeadd, geodist, satazel
+#include <algorithm>             // for std::count_if
+#include <array>                 // for std::array
+#include <cmath>                 // for std::ceil, std::abs
+#include <string>                // for std::string
+#include <utility>               // for std::pair
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+namespace
+{
+// Maximum Doppler rate of a GNSS satellite seen from a static receiver, at L1 [Hz/s]
+constexpr double MAX_DOPPLER_RATE_L1_HZ_S = 1.0;
+// Additional Doppler uncertainty of an almanac-based prediction, at L1 [Hz]
+constexpr double ALMANAC_DOPPLER_MARGIN_L1_HZ = 100.0;
+// Predictions older than this are discarded [s]
+constexpr double MAX_PREDICTION_AGE_S = 600.0;
+constexpr double HALF_WEEK_S = 302400.0;
+constexpr double WEEK_S = 604800.0;
+
+// The almanacs only hold the time of week of their reference time, so it is
+// placed in the week that takes it closest to the fix (t - toa wrapped by
+// +-302400 s, as for the ephemerides), and the almanac is propagated from
+// there with full times
+alm_t almanac_at_fix(alm_t rtklib_alm, const gtime_t& gps_time, double rx_tow_s)
+{
+    double toa_minus_rx_s = static_cast<double>(rtklib_alm.toas) - rx_tow_s;
+    if (toa_minus_rx_s > HALF_WEEK_S)
+        {
+            toa_minus_rx_s -= WEEK_S;
+        }
+    else if (toa_minus_rx_s < -HALF_WEEK_S)
+        {
+            toa_minus_rx_s += WEEK_S;
+        }
+    rtklib_alm.toa = timeadd(gps_time, toa_minus_rx_s);
+    return rtklib_alm;
+}
+
+double carrier_frequency_hz(const std::string& signal)
+{
+    if (signal == "1C" || signal == "1B")
+        {
+            return FREQ1;
+        }
+    if (signal == "2S")
+        {
+            return FREQ2;
+        }
+    if (signal == "L5" || signal == "5X")
+        {
+            return FREQ5;
+        }
+    if (signal == "7X")
+        {
+            return FREQ7;
+        }
+    if (signal == "E6")
+        {
+            return FREQ6;
+        }
+    return 0.0;
+}
+}  // namespace
+
+
+AcquisitionScheduler::AcquisitionScheduler(double elevation_mask_deg,
+    uint32_t doppler_window_hz,
+    double update_period_s,
+    bool pre_2009_file)
+    : elevation_mask_deg_(elevation_mask_deg),
+      update_period_s_(update_period_s),
+      clock_drift_ppm_(0.0),
+      last_rx_time_(-1.0),
+      receiver_time_s_(0.0),
+      last_update_receiver_time_s_(0.0),
+      doppler_window_hz_(doppler_window_hz),
+      pre_2009_file_(pre_2009_file),
+      has_fix_(false)
+{
+}
+
+
+void AcquisitionScheduler::set_receiver_time(double receiver_time_s)
+{
+    receiver_time_s_ = receiver_time_s;
+}
+
+
+bool AcquisitionScheduler::needs_update(const Monitor_Pvt& pvt_status) const
+{
+    if (pvt_status.RX_time < 0.0)
+        {
+            return false;
+        }
+    return !has_fix_ || std::abs(pvt_status.RX_time - last_rx_time_) >= update_period_s_;
+}
+
+
+void AcquisitionScheduler::update(const Monitor_Pvt& pvt_status,
+    const std::map<int, Gps_Ephemeris>& gps_ephemeris,
+    const std::map<int, Galileo_Ephemeris>& galileo_ephemeris,
+    const std::map<int, Gps_Almanac>& gps_almanac,
+    const std::map<int, Galileo_Almanac>& galileo_almanac)
+{
+    if (pvt_status.RX_time < 0.0)
+        {
+            return;
+        }
+    const std::array<double, 3> rx_pos{pvt_status.pos_x, pvt_status.pos_y, pvt_status.pos_z};
+    const std::array<double, 3> rx_vel{pvt_status.vel_x, pvt_status.vel_y, pvt_status.vel_z};
+    if (norm_rtk(rx_pos.data(), 3) <= 0.0)
+        {
+            return;
+        }
+
+    // Satellite velocities are obtained from positions half a second before and after the fix
+    const double dt = 1.0;
+    const gtime_t gps_time = gpst2time(static_cast<int>(pvt_status.week), pvt_status.RX_time);
+    const gtime_t time_before = timeadd(gps_time, -dt / 2.0);
+    const gtime_t time_after = timeadd(gps_time, dt / 2.0);
+
+    std::array<double, 3> sat_pos_before{};
+    std::array<double, 3> sat_pos_after{};
+    double clock_bias_s;
+    double sat_pos_variance_m2;
+    Satellite_Prediction prediction{};
+
+    gps_predictions_.clear();
+    for (const auto& eph : gps_ephemeris)
+        {
+            const eph_t rtklib_eph = eph_to_rtklib(eph.second, pre_2009_file_);
+            eph2pos(time_before, &rtklib_eph, sat_pos_before.data(), &clock_bias_s, &sat_pos_variance_m2);
+            eph2pos(time_after, &rtklib_eph, sat_pos_after.data(), &clock_bias_s, &sat_pos_variance_m2);
+            if (predict(rx_pos.data(), rx_vel.data(), sat_pos_before.data(), sat_pos_after.data(), dt, false, prediction))
+                {
+                    gps_predictions_[eph.second.PRN] = prediction;
+                }
+        }
+    for (const auto& alm : gps_almanac)
+        {
+            if (gps_predictions_.count(alm.second.PRN) != 0)
+                {
+                    continue;
+                }
+            const alm_t rtklib_alm = almanac_at_fix(alm_to_rtklib(alm.second), gps_time, pvt_status.RX_time);
+            alm2pos(time_before, &rtklib_alm, sat_pos_before.data(), &clock_bias_s);
+            alm2pos(time_after, &rtklib_alm, sat_pos_after.data(), &clock_bias_s);
+            if (predict(rx_pos.data(), rx_vel.data(), sat_pos_before.data(), sat_pos_after.data(), dt, true, prediction))
+                {
+                    gps_predictions_[alm.second.PRN] = prediction;
+                }
+        }
+
+    galileo_predictions_.clear();
+    for (const auto& eph : galileo_ephemeris)
+        {
+            const eph_t rtklib_eph = eph_to_rtklib(eph.second);
+            eph2pos(time_before, &rtklib_eph, sat_pos_before.data(), &clock_bias_s, &sat_pos_variance_m2);
+            eph2pos(time_after, &rtklib_eph, sat_pos_after.data(), &clock_bias_s, &sat_pos_variance_m2);
+            if (predict(rx_pos.data(), rx_vel.data(), sat_pos_before.data(), sat_pos_after.data(), dt, false, prediction))
+                {
+                    galileo_predictions_[eph.second.PRN] = prediction;
+                }
+        }
+    for (const auto& alm : galileo_almanac)
+        {
+            if (galileo_predictions_.count(alm.second.PRN) != 0)
+                {
+                    continue;
+                }
+            const alm_t rtklib_alm = almanac_at_fix(alm_to_rtklib(alm.second), gps_time, pvt_status.RX_time);
+            alm2pos(time_before, &rtklib_alm, sat_pos_before.data(), &clock_bias_s);
+            alm2pos(time_after, &rtklib_alm, sat_pos_after.data(), &clock_bias_s);
+            if (predict(rx_pos.data(), rx_vel.data(), sat_pos_before.data(), sat_pos_after.data(), dt, true, prediction))
+                {
+                    galileo_predictions_[alm.second.PRN] = prediction;
+                }
+        }
+
+    clock_drift_ppm_ = pvt_status.user_clk_drift_ppm;
+    last_rx_time_ = pvt_status.RX_time;
+    last_update_receiver_time_s_ = receiver_time_s_;
+    has_fix_ = true;
+    DLOG(INFO) << "Acquisition scheduler: " << get_number_of_predictions() << " satellites predicted, "
+               << get_number_below_elevation_mask() << " of them below the elevation mask";
+}
+
+
+bool AcquisitionScheduler::get_doppler_window(const Gnss_Signal& signal,
+    double& doppler_hz,
+    uint32_t& doppler_window_hz) const
+{
+    if (!is_valid())
+        {
+            return false;
+        }
+    const double freq_hz = carrier_frequency_hz(signal.get_signal_str());
+    if (freq_hz == 0.0)
+        {
+            return false;
+        }
+    const Gnss_Satellite satellite = signal.get_satellite();
+    const std::map<uint32_t, Satellite_Prediction>* predictions = nullptr;
+    if (satellite.get_system() == "GPS")
+        {
+            predictions = &gps_predictions_;
+        }
+    else if (satellite.get_system() == "Galileo")
+        {
+            predictions = &galileo_predictions_;
+        }
+    else
+        {
+            return false;
+        }
+    const auto it = predictions->find(satellite.get_PRN());
+    if (it == predictions->cend())
+        {
+            return false;
+        }
+
+    const double scale = freq_hz / FREQ1;
+    double window_hz = doppler_window_hz_ * scale + MAX_DOPPLER_RATE_L1_HZ_S * age_s() * scale;
+    if (it->second.from_almanac)
+        {
+            window_hz += ALMANAC_DOPPLER_MARGIN_L1_HZ * scale;
+        }
+    doppler_hz = -(it->second.range_rate_m_s / SPEED_OF_LIGHT_M_S + clock_drift_ppm_ * 1e-6) * freq_hz;
+    doppler_window_hz = static_cast<uint32_t>(std::ceil(window_hz));
+    return true;
+}
+
+
+bool AcquisitionScheduler::is_below_elevation_mask(const Gnss_Satellite& satellite) const
+{
+    if (!is_valid())
+        {
+            return false;
+        }
+    const std::map<uint32_t, Satellite_Prediction>* predictions = nullptr;
+    if (satellite.get_system() == "GPS")
+        {
+            predictions = &gps_predictions_;
+        }
+    else if (satellite.get_system() == "Galileo")
+        {
+            predictions = &galileo_predictions_;
+        }
+    else
+        {
+            return false;
+        }
+    const auto it = predictions->find(satellite.get_PRN());
+    return it != predictions->cend() && it->second.elevation_deg < elevation_mask_deg_;
+}
+
+
+size_t AcquisitionScheduler::get_number_below_elevation_mask() const
+{
+    if (!is_valid())
+        {
+            return 0;
+        }
+    const auto below = [this](const std::pair<const uint32_t, Satellite_Prediction>& p) { return p.second.elevation_deg < elevation_mask_deg_; };
+    return std::count_if(gps_predictions_.cbegin(), gps_predictions_.cend(), below) +
+           std::count_if(galileo_predictions_.cbegin(), galileo_predictions_.cend(), below);
+}
+
+
+size_t AcquisitionScheduler::get_number_of_predictions() const
+{
+    return is_valid() ? gps_predictions_.size() + galileo_predictions_.size() : 0;
+}
+
+
+bool AcquisitionScheduler::predict(const double* rx_pos,
+    const double* rx_vel,
+    const double* sat_pos_before,
+    const double* sat_pos_after,
+    double dt,
+    bool from_almanac,
+    Satellite_Prediction& prediction) const
+{
+    std::array<double, 3> sat_pos{};
+    std::array<double, 3> relative_vel{};
+    for (int i = 0; i < 3; i++)
+        {
+            sat_pos[i] = (sat_pos_before[i] + sat_pos_after[i]) / 2.0;
+            relative_vel[i] = (sat_pos_after[i] - sat_pos_before[i]) / dt - rx_vel[i];
+        }
+    std::array<double, 3> los{};
+    if (geodist(sat_pos.data(), rx_pos, los.data()) <= 0.0)
+        {
+            return false;  // no orbit data
+        }
+    std::array<double, 3> rx_llh{};
+    std::array<double, 2> azel{};
+    ecef2pos(rx_pos, rx_llh.data());
+    satazel(rx_llh.data(), los.data(), azel.data());
+    prediction.elevation_deg = azel[1] * R2D;
+    prediction.range_rate_m_s = dot(los.data(), relative_vel.data(), 3);
+    prediction.from_almanac = from_almanac;
+    return true;
+}
+
+
+bool AcquisitionScheduler::is_valid() const
+{
+    return has_fix_ && age_s() < MAX_PREDICTION_AGE_S;
+}
+
+
+double AcquisitionScheduler::age_s() const
+{
+    return receiver_time_s_ - last_update_receiver_time_s_;
+}
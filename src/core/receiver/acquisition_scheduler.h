@@ -0,0 +1,149 @@
+/*!
+ * \file acquisition_scheduler.h
+ * \brief Class that predicts the elevation and the Doppler shift of every
+ * satellite from ephemerides, almanacs and the latest PVT fix, in order to
+ * skip satellites below the horizon and to narrow the acquisition Doppler
+ * search.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_SCHEDULER_H
+#define GNSS_SDR_ACQUISITION_SCHEDULER_H
+
+#include "galileo_almanac.h"
+#include "galileo_ephemeris.h"
+#include "gnss_satellite.h"
+#include "gnss_signal.h"
+#include "gps_almanac.h"
+#include "gps_ephemeris.h"
+#include "monitor_pvt.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Keeps a prediction of the elevation and the Doppler shift of every
+ * GPS and Galileo satellite with ephemeris or almanac data, computed at the
+ * time and position of the latest PVT fix.
+ *
+ * The acquisition manager uses it to push back satellites predicted below the
+ * elevation mask and to search only a window around the predicted Doppler
+ * shift. Predictions older than a few minutes are discarded, and the Doppler
+ * window widens with the age of the prediction, so a receiver that loses its
+ * fix falls back to the full search.
+ */
+class AcquisitionScheduler
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param elevation_mask_deg - Satellites predicted below this elevation are not searched [deg]
+     * \param doppler_window_hz - Half-width of the Doppler window around the prediction, at L1 [Hz]
+     * \param update_period_s - Minimum time between two updates of the predictions [s]
+     * \param pre_2009_file - Week numbers of the ephemerides are prior to the 2009 rollover
+     */
+    AcquisitionScheduler(double elevation_mask_deg,
+        uint32_t doppler_window_hz,
+        double update_period_s = 1.0,
+        bool pre_2009_file = false);
+
+    /*!
+     * \brief Sets the current receiver time, counted in samples of the
+     * receiver clock since the beginning of the run [s]. The age of the
+     * predictions is measured with this time, so it is also right when
+     * files are processed faster or slower than real time.
+     */
+    void set_receiver_time(double receiver_time_s);
+
+    /*!
+     * \brief Returns true if there is a PVT fix newer than the last update by
+     * more than the update period
+     */
+    bool needs_update(const Monitor_Pvt& pvt_status) const;
+
+    /*!
+     * \brief Computes the predictions at the time and position of pvt_status.
+     * Ephemerides take precedence over almanacs. Does nothing if there is no fix.
+     */
+    void update(const Monitor_Pvt& pvt_status,
+        const std::map<int, Gps_Ephemeris>& gps_ephemeris,
+        const std::map<int, Galileo_Ephemeris>& galileo_ephemeris,
+        const std::map<int, Gps_Almanac>& gps_almanac,
+        const std::map<int, Galileo_Almanac>& galileo_almanac);
+
+    /*!
+     * \brief Gets the predicted Doppler shift of the signal, and the half-width
+     * of the window to be searched around it. Returns false if there is no
+     * valid prediction for the signal.
+     */
+    bool get_doppler_window(const Gnss_Signal& signal,
+        double& doppler_hz,
+        uint32_t& doppler_window_hz) const;
+
+    /*!
+     * \brief Returns true if the satellite is predicted below the elevation
+     * mask. Satellites without a valid prediction are never below the mask.
+     */
+    bool is_below_elevation_mask(const Gnss_Satellite& satellite) const;
+
+    /*!
+     * \brief Returns the number of satellites predicted below the elevation mask
+     */
+    size_t get_number_below_elevation_mask() const;
+
+    /*!
+     * \brief Returns the number of satellites with a valid prediction
+     */
+    size_t get_number_of_predictions() const;
+
+private:
+    struct Satellite_Prediction
+    {
+        double elevation_deg;
+        double range_rate_m_s;
+        bool from_almanac;
+    };
+
+    bool predict(const double* rx_pos,
+        const double* rx_vel,
+        const double* sat_pos_before,
+        const double* sat_pos_after,
+        double dt,
+        bool from_almanac,
+        Satellite_Prediction& prediction) const;
+    bool is_valid() const;
+    double age_s() const;
+
+    std::map<uint32_t, Satellite_Prediction> gps_predictions_;
+    std::map<uint32_t, Satellite_Prediction> galileo_predictions_;
+
+    double elevation_mask_deg_;
+    double update_period_s_;
+    double clock_drift_ppm_;
+    double last_rx_time_;
+    double receiver_time_s_;
+    double last_update_receiver_time_s_;
+    uint32_t doppler_window_hz_;
+    bool pre_2009_file_;
+    bool has_fix_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_SCHEDULER_H
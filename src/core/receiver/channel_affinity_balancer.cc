@@ -0,0 +1,162 @@
+/*!
+ * \file channel_affinity_balancer.cc
+ * \brief Class that pins the blocks of each channel to one core of a set, and
+ * moves channels between cores to balance their load.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "channel_affinity_balancer.h"
+#include <algorithm>  // for std::fill, std::max
+#include <cmath>      // for std::abs
+
+
+ChannelAffinityBalancer::ChannelAffinityBalancer(const std::vector<int>& cpus,
+    size_t channels,
+    double imbalance_threshold)
+    : cpus_(cpus),
+      core_of_channel_(channels, 0),
+      last_busy_time_s_(channels, 0.0),
+      channel_load_(channels, 0.0),
+      utilization_(cpus.size(), 0.0),
+      imbalance_threshold_(imbalance_threshold),
+      has_busy_time_(false)
+{
+    if (cpus_.empty())
+        {
+            cpus_.push_back(0);
+            utilization_.push_back(0.0);
+        }
+    for (size_t channel = 0; channel < channels; channel++)
+        {
+            core_of_channel_[channel] = channel % cpus_.size();
+        }
+}
+
+
+size_t ChannelAffinityBalancer::get_core(size_t channel) const
+{
+    return core_of_channel_.at(channel);
+}
+
+
+int ChannelAffinityBalancer::get_cpu(size_t core) const
+{
+    return cpus_.at(core);
+}
+
+
+size_t ChannelAffinityBalancer::get_number_of_cores() const
+{
+    return cpus_.size();
+}
+
+
+const std::vector<double>& ChannelAffinityBalancer::get_utilization() const
+{
+    return utilization_;
+}
+
+
+void ChannelAffinityBalancer::update_utilization()
+{
+    std::fill(utilization_.begin(), utilization_.end(), 0.0);
+    for (size_t channel = 0; channel < core_of_channel_.size(); channel++)
+        {
+            utilization_[core_of_channel_[channel]] += channel_load_[channel];
+        }
+}
+
+
+std::vector<size_t> ChannelAffinityBalancer::balance(const std::vector<double>& busy_time_s, double elapsed_s)
+{
+    std::vector<size_t> moved_channels;
+    if (busy_time_s.size() != core_of_channel_.size() || elapsed_s <= 0.0)
+        {
+            return moved_channels;
+        }
+
+    for (size_t channel = 0; channel < busy_time_s.size(); channel++)
+        {
+            channel_load_[channel] = std::max(busy_time_s[channel] - last_busy_time_s_[channel], 0.0) / elapsed_s;
+            last_busy_time_s_[channel] = busy_time_s[channel];
+        }
+    // The first call only sets the reference of the busy times
+    if (!has_busy_time_)
+        {
+            has_busy_time_ = true;
+            std::fill(channel_load_.begin(), channel_load_.end(), 0.0);
+            return moved_channels;
+        }
+    update_utilization();
+
+    // Each move takes a channel from the busiest core to the idlest one among
+    // the cores that have not been part of a move yet, so that the loads
+    // measured in the next period reflect the moves
+    std::vector<bool> moved_core(cpus_.size(), false);
+    while (true)
+        {
+            size_t busiest = cpus_.size();
+            size_t idlest = cpus_.size();
+            for (size_t core = 0; core < cpus_.size(); core++)
+                {
+                    if (!moved_core[core])
+                        {
+                            if (busiest == cpus_.size() || utilization_[core] > utilization_[busiest])
+                                {
+                                    busiest = core;
+                                }
+                            if (idlest == cpus_.size() || utilization_[core] < utilization_[idlest])
+                                {
+                                    idlest = core;
+                                }
+                        }
+                }
+            if (busiest == cpus_.size() || busiest == idlest)
+                {
+                    break;
+                }
+            const double imbalance = utilization_[busiest] - utilization_[idlest];
+            if (imbalance < imbalance_threshold_)
+                {
+                    break;
+                }
+
+            // The channel that best evens out both cores is the one with the
+            // load closest to half of the imbalance, and it must be lighter
+            // than the imbalance itself to reduce it
+            size_t best_channel = core_of_channel_.size();
+            double best_distance = imbalance;
+            for (size_t channel = 0; channel < core_of_channel_.size(); channel++)
+                {
+                    if (core_of_channel_[channel] == busiest && channel_load_[channel] > 0.0 && channel_load_[channel] < imbalance)
+                        {
+                            const double distance = std::abs(channel_load_[channel] - 0.5 * imbalance);
+                            if (distance < best_distance)
+                                {
+                                    best_distance = distance;
+                                    best_channel = channel;
+                                }
+                        }
+                }
+            if (best_channel == core_of_channel_.size())
+                {
+                    break;
+                }
+            core_of_channel_[best_channel] = idlest;
+            utilization_[busiest] -= channel_load_[best_channel];
+            utilization_[idlest] += channel_load_[best_channel];
+            moved_core[busiest] = true;
+            moved_core[idlest] = true;
+            moved_channels.push_back(best_channel);
+        }
+    return moved_channels;
+}
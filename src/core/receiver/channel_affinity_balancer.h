@@ -0,0 +1,99 @@
+/*!
+ * \file channel_affinity_balancer.h
+ * \brief Class that pins the blocks of each channel to one core of a set, and
+ * moves channels between cores to balance their load.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CHANNEL_AFFINITY_BALANCER_H
+#define GNSS_SDR_CHANNEL_AFFINITY_BALANCER_H
+
+#include <cstddef>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Assignment of the channels to a set of cores.
+ *
+ * This class only decides the CPU affinity of the channels. GNU Radio still
+ * runs every block in its own thread, so the number of threads and of context
+ * switches does not change, but the threads of the blocks of a channel
+ * (acquisition, tracking and telemetry decoder) stay on the same core and
+ * share its cache. Channels are first assigned in round-robin. Then, from the
+ * busy time of the blocks of each channel, the balancer estimates the load of
+ * every channel and the utilization of every core, and moves channels from
+ * the most loaded cores to the least loaded ones.
+ */
+class ChannelAffinityBalancer
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param cpus - CPU of each core of the set
+     * \param channels - Number of channels
+     * \param imbalance_threshold - Minimum difference of utilization between
+     * two cores for a channel to be moved from one to the other
+     */
+    ChannelAffinityBalancer(const std::vector<int>& cpus,
+        size_t channels,
+        double imbalance_threshold = 0.1);
+
+    /*!
+     * \brief Returns the index of the core of the channel
+     */
+    size_t get_core(size_t channel) const;
+
+    /*!
+     * \brief Returns the CPU of the core
+     */
+    int get_cpu(size_t core) const;
+
+    size_t get_number_of_cores() const;
+
+    /*!
+     * \brief Updates the load of the channels and the utilization of the
+     * cores, and moves channels from the most loaded cores to the least loaded
+     * ones. Each core gives or takes at most one channel per call.
+     * \param busy_time_s - Total time spent in the blocks of each channel
+     * since the start of the receiver [s]
+     * \param elapsed_s - Time since the previous call [s]
+     * \return channels that have been moved to another core
+     */
+    std::vector<size_t> balance(const std::vector<double>& busy_time_s, double elapsed_s);
+
+    /*!
+     * \brief Returns the fraction of time that the channels of each core have
+     * been busy during the last balancing period
+     */
+    const std::vector<double>& get_utilization() const;
+
+private:
+    void update_utilization();
+
+    std::vector<int> cpus_;
+    std::vector<size_t> core_of_channel_;
+    std::vector<double> last_busy_time_s_;
+    std::vector<double> channel_load_;
+    std::vector<double> utilization_;
+    double imbalance_threshold_;
+    bool has_busy_time_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CHANNEL_AFFINITY_BALANCER_H
@@ -53,7 +53,8 @@
 #include <boost/interprocess/ipc/message_queue.hpp>  // for message_queue
 #include <boost/lexical_cast.hpp>                    // for bad_lexical_cast
 #include <pmt/pmt.h>                                 // for make_any
-#include <algorithm>                                 // for find, min
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>        // for volk_gnsssdr_set_buffer_policy
+#include <algorithm>                                 // for find, max, min
 #include <chrono>                                    // for milliseconds
 #include <cmath>                                     // for floor, fmod, log
 #include <csignal>                                   // for signal, SIGINT
@@ -64,6 +65,7 @@
 #include <map>                                       // for map
 #include <pthread.h>                                 // for pthread_cancel
 #include <stdexcept>                                 // for invalid_argument
+#include <utility>                                   // for pair
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -171,6 +173,8 @@ void ControlThread::init()
     telecommand_enabled_ = configuration_->property("GNSS-SDR.telecommand_enabled", false);
     // OPTIONAL: specify a custom year to override the system time in order to postprocess old gnss records and avoid wrong week rollover
     pre_2009_file_ = configuration_->property("GNSS-SDR.pre_2009_file", false);
+    // Allocation of the volk_gnsssdr::vector buffers, set before any block is created
+    set_buffer_policy();
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
     control_queue_ = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
     cmd_interface_.set_msg_queue(control_queue_);  // set also the queue pointer for the telecommand thread
@@ -363,11 +367,47 @@ void ControlThread::event_dispatcher(bool &valid_event, pmt::pmt_t &msg)
                 {
                     // perform non-priority tasks
                     flowgraph_->acquisition_manager(0);  // start acquisition of untracked satellites
+                    flowgraph_->balance_channel_affinity();
                 }
         }
 }
 
 
+void ControlThread::set_buffer_policy()
+{
+    const std::string hugepages = configuration_->property("GNSS-SDR.buffer_hugepages", std::string("none"));
+    const double pool_size_mb = configuration_->property("GNSS-SDR.buffer_pool_size_mb", 0.0);
+    unsigned int flags = 0;
+    if (hugepages == "transparent")
+        {
+            flags |= VOLK_GNSSSDR_BUFFER_HUGEPAGES;
+        }
+    else if (hugepages == "explicit")
+        {
+            flags |= VOLK_GNSSSDR_BUFFER_EXPLICIT_HUGEPAGES;
+        }
+    else if (hugepages != "none")
+        {
+            std::cerr << "GNSS-SDR.buffer_hugepages=" << hugepages << " is not valid. Please use none, transparent or explicit.\n";
+        }
+    if (pool_size_mb > 0.0)
+        {
+            flags |= VOLK_GNSSSDR_BUFFER_POOLED;
+        }
+    volk_gnsssdr_set_buffer_policy(flags, static_cast<size_t>(std::max(pool_size_mb, 0.0) * 1024.0 * 1024.0));
+}
+
+
+void ControlThread::log_buffer_stats() const
+{
+    volk_gnsssdr_buffer_stats_t stats{};
+    volk_gnsssdr_get_buffer_stats(&stats);
+    LOG(INFO) << "Buffers: " << stats.allocations << " allocations (" << stats.pool_hits << " from the pool, "
+              << stats.hugepage_allocations << " on hugepages), peak " << stats.peak_bytes_in_use / 1024 << " kB in use, "
+              << stats.pooled_bytes / 1024 << " kB pooled, " << stats.mapped_bytes / 1024 << " kB mapped";
+}
+
+
 /*
  * Runs the control thread that manages the receiver control plane
  *
@@ -448,6 +488,7 @@ int ControlThread::run()
     flowgraph_->stop();
     stop_ = true;
     flowgraph_->disconnect();
+    log_buffer_stats();
 
 #ifdef ENABLE_FPGA
     // trigger a HW reset
@@ -1016,6 +1057,14 @@ void ControlThread::apply_action(unsigned int what)
             // start again the satellite acquisitions
             receiver_on_standby_ = false;
             break;
+        case 14:
+            {
+                const std::pair<uint32_t, uint32_t> channel_satellite = cmd_interface_.get_channel_satellite();
+                LOG(INFO) << "Receiver action SET CHANNEL " << channel_satellite.first << " SATELLITE " << channel_satellite.second;
+                // takes effect at the next acquisition of the channel
+                flowgraph_->set_channel_satellite(channel_satellite.first, channel_satellite.second);
+                break;
+            }
         default:
             LOG(INFO) << "Unrecognized action.";
             break;
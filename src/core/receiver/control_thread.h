@@ -132,6 +132,13 @@ private:
 
     void init();
 
+    /*
+     * Sets the allocation policy of the volk_gnsssdr::vector buffers from
+     * GNSS-SDR.buffer_hugepages and GNSS-SDR.buffer_pool_size_mb
+     */
+    void set_buffer_policy();
+    void log_buffer_stats() const;
+
     void apply_action(unsigned int what);
 
     /*
@@ -0,0 +1,97 @@
+/*!
+ * \file flowgraph_config_snapshot.cc
+ * \brief Typed, immutable copy of the configuration parameters read by the
+ * flowgraph control plane at runtime
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "flowgraph_config_snapshot.h"
+#include "configuration_interface.h"
+#include <exception>  // for std::exception
+#include <string>     // for std::string, std::to_string
+#include <utility>    // for std::move
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+FlowgraphConfigSnapshot::FlowgraphConfigSnapshot(const ConfigurationInterface* configuration,
+    int channels_count,
+    bool multiband)
+    : channel_satellite(channels_count > 0 ? channels_count : 0, 0U)
+{
+    for (int i = 0; i < channels_count; i++)
+        {
+            try
+                {
+                    channel_satellite[i] = configuration->property("Channel" + std::to_string(i) + ".satellite", 0U);
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << e.what();
+                }
+        }
+    channels_1C = configuration->property("Channels_1C.count", 0);
+    channels_2S = configuration->property("Channels_2S.count", 0);
+    channels_L5 = configuration->property("Channels_L5.count", 0);
+    channels_SBAS = configuration->property("Channels_SBAS.count", 0);
+    channels_1B = configuration->property("Channels_1B.count", 0);
+    channels_5X = configuration->property("Channels_5X.count", 0);
+    channels_7X = configuration->property("Channels_7X.count", 0);
+    channels_E6 = configuration->property("Channels_E6.count", 0);
+    channels_1G = configuration->property("Channels_1G.count", 0);
+    channels_2G = configuration->property("Channels_2G.count", 0);
+    channels_B1 = configuration->property("Channels_B1.count", 0);
+    channels_B3 = configuration->property("Channels_B3.count", 0);
+    assist_dual_frequency_acq = configuration->property("GNSS-SDR.assist_dual_frequency_acq", multiband);
+}
+
+
+uint32_t FlowgraphConfigSnapshot::satellite(unsigned int channel) const
+{
+    return channel < channel_satellite.size() ? channel_satellite[channel] : 0U;
+}
+
+
+FlowgraphConfigSnapshotHolder::FlowgraphConfigSnapshotHolder()
+    : current_(std::make_shared<const FlowgraphConfigSnapshot>())
+{
+}
+
+
+void FlowgraphConfigSnapshotHolder::publish(std::shared_ptr<const FlowgraphConfigSnapshot> snapshot)
+{
+    if (snapshot == nullptr)
+        {
+            return;
+        }
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    std::atomic_store(&current_, std::move(snapshot));
+}
+
+
+bool FlowgraphConfigSnapshotHolder::set_channel_satellite(unsigned int channel, uint32_t satellite)
+{
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    const std::shared_ptr<const FlowgraphConfigSnapshot> current = std::atomic_load(&current_);
+    if (channel >= current->channel_satellite.size())
+        {
+            return false;
+        }
+    auto snapshot = std::make_shared<FlowgraphConfigSnapshot>(*current);
+    snapshot->channel_satellite[channel] = satellite;
+    std::atomic_store(&current_, std::shared_ptr<const FlowgraphConfigSnapshot>(std::move(snapshot)));
+    return true;
+}
@@ -0,0 +1,116 @@
+/*!
+ * \file flowgraph_config_snapshot.h
+ * \brief Typed, immutable copy of the configuration parameters read by the
+ * flowgraph control plane at runtime
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FLOWGRAPH_CONFIG_SNAPSHOT_H
+#define GNSS_SDR_FLOWGRAPH_CONFIG_SNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Configuration parameters read by the acquisition manager and the
+ * channel event handlers, parsed once so that runtime code reads fields
+ * instead of looking up string keys.
+ */
+class FlowgraphConfigSnapshot
+{
+public:
+    FlowgraphConfigSnapshot() = default;
+
+    /*!
+     * \brief Reads the parameters from the configuration
+     * \param configuration - Receiver configuration
+     * \param channels_count - Number of channels of the receiver
+     * \param multiband - Default value of GNSS-SDR.assist_dual_frequency_acq
+     */
+    FlowgraphConfigSnapshot(const ConfigurationInterface* configuration,
+        int channels_count,
+        bool multiband);
+
+    /*!
+     * \brief Satellite assigned to a channel (ChannelN.satellite), 0 if the
+     * channel searches the available satellites.
+     */
+    uint32_t satellite(unsigned int channel) const;
+
+    std::vector<uint32_t> channel_satellite;  //!< ChannelN.satellite, indexed by channel
+    int32_t channels_1C{};                    //!< Channels_1C.count
+    int32_t channels_2S{};                    //!< Channels_2S.count
+    int32_t channels_L5{};                    //!< Channels_L5.count
+    int32_t channels_SBAS{};                  //!< Channels_SBAS.count
+    int32_t channels_1B{};                    //!< Channels_1B.count
+    int32_t channels_5X{};                    //!< Channels_5X.count
+    int32_t channels_7X{};                    //!< Channels_7X.count
+    int32_t channels_E6{};                    //!< Channels_E6.count
+    int32_t channels_1G{};                    //!< Channels_1G.count
+    int32_t channels_2G{};                    //!< Channels_2G.count
+    int32_t channels_B1{};                    //!< Channels_B1.count
+    int32_t channels_B3{};                    //!< Channels_B3.count
+    bool assist_dual_frequency_acq{};         //!< GNSS-SDR.assist_dual_frequency_acq
+};
+
+
+/*!
+ * \brief Holds the current FlowgraphConfigSnapshot.
+ *
+ * Readers get the current snapshot with a single atomic load of a shared
+ * pointer, without locks, and keep it alive for as long as they hold it.
+ * A new snapshot is published with an atomic store, and the replaced one is
+ * freed when its last reader releases it.
+ */
+class FlowgraphConfigSnapshotHolder
+{
+public:
+    FlowgraphConfigSnapshotHolder();
+
+    /*!
+     * \brief Returns the current snapshot. Never null.
+     */
+    inline std::shared_ptr<const FlowgraphConfigSnapshot> get() const
+    {
+        return std::atomic_load(&current_);
+    }
+
+    /*!
+     * \brief Publishes a new snapshot
+     */
+    void publish(std::shared_ptr<const FlowgraphConfigSnapshot> snapshot);
+
+    /*!
+     * \brief Publishes a copy of the current snapshot with a new satellite
+     * assigned to a channel. Returns false if the channel does not exist.
+     */
+    bool set_channel_satellite(unsigned int channel, uint32_t satellite);
+
+private:
+    std::shared_ptr<const FlowgraphConfigSnapshot> current_;
+    std::mutex publish_mutex_;  // serializes the copies of set_channel_satellite
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FLOWGRAPH_CONFIG_SNAPSHOT_H
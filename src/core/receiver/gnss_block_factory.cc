@@ -35,6 +35,7 @@
 #include "beidou_b3i_telemetry_decoder.h"
 #include "byte_to_short.h"
 #include "channel.h"
+#include "channelizer_signal_conditioner.h"
 #include "configuration_interface.h"
 #include "cshort_to_grcomplex.h"
 #include "direct_resampler_conditioner.h"
@@ -44,6 +45,7 @@
 #include "fir_filter.h"
 #include "four_bit_cpx_file_signal_source.h"
 #include "freq_xlating_fir_filter.h"
+#include "fused_signal_conditioner.h"
 #include "galileo_e1_dll_pll_veml_tracking.h"
 #include "galileo_e1_pcps_8ms_ambiguous_acquisition.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
@@ -73,6 +75,7 @@
 #include "gnss_block_interface.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_sdr_string_literals.h"
+#include "gnss_synchro_replay_signal_source.h"
 #include "gps_l1_ca_dll_pll_tracking.h"
 #include "gps_l1_ca_gaussian_tracking.h"
 #include "gps_l1_ca_kf_tracking.h"
@@ -103,6 +106,8 @@
 #include "notch_filter_lite.h"
 #include "nsr_file_signal_source.h"
 #include "pass_through.h"
+#include "pfb_channelizer_filter.h"
+#include "polyphase_resampler_conditioner.h"
 #include "pulse_blanking_filter.h"
 #include "rtklib_pvt.h"
 #include "rtl_tcp_signal_source.h"
@@ -318,6 +323,35 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetSignalConditioner(
             return conditioner_;
         }
 
+    if (signal_conditioner == "Channelizer_Signal_Conditioner")
+        {
+            // one wideband source split in several bands, one per output port
+            if (!resampler.empty() and (resampler != "Pass_Through"))
+                {
+                    LOG(WARNING) << "Configuration warning: " << role_conditioner << impl_prop << "=Channelizer_Signal_Conditioner "
+                                 << "does not use a resampler. " << role_resampler << " configuration parameters will be ignored.";
+                }
+            std::unique_ptr<GNSSBlockInterface> conditioner_ = std::make_unique<ChannelizerSignalConditioner>(
+                GetBlock(configuration, role_datatypeadapter, 1, 1),
+                GetBlock(configuration, role_inputfilter, 1, 1),
+                role_conditioner);
+            return conditioner_;
+        }
+
+    if (signal_conditioner == "Fused_Signal_Conditioner")
+        {
+            // data type adapter and input filter in a single block, configured
+            // with their options, and the resampler (if any) after it
+            std::shared_ptr<GNSSBlockInterface> resampler_block;
+            if (!resampler.empty() and (resampler != "Pass_Through"))
+                {
+                    resampler_block = GetBlock(configuration, role_resampler, 1, 1);
+                }
+            std::unique_ptr<GNSSBlockInterface> conditioner_ = std::make_unique<FusedSignalConditioner>(
+                configuration, std::move(resampler_block), role_conditioner, role_datatypeadapter, role_inputfilter);
+            return conditioner_;
+        }
+
     if (signal_conditioner != "Signal_Conditioner")
         {
             std::cerr << "Error in configuration file: SignalConditioner.implementation=" << signal_conditioner << " is not a valid value.\n";
@@ -705,6 +739,12 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams, queue);
                     block = std::move(block_);
                 }
+            else if (implementation == "Gnss_Synchro_Replay_Signal_Source")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<GnssSynchroReplaySignalSource>(configuration, role, in_streams,
+                        out_streams, queue);
+                    block = std::move(block_);
+                }
 #if RAW_UDP
             else if (implementation == "Custom_UDP_Signal_Source")
                 {
@@ -964,6 +1004,12 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams);
                     block = std::move(block_);
                 }
+            else if (implementation == "Pfb_Channelizer_Filter")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<PfbChannelizerFilter>(configuration, role, in_streams,
+                        out_streams);
+                    block = std::move(block_);
+                }
 
             // RESAMPLER ---------------------------------------------------------------
             else if (implementation == "Direct_Resampler")
@@ -980,6 +1026,13 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                     block = std::move(block_);
                 }
 
+            else if (implementation == "Polyphase_Resampler")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<PolyphaseResamplerConditioner>(configuration, role,
+                        in_streams, out_streams);
+                    block = std::move(block_);
+                }
+
             // ACQUISITION BLOCKS ------------------------------------------------------
             else if (implementation == "GPS_L1_CA_PCPS_Acquisition")
                 {
@@ -31,34 +31,44 @@
 #include "channel.h"
 #include "channel_fsm.h"
 #include "channel_interface.h"
+#include "channelizer_signal_conditioner.h"
 #include "configuration_interface.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
+#include "gnss_synchro_record.h"
+#include "gnss_synchro_recorder.h"
 #include "nav_message_monitor.h"
 #include "signal_source_interface.h"
-#include <boost/lexical_cast.hpp>    // for boost::lexical_cast
-#include <boost/tokenizer.hpp>       // for boost::tokenizer
-#include <gnuradio/basic_block.h>    // for basic_block
-#include <gnuradio/filter/firdes.h>  // for gr::filter::firdes
-#include <gnuradio/io_signature.h>   // for io_signature
-#include <gnuradio/top_block.h>      // for top_block, make_top_block
-#include <pmt/pmt_sugar.h>           // for mp
-#include <algorithm>                 // for transform, sort, unique
-#include <cmath>                     // for floor
-#include <cstddef>                   // for size_t
-#include <cstdlib>                   // for exit
-#include <exception>                 // for exception
-#include <iostream>                  // for operator<<
-#include <iterator>                  // for insert_iterator, inserter
-#include <memory>                    // for std::shared_ptr
-#include <set>                       // for set
-#include <sstream>                   // for std::stringstream
-#include <stdexcept>                 // for invalid_argument
-#include <thread>                    // for std::thread
-#include <utility>                   // for std::move
+#include <boost/lexical_cast.hpp>     // for boost::lexical_cast
+#include <boost/tokenizer.hpp>        // for boost::tokenizer
+#include <gnuradio/basic_block.h>     // for basic_block
+#include <gnuradio/block.h>           // for block
+#include <gnuradio/block_detail.h>    // for block_detail
+#include <gnuradio/buffer.h>          // for buffer
+#include <gnuradio/filter/firdes.h>   // for gr::filter::firdes
+#include <gnuradio/hier_block2.h>     // for hier_block2
+#include <gnuradio/high_res_timer.h>  // for high_res_timer_tps
+#include <gnuradio/io_signature.h>    // for io_signature
+#include <gnuradio/prefs.h>           // for prefs
+#include <gnuradio/top_block.h>       // for top_block, make_top_block
+#include <pmt/pmt_sugar.h>            // for mp
+#include <algorithm>                  // for transform, sort, unique
+#include <cmath>                      // for floor
+#include <cstddef>                    // for size_t
+#include <cstdint>                    // for uint32_t
+#include <cstdlib>                    // for exit
+#include <exception>                  // for exception
+#include <iostream>                   // for operator<<
+#include <iterator>                   // for insert_iterator, inserter
+#include <memory>                     // for std::shared_ptr
+#include <set>                        // for set
+#include <sstream>                    // for std::stringstream
+#include <stdexcept>                  // for invalid_argument
+#include <thread>                     // for std::thread
+#include <utility>                    // for std::move
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -72,17 +82,115 @@
 #include <gnuradio/filter/fir_filter_ccf.h>
 #endif
 
+#ifdef GR_GREATER_310
+#include <gnuradio/buffer_reader.h>
+#endif
+
 
 #define GNSS_SDR_ARRAY_SIGNAL_CONDITIONER_CHANNELS 8
 
 
+namespace
+{
+// Pins the threads of a block, or of all the blocks inside a hierarchical block
+void set_block_affinity(const gr::basic_block_sptr& basic_block, const std::vector<int>& mask)
+{
+    if (basic_block == nullptr || mask.empty())
+        {
+            return;
+        }
+#if GNURADIO_USES_STD_POINTERS
+    const auto block = std::dynamic_pointer_cast<gr::block>(basic_block);
+    const auto hier_block = std::dynamic_pointer_cast<gr::hier_block2>(basic_block);
+#else
+    const auto block = boost::dynamic_pointer_cast<gr::block>(basic_block);
+    const auto hier_block = boost::dynamic_pointer_cast<gr::hier_block2>(basic_block);
+#endif
+    if (block)
+        {
+            block->set_processor_affinity(mask);
+        }
+    else if (hier_block)
+        {
+            hier_block->set_processor_affinity(mask);
+        }
+}
+
+
+// Pins the threads of a block and of all the blocks upstream of it. The
+// links between blocks are only known once the flowgraph has started.
+void set_upstream_affinity(const gr::basic_block_sptr& basic_block, const std::vector<int>& mask)
+{
+    if (basic_block == nullptr || mask.empty())
+        {
+            return;
+        }
+    set_block_affinity(basic_block, mask);
+#if GNURADIO_USES_STD_POINTERS
+    const auto block = std::dynamic_pointer_cast<gr::block>(basic_block);
+#else
+    const auto block = boost::dynamic_pointer_cast<gr::block>(basic_block);
+#endif
+    if (!block || !block->detail())
+        {
+            return;
+        }
+    for (int port = 0; port < block->detail()->ninputs(); port++)
+        {
+            set_upstream_affinity(block->detail()->input(port)->buffer()->link(), mask);
+        }
+}
+
+
+// Moves the pages of the output buffers of a block to the NUMA node of
+// their readers. GNU Radio allocates the buffers when the flowgraph starts.
+// Returns false if some pages could not be moved.
+bool bind_output_buffers(const gr::basic_block_sptr& basic_block, int node)
+{
+    bool moved = true;
+    if (basic_block == nullptr || node < 0)
+        {
+            return moved;
+        }
+#if GNURADIO_USES_STD_POINTERS
+    const auto block = std::dynamic_pointer_cast<gr::block>(basic_block);
+#else
+    const auto block = boost::dynamic_pointer_cast<gr::block>(basic_block);
+#endif
+    if (!block || !block->detail())
+        {
+            return moved;
+        }
+    for (int port = 0; port < block->detail()->noutputs(); port++)
+        {
+            // The buffer is mapped twice in a row, so the whole buffer
+            // follows the write pointer wherever it is
+            const auto buffer = block->detail()->output(port);
+            const size_t length = static_cast<size_t>(buffer->bufsize()) * block->output_signature()->sizeof_stream_item(port);
+            if (!NumaTopology::bind_memory(buffer->write_pointer(), length, node))
+                {
+                    DLOG(INFO) << "Could not move the output buffer " << port << " of " << block->name() << " to NUMA node " << node;
+                    moved = false;
+                }
+        }
+    return moved;
+}
+}  // namespace
+
+
 GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configuration,
     std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue)  // NOLINT(performance-unnecessary-value-param)
     : configuration_(std::move(configuration)),
       queue_(std::move(queue)),
+      channel_affinity_balance_period_s_(0.0),
+      channel_affinity_balancing_(false),
+      observable_interval_ms_(20),
       connected_(false),
       running_(false),
       multiband_(GNSSFlowgraph::is_multiband()),
+      enable_gnss_synchro_recorder_(false),
+      gnss_synchro_recorder_at_tracking_(false),
+      gnss_synchro_replay_(false),
       enable_osnma_rx_(false),
       enable_e6_has_rx_(false)
 {
@@ -110,6 +218,16 @@ void GNSSFlowgraph::init()
 
     channels_status_ = channel_status_msg_receiver_make();
 
+    if (configuration_->property("GNSS-SDR.enable_acquisition_scheduler", false))
+        {
+            observable_interval_ms_ = configuration_->property("GNSS-SDR.observable_interval_ms", 20);
+            acq_scheduler_ = std::make_unique<AcquisitionScheduler>(
+                configuration_->property("GNSS-SDR.acquisition_scheduler_elevation_mask_deg", 0.0),
+                configuration_->property("GNSS-SDR.acquisition_scheduler_doppler_window_hz", static_cast<uint32_t>(500)),
+                configuration_->property("GNSS-SDR.acquisition_scheduler_update_period_s", 1.0),
+                configuration_->property("GNSS-SDR.pre_2009_file", false));
+        }
+
     if (configuration_->property("Channels_E6.count", 0) > 0)
         {
             enable_e6_has_rx_ = true;
@@ -175,7 +293,13 @@ void GNSSFlowgraph::init()
                     for (auto j = 0U; j < RF_Channels; ++j)
                         {
                             sig_conditioner_.push_back(block_factory->GetSignalConditioner(configuration_.get(), signal_conditioner_ID));
+                            sig_conditioner_source_.push_back(static_cast<size_t>(i));
                             signal_conditioner_ID++;
+                            if (src->implementation() == "Raw_Array_Signal_Source" or (sig_conditioner_.back() != nullptr && sig_conditioner_.back()->implementation() == "Array_Signal_Conditioner"))
+                                {
+                                    // All the RF channels of the source feed the elements of a single array signal conditioner
+                                    break;
+                                }
                         }
                 }
         }
@@ -183,11 +307,31 @@ void GNSSFlowgraph::init()
         {
             std::cout << "RF Channels: " << sources_count_ << '\n';
         }
-    if (!sig_conditioner_.empty())
+    // Each output port of a signal conditioner is one RF channel. A channelizer
+    // conditioner splits one wideband source in several bands, which take
+    // consecutive RF_channel_IDs.
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            int outputs = 1;
+            const auto channelizer = std::dynamic_pointer_cast<ChannelizerSignalConditioner>(sig_conditioner_[n]);
+            if (channelizer != nullptr)
+                {
+                    outputs = channelizer->outputs();
+                    std::cout << "Signal conditioner " << n << " provides " << outputs << " bands\n";
+                }
+            for (int port = 0; port < outputs; port++)
+                {
+                    rf_channel_outputs_.emplace_back(n, port);
+                }
+        }
+    if (!rf_channel_outputs_.empty())
         {
-            signal_conditioner_connected_ = std::vector<bool>(sig_conditioner_.size(), false);
+            signal_conditioner_connected_ = std::vector<bool>(rf_channel_outputs_.size(), false);
         }
 
+    // A Gnss_Synchro replay feeds the Observables block directly, bypassing the channels
+    gnss_synchro_replay_ = (sources_count_ == 1 && sig_source_.at(0)->implementation() == "Gnss_Synchro_Replay_Signal_Source");
+
     observables_ = block_factory->GetObservables(configuration_.get());
 
     pvt_ = block_factory->GetPVT(configuration_.get());
@@ -201,6 +345,9 @@ void GNSSFlowgraph::init()
             channels_.push_back(std::dynamic_pointer_cast<ChannelInterface>(chan_));
         }
 
+    // parameters read at runtime by the acquisition manager
+    config_snapshot_.publish(std::make_shared<const FlowgraphConfigSnapshot>(configuration_.get(), channels_count_, multiband_));
+
     top_block_ = gr::make_top_block("GNSSFlowgraph");
 
     mapStringValues_["1C"] = evGPS_1C;
@@ -247,7 +394,10 @@ void GNSSFlowgraph::init()
                 configuration_->property("Monitor.decimation_factor", 1),
                 udp_port_vec,
                 udp_addr_vec,
-                enable_protobuf);
+                enable_protobuf,
+                configuration_->property("Monitor.enable_batching", false),
+                configuration_->property("Monitor.mtu", 1500),
+                configuration_->property("Monitor.max_latency_ms", 20));
         }
 
     /*
@@ -276,7 +426,10 @@ void GNSSFlowgraph::init()
                 configuration_->property("AcquisitionMonitor.decimation_factor", 1),
                 udp_port_vec,
                 udp_addr_vec,
-                enable_protobuf);
+                enable_protobuf,
+                configuration_->property("AcquisitionMonitor.enable_batching", false),
+                configuration_->property("AcquisitionMonitor.mtu", 1500),
+                configuration_->property("AcquisitionMonitor.max_latency_ms", 20));
         }
 
     /*
@@ -305,7 +458,10 @@ void GNSSFlowgraph::init()
                 configuration_->property("TrackingMonitor.decimation_factor", 1),
                 udp_port_vec,
                 udp_addr_vec,
-                enable_protobuf);
+                enable_protobuf,
+                configuration_->property("TrackingMonitor.enable_batching", false),
+                configuration_->property("TrackingMonitor.mtu", 1500),
+                configuration_->property("TrackingMonitor.max_latency_ms", 20));
         }
 
     /*
@@ -321,6 +477,24 @@ void GNSSFlowgraph::init()
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
             NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
         }
+
+    /*
+     * Instantiate the Gnss_Synchro recorder block, if required
+     */
+    enable_gnss_synchro_recorder_ = configuration_->property("GnssSynchroRecorder.enable_recorder", false) && !gnss_synchro_replay_;
+    if (enable_gnss_synchro_recorder_)
+        {
+            const std::string tap = configuration_->property("GnssSynchroRecorder.tap", std::string("telemetry"));
+            gnss_synchro_recorder_at_tracking_ = (tap == "tracking");
+            if (!gnss_synchro_recorder_at_tracking_ && tap != "telemetry")
+                {
+                    LOG(WARNING) << "Unknown GnssSynchroRecorder.tap=" << tap << ", using telemetry";
+                }
+            // The telemetry tap records the Observables inputs, including the sample counter stream
+            GnssSynchroRecorder_ = gnss_synchro_make_recorder(gnss_synchro_recorder_at_tracking_ ? channels_count_ : channels_count_ + 1,
+                gnss_synchro_recorder_at_tracking_ ? Gnss_Synchro_Record_Tap::TRACKING : Gnss_Synchro_Record_Tap::TELEMETRY,
+                configuration_->property("GnssSynchroRecorder.filename", std::string("./gnss_synchro.dat")));
+        }
 }
 
 
@@ -332,6 +506,9 @@ void GNSSFlowgraph::start()
             return;
         }
 
+    init_cpu_placement();
+    init_channel_affinity();
+
     try
         {
             top_block_->start();
@@ -343,6 +520,9 @@ void GNSSFlowgraph::start()
             return;
         }
 
+    pin_signal_sources();
+    bind_buffers_to_consumer_nodes();
+
     if (enable_fpga_offloading_ == true)
         {
             // start the DMA if the receiver is in post-processing mode
@@ -455,6 +635,11 @@ void GNSSFlowgraph::disconnect()
 
 int GNSSFlowgraph::connect_desktop_flowgraph()
 {
+    if (gnss_synchro_replay_)
+        {
+            return connect_gnss_synchro_replay_flowgraph();
+        }
+
     // Connect blocks to the top_block
     const int max_channels_in_acq = configuration_->property("Channels.in_acquisition", 0);
     if (max_channels_in_acq > channels_count_)
@@ -528,6 +713,14 @@ int GNSSFlowgraph::connect_desktop_flowgraph()
             return 1;
         }
 
+    if (enable_gnss_synchro_recorder_)
+        {
+            if (connect_gnss_synchro_recorder() != 0)
+                {
+                    return 1;
+                }
+        }
+
     if (enable_e6_has_rx_)
         {
             if (connect_gal_e6_has() != 0)
@@ -827,6 +1020,324 @@ int GNSSFlowgraph::connect_channels()
 }
 
 
+void GNSSFlowgraph::init_channel_affinity()
+{
+    const int cores = configuration_->property("GNSS-SDR.channel_cores", 0);
+    if (cores <= 0 || enable_fpga_offloading_ || channels_count_ <= 0)
+        {
+            channel_affinity_.reset();
+            return;
+        }
+    const int first_cpu = configuration_->property("GNSS-SDR.channel_cores_first_cpu", 0);
+    channel_affinity_balance_period_s_ = configuration_->property("GNSS-SDR.channel_cores_balance_period_s", 0.0);
+    const int cpu_count = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    std::vector<int> cpus;
+    for (int core = 0; core < cores; core++)
+        {
+            cpus.push_back((first_cpu + core) % cpu_count);
+        }
+    channel_affinity_ = std::make_unique<ChannelAffinityBalancer>(cpus, static_cast<size_t>(channels_count_));
+    for (int i = 0; i < channels_count_; i++)
+        {
+            apply_channel_affinity(i);
+        }
+    LOG(INFO) << "Pinning " << channels_count_ << " channels to " << cores << " cores starting at CPU " << first_cpu;
+
+    // The balancing reads the busy time of the blocks from the performance
+    // counters of GNU Radio. They are off by default, and can only be switched
+    // on for all the blocks, so they are only enabled if the balancing is
+    // requested. This takes effect when the flowgraph starts, if GNU Radio was
+    // built with them.
+    channel_affinity_balancing_ = channel_affinity_balance_period_s_ > 0.0;
+    if (channel_affinity_balancing_)
+        {
+            gr::prefs::singleton()->set_bool("PerfCounters", "on", true);
+            // Sets the reference of the busy times
+            channel_affinity_->balance(get_channel_busy_times_s(), 1.0);
+            last_channel_affinity_balance_ = std::chrono::steady_clock::now();
+        }
+}
+
+
+void GNSSFlowgraph::apply_channel_affinity(int channel)
+{
+    // GNU Radio runs each block in its own thread, so all the threads of the
+    // channel are pinned to its core
+    const std::vector<int> mask{channel_affinity_->get_cpu(channel_affinity_->get_core(channel))};
+    if (static_cast<size_t>(channel) < channel_cpus_.size())
+        {
+            channel_cpus_[channel] = mask;
+        }
+    const auto& chan = channels_.at(channel);
+    for (const auto& basic_block : {chan->get_left_block_acq(), chan->get_right_block_acq(), chan->get_left_block_trk(), chan->get_right_block()})
+        {
+            set_block_affinity(basic_block, mask);
+        }
+}
+
+
+std::vector<double> GNSSFlowgraph::get_channel_busy_times_s() const
+{
+    // Requires the performance counters of GNU Radio. If they are not
+    // available, all the busy times are zero.
+    const double ticks_per_second = static_cast<double>(gr::high_res_timer_tps());
+    std::vector<double> busy_times_s(channels_.size(), 0.0);
+    for (size_t i = 0; i < channels_.size(); i++)
+        {
+            const auto& chan = channels_[i];
+            std::set<gr::basic_block_sptr> blocks{chan->get_left_block_acq(), chan->get_right_block_acq(), chan->get_left_block_trk(), chan->get_right_block()};
+            for (const auto& basic_block : blocks)
+                {
+#if GNURADIO_USES_STD_POINTERS
+                    const auto block = std::dynamic_pointer_cast<gr::block>(basic_block);
+#else
+                    const auto block = boost::dynamic_pointer_cast<gr::block>(basic_block);
+#endif
+                    if (block)
+                        {
+                            busy_times_s[i] += static_cast<double>(block->pc_work_time_total()) / ticks_per_second;
+                        }
+                }
+        }
+    return busy_times_s;
+}
+
+
+void GNSSFlowgraph::balance_channel_affinity()
+{
+    if (!channel_affinity_ || !running_ || !channel_affinity_balancing_)
+        {
+            return;
+        }
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed_s = std::chrono::duration<double>(now - last_channel_affinity_balance_).count();
+    if (elapsed_s < channel_affinity_balance_period_s_)
+        {
+            return;
+        }
+    last_channel_affinity_balance_ = now;
+
+    const std::vector<double> busy_times_s = get_channel_busy_times_s();
+    if (std::all_of(busy_times_s.cbegin(), busy_times_s.cend(), [](double busy_time_s) { return busy_time_s == 0.0; }))
+        {
+            // The blocks of the channels always do some work within a period
+            LOG(WARNING) << "The performance counters of GNU Radio are not available, so the channels stay on their initial cores. "
+                         << "Build GNU Radio with ENABLE_PERFORMANCE_COUNTERS=ON to balance their load";
+            channel_affinity_balancing_ = false;
+            return;
+        }
+    const std::vector<size_t> moved_channels = channel_affinity_->balance(busy_times_s, elapsed_s);
+    for (const auto channel : moved_channels)
+        {
+            apply_channel_affinity(static_cast<int>(channel));
+            DLOG(INFO) << "Channel " << channel << " moved to CPU " << channel_affinity_->get_cpu(channel_affinity_->get_core(channel));
+        }
+
+    std::stringstream utilization;
+    for (const auto core_utilization : channel_affinity_->get_utilization())
+        {
+            utilization << ' ' << core_utilization;
+        }
+    LOG(INFO) << "Channel core utilization:" << utilization.str();
+}
+
+
+std::vector<double> GNSSFlowgraph::get_channel_core_utilization() const
+{
+    if (!channel_affinity_)
+        {
+            return {};
+        }
+    return channel_affinity_->get_utilization();
+}
+
+
+void GNSSFlowgraph::init_cpu_placement()
+{
+    if (enable_fpga_offloading_ || gnss_synchro_replay_)
+        {
+            return;
+        }
+    const bool numa_auto_placement = configuration_->property("GNSS-SDR.numa_auto_placement", false);
+    numa_topology_ = std::make_unique<NumaTopology>(NumaTopology::from_sysfs());
+    const auto configured_cpus = [this](const std::string& role) {
+        return NumaTopology::parse_cpu_list(configuration_->property(role + ".cpus", std::string("")));
+    };
+
+    // The channels fed by a signal conditioner are grouped with it, and its
+    // signal source, on one node
+    std::vector<size_t> group_weights(sig_conditioner_.size(), 1);
+    for (const auto conditioner : channel_conditioner_)
+        {
+            if (conditioner < group_weights.size())
+                {
+                    group_weights[conditioner]++;
+                }
+        }
+    const std::vector<size_t> node_of_group = numa_topology_->assign_groups(group_weights);
+    const auto group_cpus = [&](size_t conditioner) {
+        if (!numa_auto_placement || conditioner >= node_of_group.size())
+            {
+                return std::vector<int>();
+            }
+        return numa_topology_->get_cpus(node_of_group[conditioner]);
+    };
+
+    sig_conditioner_cpus_ = std::vector<std::vector<int>>(sig_conditioner_.size());
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            if (sig_conditioner_[n] != nullptr)
+                {
+                    sig_conditioner_cpus_[n] = configured_cpus(sig_conditioner_[n]->role());
+                    if (sig_conditioner_cpus_[n].empty())
+                        {
+                            sig_conditioner_cpus_[n] = group_cpus(n);
+                        }
+                    set_block_affinity(sig_conditioner_[n]->get_left_block(), sig_conditioner_cpus_[n]);
+                    set_block_affinity(sig_conditioner_[n]->get_right_block(), sig_conditioner_cpus_[n]);
+                }
+        }
+
+    sig_source_cpus_ = std::vector<std::vector<int>>(sig_source_.size());
+    for (size_t i = 0; i < sig_source_.size(); i++)
+        {
+            if (sig_source_[i] != nullptr)
+                {
+                    sig_source_cpus_[i] = configured_cpus(sig_source_[i]->role());
+                    const auto first_conditioner = std::find(sig_conditioner_source_.cbegin(), sig_conditioner_source_.cend(), i);
+                    if (sig_source_cpus_[i].empty() && first_conditioner != sig_conditioner_source_.cend())
+                        {
+                            sig_source_cpus_[i] = group_cpus(static_cast<size_t>(std::distance(sig_conditioner_source_.cbegin(), first_conditioner)));
+                        }
+                    // The rest of the source is pinned once the flowgraph has started
+                    set_block_affinity(sig_source_[i]->get_right_block(), sig_source_cpus_[i]);
+                }
+        }
+
+    channel_cpus_ = std::vector<std::vector<int>>(channels_.size());
+    const std::vector<int> all_channels_cpus = configured_cpus("Channels");
+    for (size_t i = 0; i < channels_.size(); i++)
+        {
+            channel_cpus_[i] = configured_cpus("Channel" + std::to_string(i));
+            if (channel_cpus_[i].empty())
+                {
+                    channel_cpus_[i] = all_channels_cpus;
+                }
+            if (channel_cpus_[i].empty() && i < channel_conditioner_.size())
+                {
+                    channel_cpus_[i] = group_cpus(channel_conditioner_[i]);
+                }
+            const auto& chan = channels_[i];
+            for (const auto& basic_block : {chan->get_left_block_acq(), chan->get_right_block_acq(), chan->get_left_block_trk(), chan->get_right_block()})
+                {
+                    set_block_affinity(basic_block, channel_cpus_[i]);
+                }
+        }
+
+    // Observables and PVT read from all the channels, and go with the
+    // largest group
+    const auto largest_group = static_cast<size_t>(std::distance(group_weights.cbegin(), std::max_element(group_weights.cbegin(), group_weights.cend())));
+    if (observables_ != nullptr)
+        {
+            observables_cpus_ = configured_cpus(observables_->role());
+            if (observables_cpus_.empty())
+                {
+                    observables_cpus_ = group_cpus(largest_group);
+                }
+            set_block_affinity(observables_->get_left_block(), observables_cpus_);
+            set_block_affinity(observables_->get_right_block(), observables_cpus_);
+        }
+    if (pvt_ != nullptr)
+        {
+            pvt_cpus_ = configured_cpus(pvt_->role());
+            if (pvt_cpus_.empty())
+                {
+                    pvt_cpus_ = group_cpus(largest_group);
+                }
+            set_block_affinity(pvt_->get_left_block(), pvt_cpus_);
+        }
+
+    if (numa_auto_placement)
+        {
+            std::stringstream placement;
+            for (size_t n = 0; n < node_of_group.size(); n++)
+                {
+                    placement << " conditioner " << n << " (" << group_weights[n] - 1 << " channels) on node " << node_of_group[n] << ';';
+                }
+            LOG(INFO) << "NUMA placement over " << numa_topology_->get_number_of_nodes() << " nodes:" << placement.str();
+        }
+}
+
+
+void GNSSFlowgraph::pin_signal_sources() const
+{
+    for (size_t i = 0; i < sig_source_.size() && i < sig_source_cpus_.size(); i++)
+        {
+            const auto& src = sig_source_[i];
+            if (src != nullptr && !sig_source_cpus_[i].empty())
+                {
+                    set_upstream_affinity(src->get_right_block(), sig_source_cpus_[i]);
+                    for (size_t j = 1; j < src->getRfChannels(); j++)
+                        {
+                            set_upstream_affinity(src->get_right_block(static_cast<int>(j)), sig_source_cpus_[i]);
+                        }
+                }
+        }
+}
+
+
+void GNSSFlowgraph::bind_buffers_to_consumer_nodes() const
+{
+    if (!numa_topology_ || numa_topology_->get_number_of_nodes() < 2)
+        {
+            return;
+        }
+    bool moved = true;
+
+    // Source to signal conditioners
+    for (size_t n = 0; n < sig_conditioner_.size() && n < sig_conditioner_source_.size(); n++)
+        {
+            const auto& src = sig_source_.at(sig_conditioner_source_[n]);
+            if (src != nullptr && (n == 0 || sig_conditioner_source_[n - 1] != sig_conditioner_source_[n]))
+                {
+                    moved = bind_output_buffers(src->get_right_block(), numa_topology_->get_node(sig_conditioner_cpus_.at(n))) && moved;
+                }
+        }
+
+    // Signal conditioners to channels
+    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+        {
+            std::vector<int> readers_cpus;
+            for (size_t i = 0; i < channel_conditioner_.size() && i < channel_cpus_.size(); i++)
+                {
+                    if (channel_conditioner_[i] == n)
+                        {
+                            readers_cpus.insert(readers_cpus.end(), channel_cpus_[i].cbegin(), channel_cpus_[i].cend());
+                        }
+                }
+            if (sig_conditioner_[n] != nullptr)
+                {
+                    moved = bind_output_buffers(sig_conditioner_[n]->get_right_block(), numa_topology_->get_node(readers_cpus)) && moved;
+                }
+        }
+
+    // Channels to observables, and observables to PVT
+    const int observables_node = numa_topology_->get_node(observables_cpus_);
+    for (const auto& chan : channels_)
+        {
+            moved = bind_output_buffers(chan->get_right_block(), observables_node) && moved;
+        }
+    if (observables_ != nullptr)
+        {
+            moved = bind_output_buffers(observables_->get_right_block(), numa_topology_->get_node(pvt_cpus_)) && moved;
+        }
+    if (!moved)
+        {
+            LOG(WARNING) << "The stream buffers could not be moved to the NUMA nodes of their readers, which requires CAP_SYS_NICE. Only the pages faulted from now on follow their readers";
+        }
+}
+
+
 int GNSSFlowgraph::connect_observables()
 {
     if (observables_ == nullptr)
@@ -985,15 +1496,26 @@ int GNSSFlowgraph::connect_signal_sources_to_signal_conditioners()
 
                     // TODO: Remove this array implementation and create generic multistream connector
                     // (if a signal source has more than 1 stream, then connect it to the multistream signal conditioner)
-                    if (src->implementation() == "Raw_Array_Signal_Source")
+                    if (src->implementation() == "Raw_Array_Signal_Source" or sig_conditioner_.at(signal_conditioner_ID)->implementation() == "Array_Signal_Conditioner")
                         {
-                            // Multichannel Array
+                            // Multichannel Array: every RF channel of the source feeds one
+                            // element of the array signal conditioner
                             std::cout << "ARRAY MODE\n";
-                            for (int j = 0; j < GNSS_SDR_ARRAY_SIGNAL_CONDITIONER_CHANNELS; j++)
+                            const int array_channels = src->implementation() == "Raw_Array_Signal_Source" ? GNSS_SDR_ARRAY_SIGNAL_CONDITIONER_CHANNELS : static_cast<int>(src->getRfChannels());
+                            const bool single_output_block = src->get_right_block()->output_signature()->max_streams() > 1 or src->get_right_block()->output_signature()->max_streams() == -1;
+                            for (int j = 0; j < array_channels; j++)
                                 {
                                     std::cout << "connecting ch " << j << '\n';
-                                    top_block_->connect(src->get_right_block(), j, sig_conditioner_.at(i)->get_left_block(), j);
+                                    if (single_output_block)
+                                        {
+                                            top_block_->connect(src->get_right_block(), j, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), j);
+                                        }
+                                    else
+                                        {
+                                            top_block_->connect(src->get_right_block(j), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), j);
+                                        }
                                 }
+                            signal_conditioner_ID++;
                         }
                     else
                         {
@@ -1073,6 +1595,7 @@ int GNSSFlowgraph::connect_signal_sources_to_signal_conditioners()
 
 int GNSSFlowgraph::connect_signal_conditioners_to_channels()
 {
+    channel_conditioner_ = std::vector<size_t>(channels_count_, 0);
     for (int i = 0; i < channels_count_; i++)
         {
             int selected_signal_conditioner_ID = 0;
@@ -1090,6 +1613,11 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                 }
             try
                 {
+                    const auto& rf_channel_output = rf_channel_outputs_.at(selected_signal_conditioner_ID);
+                    channel_conditioner_[i] = rf_channel_output.first;
+                    const gr::basic_block_sptr sig_conditioner_block = sig_conditioner_.at(rf_channel_output.first)->get_right_block();
+                    const int sig_conditioner_port = rf_channel_output.second;
+
                     // Enable automatic resampler for the acquisition, if required
                     if (use_acq_resampler == true)
                         {
@@ -1159,7 +1687,7 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                             ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
                                             if (ret.second == true)
                                                 {
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                                    top_block_->connect(sig_conditioner_block, sig_conditioner_port,
                                                         acq_resamplers_.at(map_key), 0);
                                                     LOG(INFO) << "Created "
                                                               << channels_.at(i)->get_signal().get_signal_str()
@@ -1182,23 +1710,23 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
                                             // resampler not required!
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                            top_block_->connect(sig_conditioner_block, sig_conditioner_port,
                                                 channels_.at(i)->get_left_block_acq(), 0);
                                         }
                                 }
                             else
                                 {
                                     LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                    top_block_->connect(sig_conditioner_block, sig_conditioner_port,
                                         channels_.at(i)->get_left_block_acq(), 0);
                                 }
                         }
                     else
                         {
-                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                            top_block_->connect(sig_conditioner_block, sig_conditioner_port,
                                 channels_.at(i)->get_left_block_acq(), 0);
                         }
-                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    top_block_->connect(sig_conditioner_block, sig_conditioner_port,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -1244,6 +1772,11 @@ int GNSSFlowgraph::connect_observables_to_pvt()
             for (int i = 0; i < channels_count_; i++)
                 {
                     top_block_->connect(observables_->get_right_block(), i, pvt_->get_left_block(), i);
+                    if (gnss_synchro_replay_)
+                        {
+                            // Channels are not part of the flow graph
+                            continue;
+                        }
                     top_block_->msg_connect(channels_.at(i)->get_right_block(), pmt::mp("telemetry"), pvt_->get_left_block(), pmt::mp("telemetry"));
                     // experimental Vector Tracking Loop (VTL) messages from PVT to Tracking blocks
                     // not supported by all tracking algorithms
@@ -1253,7 +1786,7 @@ int GNSSFlowgraph::connect_observables_to_pvt()
                             // std::cout << "pmt: " << pmt::symbol_to_string(pmt::vector_ref(ports_in, n)) << "\n";
                             if (pmt::symbol_to_string(pmt::vector_ref(ports_in, n)) == "pvt_to_trk")
                                 {
-                                    top_block_->msg_connect(pvt_->get_left_block(), pmt::mp("pvt_to_trk"), channels_.at(i)->get_left_block_trk(), pmt::mp("pvt_to_trk"));
+                                    top_block_->msg_connect(pvt_->get_left_block(), pmt::mp("pvt_to_trk" + std::to_string(i)), channels_.at(i)->get_left_block_trk(), pmt::mp("pvt_to_trk"));
                                     LOG(INFO) << "pvt_to_trk message port connected in " << channels_.at(i)->implementation();
                                 }
                         }
@@ -1360,6 +1893,104 @@ int GNSSFlowgraph::connect_navdata_monitor()
 }
 
 
+int GNSSFlowgraph::connect_gnss_synchro_recorder()
+{
+    try
+        {
+            for (int i = 0; i < channels_count_; i++)
+                {
+                    if (gnss_synchro_recorder_at_tracking_)
+                        {
+                            top_block_->connect(channels_.at(i)->get_right_block_trk(), 0, GnssSynchroRecorder_, i);
+                        }
+                    else
+                        {
+                            top_block_->connect(channels_.at(i)->get_right_block(), 0, GnssSynchroRecorder_, i);
+                        }
+                }
+            if (!gnss_synchro_recorder_at_tracking_)
+                {
+                    top_block_->connect(ch_out_sample_counter_, 0, GnssSynchroRecorder_, channels_count_);
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Can't connect the Gnss_Synchro recorder: " << e.what();
+            top_block_->disconnect_all();
+            return 1;
+        }
+    DLOG(INFO) << "Gnss_Synchro recorder successfully connected";
+    return 0;
+}
+
+
+int GNSSFlowgraph::connect_gnss_synchro_replay_flowgraph()
+{
+    if (connect_signal_sources() != 0)
+        {
+            return 1;
+        }
+
+    if (connect_observables() != 0)
+        {
+            return 1;
+        }
+
+    if (connect_pvt() != 0)
+        {
+            return 1;
+        }
+
+    if (connect_gnss_synchro_replay_to_observables() != 0)
+        {
+            return 1;
+        }
+
+    if (connect_observables_to_pvt() != 0)
+        {
+            return 1;
+        }
+
+    if (connect_monitors() != 0)
+        {
+            return 1;
+        }
+
+    LOG(INFO) << "The GNU Radio flowgraph for the Gnss_Synchro replay has been successfully connected";
+    return 0;
+}
+
+
+int GNSSFlowgraph::connect_gnss_synchro_replay_to_observables()
+{
+    // One stream per channel plus the sample counter stream, in the Observables input order
+    const auto replay_block = sig_source_.at(0)->get_right_block();
+    const int n_streams = replay_block->output_signature()->max_streams();
+    if (n_streams != channels_count_ + 1)
+        {
+            help_hint_ += " * The Gnss_Synchro capture contains " + std::to_string(n_streams - 1) + " channels,\n";
+            help_hint_ += "   but the total number of channels is set to " + std::to_string(channels_count_) + ".\n";
+            help_hint_ += "   Please use the same channel configuration as in the recorded run.\n";
+            return 1;
+        }
+    try
+        {
+            for (int i = 0; i <= channels_count_; i++)
+                {
+                    top_block_->connect(replay_block, i, observables_->get_left_block(), i);
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Can't connect the Gnss_Synchro replay to Observables: " << e.what();
+            top_block_->disconnect_all();
+            return 1;
+        }
+    DLOG(INFO) << "Gnss_Synchro replay successfully connected to the Observables block";
+    return 0;
+}
+
+
 int GNSSFlowgraph::connect_monitors()
 {
     // GNSS SYNCHRO MONITOR
@@ -1371,6 +2002,15 @@ int GNSSFlowgraph::connect_monitors()
                 }
         }
 
+    if (gnss_synchro_replay_)
+        {
+            if (enable_acquisition_monitor_ || enable_tracking_monitor_ || enable_navdata_monitor_)
+                {
+                    LOG(WARNING) << "Acquisition, tracking and navigation data monitors are not available when replaying Gnss_Synchro captures";
+                }
+            return 0;
+        }
+
     // GNSS SYNCHRO ACQUISITION MONITOR
     if (enable_acquisition_monitor_)
         {
@@ -1477,14 +2117,14 @@ void GNSSFlowgraph::check_signal_conditioners()
 {
     // check for unconnected signal conditioners and connect null_sinks
     // in order to provide configuration flexibility to multiband files or signal sources
-    for (size_t n = 0; n < sig_conditioner_.size(); n++)
+    for (size_t n = 0; n < rf_channel_outputs_.size(); n++)
         {
             if (signal_conditioner_connected_.at(n) == false)
                 {
                     null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
-                    top_block_->connect(sig_conditioner_.at(n)->get_right_block(), 0,
+                    top_block_->connect(sig_conditioner_.at(rf_channel_outputs_[n].first)->get_right_block(), rf_channel_outputs_[n].second,
                         null_sinks_.back(), 0);
-                    LOG(INFO) << "Null sink connected to signal conditioner " << n << " due to lack of connection to any channel\n";
+                    LOG(INFO) << "Null sink connected to RF channel " << n << " due to lack of connection to any channel\n";
                 }
         }
 }
@@ -1516,96 +2156,97 @@ int GNSSFlowgraph::assign_channels()
                 }
         }
 
-    if (configuration_->property("Channels_1C.count", uint64_t(0ULL)) > available_GPS_1C_signals_.size() - 1)
+    if (configuration_->property("Channels_1C.count", uint64_t(0ULL)) > available_signals_[evGPS_1C].size() - 1)
         {
             help_hint_ += " * The number of GPS L1 channels is set to Channels_1C.count=" + std::to_string(configuration_->property("Channels_1C.count", 0));
-            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_GPS_1C_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_1C.count=" + std::to_string(available_GPS_1C_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_signals_[evGPS_1C].size()) + ".\n";
+            help_hint_ += " Please set Channels_1C.count=" + std::to_string(available_signals_[evGPS_1C].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_2S.count", uint64_t(0ULL)) > available_GPS_2S_signals_.size() - 1)
+    if (configuration_->property("Channels_2S.count", uint64_t(0ULL)) > available_signals_[evGPS_2S].size() - 1)
         {
             help_hint_ += " * The number of GPS L2 channels is set to Channels_2S.count=" + std::to_string(configuration_->property("Channels_2S.count", 0));
-            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_GPS_2S_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_2S.count=" + std::to_string(available_GPS_2S_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_signals_[evGPS_2S].size()) + ".\n";
+            help_hint_ += " Please set Channels_2S.count=" + std::to_string(available_signals_[evGPS_2S].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_L5.count", uint64_t(0ULL)) > available_GPS_L5_signals_.size() - 1)
+    if (configuration_->property("Channels_L5.count", uint64_t(0ULL)) > available_signals_[evGPS_L5].size() - 1)
         {
             help_hint_ += " * The number of GPS L5 channels is set to Channels_L5.count=" + std::to_string(configuration_->property("Channels_L5.count", 0));
-            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_GPS_L5_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_L5.count=" + std::to_string(available_GPS_L5_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available GPS satellites is " + std::to_string(available_signals_[evGPS_L5].size()) + ".\n";
+            help_hint_ += " Please set Channels_L5.count=" + std::to_string(available_signals_[evGPS_L5].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_1B.count", uint64_t(0ULL)) > available_GAL_1B_signals_.size() - 1)
+    if (configuration_->property("Channels_1B.count", uint64_t(0ULL)) > available_signals_[evGAL_1B].size() - 1)
         {
             help_hint_ += " * The number of Galileo E1 channels is set to Channels_1B.count=" + std::to_string(configuration_->property("Channels_1B.count", 0));
-            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_GAL_1B_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_1B.count=" + std::to_string(available_GAL_1B_signals_.size()) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_signals_[evGAL_1B].size()) + ".\n";
+            help_hint_ += " Please set Channels_1B.count=" + std::to_string(available_signals_[evGAL_1B].size()) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_5X.count", uint64_t(0ULL)) > available_GAL_5X_signals_.size() - 1)
+    if (configuration_->property("Channels_5X.count", uint64_t(0ULL)) > available_signals_[evGAL_5X].size() - 1)
         {
             help_hint_ += " * The number of Galileo E5a channels is set to Channels_5X.count=" + std::to_string(configuration_->property("Channels_5X.count", 0));
-            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_GAL_5X_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_5X.count=" + std::to_string(available_GAL_5X_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_signals_[evGAL_5X].size()) + ".\n";
+            help_hint_ += " Please set Channels_5X.count=" + std::to_string(available_signals_[evGAL_5X].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_7X.count", uint64_t(0ULL)) > available_GAL_7X_signals_.size() - 1)
+    if (configuration_->property("Channels_7X.count", uint64_t(0ULL)) > available_signals_[evGAL_7X].size() - 1)
         {
             help_hint_ += " * The number of Galileo E5b channels is set to Channels_7X.count=" + std::to_string(configuration_->property("Channels_7X.count", 0));
-            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_GAL_7X_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_7X.count=" + std::to_string(available_GAL_7X_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_signals_[evGAL_7X].size()) + ".\n";
+            help_hint_ += " Please set Channels_7X.count=" + std::to_string(available_signals_[evGAL_7X].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_E6.count", uint64_t(0ULL)) > available_GAL_E6_signals_.size() - 1)
+    if (configuration_->property("Channels_E6.count", uint64_t(0ULL)) > available_signals_[evGAL_E6].size() - 1)
         {
             help_hint_ += " * The number of Galileo E6 channels is set to Channels_7X.count=" + std::to_string(configuration_->property("Channels_E6.count", 0));
-            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_GAL_E6_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_E6.count=" + std::to_string(available_GAL_E6_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Galileo satellites is " + std::to_string(available_signals_[evGAL_E6].size()) + ".\n";
+            help_hint_ += " Please set Channels_E6.count=" + std::to_string(available_signals_[evGAL_E6].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_1G.count", uint64_t(0ULL)) > available_GLO_1G_signals_.size() + 7)  // satellites sharing same frequency number
+    if (configuration_->property("Channels_1G.count", uint64_t(0ULL)) > available_signals_[evGLO_1G].size() + 7)  // satellites sharing same frequency number
         {
             help_hint_ += " * The number of Glonass L1 channels is set to Channels_1G.count=" + std::to_string(configuration_->property("Channels_1G.count", 0));
-            help_hint_ += " but the maximum number of available Glonass satellites is " + std::to_string(available_GLO_1G_signals_.size() + 8) + ".\n";
-            help_hint_ += " Please set Channels_1G.count=" + std::to_string(available_GLO_1G_signals_.size() + 7) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Glonass satellites is " + std::to_string(available_signals_[evGLO_1G].size() + 8) + ".\n";
+            help_hint_ += " Please set Channels_1G.count=" + std::to_string(available_signals_[evGLO_1G].size() + 7) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_2G.count", uint64_t(0ULL)) > available_GLO_2G_signals_.size() + 7)  // satellites sharing same frequency number
+    if (configuration_->property("Channels_2G.count", uint64_t(0ULL)) > available_signals_[evGLO_2G].size() + 7)  // satellites sharing same frequency number
         {
             help_hint_ += " * The number of Glonass L2 channels is set to Channels_2G.count=" + std::to_string(configuration_->property("Channels_2G.count", 0));
-            help_hint_ += " but the maximum number of available Glonass satellites is " + std::to_string(available_GLO_2G_signals_.size() + 8) + ".\n";
-            help_hint_ += " Please set Channels_2G.count=" + std::to_string(available_GLO_2G_signals_.size() + 7) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available Glonass satellites is " + std::to_string(available_signals_[evGLO_2G].size() + 8) + ".\n";
+            help_hint_ += " Please set Channels_2G.count=" + std::to_string(available_signals_[evGLO_2G].size() + 7) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_B1.count", uint64_t(0ULL)) > available_BDS_B1_signals_.size() - 1)
+    if (configuration_->property("Channels_B1.count", uint64_t(0ULL)) > available_signals_[evBDS_B1].size() - 1)
         {
             help_hint_ += " * The number of BeiDou B1 channels is set to Channels_B1.count=" + std::to_string(configuration_->property("Channels_B1.count", 0));
-            help_hint_ += " but the maximum number of available BeiDou satellites is " + std::to_string(available_BDS_B1_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_B1.count=" + std::to_string(available_BDS_B1_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available BeiDou satellites is " + std::to_string(available_signals_[evBDS_B1].size()) + ".\n";
+            help_hint_ += " Please set Channels_B1.count=" + std::to_string(available_signals_[evBDS_B1].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
-    if (configuration_->property("Channels_B3.count", uint64_t(0ULL)) > available_BDS_B3_signals_.size() - 1)
+    if (configuration_->property("Channels_B3.count", uint64_t(0ULL)) > available_signals_[evBDS_B3].size() - 1)
         {
             help_hint_ += " * The number of BeiDou B3 channels is set to Channels_B3.count=" + std::to_string(configuration_->property("Channels_B3.count", 0));
-            help_hint_ += " but the maximum number of available BeiDou satellites is " + std::to_string(available_BDS_B3_signals_.size()) + ".\n";
-            help_hint_ += " Please set Channels_B3.count=" + std::to_string(available_BDS_B3_signals_.size() - 1) + " or lower in your configuration file.\n";
+            help_hint_ += " but the maximum number of available BeiDou satellites is " + std::to_string(available_signals_[evBDS_B3].size()) + ".\n";
+            help_hint_ += " Please set Channels_B3.count=" + std::to_string(available_signals_[evBDS_B3].size() - 1) + " or lower in your configuration file.\n";
             top_block_->disconnect_all();
             return 1;
         }
 
     // Assign satellites to channels in the initialization
+    channels_satellite_.assign(channels_count_, 0U);
     for (unsigned int& i : vector_of_channels)
         {
             const std::string gnss_signal_str = channels_.at(i)->get_signal().get_signal_str();  // use channel's implicit signal
@@ -1618,6 +2259,7 @@ int GNSSFlowgraph::assign_channels()
                 {
                     LOG(WARNING) << e.what();
                 }
+            channels_satellite_[i] = sat;
             if (sat == 0)
                 {
                     bool assistance_available;
@@ -1628,84 +2270,8 @@ int GNSSFlowgraph::assign_channels()
                 }
             else
                 {
-                    std::string gnss_system_str;
-                    Gnss_Signal gnss_signal;
-                    switch (mapStringValues_[gnss_signal_str])
-                        {
-                        case evGPS_1C:
-                            gnss_system_str = "GPS";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GPS_1C_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGPS_2S:
-                            gnss_system_str = "GPS";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GPS_2S_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGPS_L5:
-                            gnss_system_str = "GPS";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GPS_L5_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGAL_1B:
-                            gnss_system_str = "Galileo";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GAL_1B_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGAL_5X:
-                            gnss_system_str = "Galileo";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GAL_5X_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGAL_7X:
-                            gnss_system_str = "Galileo";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GAL_7X_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGAL_E6:
-                            gnss_system_str = "Galileo";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GAL_E6_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGLO_1G:
-                            gnss_system_str = "Glonass";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GLO_1G_signals_.remove(gnss_signal);
-                            break;
-
-                        case evGLO_2G:
-                            gnss_system_str = "Glonass";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GLO_2G_signals_.remove(gnss_signal);
-                            break;
-
-                        case evBDS_B1:
-                            gnss_system_str = "Beidou";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_BDS_B1_signals_.remove(gnss_signal);
-                            break;
-
-                        case evBDS_B3:
-                            gnss_system_str = "Beidou";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_BDS_B3_signals_.remove(gnss_signal);
-                            break;
-
-                        default:
-                            LOG(ERROR) << "This should not happen :-(";
-                            gnss_system_str = "GPS";
-                            gnss_signal = Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), gnss_signal_str);
-                            available_GPS_1C_signals_.remove(gnss_signal);
-                            break;
-                        }
-
+                    const Gnss_Signal gnss_signal = satellite_signal(gnss_signal_str, sat);
+                    remove_signal(gnss_signal);
                     channels_.at(i)->set_signal(gnss_signal);
                 }
         }
@@ -1753,122 +2319,85 @@ bool GNSSFlowgraph::send_telemetry_msg(const pmt::pmt_t& msg)
 
 void GNSSFlowgraph::push_back_signal(const Gnss_Signal& gs)
 {
-    switch (mapStringValues_[gs.get_signal_str()])
+    // a signal assigned to a channel by its satellite number is never
+    // available to the other channels
+    for (size_t ch = 0; ch < channels_satellite_.size(); ch++)
         {
-        case evGPS_1C:
-            available_GPS_1C_signals_.remove(gs);
-            available_GPS_1C_signals_.push_back(gs);
-            break;
-
-        case evGPS_2S:
-            available_GPS_2S_signals_.remove(gs);
-            available_GPS_2S_signals_.push_back(gs);
-            break;
-
-        case evGPS_L5:
-            available_GPS_L5_signals_.remove(gs);
-            available_GPS_L5_signals_.push_back(gs);
-            break;
-
-        case evGAL_1B:
-            available_GAL_1B_signals_.remove(gs);
-            available_GAL_1B_signals_.push_back(gs);
-            break;
-
-        case evGAL_5X:
-            available_GAL_5X_signals_.remove(gs);
-            available_GAL_5X_signals_.push_back(gs);
-            break;
-
-        case evGAL_7X:
-            available_GAL_7X_signals_.remove(gs);
-            available_GAL_7X_signals_.push_back(gs);
-            break;
-
-        case evGAL_E6:
-            available_GAL_E6_signals_.remove(gs);
-            available_GAL_E6_signals_.push_back(gs);
-            break;
-
-        case evGLO_1G:
-            available_GLO_1G_signals_.remove(gs);
-            available_GLO_1G_signals_.push_back(gs);
-            break;
-
-        case evGLO_2G:
-            available_GLO_2G_signals_.remove(gs);
-            available_GLO_2G_signals_.push_back(gs);
-            break;
-
-        case evBDS_B1:
-            available_BDS_B1_signals_.remove(gs);
-            available_BDS_B1_signals_.push_back(gs);
-            break;
-
-        case evBDS_B3:
-            available_BDS_B3_signals_.remove(gs);
-            available_BDS_B3_signals_.push_back(gs);
-            break;
-
-        default:
-            LOG(ERROR) << "This should not happen :-(";
-            break;
+            if (channels_satellite_[ch] != 0 && channels_[ch]->get_signal() == gs)
+                {
+                    return;
+                }
         }
+    available_signals_[mapStringValues_[gs.get_signal_str()]].push_back(gs);
 }
 
 
 void GNSSFlowgraph::remove_signal(const Gnss_Signal& gs)
 {
-    switch (mapStringValues_[gs.get_signal_str()])
+    available_signals_[mapStringValues_[gs.get_signal_str()]].remove(gs);
+}
+
+
+Gnss_Signal GNSSFlowgraph::satellite_signal(const std::string& signal_str, unsigned int sat)
+{
+    std::string gnss_system_str;
+    switch (mapStringValues_[signal_str])
         {
         case evGPS_1C:
-            available_GPS_1C_signals_.remove(gs);
-            break;
-
         case evGPS_2S:
-            available_GPS_2S_signals_.remove(gs);
-            break;
-
         case evGPS_L5:
-            available_GPS_L5_signals_.remove(gs);
+            gnss_system_str = "GPS";
             break;
 
         case evGAL_1B:
-            available_GAL_1B_signals_.remove(gs);
-            break;
-
         case evGAL_5X:
-            available_GAL_5X_signals_.remove(gs);
-            break;
-
         case evGAL_7X:
-            available_GAL_7X_signals_.remove(gs);
-            break;
-
         case evGAL_E6:
-            available_GAL_E6_signals_.remove(gs);
+            gnss_system_str = "Galileo";
             break;
 
         case evGLO_1G:
-            available_GLO_1G_signals_.remove(gs);
-            break;
-
         case evGLO_2G:
-            available_GLO_2G_signals_.remove(gs);
+            gnss_system_str = "Glonass";
             break;
 
         case evBDS_B1:
-            available_BDS_B1_signals_.remove(gs);
-            break;
-
         case evBDS_B3:
-            available_BDS_B3_signals_.remove(gs);
+            gnss_system_str = "Beidou";
             break;
 
         default:
             LOG(ERROR) << "This should not happen :-(";
+            gnss_system_str = "GPS";
             break;
         }
+    return Gnss_Signal(Gnss_Satellite(gnss_system_str, sat), signal_str);
+}
+
+
+void GNSSFlowgraph::retarget_channel(unsigned int channel, unsigned int sat)
+{
+    const Gnss_Signal current_signal = channels_[channel]->get_signal();
+    if (sat != 0)
+        {
+            const Gnss_Signal gnss_signal = satellite_signal(current_signal.get_signal_str(), sat);
+            const bool available = available_signals_[mapStringValues_[gnss_signal.get_signal_str()]].remove(gnss_signal);
+            if (!available && !(gnss_signal == current_signal))
+                {
+                    // tracked by another channel, or fixed to it: try again at the next acquisition
+                    DLOG(INFO) << "Channel " << channel << " cannot switch to " << gnss_signal << " yet: it is assigned to another channel";
+                    return;
+                }
+            channels_[channel]->set_signal(gnss_signal);
+        }
+    const unsigned int previous_sat = channels_satellite_[channel];
+    channels_satellite_[channel] = sat;
+    if (previous_sat != 0)
+        {
+            // the signal that was fixed to this channel is available again
+            push_back_signal(current_signal);
+        }
+    LOG(INFO) << "Channel " << channel << " switched from satellite " << previous_sat << " to satellite " << sat;
 }
 
 
@@ -1896,23 +2425,55 @@ double GNSSFlowgraph::project_doppler(const std::string& searched_signal, double
 }
 
 
+double GNSSFlowgraph::receiver_time_s() const
+{
+    // The sample counter produces one item per observable interval of
+    // processed samples, so this is the time of the receiver clock, not of
+    // the wall clock.
+    uint64_t intervals = 0;
+    if (ch_out_sample_counter_)
+        {
+            intervals = ch_out_sample_counter_->nitems_written(0);
+        }
+#if ENABLE_FPGA
+    else if (ch_out_fpga_sample_counter_)
+        {
+            intervals = ch_out_fpga_sample_counter_->nitems_written(0);
+        }
+#endif
+    return static_cast<double>(intervals) * static_cast<double>(observable_interval_ms_) / 1000.0;
+}
+
+
 void GNSSFlowgraph::acquisition_manager(unsigned int who)
 {
+    if (acq_scheduler_)
+        {
+            acq_scheduler_->set_receiver_time(receiver_time_s());
+            const Monitor_Pvt pvt_status = channels_status_->get_current_status_pvt();
+            const std::shared_ptr<PvtInterface> pvt_ptr = get_pvt();
+            if (pvt_ptr && acq_scheduler_->needs_update(pvt_status))
+                {
+                    acq_scheduler_->update(pvt_status,
+                        pvt_ptr->get_gps_ephemeris(),
+                        pvt_ptr->get_galileo_ephemeris(),
+                        pvt_ptr->get_gps_almanac(),
+                        pvt_ptr->get_galileo_almanac());
+                }
+        }
+    const std::shared_ptr<const FlowgraphConfigSnapshot> config = config_snapshot_.get();
     unsigned int current_channel;
     for (int i = 0; i < channels_count_; i++)
         {
             current_channel = (i + who + 1) % channels_count_;
-            unsigned int sat_ = 0;
-            try
-                {
-                    sat_ = configuration_->property("Channel" + std::to_string(current_channel) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
             if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[current_channel] == 0))
                 {
+                    if (config->satellite(current_channel) != channels_satellite_[current_channel])
+                        {
+                            // set_channel_satellite was called since the last acquisition
+                            retarget_channel(current_channel, config->satellite(current_channel));
+                        }
+                    const unsigned int sat_ = channels_satellite_[current_channel];
                     bool is_primary_freq = true;
                     bool assistance_available = false;
                     bool start_acquisition = false;
@@ -1927,8 +2488,23 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                                 assistance_available,
                                 estimated_doppler,
                                 RX_time);
+                            if (acq_scheduler_)
+                                {
+                                    // push back the satellites predicted below the elevation mask
+                                    const size_t max_skipped = acq_scheduler_->get_number_below_elevation_mask();
+                                    size_t skipped = 0;
+                                    while (!assistance_available && skipped < max_skipped && acq_scheduler_->is_below_elevation_mask(gnss_signal.get_satellite()))
+                                        {
+                                            gnss_signal = search_next_signal(channels_[current_channel]->get_signal().get_signal_str(),
+                                                is_primary_freq,
+                                                assistance_available,
+                                                estimated_doppler,
+                                                RX_time);
+                                            skipped++;
+                                        }
+                                }
                             channels_[current_channel]->set_signal(gnss_signal);
-                            start_acquisition = is_primary_freq or assistance_available or !configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_);
+                            start_acquisition = is_primary_freq or assistance_available or !config->assist_dual_frequency_acq;
                         }
                     else
                         {
@@ -1943,10 +2519,17 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                             DLOG(INFO) << "Channel " << current_channel
                                        << " Starting acquisition " << channels_[current_channel]->get_signal().get_satellite()
                                        << ", Signal " << channels_[current_channel]->get_signal().get_signal_str();
-                            if (assistance_available == true and configuration_->property("GNSS-SDR.assist_dual_frequency_acq", multiband_))
+                            double predicted_doppler;
+                            uint32_t doppler_window;
+                            if (assistance_available == true and config->assist_dual_frequency_acq)
                                 {
                                     channels_[current_channel]->assist_acquisition_doppler(project_doppler(channels_[current_channel]->get_signal().get_signal_str(), estimated_doppler));
                                 }
+                            else if (acq_scheduler_ && acq_scheduler_->get_doppler_window(channels_[current_channel]->get_signal(), predicted_doppler, doppler_window))
+                                {
+                                    // search only around the Doppler predicted from the orbits and the latest PVT fix
+                                    channels_[current_channel]->assist_acquisition_doppler(predicted_doppler, doppler_window);
+                                }
                             else
                                 {
                                     // set Doppler center to 0 Hz
@@ -2010,16 +2593,9 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
     DLOG(INFO) << "Received " << what << " from " << who;
     unsigned int sat = 0;
     Gnss_Signal gs;
-    if (who < 200)
+    if (who < channels_satellite_.size())
         {
-            try
-                {
-                    sat = configuration_->property("Channel" + std::to_string(who) + ".satellite", 0);
-                }
-            catch (const std::exception& e)
-                {
-                    LOG(WARNING) << e.what();
-                }
+            sat = channels_satellite_[who];
         }
     switch (what)
         {
@@ -2057,7 +2633,17 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
         case 2:
             gs = channels_[who]->get_signal();
             DLOG(INFO) << "Channel " << who << " TRK FAILED satellite " << gs.get_satellite();
-            if (acq_channels_count_ < max_acq_channels_)
+            if (config_snapshot_.get()->satellite(who) != sat)
+                {
+                    // the channel has been assigned another satellite: do not try to acquire this one again
+                    channels_state_[who] = 0;
+                    acquisition_manager(who);
+                    if (sat == 0)
+                        {
+                            push_back_signal(gs);
+                        }
+                }
+            else if (acq_channels_count_ < max_acq_channels_)
                 {
                     // try to acquire the same satellite
                     channels_state_[who] = 1;
@@ -2113,69 +2699,20 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
 
 void GNSSFlowgraph::priorize_satellites(const std::vector<std::pair<int, Gnss_Satellite>>& visible_satellites)
 {
-    size_t old_size;
-    Gnss_Signal gs;
     for (const auto& visible_satellite : visible_satellites)
         {
             if (visible_satellite.second.get_system() == "GPS")
                 {
-                    gs = Gnss_Signal(visible_satellite.second, "1C");
-                    old_size = available_GPS_1C_signals_.size();
-                    available_GPS_1C_signals_.remove(gs);
-                    if (old_size > available_GPS_1C_signals_.size())
-                        {
-                            available_GPS_1C_signals_.push_front(gs);
-                        }
-
-                    gs = Gnss_Signal(visible_satellite.second, "2S");
-                    old_size = available_GPS_2S_signals_.size();
-                    available_GPS_2S_signals_.remove(gs);
-                    if (old_size > available_GPS_2S_signals_.size())
-                        {
-                            available_GPS_2S_signals_.push_front(gs);
-                        }
-
-                    gs = Gnss_Signal(visible_satellite.second, "L5");
-                    old_size = available_GPS_L5_signals_.size();
-                    available_GPS_L5_signals_.remove(gs);
-                    if (old_size > available_GPS_L5_signals_.size())
-                        {
-                            available_GPS_L5_signals_.push_front(gs);
-                        }
+                    available_signals_[evGPS_1C].move_to_front(Gnss_Signal(visible_satellite.second, "1C"));
+                    available_signals_[evGPS_2S].move_to_front(Gnss_Signal(visible_satellite.second, "2S"));
+                    available_signals_[evGPS_L5].move_to_front(Gnss_Signal(visible_satellite.second, "L5"));
                 }
             else if (visible_satellite.second.get_system() == "Galileo")
                 {
-                    gs = Gnss_Signal(visible_satellite.second, "1B");
-                    old_size = available_GAL_1B_signals_.size();
-                    available_GAL_1B_signals_.remove(gs);
-                    if (old_size > available_GAL_1B_signals_.size())
-                        {
-                            available_GAL_1B_signals_.push_front(gs);
-                        }
-
-                    gs = Gnss_Signal(visible_satellite.second, "5X");
-                    old_size = available_GAL_5X_signals_.size();
-                    available_GAL_5X_signals_.remove(gs);
-                    if (old_size > available_GAL_5X_signals_.size())
-                        {
-                            available_GAL_5X_signals_.push_front(gs);
-                        }
-
-                    gs = Gnss_Signal(visible_satellite.second, "7X");
-                    old_size = available_GAL_7X_signals_.size();
-                    available_GAL_7X_signals_.remove(gs);
-                    if (old_size > available_GAL_7X_signals_.size())
-                        {
-                            available_GAL_7X_signals_.push_front(gs);
-                        }
-
-                    gs = Gnss_Signal(visible_satellite.second, "E6");
-                    old_size = available_GAL_E6_signals_.size();
-                    available_GAL_E6_signals_.remove(gs);
-                    if (old_size > available_GAL_E6_signals_.size())
-                        {
-                            available_GAL_E6_signals_.push_front(gs);
-                        }
+                    available_signals_[evGAL_1B].move_to_front(Gnss_Signal(visible_satellite.second, "1B"));
+                    available_signals_[evGAL_5X].move_to_front(Gnss_Signal(visible_satellite.second, "5X"));
+                    available_signals_[evGAL_7X].move_to_front(Gnss_Signal(visible_satellite.second, "7X"));
+                    available_signals_[evGAL_E6].move_to_front(Gnss_Signal(visible_satellite.second, "E6"));
                 }
         }
 }
@@ -2193,6 +2730,30 @@ void GNSSFlowgraph::set_configuration(const std::shared_ptr<ConfigurationInterfa
             LOG(WARNING) << "Unable to update configuration while flowgraph connected";
         }
     configuration_ = configuration;
+    config_snapshot_.publish(std::make_shared<const FlowgraphConfigSnapshot>(configuration_.get(), channels_count_, multiband_));
+}
+
+
+Gnss_Signal GNSSFlowgraph::get_channel_signal(unsigned int channel)
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex_);
+    if (channel >= channels_.size())
+        {
+            return Gnss_Signal();
+        }
+    return channels_[channel]->get_signal();
+}
+
+
+bool GNSSFlowgraph::set_channel_satellite(unsigned int channel, unsigned int satellite)
+{
+    if (!config_snapshot_.set_channel_satellite(channel, satellite))
+        {
+            LOG(WARNING) << "Unable to assign satellite " << satellite << " to non-existent channel " << channel;
+            return false;
+        }
+    LOG(INFO) << "Channel " << channel << " assigned to satellite " << satellite;
+    return true;
 }
 
 
@@ -2488,9 +3049,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_gps_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GPS_1C_signals_.emplace_back(
+                    available_signals_[evGPS_1C].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("GPS"), *available_gnss_prn_iter),
-                        std::string("1C"));
+                        std::string("1C")));
                 }
         }
 
@@ -2501,9 +3062,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_gps_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GPS_2S_signals_.emplace_back(
+                    available_signals_[evGPS_2S].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("GPS"), *available_gnss_prn_iter),
-                        std::string("2S"));
+                        std::string("2S")));
                 }
         }
 
@@ -2514,9 +3075,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_gps_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GPS_L5_signals_.emplace_back(
+                    available_signals_[evGPS_L5].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("GPS"), *available_gnss_prn_iter),
-                        std::string("L5"));
+                        std::string("L5")));
                 }
         }
 
@@ -2527,9 +3088,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_sbas_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_SBAS_1C_signals_.emplace_back(
+                    available_signals_[evSBAS_1C].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("SBAS"), *available_gnss_prn_iter),
-                        std::string("1C"));
+                        std::string("1C")));
                 }
         }
 
@@ -2540,9 +3101,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_galileo_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GAL_1B_signals_.emplace_back(
+                    available_signals_[evGAL_1B].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Galileo"), *available_gnss_prn_iter),
-                        std::string("1B"));
+                        std::string("1B")));
                 }
         }
 
@@ -2553,9 +3114,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_galileo_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GAL_5X_signals_.emplace_back(
+                    available_signals_[evGAL_5X].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Galileo"), *available_gnss_prn_iter),
-                        std::string("5X"));
+                        std::string("5X")));
                 }
         }
 
@@ -2566,9 +3127,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_galileo_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GAL_7X_signals_.emplace_back(
+                    available_signals_[evGAL_7X].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Galileo"), *available_gnss_prn_iter),
-                        std::string("7X"));
+                        std::string("7X")));
                 }
         }
 
@@ -2579,9 +3140,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_galileo_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GAL_E6_signals_.emplace_back(
+                    available_signals_[evGAL_E6].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Galileo"), *available_gnss_prn_iter),
-                        std::string("E6"));
+                        std::string("E6")));
                 }
         }
 
@@ -2592,9 +3153,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_glonass_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GLO_1G_signals_.emplace_back(
+                    available_signals_[evGLO_1G].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Glonass"), *available_gnss_prn_iter),
-                        std::string("1G"));
+                        std::string("1G")));
                 }
         }
 
@@ -2605,9 +3166,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_glonass_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_GLO_2G_signals_.emplace_back(
+                    available_signals_[evGLO_2G].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Glonass"), *available_gnss_prn_iter),
-                        std::string("2G"));
+                        std::string("2G")));
                 }
         }
 
@@ -2618,9 +3179,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_beidou_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_BDS_B1_signals_.emplace_back(
+                    available_signals_[evBDS_B1].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Beidou"), *available_gnss_prn_iter),
-                        std::string("B1"));
+                        std::string("B1")));
                 }
         }
 
@@ -2631,9 +3192,9 @@ void GNSSFlowgraph::set_signals_list()
                 available_gnss_prn_iter != available_beidou_prn.cend();
                 available_gnss_prn_iter++)
                 {
-                    available_BDS_B3_signals_.emplace_back(
+                    available_signals_[evBDS_B3].push_back(Gnss_Signal(
                         Gnss_Satellite(std::string("Beidou"), *available_gnss_prn_iter),
-                        std::string("B3"));
+                        std::string("B3")));
                 }
         }
 }
@@ -2719,6 +3280,7 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
     float& estimated_doppler,
     double& RX_time)
 {
+    const std::shared_ptr<const FlowgraphConfigSnapshot> config = config_snapshot_.get();
     is_primary_frequency = false;
     assistance_available = false;
     Gnss_Signal result{};
@@ -2727,242 +3289,166 @@ Gnss_Signal GNSSFlowgraph::search_next_signal(const std::string& searched_signal
         {
         case evGPS_1C:
             // todo: assist the satellite selection with almanac and current PVT here (reuse priorize_satellite function used in control_thread)
-            result = available_GPS_1C_signals_.front();
-            available_GPS_1C_signals_.pop_front();
-            available_GPS_1C_signals_.push_back(result);
+            available_signals_[evGPS_1C].next(result);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGPS_2S:
-            if (configuration_->property("Channels_1C.count", 0) > 0)
+            if (config->channels_1C > 0)
                 {
                     // 1. Get the current channel status map
                     std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
                     // 2. search the currently tracked GPS L1 satellites and assist the GPS L2 acquisition if the satellite is not tracked on L2
                     for (auto& current_status : current_channels_status)
                         {
-                            if (std::string(current_status.second->Signal) == "1C")
+                            // 3. return the GPS L2 satellite and remove it from the pool
+                            if (std::string(current_status.second->Signal) == "1C" and available_signals_[evGPS_2S].take(current_status.second->PRN, result))
                                 {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GPS_2S_signals_), std::end(available_GPS_2S_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GPS_2S_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // 3. return the GPS L2 satellite and remove it from list
-                                            result = *it2;
-                                            available_GPS_2S_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
+                                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                                    RX_time = current_status.second->RX_time;
+                                    found_signal = true;
+                                    assistance_available = true;
+                                    break;
                                 }
                         }
                 }
             // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L2
             if (found_signal == false)
                 {
-                    result = available_GPS_2S_signals_.front();
-                    available_GPS_2S_signals_.pop_front();
-                    available_GPS_2S_signals_.push_back(result);
+                    available_signals_[evGPS_2S].next(result);
                 }
             break;
 
         case evGPS_L5:
-            if (configuration_->property("Channels_1C.count", 0) > 0)
+            if (config->channels_1C > 0)
                 {
                     // 1. Get the current channel status map
                     std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
                     // 2. search the currently tracked GPS L1 satellites and assist the GPS L5 acquisition if the satellite is not tracked on L5
                     for (auto& current_status : current_channels_status)
                         {
-                            if (std::string(current_status.second->Signal) == "1C")
+                            // 3. return the GPS L5 satellite and remove it from the pool
+                            if (std::string(current_status.second->Signal) == "1C" and available_signals_[evGPS_L5].take(current_status.second->PRN, result))
                                 {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GPS_L5_signals_), std::end(available_GPS_L5_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GPS_L5_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the GPS L5 satellite and remove it from list
-                                            result = *it2;
-                                            available_GPS_L5_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
+                                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                                    RX_time = current_status.second->RX_time;
+                                    found_signal = true;
+                                    assistance_available = true;
+                                    break;
                                 }
                         }
                 }
             // fallback: pick the front satellite because there is no tracked satellites in L1 to assist L5
             if (found_signal == false)
                 {
-                    result = available_GPS_L5_signals_.front();
-                    available_GPS_L5_signals_.pop_front();
-                    available_GPS_L5_signals_.push_back(result);
+                    available_signals_[evGPS_L5].next(result);
                 }
             break;
 
         case evGAL_1B:
-            result = available_GAL_1B_signals_.front();
-            available_GAL_1B_signals_.pop_front();
-            available_GAL_1B_signals_.push_back(result);
+            available_signals_[evGAL_1B].next(result);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGAL_5X:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
+            if (config->channels_1B > 0)
                 {
                     // 1. Get the current channel status map
                     std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
                     // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
                     for (auto& current_status : current_channels_status)
                         {
-                            if (std::string(current_status.second->Signal) == "1B")
+                            // 3. return the Gal 5X satellite and remove it from the pool
+                            if (std::string(current_status.second->Signal) == "1B" and available_signals_[evGAL_5X].take(current_status.second->PRN, result))
                                 {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_5X_signals_), std::end(available_GAL_5X_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_5X_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal 5X satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_5X_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
+                                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                                    RX_time = current_status.second->RX_time;
+                                    found_signal = true;
+                                    assistance_available = true;
+                                    break;
                                 }
                         }
                 }
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
             if (found_signal == false)
                 {
-                    result = available_GAL_5X_signals_.front();
-                    available_GAL_5X_signals_.pop_front();
-                    available_GAL_5X_signals_.push_back(result);
+                    available_signals_[evGAL_5X].next(result);
                 }
             break;
 
         case evGAL_7X:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
+            if (config->channels_1B > 0)
                 {
                     // 1. Get the current channel status map
                     std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
                     // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
                     for (auto& current_status : current_channels_status)
                         {
-                            if (std::string(current_status.second->Signal) == "1B")
+                            // 3. return the Gal 7X satellite and remove it from the pool
+                            if (std::string(current_status.second->Signal) == "1B" and available_signals_[evGAL_7X].take(current_status.second->PRN, result))
                                 {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_7X_signals_), std::end(available_GAL_7X_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_7X_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal 7X satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_7X_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
+                                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                                    RX_time = current_status.second->RX_time;
+                                    found_signal = true;
+                                    assistance_available = true;
+                                    break;
                                 }
                         }
                 }
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E5
             if (found_signal == false)
                 {
-                    result = available_GAL_7X_signals_.front();
-                    available_GAL_7X_signals_.pop_front();
-                    available_GAL_7X_signals_.push_back(result);
+                    available_signals_[evGAL_7X].next(result);
                 }
             break;
 
         case evGAL_E6:
-            if (configuration_->property("Channels_1B.count", 0) > 0)
+            if (config->channels_1B > 0)
                 {
                     // 1. Get the current channel status map
                     std::map<int, std::shared_ptr<Gnss_Synchro>> current_channels_status = channels_status_->get_current_status_map();
                     // 2. search the currently tracked Galileo E1 satellites and assist the Galileo E5 acquisition if the satellite is not tracked on E5
                     for (auto& current_status : current_channels_status)
                         {
-                            if (std::string(current_status.second->Signal) == "1B")
+                            // 3. return the Gal E6 satellite and remove it from the pool
+                            if (std::string(current_status.second->Signal) == "1B" and available_signals_[evGAL_E6].take(current_status.second->PRN, result))
                                 {
-                                    std::list<Gnss_Signal>::iterator it2;
-                                    it2 = std::find_if(std::begin(available_GAL_E6_signals_), std::end(available_GAL_E6_signals_),
-                                        [&](Gnss_Signal const& sig) { return sig.get_satellite().get_PRN() == current_status.second->PRN; });
-
-                                    if (it2 != available_GAL_E6_signals_.end())
-                                        {
-                                            estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
-                                            RX_time = current_status.second->RX_time;
-                                            // std::cout << " Channel: " << it->first << " => Doppler: " << estimated_doppler << "[Hz] \n";
-                                            // 3. return the Gal E6 satellite and remove it from list
-                                            result = *it2;
-                                            available_GAL_E6_signals_.erase(it2);
-                                            found_signal = true;
-                                            assistance_available = true;
-                                            break;
-                                        }
+                                    estimated_doppler = static_cast<float>(current_status.second->Carrier_Doppler_hz);
+                                    RX_time = current_status.second->RX_time;
+                                    found_signal = true;
+                                    assistance_available = true;
+                                    break;
                                 }
                         }
                 }
             // fallback: pick the front satellite because there is no tracked satellites in E1 to assist E6
             if (found_signal == false)
                 {
-                    result = available_GAL_E6_signals_.front();
-                    available_GAL_E6_signals_.pop_front();
-                    available_GAL_E6_signals_.push_back(result);
+                    available_signals_[evGAL_E6].next(result);
                 }
             break;
 
         case evGLO_1G:
-            result = available_GLO_1G_signals_.front();
-            available_GLO_1G_signals_.pop_front();
-            available_GLO_1G_signals_.push_back(result);
+            available_signals_[evGLO_1G].next(result);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evGLO_2G:
-            result = available_GLO_2G_signals_.front();
-            available_GLO_2G_signals_.pop_front();
-            available_GLO_2G_signals_.push_back(result);
+            available_signals_[evGLO_2G].next(result);
             break;
 
         case evBDS_B1:
-            result = available_BDS_B1_signals_.front();
-            available_BDS_B1_signals_.pop_front();
-            available_BDS_B1_signals_.push_back(result);
+            available_signals_[evBDS_B1].next(result);
             is_primary_frequency = true;  // indicate that the searched satellite signal belongs to "primary" link (L1, E1, B1, etc..)
             break;
 
         case evBDS_B3:
-            result = available_BDS_B3_signals_.front();
-            available_BDS_B3_signals_.pop_front();
-            available_BDS_B3_signals_.push_back(result);
+            available_signals_[evBDS_B3].next(result);
             break;
 
         default:
             LOG(ERROR) << "This should not happen :-(";
-            if (!available_GPS_1C_signals_.empty())
-                {
-                    result = available_GPS_1C_signals_.front();
-                    available_GPS_1C_signals_.pop_front();
-                    available_GPS_1C_signals_.push_back(result);
-                }
+            available_signals_[evGPS_1C].next(result);
             break;
         }
     return result;
@@ -24,18 +24,24 @@
 #ifndef GNSS_SDR_GNSS_FLOWGRAPH_H
 #define GNSS_SDR_GNSS_FLOWGRAPH_H
 
+#include "acquisition_scheduler.h"
 #include "channel_status_msg_receiver.h"
+#include "channel_affinity_balancer.h"
 #include "concurrent_queue.h"
+#include "flowgraph_config_snapshot.h"
 #include "galileo_e6_has_msg_receiver.h"
 #include "galileo_tow_map.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_signal.h"
+#include "gnss_signal_pool.h"
+#include "numa_topology.h"
 #include "osnma_msg_receiver.h"
 #include "pvt_interface.h"
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
-#include <list>                         // for list
+#include <array>                        // for array
+#include <chrono>                       // for steady_clock
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
 #include <mutex>                        // for mutex
@@ -114,6 +120,20 @@ public:
      */
     void acquisition_manager(unsigned int who);
 
+    /*!
+     * \brief Moves channels from the most loaded channel cores to the least
+     * loaded ones, if GNSS-SDR.channel_cores and
+     * GNSS-SDR.channel_cores_balance_period_s are set. It does nothing until
+     * the balancing period has elapsed since the previous call.
+     */
+    void balance_channel_affinity();
+
+    /*!
+     * \brief Returns the fraction of time that the channels of each channel
+     * core have been busy during the last balancing period
+     */
+    std::vector<double> get_channel_core_utilization() const;
+
     /*!
      * \brief Applies an action to the flow graph
      *
@@ -127,6 +147,18 @@ public:
      */
     void set_configuration(const std::shared_ptr<ConfigurationInterface>& configuration);
 
+    /*!
+     * \brief Assigns a satellite to a channel (0: the channel searches the
+     * available satellites). It takes effect at the next acquisition of the
+     * channel. Returns false if the channel does not exist.
+     */
+    bool set_channel_satellite(unsigned int channel, unsigned int satellite);
+
+    /*!
+     * \brief Returns the signal currently assigned to a channel
+     */
+    Gnss_Signal get_channel_signal(unsigned int channel);
+
     bool connected() const
     {
         return connected_;
@@ -186,6 +218,9 @@ private:
     int connect_acquisition_monitor();
     int connect_tracking_monitor();
     int connect_navdata_monitor();
+    int connect_gnss_synchro_recorder();
+    int connect_gnss_synchro_replay_flowgraph();
+    int connect_gnss_synchro_replay_to_observables();
 
 #if ENABLE_FPGA
     int connect_fpga_flowgraph();
@@ -206,14 +241,27 @@ private:
 
     void push_back_signal(const Gnss_Signal& gs);
     void remove_signal(const Gnss_Signal& gs);
+    Gnss_Signal satellite_signal(const std::string& signal_str, unsigned int sat);
+    void retarget_channel(unsigned int channel, unsigned int sat);
     void print_help();
     void check_desktop_conf_in_fpga_env();
 
     double project_doppler(const std::string& searched_signal, double primary_freq_doppler_hz);
+    double receiver_time_s() const;
     bool is_multiband() const;
 
+    void init_channel_affinity();
+    void apply_channel_affinity(int channel);
+    std::vector<double> get_channel_busy_times_s() const;
+    void init_cpu_placement();
+    void pin_signal_sources() const;
+    void bind_buffers_to_consumer_nodes() const;
+
     std::vector<std::string> split_string(const std::string& s, char delim);
     std::vector<bool> signal_conditioner_connected_;
+    std::vector<std::pair<size_t, int>> rf_channel_outputs_;  // (signal conditioner, output port) for each RF_channel_ID
+    std::vector<size_t> sig_conditioner_source_;               // signal source of each signal conditioner
+    std::vector<size_t> channel_conditioner_;                  // signal conditioner of each channel
 
     gr::top_block_sptr top_block_;
 
@@ -233,10 +281,22 @@ private:
     gr::basic_block_sptr GnssSynchroAcquisitionMonitor_;
     gr::basic_block_sptr GnssSynchroTrackingMonitor_;
     gr::basic_block_sptr NavDataMonitor_;
+    gr::basic_block_sptr GnssSynchroRecorder_;
     channel_status_msg_receiver_sptr channels_status_;  // class that receives and stores the current status of the receiver channels
     galileo_e6_has_msg_receiver_sptr gal_e6_has_rx_;
     galileo_tow_map_sptr galileo_tow_map_;
     osnma_msg_receiver_sptr osnma_rx_;
+    std::unique_ptr<AcquisitionScheduler> acq_scheduler_;
+    std::unique_ptr<ChannelAffinityBalancer> channel_affinity_;
+    std::chrono::time_point<std::chrono::steady_clock> last_channel_affinity_balance_;
+    double channel_affinity_balance_period_s_;
+    bool channel_affinity_balancing_;  // false if not requested or if the busy times of the blocks are not available
+    std::unique_ptr<NumaTopology> numa_topology_;
+    std::vector<std::vector<int>> sig_source_cpus_;  // CPUs of each block, empty if not pinned
+    std::vector<std::vector<int>> sig_conditioner_cpus_;
+    std::vector<std::vector<int>> channel_cpus_;
+    std::vector<int> observables_cpus_;
+    std::vector<int> pvt_cpus_;
 
     gnss_sdr_sample_counter_sptr ch_out_sample_counter_;
 #if ENABLE_FPGA
@@ -244,19 +304,7 @@ private:
 #endif
 
     std::vector<unsigned int> channels_state_;
-
-    std::list<Gnss_Signal> available_GPS_1C_signals_;
-    std::list<Gnss_Signal> available_GPS_2S_signals_;
-    std::list<Gnss_Signal> available_GPS_L5_signals_;
-    std::list<Gnss_Signal> available_SBAS_1C_signals_;
-    std::list<Gnss_Signal> available_GAL_1B_signals_;
-    std::list<Gnss_Signal> available_GAL_5X_signals_;
-    std::list<Gnss_Signal> available_GAL_7X_signals_;
-    std::list<Gnss_Signal> available_GAL_E6_signals_;
-    std::list<Gnss_Signal> available_GLO_1G_signals_;
-    std::list<Gnss_Signal> available_GLO_2G_signals_;
-    std::list<Gnss_Signal> available_BDS_B1_signals_;
-    std::list<Gnss_Signal> available_BDS_B3_signals_;
+    std::vector<unsigned int> channels_satellite_;  // satellite fixed to each channel, 0 if it searches the available ones
 
     enum StringValue
     {
@@ -275,15 +323,20 @@ private:
     };
     std::map<std::string, StringValue> mapStringValues_;
 
+    // Signals not assigned to any channel, one search queue per signal type
+    std::array<GnssSignalPool, evBDS_B3 + 1> available_signals_;
+
     std::string config_file_;
     std::string help_hint_;
 
-    std::mutex signal_list_mutex_;
+    FlowgraphConfigSnapshotHolder config_snapshot_;
+    std::mutex signal_list_mutex_;  // guards the channel states
 
     int sources_count_;
     int channels_count_;
     int acq_channels_count_;
     int max_acq_channels_;
+    int observable_interval_ms_;
 
     bool connected_;
     bool running_;
@@ -292,6 +345,9 @@ private:
     bool enable_acquisition_monitor_;
     bool enable_tracking_monitor_;
     bool enable_navdata_monitor_;
+    bool enable_gnss_synchro_recorder_;
+    bool gnss_synchro_recorder_at_tracking_;
+    bool gnss_synchro_replay_;
     bool enable_fpga_offloading_;
     bool enable_osnma_rx_;
     bool enable_e6_has_rx_;
@@ -0,0 +1,206 @@
+/*!
+ * \file gnss_signal_pool.cc
+ * \brief Queue of the GNSS signals of one type available for acquisition,
+ * indexed by PRN.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_pool.h"
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+GnssSignalPool::GnssSignalPool()
+    : head_(NONE),
+      tail_(NONE),
+      size_(0)
+{
+    next_.fill(NONE);
+    prev_.fill(NONE);
+}
+
+
+void GnssSignalPool::push_back(const Gnss_Signal& gs)
+{
+    const uint32_t prn = gs.get_satellite().get_PRN();
+    if (prn >= MAX_PRN)
+        {
+            LOG(WARNING) << "Signal " << gs << " cannot be queued for acquisition";
+            return;
+        }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queued_[prn])
+        {
+            if (!(signals_[prn] == gs))
+                {
+                    return;  // the PRN is taken by a signal of another system
+                }
+            unlink(prn);
+        }
+    else
+        {
+            if (signals_.size() <= prn)
+                {
+                    signals_.resize(prn + 1);
+                }
+            signals_[prn] = gs;
+        }
+    link_back(prn);
+}
+
+
+bool GnssSignalPool::move_to_front(const Gnss_Signal& gs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_queued(gs))
+        {
+            return false;
+        }
+    const uint32_t prn = gs.get_satellite().get_PRN();
+    unlink(prn);
+    link_front(prn);
+    return true;
+}
+
+
+bool GnssSignalPool::remove(const Gnss_Signal& gs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_queued(gs))
+        {
+            return false;
+        }
+    unlink(gs.get_satellite().get_PRN());
+    return true;
+}
+
+
+bool GnssSignalPool::next(Gnss_Signal& gs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (head_ == NONE)
+        {
+            return false;
+        }
+    const auto prn = static_cast<uint32_t>(head_);
+    gs = signals_[prn];
+    unlink(prn);
+    link_back(prn);
+    return true;
+}
+
+
+bool GnssSignalPool::take(uint32_t prn, Gnss_Signal& gs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (prn >= MAX_PRN || !queued_[prn])
+        {
+            return false;
+        }
+    gs = signals_[prn];
+    unlink(prn);
+    return true;
+}
+
+
+bool GnssSignalPool::contains(uint32_t prn) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return prn < MAX_PRN && queued_[prn];
+}
+
+
+size_t GnssSignalPool::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+
+bool GnssSignalPool::empty() const
+{
+    return size() == 0;
+}
+
+
+bool GnssSignalPool::is_queued(const Gnss_Signal& gs) const
+{
+    const uint32_t prn = gs.get_satellite().get_PRN();
+    return prn < MAX_PRN && queued_[prn] && signals_[prn] == gs;
+}
+
+
+void GnssSignalPool::link_back(uint32_t prn)
+{
+    const auto node = static_cast<int16_t>(prn);
+    prev_[prn] = tail_;
+    next_[prn] = NONE;
+    if (tail_ == NONE)
+        {
+            head_ = node;
+        }
+    else
+        {
+            next_[tail_] = node;
+        }
+    tail_ = node;
+    queued_[prn] = true;
+    size_++;
+}
+
+
+void GnssSignalPool::link_front(uint32_t prn)
+{
+    const auto node = static_cast<int16_t>(prn);
+    prev_[prn] = NONE;
+    next_[prn] = head_;
+    if (head_ == NONE)
+        {
+            tail_ = node;
+        }
+    else
+        {
+            prev_[head_] = node;
+        }
+    head_ = node;
+    queued_[prn] = true;
+    size_++;
+}
+
+
+void GnssSignalPool::unlink(uint32_t prn)
+{
+    if (prev_[prn] == NONE)
+        {
+            head_ = next_[prn];
+        }
+    else
+        {
+            next_[prev_[prn]] = next_[prn];
+        }
+    if (next_[prn] == NONE)
+        {
+            tail_ = prev_[prn];
+        }
+    else
+        {
+            prev_[next_[prn]] = prev_[prn];
+        }
+    prev_[prn] = NONE;
+    next_[prn] = NONE;
+    queued_[prn] = false;
+    size_--;
+}
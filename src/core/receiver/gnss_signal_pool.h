@@ -0,0 +1,105 @@
+/*!
+ * \file gnss_signal_pool.h
+ * \brief Queue of the GNSS signals of one type available for acquisition,
+ * indexed by PRN.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SIGNAL_POOL_H
+#define GNSS_SDR_GNSS_SIGNAL_POOL_H
+
+#include "gnss_signal.h"
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief Search queue of the signals of one type (e.g., GPS L1 C/A) that are
+ * not assigned to any channel.
+ *
+ * The queue is a doubly linked list threaded through arrays indexed by PRN,
+ * with a bitmap of the PRNs in the queue, so that finding, removing, and
+ * moving a signal to the front or to the back of the queue take constant
+ * time. Each pool has its own lock, so operations on different signal types
+ * do not block each other.
+ */
+class GnssSignalPool
+{
+public:
+    GnssSignalPool();
+
+    /*!
+     * \brief Adds the signal at the back of the queue, or moves it there if
+     * it is already in the queue
+     */
+    void push_back(const Gnss_Signal& gs);
+
+    /*!
+     * \brief Moves the signal to the front of the queue. Returns false, and
+     * does nothing, if the signal is not in the queue.
+     */
+    bool move_to_front(const Gnss_Signal& gs);
+
+    /*!
+     * \brief Removes the signal from the queue. Returns false if the signal
+     * was not in the queue.
+     */
+    bool remove(const Gnss_Signal& gs);
+
+    /*!
+     * \brief Gets the signal at the front of the queue and moves it to the
+     * back. Returns false if the queue is empty.
+     */
+    bool next(Gnss_Signal& gs);
+
+    /*!
+     * \brief Gets and removes the signal of the given PRN. Returns false if
+     * it is not in the queue.
+     */
+    bool take(uint32_t prn, Gnss_Signal& gs);
+
+    bool contains(uint32_t prn) const;
+    size_t size() const;
+    bool empty() const;
+
+private:
+    static constexpr uint32_t MAX_PRN = 256;
+    static constexpr int16_t NONE = -1;
+
+    bool is_queued(const Gnss_Signal& gs) const;
+    void link_back(uint32_t prn);
+    void link_front(uint32_t prn);
+    void unlink(uint32_t prn);
+
+    std::vector<Gnss_Signal> signals_;  // indexed by PRN
+    std::array<int16_t, MAX_PRN> next_;
+    std::array<int16_t, MAX_PRN> prev_;
+    std::bitset<MAX_PRN> queued_;
+    mutable std::mutex mutex_;
+    int16_t head_;
+    int16_t tail_;
+    size_t size_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SIGNAL_POOL_H
@@ -0,0 +1,212 @@
+/*!
+ * \file numa_topology.cc
+ * \brief NUMA nodes of the host, and placement of the receiver blocks on them
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "numa_topology.h"
+#include <algorithm>  // for std::sort, std::stable_sort, std::min_element
+#include <cctype>     // for std::isspace
+#include <cstdint>    // for uintptr_t
+#include <exception>  // for std::exception
+#include <fstream>    // for std::ifstream
+#include <iterator>   // for std::distance
+#include <numeric>    // for std::iota
+#include <sstream>    // for std::stringstream
+#include <thread>     // for std::thread::hardware_concurrency
+#include <utility>    // for std::move
+#if defined(__linux__)
+#include <sys/syscall.h>  // for SYS_mbind
+#include <unistd.h>       // for syscall, sysconf
+#endif
+
+
+NumaTopology::NumaTopology(std::vector<std::vector<int>> node_cpus)
+    : node_cpus_(std::move(node_cpus))
+{
+    for (auto& cpus : node_cpus_)
+        {
+            std::sort(cpus.begin(), cpus.end());
+        }
+    if (std::all_of(node_cpus_.cbegin(), node_cpus_.cend(), [](const std::vector<int>& cpus) { return cpus.empty(); }))
+        {
+            node_cpus_.clear();
+            std::vector<int> cpus(std::max(static_cast<int>(std::thread::hardware_concurrency()), 1));
+            std::iota(cpus.begin(), cpus.end(), 0);
+            node_cpus_.push_back(std::move(cpus));
+        }
+}
+
+
+NumaTopology NumaTopology::from_sysfs(const std::string& sysfs_node_dir)
+{
+    // Node numbers may have gaps, so the first nodes are looked up until
+    // several consecutive ones are missing. Missing nodes are kept without
+    // CPUs, so that the index of a node is its number.
+    std::vector<std::vector<int>> node_cpus;
+    int missing = 0;
+    for (int node = 0; missing < 8; node++)
+        {
+            std::ifstream cpulist(sysfs_node_dir + "/node" + std::to_string(node) + "/cpulist");
+            std::string line;
+            if (!cpulist.is_open() || !std::getline(cpulist, line))
+                {
+                    missing++;
+                    continue;
+                }
+            node_cpus.resize(node);
+            missing = 0;
+            node_cpus.push_back(parse_cpu_list(line));
+        }
+    return NumaTopology(std::move(node_cpus));
+}
+
+
+std::vector<int> NumaTopology::parse_cpu_list(const std::string& cpu_list)
+{
+    std::vector<int> cpus;
+    std::stringstream list(cpu_list);
+    std::string range;
+    while (std::getline(list, range, ','))
+        {
+            range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }), range.end());
+            if (range.empty())
+                {
+                    continue;
+                }
+            try
+                {
+                    const size_t dash = range.find('-');
+                    size_t parsed = 0;
+                    const int first = std::stoi(range.substr(0, dash), &parsed);
+                    int last = first;
+                    if (dash != std::string::npos)
+                        {
+                            last = std::stoi(range.substr(dash + 1), &parsed);
+                            parsed += dash + 1;
+                        }
+                    if (parsed != range.size() || first < 0 || last < first)
+                        {
+                            return {};
+                        }
+                    for (int cpu = first; cpu <= last; cpu++)
+                        {
+                            cpus.push_back(cpu);
+                        }
+                }
+            catch (const std::exception&)
+                {
+                    return {};
+                }
+        }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+
+bool NumaTopology::bind_memory(void* address, size_t length, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (address == nullptr || length == 0 || node < 0)
+        {
+            return false;
+        }
+    // Values from linux/mempolicy.h
+    constexpr int mpol_preferred = 1;
+    constexpr unsigned int mpol_mf_move = 1U << 1U;
+    constexpr unsigned int mpol_mf_move_all = 1U << 2U;
+    constexpr size_t bits_per_word = 8 * sizeof(unsigned long);
+
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto first_byte = reinterpret_cast<uintptr_t>(address);
+    const uintptr_t first_page = first_byte & ~(page_size - 1);
+    std::vector<unsigned long> nodemask(static_cast<size_t>(node) / bits_per_word + 1, 0);
+    nodemask[static_cast<size_t>(node) / bits_per_word] |= 1UL << (static_cast<size_t>(node) % bits_per_word);
+    const auto mbind = [&](unsigned int flags) {
+        return syscall(SYS_mbind, first_page, length + (first_byte - first_page), mpol_preferred,
+                   nodemask.data(), nodemask.size() * bits_per_word + 1, flags) == 0;
+    };
+    // The stream buffers of GNU Radio map each page twice, and MPOL_MF_MOVE
+    // skips the pages mapped more than once. Without CAP_SYS_NICE, only the
+    // pages faulted from now on follow the policy.
+    if (mbind(mpol_mf_move_all))
+        {
+            return true;
+        }
+    mbind(mpol_mf_move);
+    return false;
+#else
+    (void)address;
+    (void)length;
+    (void)node;
+    return false;
+#endif
+}
+
+
+size_t NumaTopology::get_number_of_nodes() const
+{
+    return node_cpus_.size();
+}
+
+
+const std::vector<int>& NumaTopology::get_cpus(size_t node) const
+{
+    return node_cpus_.at(node);
+}
+
+
+int NumaTopology::get_node(const std::vector<int>& cpus) const
+{
+    int best_node = -1;
+    size_t best_count = 0;
+    for (size_t node = 0; node < node_cpus_.size(); node++)
+        {
+            const auto count = static_cast<size_t>(std::count_if(cpus.cbegin(), cpus.cend(), [&](int cpu) {
+                return std::binary_search(node_cpus_[node].cbegin(), node_cpus_[node].cend(), cpu);
+            }));
+            if (count > best_count)
+                {
+                    best_count = count;
+                    best_node = static_cast<int>(node);
+                }
+        }
+    return best_node;
+}
+
+
+std::vector<size_t> NumaTopology::assign_groups(const std::vector<size_t>& group_weights) const
+{
+    std::vector<size_t> order(group_weights.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return group_weights[a] > group_weights[b]; });
+
+    // Nodes without CPUs (memory only) do not take groups
+    std::vector<size_t> nodes;
+    for (size_t node = 0; node < node_cpus_.size(); node++)
+        {
+            if (!node_cpus_[node].empty())
+                {
+                    nodes.push_back(node);
+                }
+        }
+    std::vector<size_t> node_load(nodes.size(), 0);
+    std::vector<size_t> node_of_group(group_weights.size(), 0);
+    for (const auto group : order)
+        {
+            const auto index = static_cast<size_t>(std::distance(node_load.begin(), std::min_element(node_load.begin(), node_load.end())));
+            node_of_group[group] = nodes[index];
+            node_load[index] += group_weights[group];
+        }
+    return node_of_group;
+}
@@ -0,0 +1,89 @@
+/*!
+ * \file numa_topology.h
+ * \brief NUMA nodes of the host, and placement of the receiver blocks on them
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NUMA_TOPOLOGY_H
+#define GNSS_SDR_NUMA_TOPOLOGY_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+/*!
+ * \brief CPUs of each NUMA node of the host.
+ *
+ * The nodes are read from sysfs, and the index of a node is its number. On
+ * hosts without NUMA information, there is a single node with all the CPUs.
+ */
+class NumaTopology
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param node_cpus - CPUs of each node, empty for nodes without CPUs
+     */
+    explicit NumaTopology(std::vector<std::vector<int>> node_cpus);
+
+    /*!
+     * \brief Reads the nodes of the host from the node* directories of
+     * sysfs_node_dir
+     */
+    static NumaTopology from_sysfs(const std::string& sysfs_node_dir = "/sys/devices/system/node");
+
+    /*!
+     * \brief Parses a list of CPUs such as "0-3,8,10-11". Returns an empty
+     * list if the string is empty or malformed.
+     */
+    static std::vector<int> parse_cpu_list(const std::string& cpu_list);
+
+    /*!
+     * \brief Sets the preferred node of the pages of a memory region, and
+     * moves the pages already in use. Moving pages shared with another
+     * mapping, as those of the GNU Radio stream buffers, requires
+     * CAP_SYS_NICE. Returns false if the pages could not be moved.
+     */
+    static bool bind_memory(void* address, size_t length, int node);
+
+    size_t get_number_of_nodes() const;
+
+    const std::vector<int>& get_cpus(size_t node) const;
+
+    /*!
+     * \brief Returns the node holding most of the CPUs, or -1 if none of them
+     * is known
+     */
+    int get_node(const std::vector<int>& cpus) const;
+
+    /*!
+     * \brief Assigns groups of blocks to the nodes, heaviest first on the
+     * least loaded node, so that the blocks of a group share a node
+     * \param group_weights - Weight of each group, e.g. its number of channels
+     * \return node of each group
+     */
+    std::vector<size_t> assign_groups(const std::vector<size_t>& group_weights) const;
+
+private:
+    std::vector<std::vector<int>> node_cpus_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NUMA_TOPOLOGY_H
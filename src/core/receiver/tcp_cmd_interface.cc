@@ -35,6 +35,8 @@ TcpCmdInterface::TcpCmdInterface()
     : rx_latitude_(0.0),
       rx_longitude_(0.0),
       rx_altitude_(0.0),
+      ch_channel_(0),
+      ch_satellite_(0),
       receiver_utc_time_(0),
       keep_running_(true)
 {
@@ -83,6 +85,12 @@ std::array<float, 3> TcpCmdInterface::get_LLH() const
 }
 
 
+std::pair<uint32_t, uint32_t> TcpCmdInterface::get_channel_satellite() const
+{
+    return std::pair<uint32_t, uint32_t>{ch_channel_, ch_satellite_};
+}
+
+
 std::string TcpCmdInterface::reset(const std::vector<std::string> &commandLine __attribute__((unused)))
 {
     std::string response;
@@ -281,11 +289,35 @@ std::string TcpCmdInterface::coldstart(const std::vector<std::string> &commandLi
 }
 
 
-std::string TcpCmdInterface::set_ch_satellite(const std::vector<std::string> &commandLine __attribute__((unused)))
+std::string TcpCmdInterface::set_ch_satellite(const std::vector<std::string> &commandLine)
 {
     std::string response;
-    // todo: implement the set satellite command
-    response = "Not implemented\n";
+    if (commandLine.size() > 2)
+        {
+            const int channel = std::stoi(commandLine.at(1));
+            const int satellite = std::stoi(commandLine.at(2));
+            if (channel < 0 || satellite < 0)
+                {
+                    response = "ERROR: channel or satellite malformed\n";
+                    return response;
+                }
+            ch_channel_ = static_cast<uint32_t>(channel);
+            ch_satellite_ = static_cast<uint32_t>(satellite);
+            if (control_queue_ != nullptr)
+                {
+                    const command_event_sptr new_evnt = command_event_make(300, 14);  // send the set satellite message (who=300,what=14)
+                    control_queue_->push(pmt::make_any(new_evnt));
+                    response = "OK\n";
+                }
+            else
+                {
+                    response = "ERROR\n";
+                }
+        }
+    else
+        {
+            response = "ERROR: parameters not found, please use set_ch_satellite channel satellite (satellite 0: any)\n";
+        }
     return response;
 }
 
@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /** \addtogroup Core
@@ -56,6 +57,11 @@ public:
      */
     std::array<float, 3> get_LLH() const;
 
+    /*!
+     * \brief gets the channel and the satellite PRN from the last set_ch_satellite command issued
+     */
+    std::pair<uint32_t, uint32_t> get_channel_satellite() const;
+
     void set_pvt(std::shared_ptr<PvtInterface> PVT_sptr);
 
 private:
@@ -78,6 +84,9 @@ private:
     float rx_longitude_;
     float rx_altitude_;
 
+    uint32_t ch_channel_;
+    uint32_t ch_satellite_;
+
     time_t receiver_utc_time_;
 
     bool keep_running_;
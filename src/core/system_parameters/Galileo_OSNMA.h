@@ -31,6 +31,7 @@
  * \{ */
 
 constexpr size_t SIZE_DSM_BLOCKS_BYTES = 13;
+constexpr uint32_t OSNMA_TESLA_CHECKPOINT_INTERVAL = 120;  // subframes between stored TESLA keys (1 hour)
 
 // OSNMA User ICD, Issue 1.1, Table 1
 const std::unordered_map<uint8_t, std::string> OSNMA_TABLE_1 = {
@@ -162,6 +163,7 @@ const std::string PEMFILE_DEFAULT("./OSNMA_PublicKey.pem");
 const std::string CRTFILE_DEFAULT("./OSNMA_PublicKey_20240115100000_newPKID_1.crt");
 const std::string MERKLEFILE_DEFAULT("./OSNMA_MerkleTree_20240115100000_newPKID_1.xml");
 const std::string KROOTFILE_DEFAULT("./OSNMA_DSM_KROOT_NMAHeader.bin");
+const std::string TESLAFILE_DEFAULT("./OSNMA_TESLA_Checkpoints.bin");
 
 class Mack_lookup
 {
@@ -21,6 +21,7 @@
 #define GNSS_SDR_GNSS_SYNCHRO_H
 
 #include <boost/serialization/nvp.hpp>
+#include <boost/serialization/version.hpp>
 #include <cstdint>
 #include <utility>
 
@@ -79,6 +80,7 @@ public:
     bool Flag_valid_word{};                //!< Set by Telemetry Decoder processing block
     bool Flag_valid_pseudorange{};         //!< Set by Observables processing block
     bool Flag_PLL_180_deg_phase_locked{};  //!< Set by Telemetry Decoder processing block
+    bool Flag_refined_acquisition{};       //!< Set by Acquisition processing block
 
     /// Copy constructor
     Gnss_Synchro(const Gnss_Synchro& other) noexcept = default;
@@ -117,6 +119,7 @@ public:
                 this->Flag_valid_word = rhs.Flag_valid_word;
                 this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
                 this->Flag_PLL_180_deg_phase_locked = rhs.Flag_PLL_180_deg_phase_locked;
+                this->Flag_refined_acquisition = rhs.Flag_refined_acquisition;
             }
         return *this;
     };
@@ -157,6 +160,7 @@ public:
                 this->Flag_valid_word = other.Flag_valid_word;
                 this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
                 this->Flag_PLL_180_deg_phase_locked = other.Flag_PLL_180_deg_phase_locked;
+                this->Flag_refined_acquisition = other.Flag_refined_acquisition;
 
                 // Leave the source object in a valid but unspecified state
                 other.Signal[0] = '\0';
@@ -187,6 +191,7 @@ public:
                 other.Flag_valid_word = false;
                 other.Flag_valid_pseudorange = false;
                 other.Flag_PLL_180_deg_phase_locked = false;
+                other.Flag_refined_acquisition = false;
             }
         return *this;
     };
@@ -199,9 +204,6 @@ public:
 
     void serialize(Archive& ar, const unsigned int version)
     {
-        if (version)
-            {
-            };
         // Satellite and signal info
         ar& BOOST_SERIALIZATION_NVP(System);
         ar& BOOST_SERIALIZATION_NVP(Signal);
@@ -234,9 +236,16 @@ public:
         ar& BOOST_SERIALIZATION_NVP(Flag_valid_word);
         ar& BOOST_SERIALIZATION_NVP(Flag_valid_pseudorange);
         ar& BOOST_SERIALIZATION_NVP(Flag_PLL_180_deg_phase_locked);
+        // Added in version 1, archives of version 0 keep the default value
+        if (version >= 1)
+            {
+                ar& BOOST_SERIALIZATION_NVP(Flag_refined_acquisition);
+            }
     }
 };
 
+BOOST_CLASS_VERSION(Gnss_Synchro, 1)
+
 
 /** \} */
 /** \} */
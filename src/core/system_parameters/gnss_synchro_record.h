@@ -0,0 +1,217 @@
+/*!
+ * \file gnss_synchro_record.h
+ * \brief Fixed-layout binary representation of Gnss_Synchro objects, used
+ * to capture and replay the receiver internal data streams
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_RECORD_H
+#define GNSS_SDR_GNSS_SYNCHRO_RECORD_H
+
+#include "gnss_synchro.h"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Point of the flow graph where a Gnss_Synchro capture was taken.
+ * Values are part of the file format and must not be reordered.
+ */
+enum class Gnss_Synchro_Record_Tap : uint32_t
+{
+    TRACKING = 0,   //!< Outputs of the tracking blocks, one stream per channel
+    TELEMETRY = 1,  //!< Inputs of the Observables block: one stream per channel plus the sample counter stream
+};
+
+
+constexpr std::array<char, 16> GNSS_SYNCHRO_RECORD_MAGIC{{'G', 'N', 'S', 'S', '-', 'S', 'D', 'R', ' ', 'S', 'Y', 'N', 'C', 'H', 'R', 'O'}};
+constexpr uint32_t GNSS_SYNCHRO_RECORD_VERSION = 1;
+constexpr uint32_t GNSS_SYNCHRO_RECORD_BYTE_ORDER_MARK = 0x01020304;
+
+
+/*!
+ * \brief Header at the beginning of a Gnss_Synchro capture file. It is
+ * followed by a sequence of Gnss_Synchro_Record objects, so the file can be
+ * memory-mapped and read as an array of records starting at offset
+ * header_size.
+ */
+struct Gnss_Synchro_Record_File_Header
+{
+    std::array<char, 16> magic;  //!< GNSS_SYNCHRO_RECORD_MAGIC
+    uint32_t version;            //!< GNSS_SYNCHRO_RECORD_VERSION
+    uint32_t byte_order_mark;    //!< GNSS_SYNCHRO_RECORD_BYTE_ORDER_MARK, in the byte order of the writer
+    uint32_t header_size;        //!< Size of this header, in bytes
+    uint32_t record_size;        //!< Size of each record, in bytes
+    uint32_t n_streams;          //!< Number of recorded streams
+    uint32_t tap;                //!< Gnss_Synchro_Record_Tap
+    uint64_t reserved;
+};
+
+
+/*!
+ * \brief Fixed-layout copy of a Gnss_Synchro object. Members are ordered by
+ * size so that the layout does not contain implicit padding.
+ */
+struct Gnss_Synchro_Record
+{
+    double Acq_delay_samples;
+    double Acq_doppler_hz;
+    uint64_t Acq_samplestamp_samples;
+    int64_t fs;
+    double Prompt_I;
+    double Prompt_Q;
+    double CN0_dB_hz;
+    double Carrier_Doppler_hz;
+    double Carrier_phase_rads;
+    double Code_phase_samples;
+    uint64_t Tracking_sample_counter;
+    double Pseudorange_m;
+    double RX_time;
+    double interp_TOW_ms;
+    uint32_t PRN;
+    int32_t Channel_ID;
+    uint32_t Acq_doppler_step;
+    int32_t correlation_length_ms;
+    uint32_t TOW_at_current_symbol_ms;
+    uint32_t stream;  //!< Index of the flow graph stream this object was captured from
+    char System;
+    char Signal[3];
+    uint8_t flags;  //!< Bit mask of the Gnss_Synchro flags, see GNSS_SYNCHRO_RECORD_FLAG_*
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(Gnss_Synchro_Record_File_Header) == 48, "Unexpected Gnss_Synchro_Record_File_Header layout");
+static_assert(sizeof(Gnss_Synchro_Record) == 144, "Unexpected Gnss_Synchro_Record layout");
+
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_VALID_ACQUISITION = 0x01;
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_VALID_SYMBOL_OUTPUT = 0x02;
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_VALID_WORD = 0x04;
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_VALID_PSEUDORANGE = 0x08;
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_PLL_180_DEG_PHASE_LOCKED = 0x10;
+constexpr uint8_t GNSS_SYNCHRO_RECORD_FLAG_REFINED_ACQUISITION = 0x20;
+
+
+/*!
+ * \brief Returns a file header for a capture of n_streams streams taken at tap
+ */
+inline Gnss_Synchro_Record_File_Header gnss_synchro_record_file_header(uint32_t n_streams, Gnss_Synchro_Record_Tap tap)
+{
+    Gnss_Synchro_Record_File_Header header{};
+    header.magic = GNSS_SYNCHRO_RECORD_MAGIC;
+    header.version = GNSS_SYNCHRO_RECORD_VERSION;
+    header.byte_order_mark = GNSS_SYNCHRO_RECORD_BYTE_ORDER_MARK;
+    header.header_size = sizeof(Gnss_Synchro_Record_File_Header);
+    header.record_size = sizeof(Gnss_Synchro_Record);
+    header.n_streams = n_streams;
+    header.tap = static_cast<uint32_t>(tap);
+    return header;
+}
+
+
+/*!
+ * \brief Returns true if header describes a file that can be read by this
+ * version of the software
+ */
+inline bool gnss_synchro_record_file_header_is_valid(const Gnss_Synchro_Record_File_Header& header)
+{
+    return header.magic == GNSS_SYNCHRO_RECORD_MAGIC &&
+           header.version == GNSS_SYNCHRO_RECORD_VERSION &&
+           header.byte_order_mark == GNSS_SYNCHRO_RECORD_BYTE_ORDER_MARK &&
+           header.header_size >= sizeof(Gnss_Synchro_Record_File_Header) &&
+           header.record_size == sizeof(Gnss_Synchro_Record) &&
+           header.n_streams > 0;
+}
+
+
+/*!
+ * \brief Fills record with the contents of gnss_synchro
+ */
+inline void gnss_synchro_to_record(const Gnss_Synchro& gnss_synchro, uint32_t stream, Gnss_Synchro_Record& record)
+{
+    record.Acq_delay_samples = gnss_synchro.Acq_delay_samples;
+    record.Acq_doppler_hz = gnss_synchro.Acq_doppler_hz;
+    record.Acq_samplestamp_samples = gnss_synchro.Acq_samplestamp_samples;
+    record.fs = gnss_synchro.fs;
+    record.Prompt_I = gnss_synchro.Prompt_I;
+    record.Prompt_Q = gnss_synchro.Prompt_Q;
+    record.CN0_dB_hz = gnss_synchro.CN0_dB_hz;
+    record.Carrier_Doppler_hz = gnss_synchro.Carrier_Doppler_hz;
+    record.Carrier_phase_rads = gnss_synchro.Carrier_phase_rads;
+    record.Code_phase_samples = gnss_synchro.Code_phase_samples;
+    record.Tracking_sample_counter = gnss_synchro.Tracking_sample_counter;
+    record.Pseudorange_m = gnss_synchro.Pseudorange_m;
+    record.RX_time = gnss_synchro.RX_time;
+    record.interp_TOW_ms = gnss_synchro.interp_TOW_ms;
+    record.PRN = gnss_synchro.PRN;
+    record.Channel_ID = gnss_synchro.Channel_ID;
+    record.Acq_doppler_step = gnss_synchro.Acq_doppler_step;
+    record.correlation_length_ms = gnss_synchro.correlation_length_ms;
+    record.TOW_at_current_symbol_ms = gnss_synchro.TOW_at_current_symbol_ms;
+    record.stream = stream;
+    record.System = gnss_synchro.System;
+    std::memcpy(record.Signal, gnss_synchro.Signal, sizeof(record.Signal));
+    record.flags = static_cast<uint8_t>((gnss_synchro.Flag_valid_acquisition ? GNSS_SYNCHRO_RECORD_FLAG_VALID_ACQUISITION : 0) |
+                                        (gnss_synchro.Flag_valid_symbol_output ? GNSS_SYNCHRO_RECORD_FLAG_VALID_SYMBOL_OUTPUT : 0) |
+                                        (gnss_synchro.Flag_valid_word ? GNSS_SYNCHRO_RECORD_FLAG_VALID_WORD : 0) |
+                                        (gnss_synchro.Flag_valid_pseudorange ? GNSS_SYNCHRO_RECORD_FLAG_VALID_PSEUDORANGE : 0) |
+                                        (gnss_synchro.Flag_PLL_180_deg_phase_locked ? GNSS_SYNCHRO_RECORD_FLAG_PLL_180_DEG_PHASE_LOCKED : 0) |
+                                        (gnss_synchro.Flag_refined_acquisition ? GNSS_SYNCHRO_RECORD_FLAG_REFINED_ACQUISITION : 0));
+    record.reserved[0] = 0;
+    record.reserved[1] = 0;
+    record.reserved[2] = 0;
+}
+
+
+/*!
+ * \brief Fills gnss_synchro with the contents of record
+ */
+inline void gnss_synchro_from_record(const Gnss_Synchro_Record& record, Gnss_Synchro& gnss_synchro)
+{
+    gnss_synchro.System = record.System;
+    std::memcpy(gnss_synchro.Signal, record.Signal, sizeof(gnss_synchro.Signal));
+    gnss_synchro.PRN = record.PRN;
+    gnss_synchro.Channel_ID = record.Channel_ID;
+    gnss_synchro.Acq_delay_samples = record.Acq_delay_samples;
+    gnss_synchro.Acq_doppler_hz = record.Acq_doppler_hz;
+    gnss_synchro.Acq_samplestamp_samples = record.Acq_samplestamp_samples;
+    gnss_synchro.Acq_doppler_step = record.Acq_doppler_step;
+    gnss_synchro.fs = record.fs;
+    gnss_synchro.Prompt_I = record.Prompt_I;
+    gnss_synchro.Prompt_Q = record.Prompt_Q;
+    gnss_synchro.CN0_dB_hz = record.CN0_dB_hz;
+    gnss_synchro.Carrier_Doppler_hz = record.Carrier_Doppler_hz;
+    gnss_synchro.Carrier_phase_rads = record.Carrier_phase_rads;
+    gnss_synchro.Code_phase_samples = record.Code_phase_samples;
+    gnss_synchro.Tracking_sample_counter = record.Tracking_sample_counter;
+    gnss_synchro.correlation_length_ms = record.correlation_length_ms;
+    gnss_synchro.TOW_at_current_symbol_ms = record.TOW_at_current_symbol_ms;
+    gnss_synchro.Pseudorange_m = record.Pseudorange_m;
+    gnss_synchro.RX_time = record.RX_time;
+    gnss_synchro.interp_TOW_ms = record.interp_TOW_ms;
+    gnss_synchro.Flag_valid_acquisition = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_VALID_ACQUISITION) != 0;
+    gnss_synchro.Flag_valid_symbol_output = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_VALID_SYMBOL_OUTPUT) != 0;
+    gnss_synchro.Flag_valid_word = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_VALID_WORD) != 0;
+    gnss_synchro.Flag_valid_pseudorange = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_VALID_PSEUDORANGE) != 0;
+    gnss_synchro.Flag_PLL_180_deg_phase_locked = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_PLL_180_DEG_PHASE_LOCKED) != 0;
+    gnss_synchro.Flag_refined_acquisition = (record.flags & GNSS_SYNCHRO_RECORD_FLAG_REFINED_ACQUISITION) != 0;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_RECORD_H
@@ -19,6 +19,9 @@
 #include <algorithm>
 #include <cstring>
 #include <iostream>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>  // for _mm_shuffle_epi8
+#endif
 
 
 ReedSolomon::ReedSolomon(const std::string& gnss_signal)
@@ -635,6 +638,59 @@ uint8_t ReedSolomon::galois_mul_table(uint8_t a, uint8_t b) const
 }
 
 
+uint8_t ReedSolomon::galois_inv(uint8_t a) const
+{
+    // a must be different from 0
+    return d_antilog[(d_symbols_per_block - d_log_table[a]) % d_symbols_per_block];
+}
+
+
+void ReedSolomon::galois_mul_add_row(uint8_t coeff, const uint8_t* in, uint8_t* out, size_t length) const
+{
+    if (coeff == 0)
+        {
+            return;
+        }
+    size_t i = 0;
+    if (coeff == 1)
+        {
+            for (; i < length; i++)
+                {
+                    out[i] ^= in[i];
+                }
+            return;
+        }
+
+    // Multiplication by a constant is linear, so coeff * x = coeff * (x & 0x0F) + coeff * (x & 0xF0)
+    // and the product can be looked up in two tables of 16 elements.
+    alignas(16) std::array<uint8_t, 16> low_nibble{};
+    alignas(16) std::array<uint8_t, 16> high_nibble{};
+    for (uint8_t x = 1; x < 16; x++)
+        {
+            low_nibble[x] = galois_mul_table(coeff, x);
+            high_nibble[x] = galois_mul_table(coeff, static_cast<uint8_t>(x << 4));
+        }
+
+#if defined(__SSSE3__)
+    const __m128i low_table = _mm_load_si128(reinterpret_cast<const __m128i*>(low_nibble.data()));
+    const __m128i high_table = _mm_load_si128(reinterpret_cast<const __m128i*>(high_nibble.data()));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    for (; i + 16 <= length; i += 16)
+        {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            const __m128i low = _mm_shuffle_epi8(low_table, _mm_and_si128(x, mask));
+            const __m128i high = _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(y, _mm_xor_si128(low, high)));
+        }
+#endif
+    for (; i < length; i++)
+        {
+            out[i] ^= low_nibble[in[i] & 0x0F] ^ high_nibble[in[i] >> 4];
+        }
+}
+
+
 void ReedSolomon::init_log_tables()
 {
     d_log_table[0] = 0;  // dummy value
@@ -808,6 +864,106 @@ int ReedSolomon::decode(std::vector<uint8_t>& data_to_decode, const std::vector<
 }
 
 
+int ReedSolomon::decode_erasures(const std::vector<std::vector<uint8_t>>& code_matrix,
+    const std::vector<int>& known_positions,
+    std::vector<std::vector<uint8_t>>& decoded_matrix) const
+{
+    if (d_rows_G == 0)
+        {
+            std::cerr << "Reed Solomon usage problem: Generator matrix is not defined.\n";
+            return -1;
+        }
+    const size_t k = d_columns_G;
+    if (known_positions.size() < k)
+        {
+            std::cerr << "Reed Solomon usage error: not enough known positions in decode_erasures method.\n";
+            return -1;
+        }
+    if (code_matrix.size() != d_rows_G)
+        {
+            std::cerr << "Reed Solomon usage error: wrong matrix input size in decode_erasures method.\n";
+            return -1;
+        }
+    const size_t n_columns = code_matrix[0].size();
+    for (size_t r = 0; r < k; r++)
+        {
+            if (known_positions[r] < 0 || static_cast<size_t>(known_positions[r]) >= d_rows_G || code_matrix[known_positions[r]].size() != n_columns)
+                {
+                    std::cerr << "Reed Solomon usage error: wrong known position in decode_erasures method.\n";
+                    return -1;
+                }
+        }
+
+    // Invert the k x k sub-matrix of the generator matrix formed by the
+    // known rows, by Gauss-Jordan elimination in GF(2^8).
+    std::vector<uint8_t> sub_matrix(k * k);
+    std::vector<uint8_t> inverse(k * k, 0);
+    for (size_t r = 0; r < k; r++)
+        {
+            std::copy(d_genmatrix[known_positions[r]].begin(), d_genmatrix[known_positions[r]].end(), sub_matrix.begin() + r * k);
+            inverse[r * k + r] = 1;
+        }
+    for (size_t col = 0; col < k; col++)
+        {
+            size_t pivot = col;
+            while (pivot < k && sub_matrix[pivot * k + col] == 0)
+                {
+                    pivot++;
+                }
+            if (pivot == k)
+                {
+                    // Only happens with repeated known positions
+                    std::cerr << "Reed Solomon usage error: repeated known positions in decode_erasures method.\n";
+                    return -1;
+                }
+            if (pivot != col)
+                {
+                    std::swap_ranges(sub_matrix.begin() + pivot * k, sub_matrix.begin() + (pivot + 1) * k, sub_matrix.begin() + col * k);
+                    std::swap_ranges(inverse.begin() + pivot * k, inverse.begin() + (pivot + 1) * k, inverse.begin() + col * k);
+                }
+            const uint8_t pivot_inv = galois_inv(sub_matrix[col * k + col]);
+            for (size_t j = 0; j < k; j++)
+                {
+                    sub_matrix[col * k + j] = galois_mul_table(sub_matrix[col * k + j], pivot_inv);
+                    inverse[col * k + j] = galois_mul_table(inverse[col * k + j], pivot_inv);
+                }
+            for (size_t r = 0; r < k; r++)
+                {
+                    const uint8_t factor = sub_matrix[r * k + col];
+                    if (r != col && factor != 0)
+                        {
+                            galois_mul_add_row(factor, &sub_matrix[col * k], &sub_matrix[r * k], k);
+                            galois_mul_add_row(factor, &inverse[col * k], &inverse[r * k], k);
+                        }
+                }
+        }
+
+    // The decoded symbols are the first k rows of the codeword, so the
+    // decoding matrix is G[0:k] * inverse. It reduces to the inverse itself
+    // for systematic codes.
+    std::vector<uint8_t> decoding_matrix(k * k, 0);
+    for (size_t i = 0; i < k; i++)
+        {
+            for (size_t j = 0; j < k; j++)
+                {
+                    galois_mul_add_row(d_genmatrix[i][j], &inverse[j * k], &decoding_matrix[i * k], k);
+                }
+        }
+
+    // Apply the same decoding matrix to all the columns at once, row by row
+    decoded_matrix.resize(k);
+    for (size_t i = 0; i < k; i++)
+        {
+            decoded_matrix[i].assign(n_columns, 0);
+            for (size_t r = 0; r < k; r++)
+                {
+                    galois_mul_add_row(decoding_matrix[i * k + r], code_matrix[known_positions[r]].data(), decoded_matrix[i].data(), n_columns);
+                }
+        }
+    return 0;
+}
+
+
 int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) const
 {
     int deg_lambda;
@@ -101,6 +101,32 @@ public:
     int decode(std::vector<uint8_t>& data_to_decode,
         const std::vector<int>& erasure_positions = std::vector<int>{}) const;
 
+    /*!
+     * \brief Erasure-only decoding of a set of codewords that share the same
+     * erasure pattern, each of them stored as a column of code_matrix.
+     *
+     * code_matrix is a matrix of 255-shortening rows, one per code symbol.
+     * known_positions contains the rows (0-based) whose symbols were
+     * received, and it must hold at least 255-nroots-shortening elements.
+     * Only the first 255-nroots-shortening of them are used, the rest of
+     * rows are ignored.
+     *
+     * Since there are no errors to locate, the decoding matrix is obtained
+     * by inverting once the sub-matrix of the generator matrix selected by
+     * known_positions, and then it is applied to all the columns. This gives
+     * the same result as calling decode() on each column with the
+     * complementary erasure positions, at a fraction of the cost.
+     *
+     * decoded_matrix is resized to (255-nroots-shortening) x columns of
+     * code_matrix, and it contains the decoded symbols.
+     *
+     * Returns 0 on success, or -1 if the generator matrix is not defined or
+     * the inputs are not valid.
+     */
+    int decode_erasures(const std::vector<std::vector<uint8_t>>& code_matrix,
+        const std::vector<int>& known_positions,
+        std::vector<std::vector<uint8_t>>& decoded_matrix) const;
+
     /*!
      * \brief Encode data with the generator matrix (for testing purposes)
      *
@@ -128,6 +154,8 @@ private:
     uint8_t galois_mul(uint8_t a, uint8_t b) const;
     uint8_t galois_add(uint8_t a, uint8_t b) const;
     uint8_t galois_mul_table(uint8_t a, uint8_t b) const;
+    uint8_t galois_inv(uint8_t a) const;
+    void galois_mul_add_row(uint8_t coeff, const uint8_t* in, uint8_t* out, size_t length) const;  // out += coeff * in
 
     void encode_rs_8(const uint8_t* data, uint8_t* parity) const;
     void init_log_tables();    // initialize d_log_table and d_antilog
@@ -9,7 +9,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2024  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2024-2026  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -19,8 +19,11 @@
 #include "gnss_crypto.h"
 #include "osnma_helper.h"
 #include "osnma_msg_receiver.h"
+#include "osnma_tesla_chain.h"
 #include <benchmark/benchmark.h>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 void bm_verify_public_key(benchmark::State& state)
 {
@@ -45,83 +48,141 @@ void bm_verify_public_key(benchmark::State& state)
         }
 }
 
+
+namespace
+{
+const std::vector<uint8_t> KROOT_RG{0x5B, 0xF8, 0xC9, 0xCB, 0xFC, 0xF7, 0x04, 0x22, 0x08, 0x14, 0x75, 0xFD, 0x44, 0x5D, 0xF0, 0xFF};  // Receiver Guidelines v1.3, A.5.2
+const std::vector<uint8_t> K2_RG{0x2D, 0xC3, 0xA3, 0xCD, 0xB1, 0x17, 0xFA, 0xAD, 0xB8, 0x3B, 0x5F, 0x0B, 0x6F, 0xEA, 0x88, 0xEB};
+constexpr uint64_t ALPHA_RG = 0x610BDF26D77B;
+constexpr uint32_t GST_0_RG = (1248 & 0x00000FFF) << 20 | (345600 & 0x000FFFFF);  // applicable time (GST_Kroot + 30)
+constexpr uint32_t KEYS_PER_DAY = 2880;                                           // max Kroot time is 1 day as per spec.
+
+
+DSM_KROOT_message kroot_rg()
+{
+    DSM_KROOT_message kroot{};
+    kroot.kroot = KROOT_RG;
+    kroot.ks = 4;  // TABLE 10 --> 128 bits
+    kroot.alpha = ALPHA_RG;
+    kroot.hf = 0;
+    return kroot;
+}
+
+
+// Keys of a synthetic chain: keys[i] is transmitted at GST_0 - 30 + 30 * i, keys[0] is the KROOT
+std::vector<std::vector<uint8_t>> build_tesla_chain(const Gnss_Crypto& crypto, const std::vector<uint8_t>& last_key, uint32_t length)
+{
+    std::vector<std::vector<uint8_t>> keys(length + 1);
+    keys[length] = last_key;
+    for (uint32_t i = length; i > 0; i--)
+        {
+            const uint32_t GST_SFi = GST_0_RG - 30 + 30 * (i - 1);
+            std::vector<uint8_t> msg = keys[i];
+            msg.push_back((GST_SFi & 0xFF000000) >> 24);
+            msg.push_back((GST_SFi & 0x00FF0000) >> 16);
+            msg.push_back((GST_SFi & 0x0000FF00) >> 8);
+            msg.push_back(GST_SFi & 0x000000FF);
+            for (int k = 5; k >= 0; k--)
+                {
+                    msg.push_back(static_cast<uint8_t>((ALPHA_RG >> (k * 8)) & 0xFF));
+                }
+            const std::vector<uint8_t> hash = crypto.compute_SHA_256(msg);
+            keys[i - 1] = std::vector<uint8_t>(hash.begin(), hash.begin() + last_key.size());
+        }
+    return keys;
+}
+
+
+// Messages of the size of an ADKD 0 tag (PRN_d, PRN_A, GST, CTR, NMAS, 549 bits of navigation data)
+std::vector<std::vector<uint8_t>> build_tag_messages(size_t number_of_tags)
+{
+    std::vector<std::vector<uint8_t>> messages(number_of_tags, std::vector<uint8_t>(76));
+    for (size_t i = 0; i < number_of_tags; i++)
+        {
+            for (size_t k = 0; k < messages[i].size(); k++)
+                {
+                    messages[i][k] = static_cast<uint8_t>(i * 31 + k);
+                }
+        }
+    return messages;
+}
+}  // namespace
+
+
 void bm_verify_tesla_key(benchmark::State& state)
 {
-    //    osnma_msg_receiver_sptr osnma = osnma_msg_receiver_make(CRTFILE_DEFAULT, MERKLEFILE_DEFAULT);
-    //    Osnma_Helper helper;
-    //    osnma->d_tesla_key_verified = false;
-    //    osnma->d_osnma_data.d_dsm_kroot_message.kroot = {0x5B, 0xF8, 0xC9, 0xCB, 0xFC, 0xF7, 0x04, 0x22, 0x08, 0x14, 0x75, 0xFD, 0x44, 0x5D, 0xF0, 0xFF};  // Kroot, TOW 345570 GST_0 - 30
-    //    osnma->d_osnma_data.d_dsm_kroot_message.ks = 4;                                                                                                    // TABLE 10 --> 128 bits
-    //    osnma->d_osnma_data.d_dsm_kroot_message.alpha = 0x610BDF26D77B;
-    //    osnma->d_GST_SIS = (1248 & 0x00000FFF) << 20 | (345630 & 0x000FFFFF);
-    //    osnma->d_GST_0 = ((1248 & 0x00000FFF) << 20 | (345600 & 0x000FFFFF));                          // applicable time (GST_Kroot + 30)
-    //    osnma->d_GST_Sf = osnma->d_GST_0 + 30 * std::floor((osnma->d_GST_SIS - osnma->d_GST_0) / 30);  // Eq. 3 R.G.
-    //
-    //    osnma->d_tesla_keys.insert((std::pair<uint32_t, std::vector<uint8_t>>(345600, {0xEF, 0xF9, 0x99, 0x04, 0x0E, 0x19, 0xB5, 0x70, 0x83, 0x50, 0x60, 0xBE, 0xBD, 0x23, 0xED, 0x92})));  // K1, not needed, just for reference.
-    //    std::vector<uint8_t> key = {0x2D, 0xC3, 0xA3, 0xCD, 0xB1, 0x17, 0xFA, 0xAD, 0xB8, 0x3B, 0x5F, 0x0B, 0x6F, 0xEA, 0x88, 0xEB};                                                        // K2
-    //    uint32_t TOW = 345630;
-    //
-    //    while (state.KeepRunning())
-    //        {
-    //            osnma->verify_tesla_key(key, TOW);
-    //        }
+    Gnss_Crypto crypto;
+    const DSM_KROOT_message kroot = kroot_rg();
+
+    while (state.KeepRunning())
+        {
+            OSNMA_TESLA_Chain chain;  // only the KROOT is known
+            benchmark::DoNotOptimize(chain.verify_key(crypto, kroot, GST_0_RG, K2_RG, GST_0_RG + 30));
+        }
 }
 
+
 void bm_verify_tesla_key_24h(benchmark::State& state)
 {
-    // TODO - copy of normal tesla verification but with 2800 steps instead of only two (max Kroot time is 1 day as per spec.)
+    // Arg 0: hashing down to the KROOT. Arg 1: hashing down to the closest checkpoint.
+    Gnss_Crypto crypto;
+    DSM_KROOT_message kroot = kroot_rg();
+    const std::vector<std::vector<uint8_t>> keys = build_tesla_chain(crypto, K2_RG, KEYS_PER_DAY);
+    kroot.kroot = keys[0];
+    const uint32_t GST_last = GST_0_RG - 30 + 30 * (KEYS_PER_DAY - 1);
+
+    OSNMA_TESLA_Chain warm_chain;
+    warm_chain.verify_key(crypto, kroot, GST_0_RG, keys[KEYS_PER_DAY], GST_last + 30);
+
+    while (state.KeepRunning())
+        {
+            if (state.range(0) == 0)
+                {
+                    OSNMA_TESLA_Chain chain;
+                    benchmark::DoNotOptimize(chain.verify_key(crypto, kroot, GST_0_RG, keys[KEYS_PER_DAY - 1], GST_last));
+                }
+            else
+                {
+                    benchmark::DoNotOptimize(warm_chain.verify_key(crypto, kroot, GST_0_RG, keys[KEYS_PER_DAY - 1], GST_last));
+                }
+        }
 }
 
+
 void bm_tag_verification(benchmark::State& state)
 {
-    //    osnma_msg_receiver_sptr osnma = osnma_msg_receiver_make(CRTFILE_DEFAULT, MERKLEFILE_DEFAULT);
-    //    Osnma_Helper helper;
-    //    uint32_t TOW_Tag0 = 345660;
-    //    uint32_t TOW_NavData = TOW_Tag0 - 30;
-    //    uint32_t TOW_Key_Tag0 = TOW_Tag0 + 30;
-    //    uint32_t WN = 1248;
-    //    uint32_t PRNa = 2;
-    //    uint8_t CTR = 1;
-    //
-    //    osnma->d_osnma_data.d_dsm_kroot_message.ts = 9;                                                                                        // 40 bit
-    //    osnma->d_tesla_keys[TOW_Key_Tag0] = {0x69, 0xC0, 0x0A, 0xA7, 0x36, 0x42, 0x37, 0xA6, 0x5E, 0xBF, 0x00, 0x6A, 0xD8, 0xDD, 0xBC, 0x73};  // K4
-    //    osnma->d_osnma_data.d_dsm_kroot_message.mf = 0;
-    //    osnma->d_nav_data_manager->add_navigation_data(
-    //        "000011101001011001000100000101000111010110100100100101100000000000"
-    //        "011101101011001111101110101010000001010000011011111100000011101011"
-    //        "011100101101011010101011011011001001110111101011110110111111001111"
-    //        "001000011111101110011000111111110111111010000011101011111111110000"
-    //        "110111000000100000001110110000110110001110000100001110101100010100"
-    //        "110100010001000110001110011010110000111010000010000000000001101000"
-    //        "000000000011100101100100010000000000000110110100110001111100000000"
-    //        "000000100110100000000101010010100000001011000010001001100000011111"
-    //        "110111111111000000000",
-    //        PRNa, TOW_NavData);
-    //    osnma->d_osnma_data.d_nma_header.nmas = 0b10;
-    //
-    //    MACK_tag_and_info MTI;
-    //    MTI.tag = static_cast<uint64_t>(0xE37BC4F858);
-    //    MTI.tag_info.PRN_d = 0x02;
-    //    MTI.tag_info.ADKD = 0x00;
-    //    MTI.tag_info.cop = 0x0F;
-    //    Tag t0(MTI, TOW_Tag0, WN, PRNa, CTR);
-    //
-    //    while (state.KeepRunning())
-    //        {
-    //            osnma->verify_tag(t0);
-    //        }
+    // MACs of the tags received in a subframe from 12 satellites, one at a time
+    Gnss_Crypto crypto;
+    const std::vector<std::vector<uint8_t>> messages = build_tag_messages(12 * 6);
+
+    while (state.KeepRunning())
+        {
+            for (const auto& m : messages)
+                {
+                    benchmark::DoNotOptimize(crypto.compute_HMAC_SHA_256(K2_RG, m));
+                }
+        }
 }
 
-void bm_kroot_verification(benchmark::State& state)
+
+void bm_tag_verification_batched(benchmark::State& state)
 {
-    // TODO - this is essentially the signature verification, maybe could implement it for comparison purposes
+    // Same MACs, sharing the keyed context
+    Gnss_Crypto crypto;
+    const std::vector<std::vector<uint8_t>> messages = build_tag_messages(12 * 6);
+
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(crypto.compute_HMAC_SHA_256(K2_RG, messages));
+        }
 }
 
+
 BENCHMARK(bm_verify_public_key);
 BENCHMARK(bm_verify_tesla_key);
-BENCHMARK(bm_verify_tesla_key_24h);
+BENCHMARK(bm_verify_tesla_key_24h)->Arg(0)->Arg(1);
 BENCHMARK(bm_tag_verification);
-BENCHMARK(bm_kroot_verification);
+BENCHMARK(bm_tag_verification_batched);
 
 
-BENCHMARK_MAIN();
\ No newline at end of file
+BENCHMARK_MAIN();
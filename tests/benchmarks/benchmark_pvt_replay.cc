@@ -0,0 +1,258 @@
+/*!
+ * \file benchmark_pvt_replay.cc
+ * \brief Benchmark of the PVT solver fed with recorded observables and
+ * navigation data
+ *
+ * Record a replay file during a normal receiver run by setting
+ * PVT.record_replay=true (and optionally PVT.record_replay_filename) in the
+ * configuration file, then run:
+ *
+ *   $ ./benchmark_pvt_replay --replay_file=./pvt_replay.dat
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_make_unique.h"  // for std::unique_ptr in C++11
+#include "monitor_pvt.h"
+#include "pvt_conf.h"
+#include "pvt_replay.h"
+#include "rtklib.h"
+#include "rtklib_rtkpos.h"
+#include "rtklib_solver.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::atomic<uint64_t> g_allocations{0};
+std::string g_replay_filename("./pvt_replay.dat");
+constexpr size_t MAX_LATENCY_SAMPLES = 1000000;
+
+
+const Pvt_Replay_Session& get_session()
+{
+    static const Pvt_Replay_Session session = pvt_replay_load(g_replay_filename);
+    return session;
+}
+
+
+prcopt_t get_options(int positioning_mode, const Pvt_Replay_Session& session)
+{
+    prcopt_t opt{};
+    opt.mode = positioning_mode;
+    opt.nf = session.nf;
+    opt.navsys = session.navsys != 0 ? session.navsys : (SYS_GPS | SYS_GAL | SYS_GLO | SYS_CMP);
+    opt.elmin = 15.0 * D2R;
+    opt.ionoopt = (positioning_mode == PMODE_SINGLE) ? IONOOPT_BRDC : IONOOPT_EST;
+    opt.tropopt = (positioning_mode == PMODE_SINGLE) ? TROPOPT_SAAS : TROPOPT_EST;
+    opt.dynamics = (positioning_mode == PMODE_SINGLE) ? 0 : 1;
+    opt.modear = (positioning_mode == PMODE_KINEMA) ? 1 : 0;
+    opt.maxout = 5;
+    opt.minlock = 0;
+    opt.minfix = 10;
+    opt.armaxiter = 1;
+    opt.niter = 1;
+    opt.eratio[0] = 100.0;
+    opt.eratio[1] = 100.0;
+    opt.eratio[2] = 100.0;
+    opt.err[0] = 100.0;
+    opt.err[1] = 0.003;
+    opt.err[2] = 0.003;
+    opt.err[4] = 1.0;
+    opt.std[0] = 30.0;
+    opt.std[1] = 0.03;
+    opt.std[2] = 0.3;
+    opt.prn[0] = 1e-4;
+    opt.prn[1] = 1e-3;
+    opt.prn[2] = 1e-4;
+    opt.prn[3] = 1e-1;
+    opt.prn[4] = 1e-2;
+    opt.sclkstab = 5e-12;
+    opt.thresar[0] = 3.0;
+    opt.thresar[1] = 0.9999;
+    opt.thresar[2] = 0.25;
+    opt.thresar[3] = 0.1;
+    opt.thresar[4] = 0.05;
+    opt.thresslip = 0.05;
+    opt.maxtdiff = 30.0;
+    opt.maxinno = 30.0;
+    opt.maxgdop = 30.0;
+    opt.outsingle = 1;
+    opt.bancroft_init = true;
+    return opt;
+}
+
+
+void report_latencies(benchmark::State& state, const std::string& stage, std::vector<double>& latencies_us)
+{
+    if (latencies_us.empty())
+        {
+            return;
+        }
+    std::sort(latencies_us.begin(), latencies_us.end());
+    const auto percentile = [&latencies_us](double p) {
+        return latencies_us[static_cast<size_t>(p * static_cast<double>(latencies_us.size() - 1))];
+    };
+    state.counters[stage + "_p50_us"] = percentile(0.50);
+    state.counters[stage + "_p90_us"] = percentile(0.90);
+    state.counters[stage + "_p99_us"] = percentile(0.99);
+    state.counters[stage + "_max_us"] = latencies_us.back();
+}
+}  // namespace
+
+
+// Count every dynamic allocation of the process to report allocations per epoch
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+    return ptr;
+}
+
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept
+{
+    std::free(ptr);
+}
+
+
+void bm_pvt_replay(benchmark::State& state, int positioning_mode)
+{
+    const Pvt_Replay_Session& session = get_session();
+    if (session.epochs.empty())
+        {
+            state.SkipWithError(("No epochs found in " + g_replay_filename).c_str());
+            return;
+        }
+
+    const prcopt_t opt = get_options(positioning_mode, session);
+    Pvt_Conf conf;
+    rtk_t rtk;
+    rtkinit(&rtk, &opt);
+    auto solver = std::make_unique<Rtklib_Solver>(rtk, conf, "pvt_replay_benchmark", session.type_of_rx, false, false);
+
+    std::vector<double> nav_latencies_us;
+    std::vector<double> solver_latencies_us;
+    std::vector<double> monitor_latencies_us;
+    nav_latencies_us.reserve(MAX_LATENCY_SAMPLES);
+    solver_latencies_us.reserve(MAX_LATENCY_SAMPLES);
+    monitor_latencies_us.reserve(MAX_LATENCY_SAMPLES);
+
+    size_t epoch_index = 0;
+    uint64_t epochs = 0;
+    uint64_t valid_fixes = 0;
+    uint64_t allocations = 0;
+
+    for (auto _ : state)
+        {
+            if (epoch_index == session.epochs.size())
+                {
+                    // Start the session again from a clean solver state
+                    state.PauseTiming();
+                    solver.reset();
+                    rtkfree(&rtk);
+                    rtkinit(&rtk, &opt);
+                    solver = std::make_unique<Rtklib_Solver>(rtk, conf, "pvt_replay_benchmark", session.type_of_rx, false, false);
+                    epoch_index = 0;
+                    state.ResumeTiming();
+                }
+            const Pvt_Replay_Epoch& epoch = session.epochs[epoch_index++];
+            const uint64_t allocations_start = g_allocations.load(std::memory_order_relaxed);
+
+            const auto t0 = std::chrono::steady_clock::now();
+            for (const auto& nav_update : epoch.nav_updates)
+                {
+                    nav_update(*solver);
+                }
+            const auto t1 = std::chrono::steady_clock::now();
+            const bool valid = solver->get_PVT(epoch.observables, epoch.kf_update_interval_s);
+            const auto t2 = std::chrono::steady_clock::now();
+            if (valid)
+                {
+                    Monitor_Pvt monitor_pvt = solver->get_monitor_pvt();
+                    benchmark::DoNotOptimize(monitor_pvt);
+                    valid_fixes++;
+                }
+            const auto t3 = std::chrono::steady_clock::now();
+
+            allocations += g_allocations.load(std::memory_order_relaxed) - allocations_start;
+            epochs++;
+            if (solver_latencies_us.size() < MAX_LATENCY_SAMPLES)
+                {
+                    nav_latencies_us.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+                    solver_latencies_us.push_back(std::chrono::duration<double, std::micro>(t2 - t1).count());
+                    monitor_latencies_us.push_back(std::chrono::duration<double, std::micro>(t3 - t2).count());
+                }
+        }
+
+    solver.reset();
+    rtkfree(&rtk);
+
+    state.SetItemsProcessed(static_cast<int64_t>(epochs));  // reported as epochs/s
+    state.counters["epochs_per_second"] = benchmark::Counter(static_cast<double>(epochs), benchmark::Counter::kIsRate);
+    state.counters["allocations_per_epoch"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    state.counters["valid_fix_ratio"] = epochs > 0 ? static_cast<double>(valid_fixes) / static_cast<double>(epochs) : 0.0;
+    report_latencies(state, "nav_update", nav_latencies_us);
+    report_latencies(state, "get_PVT", solver_latencies_us);
+    report_latencies(state, "monitor", monitor_latencies_us);
+}
+
+
+BENCHMARK_CAPTURE(bm_pvt_replay, SPP, PMODE_SINGLE);
+BENCHMARK_CAPTURE(bm_pvt_replay, PPP, PMODE_PPP_KINEMA);
+BENCHMARK_CAPTURE(bm_pvt_replay, RTK, PMODE_KINEMA);
+
+
+int main(int argc, char** argv)
+{
+    // Extract our own flag before handing the command line to Benchmark
+    const std::string flag("--replay_file=");
+    int new_argc = 0;
+    for (int i = 0; i < argc; i++)
+        {
+            if (std::strncmp(argv[i], flag.c_str(), flag.size()) == 0)
+                {
+                    g_replay_filename = std::string(argv[i] + flag.size());
+                }
+            else
+                {
+                    argv[new_argc++] = argv[i];
+                }
+        }
+    argc = new_argc;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        {
+            return 1;
+        }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
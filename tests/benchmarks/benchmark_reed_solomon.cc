@@ -18,9 +18,57 @@
 #include "gnss_sdr_make_unique.h"  // for std::unique_ptr in C++11
 #include "reed_solomon.h"
 #include <benchmark/benchmark.h>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+namespace
+{
+// Galileo HAS message: message_size pages out of 32 carry information, and
+// each page is a row of 53 octets. Pages with PID 1, 3, and 40 to 40 +
+// message_size - 3 have been received.
+constexpr int HAS_MESSAGE_SIZE = 20;
+constexpr int HAS_OCTETS_IN_SUBPAGE = 53;
+
+std::vector<std::vector<uint8_t>> has_code_matrix(const ReedSolomon& rs, std::vector<int>& known_positions)
+{
+    std::vector<std::vector<uint8_t>> code_matrix(255, std::vector<uint8_t>(HAS_OCTETS_IN_SUBPAGE, 0));
+    for (int col = 0; col < HAS_OCTETS_IN_SUBPAGE; col++)
+        {
+            std::vector<uint8_t> message(32, 0);
+            for (int row = 0; row < HAS_MESSAGE_SIZE; row++)
+                {
+                    message[row] = static_cast<uint8_t>(7 * row + 13 * col + 1);
+                }
+            const std::vector<uint8_t> codeword = rs.encode_with_generator_matrix(message);
+            for (int row = 0; row < 255; row++)
+                {
+                    code_matrix[row][col] = codeword[row];
+                }
+        }
+
+    std::vector<int> received_positions = {0, 2};
+    for (int pos = 39; pos < 39 + HAS_MESSAGE_SIZE - 2; pos++)
+        {
+            received_positions.push_back(pos);
+        }
+    std::vector<std::vector<uint8_t>> received_matrix(255, std::vector<uint8_t>(HAS_OCTETS_IN_SUBPAGE, 0));
+    for (auto pos : received_positions)
+        {
+            received_matrix[pos] = code_matrix[pos];
+        }
+
+    known_positions = {0, 2};
+    for (int pos = HAS_MESSAGE_SIZE; pos < 32; pos++)
+        {
+            known_positions.push_back(pos);
+        }
+    known_positions.insert(known_positions.end(), received_positions.begin() + 2, received_positions.end());
+    return received_matrix;
+}
+}  // namespace
+
+
 void bm_e1b_erasurecorrection_shortened(benchmark::State& state)
 {
     std::vector<uint8_t> code_vector = {147, 109, 66, 23, 234, 140, 74, 234, 49,
@@ -295,8 +343,73 @@ void bm_e6b_erasure(benchmark::State& state)
 }
 
 
+void bm_e6b_has_message_per_column(benchmark::State& state)
+{
+    auto rs = std::make_unique<ReedSolomon>();
+    std::vector<int> known_positions;
+    const std::vector<std::vector<uint8_t>> code_matrix = has_code_matrix(*rs, known_positions);
+    std::vector<bool> known(255, false);
+    for (auto pos : known_positions)
+        {
+            known[pos] = true;
+        }
+    std::vector<int> erasure_positions;
+    for (int pos = 0; pos < 255; pos++)
+        {
+            if (!known[pos])
+                {
+                    erasure_positions.push_back(pos);
+                }
+        }
+    std::vector<std::vector<uint8_t>> decoded_matrix(32, std::vector<uint8_t>(HAS_OCTETS_IN_SUBPAGE));
+
+    while (state.KeepRunning())
+        {
+            for (int col = 0; col < HAS_OCTETS_IN_SUBPAGE; col++)
+                {
+                    std::vector<uint8_t> code_column(255);
+                    for (auto pos : known_positions)
+                        {
+                            code_column[pos] = code_matrix[pos][col];
+                        }
+                    if (rs->decode(code_column, erasure_positions) < 0)
+                        {
+                            state.SkipWithError("Failed to decode data!");
+                            break;
+                        }
+                    for (int row = 0; row < 32; row++)
+                        {
+                            decoded_matrix[row][col] = code_column[row];
+                        }
+                }
+            benchmark::DoNotOptimize(decoded_matrix);
+        }
+}
+
+
+void bm_e6b_has_message_batched(benchmark::State& state)
+{
+    auto rs = std::make_unique<ReedSolomon>();
+    std::vector<int> known_positions;
+    const std::vector<std::vector<uint8_t>> code_matrix = has_code_matrix(*rs, known_positions);
+    std::vector<std::vector<uint8_t>> decoded_matrix;
+
+    while (state.KeepRunning())
+        {
+            if (rs->decode_erasures(code_matrix, known_positions, decoded_matrix) < 0)
+                {
+                    state.SkipWithError("Failed to decode data!");
+                    break;
+                }
+            benchmark::DoNotOptimize(decoded_matrix);
+        }
+}
+
+
 BENCHMARK(bm_e1b_erasurecorrection_shortened);
 BENCHMARK(bm_e1b_erasurecorrection_unshortened);
 BENCHMARK(bm_e6b_correction);
 BENCHMARK(bm_e6b_erasure);
+BENCHMARK(bm_e6b_has_message_per_column);
+BENCHMARK(bm_e6b_has_message_batched);
 BENCHMARK_MAIN();
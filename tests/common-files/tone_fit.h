@@ -0,0 +1,57 @@
+/*!
+ * \file tone_fit.h
+ * \brief Helper file for unit testing: fit of a complex tone to the output
+ * of a filter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TONE_FIT_H
+#define GNSS_SDR_TONE_FIT_H
+
+#include <gnuradio/gr_complex.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \brief Returns the complex amplitude of the tone of frequency f [Hz] in
+ * the samples, taken at fs [Hz], from sample first on, to skip the filter
+ * transient. If residual_power is not null, it is set to the mean power of
+ * what is not the tone.
+ */
+inline std::complex<double> fit_tone(const std::vector<gr_complex>& samples, double f, double fs, size_t first, double* residual_power = nullptr)
+{
+    std::complex<double> amplitude(0.0, 0.0);
+    if (samples.size() <= first)
+        {
+            return amplitude;
+        }
+    const auto n = static_cast<double>(samples.size() - first);
+    for (size_t m = first; m < samples.size(); m++)
+        {
+            amplitude += std::complex<double>(samples[m]) * std::polar(1.0, -2.0 * M_PI * f * static_cast<double>(m) / fs);
+        }
+    amplitude /= n;
+    if (residual_power != nullptr)
+        {
+            *residual_power = 0.0;
+            for (size_t m = first; m < samples.size(); m++)
+                {
+                    *residual_power += std::norm(std::complex<double>(samples[m]) - amplitude * std::polar(1.0, 2.0 * M_PI * f * static_cast<double>(m) / fs));
+                }
+            *residual_power /= n;
+        }
+    return amplitude;
+}
+
+#endif  // GNSS_SDR_TONE_FIT_H
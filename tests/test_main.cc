@@ -94,9 +94,19 @@ private:
 #include "unit-tests/arithmetic/magnitude_squared_test.cc"
 #include "unit-tests/arithmetic/multiply_test.cc"
 #include "unit-tests/arithmetic/preamble_correlator_test.cc"
+#include "unit-tests/arithmetic/volk_gnsssdr_buffer_test.cc"
+#include "unit-tests/control-plane/acquisition_scheduler_test.cc"
+#include "unit-tests/control-plane/channel_affinity_balancer_test.cc"
+#include "unit-tests/control-plane/flowgraph_config_snapshot_test.cc"
+#include "unit-tests/control-plane/gnss_signal_pool_test.cc"
+#include "unit-tests/control-plane/gnss_synchro_batch_udp_sink_test.cc"
 #include "unit-tests/control-plane/in_memory_configuration_test.cc"
+#include "unit-tests/control-plane/numa_topology_test.cc"
 #include "unit-tests/control-plane/protobuf_test.cc"
 #include "unit-tests/control-plane/string_converter_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_fixed_point_fft_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_peak_refinement_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_quantized_grid_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_8ms_ambiguous_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_ambiguous_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_cccwsr_ambiguous_acquisition_gsoc2013_test.cc"
@@ -111,29 +121,43 @@ private:
 #include "unit-tests/signal-processing-blocks/acquisition/gps_l1_ca_pcps_tong_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/adapter_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/pass_through_test.cc"
+#include "unit-tests/signal-processing-blocks/filter/beamformer_test.cc"
+#include "unit-tests/signal-processing-blocks/filter/fused_xlating_decimator_test.cc"
+#include "unit-tests/signal-processing-blocks/filter/pfb_channelizer_test.cc"
 #include "unit-tests/signal-processing-blocks/libs/item_type_helpers_test.cc"
 #include "unit-tests/signal-processing-blocks/osnma/gnss_crypto_test.cc"
 #include "unit-tests/signal-processing-blocks/osnma/osnma_msg_receiver_test.cc"
+#include "unit-tests/signal-processing-blocks/osnma/osnma_tesla_chain_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/geohash_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/nmea_printer_test.cc"
+#include "unit-tests/signal-processing-blocks/pvt/pvt_replay_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rinex_printer_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_printer_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_test.cc"
+#include "unit-tests/signal-processing-blocks/pvt/rtklib_solver_prediction_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/serdes_monitor_pvt_test.cc"
 #include "unit-tests/signal-processing-blocks/resampler/direct_resampler_conditioner_cc_test.cc"
 #include "unit-tests/signal-processing-blocks/resampler/mmse_resampler_test.cc"
+#include "unit-tests/signal-processing-blocks/resampler/polyphase_resampler_test.cc"
 #include "unit-tests/signal-processing-blocks/sources/gnss_sdr_valve_test.cc"
 #include "unit-tests/signal-processing-blocks/sources/unpack_2bit_samples_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/spsc_byte_ring_test.cc"
 #include "unit-tests/signal-processing-blocks/telemetry_decoder/galileo_fnav_inav_decoder_test.cc"
+#include "unit-tests/signal-processing-blocks/tracking/carrier_wipeoff_decimator_test.cc"
+#include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_real_codes_16sc_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_real_codes_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/discriminator_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/galileo_e5a_tracking_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/galileo_e5b_dll_pll_tracking_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/tracking_loop_filter_test.cc"
+#include "unit-tests/signal-processing-blocks/tracking/vector_tracking_aiding_test.cc"
+#include "unit-tests/signal-processing-blocks/tracking/multiband_tracking_group_test.cc"
 #include "unit-tests/system-parameters/galileo_e1b_reed_solomon_test.cc"
 #include "unit-tests/system-parameters/galileo_e6b_reed_solomon_test.cc"
 #include "unit-tests/system-parameters/galileo_ism_test.cc"
+#include "unit-tests/system-parameters/gnss_synchro_record_test.cc"
+#include "unit-tests/system-parameters/gnss_synchro_serialization_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_ephemeris_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_nav_message_test.cc"
 #include "unit-tests/system-parameters/has_decoding_test.cc"
@@ -160,6 +184,10 @@ private:
 #include "unit-tests/signal-processing-blocks/acquisition/gps_l1_ca_pcps_opencl_acquisition_gsoc2013_test.cc"
 #endif
 
+#if RAW_UDP_BLOCKS_TEST
+#include "unit-tests/signal-processing-blocks/sources/gr_complex_udp_batch_source_test.cc"
+#endif
+
 #include "unit-tests/signal-processing-blocks/tracking/bayesian_estimation_test.cc"
 #if ARMADILLO_HAVE_MVNRND
 #include "unit-tests/signal-processing-blocks/tracking/cubature_filter_test.cc"
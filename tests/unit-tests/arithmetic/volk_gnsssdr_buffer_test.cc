@@ -0,0 +1,157 @@
+/*!
+ * \file volk_gnsssdr_buffer_test.cc
+ * \brief Tests for the allocation policies of the volk_gnsssdr::vector
+ * buffers.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+
+TEST(VolkGnsssdrBufferTest, PooledBuffersAreReused)
+{
+    volk_gnsssdr_set_buffer_policy(VOLK_GNSSSDR_BUFFER_POOLED, 1024 * 1024);
+    volk_gnsssdr_buffer_stats_t before{};
+    volk_gnsssdr_get_buffer_stats(&before);
+
+    const std::complex<float>* first_data;
+    {
+        volk_gnsssdr::vector<std::complex<float>> first(4000);
+        first_data = first.data();
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(first_data) % 64, 0U);
+    }
+    volk_gnsssdr::vector<std::complex<float>> second(4000);
+    EXPECT_EQ(second.data(), first_data);
+
+    volk_gnsssdr_buffer_stats_t after{};
+    volk_gnsssdr_get_buffer_stats(&after);
+    EXPECT_EQ(after.allocations - before.allocations, 2U);
+    EXPECT_EQ(after.deallocations - before.deallocations, 1U);
+    EXPECT_EQ(after.pool_hits - before.pool_hits, 1U);
+    // Counted with the size class of the buffer
+    EXPECT_GE(after.bytes_in_use - before.bytes_in_use, 4000 * sizeof(std::complex<float>));
+    EXPECT_LT(after.bytes_in_use - before.bytes_in_use, 2 * 4000 * sizeof(std::complex<float>));
+
+    // Disabling the pool releases the buffers that it holds
+    volk_gnsssdr_set_buffer_policy(0, 0);
+    volk_gnsssdr_get_buffer_stats(&after);
+    EXPECT_EQ(after.pooled_bytes, 0U);
+}
+
+
+TEST(VolkGnsssdrBufferTest, HugepageBuffers)
+{
+    volk_gnsssdr_set_buffer_policy(VOLK_GNSSSDR_BUFFER_HUGEPAGES, 0);
+    volk_gnsssdr_buffer_stats_t before{};
+    volk_gnsssdr_get_buffer_stats(&before);
+    {
+        // Exactly one hugepage. Other platforms fall back to plain aligned
+        // buffers.
+        volk_gnsssdr::vector<float> grid(VOLK_GNSSSDR_HUGEPAGE_SIZE / sizeof(float), 1.0F);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(grid.data()) % volk_gnsssdr_get_alignment(), 0U);
+        EXPECT_EQ(grid.back(), 1.0F);
+#if defined(__linux__)
+        volk_gnsssdr_buffer_stats_t after{};
+        volk_gnsssdr_get_buffer_stats(&after);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(grid.data()) % VOLK_GNSSSDR_HUGEPAGE_SIZE, 0U);
+        EXPECT_EQ(after.hugepage_allocations - before.hugepage_allocations, 1U);
+        // The header takes a regular page, not a second hugepage
+        EXPECT_GT(after.mapped_bytes - before.mapped_bytes, VOLK_GNSSSDR_HUGEPAGE_SIZE);
+        EXPECT_LT(after.mapped_bytes - before.mapped_bytes, 2 * VOLK_GNSSSDR_HUGEPAGE_SIZE);
+#endif
+    }
+
+    // Rows of an acquisition grid are slots of a hugepage slab
+    volk_gnsssdr_get_buffer_stats(&before);
+    std::vector<volk_gnsssdr::vector<float>> rows;
+    for (int n = 0; n < 41; n++)
+        {
+            rows.emplace_back(4096, static_cast<float>(n));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(rows.back().data()) % volk_gnsssdr_get_alignment(), 0U);
+        }
+    for (int n = 0; n < 41; n++)
+        {
+            EXPECT_EQ(rows[n].front(), static_cast<float>(n));
+            EXPECT_EQ(rows[n].back(), static_cast<float>(n));
+        }
+    volk_gnsssdr_buffer_stats_t after{};
+    volk_gnsssdr_get_buffer_stats(&after);
+#if defined(__linux__)
+    EXPECT_EQ(after.hugepage_allocations - before.hugepage_allocations, 41U);
+#endif
+
+    // and reused once freed, without mapping more slabs
+    rows.clear();
+    volk_gnsssdr::vector<float> row(4096);
+    volk_gnsssdr_buffer_stats_t reused{};
+    volk_gnsssdr_get_buffer_stats(&reused);
+    EXPECT_EQ(reused.mapped_bytes, after.mapped_bytes);
+#if defined(__linux__)
+    EXPECT_EQ(reused.hugepage_allocations - after.hugepage_allocations, 1U);
+#endif
+    volk_gnsssdr_set_buffer_policy(0, 0);
+}
+
+
+TEST(VolkGnsssdrBufferTest, MappedBytesAreBounded)
+{
+    volk_gnsssdr_set_buffer_policy(VOLK_GNSSSDR_BUFFER_HUGEPAGES, 0);
+    volk_gnsssdr_buffer_stats_t before{};
+    volk_gnsssdr_get_buffer_stats(&before);
+    size_t max_mapped_bytes = before.mapped_bytes;
+    for (size_t size = 4096; size <= 1024 * 1024; size += 4096)
+        {
+            {
+                volk_gnsssdr::vector<char> buffer(size, 1);
+                EXPECT_EQ(buffer.back(), 1);
+            }
+            volk_gnsssdr_buffer_stats_t stats{};
+            volk_gnsssdr_get_buffer_stats(&stats);
+            max_mapped_bytes = std::max(max_mapped_bytes, stats.mapped_bytes);
+        }
+    volk_gnsssdr_buffer_stats_t after{};
+    volk_gnsssdr_get_buffer_stats(&after);
+    EXPECT_EQ(after.bytes_in_use, before.bytes_in_use);
+#if defined(__linux__)
+    // At most one spare slab per size class, and the buffer being used
+    EXPECT_LT(max_mapped_bytes - before.mapped_bytes, 16 * (VOLK_GNSSSDR_HUGEPAGE_SIZE + 65536));
+#endif
+
+    // Without a policy, the empty slabs are unmapped
+    volk_gnsssdr_set_buffer_policy(0, 0);
+    volk_gnsssdr_get_buffer_stats(&after);
+    EXPECT_LE(after.mapped_bytes, before.mapped_bytes);
+}
+
+
+TEST(VolkGnsssdrBufferTest, PlainBuffersWithoutPolicy)
+{
+    volk_gnsssdr_set_buffer_policy(0, 0);
+    volk_gnsssdr_buffer_stats_t before{};
+    volk_gnsssdr_get_buffer_stats(&before);
+    {
+        volk_gnsssdr::vector<std::complex<float>> small(100);
+        volk_gnsssdr::vector<float> large(VOLK_GNSSSDR_HUGEPAGE_SIZE / sizeof(float));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(small.data()) % 64, 0U);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(large.data()) % volk_gnsssdr_get_alignment(), 0U);
+    }
+    volk_gnsssdr_buffer_stats_t after{};
+    volk_gnsssdr_get_buffer_stats(&after);
+    EXPECT_EQ(after.allocations, before.allocations);
+    EXPECT_EQ(after.mapped_bytes, before.mapped_bytes);
+}
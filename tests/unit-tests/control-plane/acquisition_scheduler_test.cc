@@ -0,0 +1,209 @@
+/*!
+ * \file acquisition_scheduler_test.cc
+ * \brief Tests for the AcquisitionScheduler class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_scheduler.h"
+#include "gnss_frequencies.h"
+#include "rtklib_conversions.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <map>
+
+class AcquisitionSchedulerTest : public ::testing::Test
+{
+protected:
+    std::map<int, Gps_Ephemeris> gps_eph;
+    std::map<int, Galileo_Ephemeris> gal_eph;
+    std::map<int, Gps_Almanac> gps_alm;
+    std::map<int, Galileo_Almanac> gal_alm;
+    Monitor_Pvt pvt{};
+    std::array<double, 3> sat_pos{};
+    const uint32_t window_hz = 500;
+
+    void SetUp() override
+    {
+        Gps_Almanac alm;
+        alm.PRN = 1;
+        alm.toa = 345600;
+        alm.WNa = 2300;
+        alm.sqrtA = 5153.6;
+        alm.ecc = 0.01;
+        alm.delta_i = 0.0;
+        alm.OMEGA_0 = 0.5;
+        alm.omega = 0.2;
+        alm.M_0 = 0.1;
+        gps_alm[alm.PRN] = alm;
+
+        pvt.week = 2300;
+        pvt.RX_time = 345660.0;
+        gtime_t tow{};
+        tow.time = 345660;
+        const alm_t rtklib_alm = alm_to_rtklib(alm);
+        double clock_bias_s;
+        alm2pos(tow, &rtklib_alm, sat_pos.data(), &clock_bias_s);
+    }
+
+    // Places the receiver on the Earth surface, at the sub-satellite point or at its antipode
+    void set_receiver(double sign)
+    {
+        const double scale = sign * 6371000.0 / norm_rtk(sat_pos.data(), 3);
+        pvt.pos_x = sat_pos[0] * scale;
+        pvt.pos_y = sat_pos[1] * scale;
+        pvt.pos_z = sat_pos[2] * scale;
+    }
+};
+
+
+TEST_F(AcquisitionSchedulerTest, NoFixNoPrediction)
+{
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    pvt.RX_time = -1.0;
+    set_receiver(1.0);
+    ASSERT_FALSE(scheduler.needs_update(pvt));
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+
+    double doppler_hz = 0.0;
+    uint32_t doppler_window_hz = 0;
+    ASSERT_FALSE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    ASSERT_FALSE(scheduler.is_below_elevation_mask(Gnss_Satellite("GPS", 1)));
+    ASSERT_EQ(scheduler.get_number_of_predictions(), 0U);
+}
+
+
+TEST_F(AcquisitionSchedulerTest, SatelliteOverhead)
+{
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    set_receiver(1.0);
+    ASSERT_TRUE(scheduler.needs_update(pvt));
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    ASSERT_FALSE(scheduler.needs_update(pvt));
+    ASSERT_EQ(scheduler.get_number_of_predictions(), 1U);
+    ASSERT_EQ(scheduler.get_number_below_elevation_mask(), 0U);
+    ASSERT_FALSE(scheduler.is_below_elevation_mask(Gnss_Satellite("GPS", 1)));
+
+    double doppler_hz = 0.0;
+    uint32_t doppler_window_hz = 0;
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    // At zenith the line of sight is almost orthogonal to the satellite velocity
+    ASSERT_LT(std::abs(doppler_hz), 500.0);
+    // Almanac-based predictions get a wider window
+    ASSERT_GT(doppler_window_hz, window_hz);
+    ASSERT_LT(doppler_window_hz, 2 * window_hz);
+
+    // The same prediction, scaled to L5
+    double doppler_l5_hz = 0.0;
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "L5"), doppler_l5_hz, doppler_window_hz));
+    ASSERT_NEAR(doppler_l5_hz, doppler_hz * FREQ5 / FREQ1, 1e-6);
+
+    // No prediction for satellites without orbit data, or for unsupported signals
+    ASSERT_FALSE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 2), "1C"), doppler_hz, doppler_window_hz));
+    ASSERT_FALSE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("Glonass", 1), "1G"), doppler_hz, doppler_window_hz));
+}
+
+
+TEST_F(AcquisitionSchedulerTest, ClockDrift)
+{
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    set_receiver(1.0);
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    double doppler_hz = 0.0;
+    uint32_t doppler_window_hz = 0;
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+
+    pvt.user_clk_drift_ppm = 1.0;
+    pvt.RX_time += 0.001;  // same geometry
+    AcquisitionScheduler scheduler_drift(5.0, window_hz);
+    scheduler_drift.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    double doppler_drift_hz = 0.0;
+    ASSERT_TRUE(scheduler_drift.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_drift_hz, doppler_window_hz));
+    ASSERT_NEAR(doppler_drift_hz - doppler_hz, -FREQ1 * 1e-6, 1.0);
+}
+
+
+TEST_F(AcquisitionSchedulerTest, SatelliteBelowHorizon)
+{
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    set_receiver(-1.0);
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    ASSERT_EQ(scheduler.get_number_of_predictions(), 1U);
+    ASSERT_EQ(scheduler.get_number_below_elevation_mask(), 1U);
+    ASSERT_TRUE(scheduler.is_below_elevation_mask(Gnss_Satellite("GPS", 1)));
+    ASSERT_FALSE(scheduler.is_below_elevation_mask(Gnss_Satellite("Galileo", 1)));
+}
+
+
+TEST_F(AcquisitionSchedulerTest, AgesWithReceiverTime)
+{
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    set_receiver(1.0);
+    scheduler.set_receiver_time(100.0);
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    double doppler_hz = 0.0;
+    uint32_t doppler_window_hz = 0;
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    const uint32_t fresh_window_hz = doppler_window_hz;
+
+    // The window widens with the receiver time elapsed since the update
+    scheduler.set_receiver_time(200.0);
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    ASSERT_GE(doppler_window_hz, fresh_window_hz + 99);
+
+    // and the prediction is dropped after 10 minutes of receiver time
+    scheduler.set_receiver_time(100.0 + 601.0);
+    ASSERT_FALSE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    ASSERT_EQ(scheduler.get_number_of_predictions(), 0U);
+}
+
+
+TEST_F(AcquisitionSchedulerTest, AlmanacAcrossWeekRollover)
+{
+    // Almanac referenced 10 minutes before the end of week 2300, used 11
+    // minutes later, at the start of week 2301
+    Gps_Almanac& alm = gps_alm[1];
+    alm.toa = 604200;
+    const alm_t rtklib_alm = alm_to_rtklib(alm);
+    gtime_t tow{};
+    tow.time = 604200 + 660;
+    double clock_bias_s;
+    alm2pos(tow, &rtklib_alm, sat_pos.data(), &clock_bias_s);
+    pvt.week = 2301;
+    pvt.RX_time = 60.0;
+    set_receiver(1.0);
+
+    AcquisitionScheduler scheduler(5.0, window_hz);
+    scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    ASSERT_EQ(scheduler.get_number_of_predictions(), 1U);
+    ASSERT_FALSE(scheduler.is_below_elevation_mask(Gnss_Satellite("GPS", 1)));
+    double doppler_hz = 0.0;
+    uint32_t doppler_window_hz = 0;
+    ASSERT_TRUE(scheduler.get_doppler_window(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), doppler_hz, doppler_window_hz));
+    ASSERT_LT(std::abs(doppler_hz), 500.0);
+
+    // and the other way round, with an almanac of the next week
+    alm.toa = 300;
+    alm.WNa = 2301;
+    const alm_t next_rtklib_alm = alm_to_rtklib(alm);
+    tow.time = 300 - 360;
+    alm2pos(tow, &next_rtklib_alm, sat_pos.data(), &clock_bias_s);
+    pvt.week = 2300;
+    pvt.RX_time = 604800.0 - 360.0;
+    set_receiver(1.0);
+    AcquisitionScheduler next_scheduler(5.0, window_hz);
+    next_scheduler.update(pvt, gps_eph, gal_eph, gps_alm, gal_alm);
+    ASSERT_FALSE(next_scheduler.is_below_elevation_mask(Gnss_Satellite("GPS", 1)));
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file channel_affinity_balancer_test.cc
+ * \brief Tests for the ChannelAffinityBalancer class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "channel_affinity_balancer.h"
+#include <gtest/gtest.h>
+
+
+TEST(ChannelAffinityBalancerTest, RoundRobin)
+{
+    const ChannelAffinityBalancer balancer({2, 3, 4}, 7);
+    EXPECT_EQ(balancer.get_number_of_cores(), 3U);
+    for (size_t channel = 0; channel < 7; channel++)
+        {
+            EXPECT_EQ(balancer.get_core(channel), channel % 3);
+        }
+    EXPECT_EQ(balancer.get_cpu(0), 2);
+    EXPECT_EQ(balancer.get_cpu(2), 4);
+}
+
+
+TEST(ChannelAffinityBalancerTest, IdleCoreTakesChannels)
+{
+    // Channels 0 and 2 on core 0, channels 1 and 3 on core 1
+    ChannelAffinityBalancer balancer({0, 1}, 4, 0.1);
+    std::vector<double> busy_time_s(4, 0.0);
+    EXPECT_TRUE(balancer.balance(busy_time_s, 1.0).empty());
+
+    // Core 0 is busy 80% of the time, core 1 only 10%
+    busy_time_s = {0.5, 0.05, 0.3, 0.05};
+    const std::vector<size_t> moved = balancer.balance(busy_time_s, 1.0);
+    ASSERT_EQ(moved.size(), 1U);
+    // Moving channel 2 (0.3) leaves 0.5 / 0.4, moving channel 0 would leave 0.3 / 0.6
+    EXPECT_EQ(moved[0], 2U);
+    EXPECT_EQ(balancer.get_core(2), 1U);
+    EXPECT_NEAR(balancer.get_utilization()[0], 0.5, 1e-9);
+    EXPECT_NEAR(balancer.get_utilization()[1], 0.4, 1e-9);
+
+    // Loads are measured from the busy time increments
+    busy_time_s = {1.0, 0.1, 0.6, 0.1};
+    EXPECT_TRUE(balancer.balance(busy_time_s, 1.0).empty());
+    EXPECT_NEAR(balancer.get_utilization()[0], 0.5, 1e-9);
+    EXPECT_NEAR(balancer.get_utilization()[1], 0.4, 1e-9);
+}
+
+
+TEST(ChannelAffinityBalancerTest, HeavyChannelIsNotMoved)
+{
+    // A single channel heavier than the imbalance cannot reduce it
+    ChannelAffinityBalancer balancer({0, 1}, 2, 0.1);
+    balancer.balance({0.0, 0.0}, 1.0);
+    EXPECT_TRUE(balancer.balance({0.9, 0.0}, 1.0).empty());
+    EXPECT_EQ(balancer.get_core(0), 0U);
+}
+
+
+TEST(ChannelAffinityBalancerTest, OneMovePerCore)
+{
+    // Channels 0 and 3 on core 0, 1 and 4 on core 1, 2 and 5 on core 2
+    ChannelAffinityBalancer balancer({0, 1, 2}, 6, 0.1);
+    balancer.balance(std::vector<double>(6, 0.0), 1.0);
+
+    // After channel 0 or 3 moves to core 1, core 1 is the busiest one and
+    // core 2 the idlest, but core 1 has already taken a channel
+    const std::vector<size_t> moved = balancer.balance({0.45, 0.01, 0.01, 0.45, 0.01, 0.01}, 1.0);
+    ASSERT_EQ(moved.size(), 1U);
+    EXPECT_EQ(balancer.get_core(moved[0]), 1U);
+    EXPECT_EQ(balancer.get_core(1), 1U);
+    EXPECT_EQ(balancer.get_core(4), 1U);
+}
@@ -0,0 +1,88 @@
+/*!
+ * \file flowgraph_config_snapshot_test.cc
+ * \brief Tests for the FlowgraphConfigSnapshot and FlowgraphConfigSnapshotHolder classes.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "flowgraph_config_snapshot.h"
+#include "gnss_sdr_make_unique.h"
+#include "in_memory_configuration.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+
+TEST(FlowgraphConfigSnapshotTest, ReadsConfiguration)
+{
+    auto configuration = std::make_unique<InMemoryConfiguration>();
+    configuration->set_property("Channels_1C.count", "2");
+    configuration->set_property("Channels_5X.count", "1");
+    configuration->set_property("Channel1.satellite", "17");
+    configuration->set_property("GNSS-SDR.assist_dual_frequency_acq", "true");
+
+    const FlowgraphConfigSnapshot snapshot(configuration.get(), 3, false);
+    EXPECT_EQ(snapshot.channels_1C, 2);
+    EXPECT_EQ(snapshot.channels_5X, 1);
+    EXPECT_EQ(snapshot.channels_1B, 0);
+    EXPECT_TRUE(snapshot.assist_dual_frequency_acq);
+    EXPECT_EQ(snapshot.satellite(0), 0U);
+    EXPECT_EQ(snapshot.satellite(1), 17U);
+    EXPECT_EQ(snapshot.satellite(2), 0U);
+    EXPECT_EQ(snapshot.satellite(3), 0U);  // non-existent channel
+
+    const FlowgraphConfigSnapshot snapshot_multiband(std::make_unique<InMemoryConfiguration>().get(), 1, true);
+    EXPECT_TRUE(snapshot_multiband.assist_dual_frequency_acq);
+}
+
+
+TEST(FlowgraphConfigSnapshotTest, SetChannelSatellite)
+{
+    auto configuration = std::make_unique<InMemoryConfiguration>();
+    configuration->set_property("Channels_1C.count", "2");
+    FlowgraphConfigSnapshotHolder holder;
+    ASSERT_NE(holder.get(), nullptr);
+    EXPECT_EQ(holder.get()->satellite(0), 0U);
+
+    holder.publish(std::make_shared<const FlowgraphConfigSnapshot>(configuration.get(), 2, false));
+    const std::shared_ptr<const FlowgraphConfigSnapshot> old_snapshot = holder.get();
+    EXPECT_TRUE(holder.set_channel_satellite(1, 5));
+    EXPECT_FALSE(holder.set_channel_satellite(2, 5));
+
+    // The new snapshot is a copy of the previous one, which remains valid
+    const std::shared_ptr<const FlowgraphConfigSnapshot> new_snapshot = holder.get();
+    EXPECT_NE(new_snapshot, old_snapshot);
+    EXPECT_EQ(new_snapshot->satellite(1), 5U);
+    EXPECT_EQ(new_snapshot->channels_1C, 2);
+    EXPECT_EQ(old_snapshot->satellite(1), 0U);
+}
+
+
+TEST(FlowgraphConfigSnapshotTest, ReaderOutlivesManyPublications)
+{
+    auto configuration = std::make_unique<InMemoryConfiguration>();
+    configuration->set_property("Channel0.satellite", "3");
+    FlowgraphConfigSnapshotHolder holder;
+    holder.publish(std::make_shared<const FlowgraphConfigSnapshot>(configuration.get(), 2, false));
+    const std::shared_ptr<const FlowgraphConfigSnapshot> reader_snapshot = holder.get();
+    for (uint32_t i = 1; i <= 1000; i++)
+        {
+            ASSERT_TRUE(holder.set_channel_satellite(i % 2, i));
+            ASSERT_EQ(holder.get()->satellite(i % 2), i);
+        }
+    const std::shared_ptr<const FlowgraphConfigSnapshot> current = holder.get();
+    EXPECT_EQ(current->satellite(0), 1000U);
+    EXPECT_EQ(current->satellite(1), 999U);
+
+    // The snapshot held by the reader is still alive and unchanged
+    EXPECT_EQ(reader_snapshot->satellite(0), 3U);
+    EXPECT_EQ(reader_snapshot->satellite(1), 0U);
+    EXPECT_EQ(reader_snapshot.use_count(), 1);
+}
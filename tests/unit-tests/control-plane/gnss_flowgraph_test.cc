@@ -101,6 +101,51 @@ TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStop /*unused*/)
     EXPECT_FALSE(flowgraph->running());
 }
 
+
+TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStopArray /*unused*/)
+{
+    // The two RF channels of the source feed the two elements of a single
+    // array signal conditioner
+    std::shared_ptr<ConfigurationInterface> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
+    config->set_property("SignalSource.sampling_frequency", "4000000");
+    config->set_property("SignalSource.implementation", "Multichannel_File_Signal_Source");
+    config->set_property("SignalSource.item_type", "gr_complex");
+    config->set_property("SignalSource.repeat", "true");
+    config->set_property("SignalSource.total_channels", "2");
+    config->set_property("SignalSource.RF_channels", "2");
+    std::string path = std::string(TEST_PATH);
+    std::string filename = path + "signal_samples/Galileo_E1_ID_1_Fs_4Msps_8ms.dat";
+    config->set_property("SignalSource.filename0", filename);
+    config->set_property("SignalSource.filename1", std::move(filename));
+    config->set_property("SignalConditioner.implementation", "Array_Signal_Conditioner");
+    config->set_property("DataTypeAdapter.implementation", "Pass_Through");
+    config->set_property("InputFilter.implementation", "Beamformer_Filter");
+    config->set_property("InputFilter.channels", "2");
+    config->set_property("Resampler.implementation", "Pass_Through");
+    config->set_property("Channels_1C.count", "2");
+    config->set_property("Channels.in_acquisition", "1");
+    config->set_property("Channel.signal", "1C");
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.threshold", "1");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+
+    std::shared_ptr<GNSSFlowgraph> flowgraph = std::make_shared<GNSSFlowgraph>(config, std::make_shared<Concurrent_Queue<pmt::pmt_t>>());
+
+    EXPECT_NO_THROW(flowgraph->connect());
+    EXPECT_TRUE(flowgraph->connected());
+
+    // Start fails if an input of the beamformer, or another conditioner, is left unconnected
+    EXPECT_NO_THROW(flowgraph->start());
+    EXPECT_TRUE(flowgraph->running());
+    flowgraph->stop();
+    EXPECT_FALSE(flowgraph->running());
+}
+
 TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStopGalileoE1B /*unused*/)
 {
     std::shared_ptr<ConfigurationInterface> config = std::make_shared<InMemoryConfiguration>();
@@ -250,3 +295,60 @@ TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStopHybrid /*unused*/)
     flowgraph->stop();
     EXPECT_FALSE(flowgraph->running());
 }
+
+
+TEST(GNSSFlowgraph /*unused*/, SetChannelSatellite /*unused*/)
+{
+    std::shared_ptr<ConfigurationInterface> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
+    config->set_property("SignalSource.sampling_frequency", "4000000");
+    config->set_property("SignalSource.implementation", "File_Signal_Source");
+    config->set_property("SignalSource.item_type", "gr_complex");
+    config->set_property("SignalSource.repeat", "true");
+    std::string path = std::string(TEST_PATH);
+    std::string filename = path + "signal_samples/Galileo_E1_ID_1_Fs_4Msps_8ms.dat";
+    config->set_property("SignalSource.filename", std::move(filename));
+    config->set_property("SignalConditioner.implementation", "Pass_Through");
+    config->set_property("Channels_1C.count", "2");
+    config->set_property("Channels.in_acquisition", "1");
+    config->set_property("Channel.signal", "1C");
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.threshold", "1");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+
+    std::shared_ptr<GNSSFlowgraph> flowgraph = std::make_shared<GNSSFlowgraph>(config, std::make_shared<Concurrent_Queue<pmt::pmt_t>>());
+    ASSERT_NO_THROW(flowgraph->connect());
+    ASSERT_TRUE(flowgraph->connected());
+
+    // Channel 0 is acquiring, channel 1 is idle. Fix channel 1 to G07.
+    ASSERT_TRUE(flowgraph->set_channel_satellite(1, 7));
+    ASSERT_FALSE(flowgraph->set_channel_satellite(2, 7));
+
+    // Each failed acquisition starts the other channel. Channel 1 switches
+    // to G07 and keeps it, and channel 0 never gets it.
+    for (int i = 0; i < 64; i++)
+        {
+            flowgraph->apply_action(0, 0);  // ACQ FAILED in channel 0
+            EXPECT_EQ(flowgraph->get_channel_signal(1).get_satellite().get_PRN(), 7U);
+            EXPECT_EQ(flowgraph->get_channel_signal(1).get_signal_str(), "1C");
+            flowgraph->apply_action(1, 0);  // ACQ FAILED in channel 1
+            EXPECT_NE(flowgraph->get_channel_signal(0).get_satellite().get_PRN(), 7U);
+        }
+
+    // Back to searching: G07 is available again
+    ASSERT_TRUE(flowgraph->set_channel_satellite(1, 0));
+    bool g07_searched = false;
+    for (int i = 0; i < 64; i++)
+        {
+            flowgraph->apply_action(0, 0);
+            g07_searched = g07_searched || flowgraph->get_channel_signal(1).get_satellite().get_PRN() == 7U;
+            flowgraph->apply_action(1, 0);
+            g07_searched = g07_searched || flowgraph->get_channel_signal(0).get_satellite().get_PRN() == 7U;
+        }
+    EXPECT_TRUE(g07_searched);
+    flowgraph->disconnect();
+}
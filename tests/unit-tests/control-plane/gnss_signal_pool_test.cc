@@ -0,0 +1,100 @@
+/*!
+ * \file gnss_signal_pool_test.cc
+ * \brief Tests for the GnssSignalPool class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_pool.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+Gnss_Signal gps_l1(uint32_t prn)
+{
+    return Gnss_Signal(Gnss_Satellite("GPS", prn), "1C");
+}
+}  // namespace
+
+
+TEST(GnssSignalPoolTest, RoundRobin)
+{
+    GnssSignalPool pool;
+    Gnss_Signal gs;
+    EXPECT_TRUE(pool.empty());
+    EXPECT_FALSE(pool.next(gs));
+    for (uint32_t prn = 1; prn <= 3; prn++)
+        {
+            pool.push_back(gps_l1(prn));
+        }
+    pool.push_back(gps_l1(2));  // already queued: moves to the back
+    EXPECT_EQ(pool.size(), 3U);
+
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 1U);
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 3U);
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 2U);
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 1U);
+    EXPECT_EQ(gs.get_signal_str(), "1C");
+    EXPECT_EQ(pool.size(), 3U);
+}
+
+
+TEST(GnssSignalPoolTest, RemoveAndTake)
+{
+    GnssSignalPool pool;
+    for (uint32_t prn = 1; prn <= 4; prn++)
+        {
+            pool.push_back(gps_l1(prn));
+        }
+    EXPECT_TRUE(pool.remove(gps_l1(1)));
+    EXPECT_FALSE(pool.remove(gps_l1(1)));
+    EXPECT_FALSE(pool.remove(Gnss_Signal(Gnss_Satellite("Galileo", 2), "1C")));  // other system
+    EXPECT_FALSE(pool.contains(1));
+    EXPECT_TRUE(pool.contains(2));
+
+    Gnss_Signal gs;
+    EXPECT_TRUE(pool.take(3, gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 3U);
+    EXPECT_FALSE(pool.take(3, gs));
+    EXPECT_FALSE(pool.take(1000, gs));
+    EXPECT_EQ(pool.size(), 2U);
+
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 2U);
+    ASSERT_TRUE(pool.next(gs));
+    EXPECT_EQ(gs.get_satellite().get_PRN(), 4U);
+}
+
+
+TEST(GnssSignalPoolTest, MoveToFront)
+{
+    GnssSignalPool pool;
+    for (uint32_t prn = 1; prn <= 4; prn++)
+        {
+            pool.push_back(gps_l1(prn));
+        }
+    EXPECT_TRUE(pool.move_to_front(gps_l1(3)));
+    EXPECT_TRUE(pool.move_to_front(gps_l1(4)));
+    EXPECT_FALSE(pool.move_to_front(gps_l1(5)));  // not queued: not added
+    EXPECT_EQ(pool.size(), 4U);
+
+    Gnss_Signal gs;
+    const uint32_t expected[] = {4, 3, 1, 2};
+    for (const auto prn : expected)
+        {
+            ASSERT_TRUE(pool.next(gs));
+            EXPECT_EQ(gs.get_satellite().get_PRN(), prn);
+        }
+}
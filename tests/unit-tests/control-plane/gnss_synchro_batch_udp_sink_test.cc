@@ -0,0 +1,93 @@
+/*!
+ * \file gnss_synchro_batch_udp_sink_test.cc
+ * \brief Tests for the batched Gnss_Synchro UDP transport
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_batch_udp_sink.h"
+#include <boost/asio.hpp>
+#include <array>
+#include <vector>
+
+
+TEST(GnssSynchroBatchUdpSinkTest, BatchesAndDecodes)
+{
+#if USE_BOOST_ASIO_IO_CONTEXT
+    boost::asio::io_context io_context;
+#else
+    boost::asio::io_service io_context;
+#endif
+    boost::asio::ip::udp::socket receiver(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), 0));
+    const std::string port = std::to_string(receiver.local_endpoint().port());
+
+    const int n_objects = 100;
+    size_t records_per_datagram = 0;
+    {
+        Gnss_Synchro_Batch_Udp_Sink sink({"127.0.0.1"}, {port}, 1500, 5);
+        records_per_datagram = sink.records_per_datagram();
+        for (int i = 0; i < n_objects; i++)
+            {
+                Gnss_Synchro gs{};
+                gs.System = 'G';
+                gs.PRN = static_cast<uint32_t>(i);
+                gs.Channel_ID = i % 8;
+                sink.write_gnss_synchro(gs, static_cast<uint32_t>(i % 8));
+            }
+        EXPECT_EQ(sink.dropped(), 0U);
+    }  // the destructor flushes the pending objects
+
+    // A standard 1500-byte MTU fits several objects per datagram
+    EXPECT_GT(records_per_datagram, 1U);
+
+    std::vector<Gnss_Synchro> received;
+    std::array<char, 65536> buffer{};
+    boost::system::error_code error;
+    receiver.non_blocking(true);
+    int datagrams = 0;
+    while (received.size() < static_cast<size_t>(n_objects))
+        {
+            const size_t length = receiver.receive(boost::asio::buffer(buffer), 0, error);
+            if (error)
+                {
+                    break;
+                }
+            EXPECT_LE(length, 1500U);
+            EXPECT_TRUE(gnss_synchro_batch_decode(buffer.data(), length, received));
+            datagrams++;
+        }
+
+    ASSERT_EQ(received.size(), static_cast<size_t>(n_objects));
+    EXPECT_LT(datagrams, n_objects);
+    for (int i = 0; i < n_objects; i++)
+        {
+            EXPECT_EQ(received[i].System, 'G');
+            EXPECT_EQ(received[i].PRN, static_cast<uint32_t>(i));
+            EXPECT_EQ(received[i].Channel_ID, i % 8);
+        }
+}
+
+
+TEST(GnssSynchroBatchUdpSinkTest, RejectsMalformedDatagrams)
+{
+    std::vector<Gnss_Synchro> received;
+    std::array<char, 8> too_short{};
+    EXPECT_FALSE(gnss_synchro_batch_decode(too_short.data(), too_short.size(), received));
+
+    Gnss_Synchro_Batch_Header header{};
+    header.magic = GNSS_SYNCHRO_BATCH_MAGIC;
+    header.version = GNSS_SYNCHRO_BATCH_VERSION;
+    header.n_records = 2;
+    header.record_size = sizeof(Gnss_Synchro_Record);
+    // Announces two records but carries none
+    EXPECT_FALSE(gnss_synchro_batch_decode(reinterpret_cast<const char*>(&header), sizeof(header), received));
+    EXPECT_TRUE(received.empty());
+}
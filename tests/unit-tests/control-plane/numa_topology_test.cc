@@ -0,0 +1,64 @@
+/*!
+ * \file numa_topology_test.cc
+ * \brief Tests for the NumaTopology class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "numa_topology.h"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+TEST(NumaTopologyTest, ParseCpuList)
+{
+    EXPECT_EQ(NumaTopology::parse_cpu_list("0-3,8, 10-11"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(NumaTopology::parse_cpu_list("5,2,2"), std::vector<int>({2, 5}));
+    EXPECT_TRUE(NumaTopology::parse_cpu_list("").empty());
+    EXPECT_TRUE(NumaTopology::parse_cpu_list("1-x").empty());
+    EXPECT_TRUE(NumaTopology::parse_cpu_list("3-1").empty());
+}
+
+
+TEST(NumaTopologyTest, ReadFromSysfs)
+{
+    // Node 1 is missing, so node 2 keeps its number
+    const std::string dir("./numa_topology_test_nodes");
+    fs::create_directories(dir + "/node0");
+    fs::create_directories(dir + "/node2");
+    std::ofstream(dir + "/node0/cpulist") << "0-3,8-11\n";
+    std::ofstream(dir + "/node2/cpulist") << "4-7,12-15\n";
+
+    const NumaTopology topology = NumaTopology::from_sysfs(dir);
+    fs::remove_all(dir);
+    ASSERT_EQ(topology.get_number_of_nodes(), 3U);
+    EXPECT_EQ(topology.get_cpus(0), std::vector<int>({0, 1, 2, 3, 8, 9, 10, 11}));
+    EXPECT_TRUE(topology.get_cpus(1).empty());
+    EXPECT_EQ(topology.get_node({5, 6, 0}), 2);
+    EXPECT_EQ(topology.get_node({99}), -1);
+
+    // Without NUMA information, all the CPUs are on node 0
+    const NumaTopology single_node = NumaTopology::from_sysfs(dir);
+    EXPECT_EQ(single_node.get_number_of_nodes(), 1U);
+    EXPECT_EQ(single_node.get_node({0}), 0);
+}
+
+
+TEST(NumaTopologyTest, GroupsAreBalanced)
+{
+    const NumaTopology topology({{0, 1}, {}, {2, 3}});
+    // Heaviest group first, always on the least loaded node with CPUs
+    const std::vector<size_t> nodes = topology.assign_groups({3, 8, 2, 4});
+    EXPECT_EQ(nodes, std::vector<size_t>({2, 0, 2, 2}));
+}
@@ -0,0 +1,232 @@
+/*!
+ * \file acq_fixed_point_fft_test.cc
+ * \brief Tests for the block floating point FFT of the fixed-point
+ * acquisition, and comparison of its detection performance with the floating
+ * point correlation.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "acq_fixed_point_fft.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<std::complex<double>> naive_dft(const std::vector<std::complex<double>>& x, bool inverse)
+{
+    const size_t n = x.size();
+    std::vector<std::complex<double>> y(n);
+    const double sign = (inverse ? 1.0 : -1.0);
+    for (size_t k = 0; k < n; k++)
+        {
+            std::complex<double> sum(0.0, 0.0);
+            for (size_t i = 0; i < n; i++)
+                {
+                    sum += x[i] * std::polar(1.0, sign * TWO_PI * static_cast<double>((k * i) % n) / static_cast<double>(n));
+                }
+            y[k] = sum;
+        }
+    return y;
+}
+
+
+// 2-bit quantization of a noisy, delayed code, as delivered by a low-bit
+// front-end
+std::vector<std::complex<int16_t>> quantized_signal(const std::vector<float>& code, uint32_t delay, float amplitude, std::mt19937& generator)
+{
+    std::normal_distribution<float> noise(0.0, 1.0);
+    const auto quantize = [](float x) { return static_cast<int16_t>(x < -1.0F ? -3 : (x < 0.0F ? -1 : (x < 1.0F ? 1 : 3))); };
+    const size_t n = code.size();
+    std::vector<std::complex<int16_t>> signal(n);
+    for (size_t i = 0; i < n; i++)
+        {
+            const float value = amplitude * code[(i + n - delay) % n];
+            signal[i] = std::complex<int16_t>(quantize(value + noise(generator)), quantize(noise(generator)));
+        }
+    return signal;
+}
+}  // namespace
+
+
+TEST(AcqFixedPointFftTest, MatchesDft)
+{
+    const uint32_t size = 1024;
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int> level(-2, 1);
+    std::vector<std::complex<int16_t>> data(size);
+    std::vector<std::complex<double>> reference(size);
+    for (uint32_t i = 0; i < size; i++)
+        {
+            data[i] = std::complex<int16_t>(static_cast<int16_t>(2 * level(generator) + 1), static_cast<int16_t>(2 * level(generator) + 1));
+            reference[i] = std::complex<double>(data[i].real(), data[i].imag());
+        }
+
+    AcqFixedPointFft fft(size);
+    for (const bool inverse : {false, true})
+        {
+            std::vector<std::complex<int16_t>> transformed(data);
+            const int32_t exponent = (inverse ? fft.inverse(transformed.data()) : fft.forward(transformed.data()));
+            const std::vector<std::complex<double>> expected = naive_dft(reference, inverse);
+            double error = 0.0;
+            double power = 0.0;
+            for (uint32_t k = 0; k < size; k++)
+                {
+                    const std::complex<double> value(std::ldexp(transformed[k].real(), exponent), std::ldexp(transformed[k].imag(), exponent));
+                    error += std::norm(value - expected[k]);
+                    power += std::norm(expected[k]);
+                }
+            // about 60 dB of signal to quantization noise ratio
+            EXPECT_LT(std::sqrt(error / power), 2e-3);
+        }
+}
+
+
+TEST(AcqFixedPointFftTest, ScalingKeepsPrecision)
+{
+    const uint32_t size = 64;
+    AcqFixedPointFft fft(size);
+    // A large impulse and a small one must both be normalized to the full range
+    for (const int16_t amplitude : {static_cast<int16_t>(1), static_cast<int16_t>(30000)})
+        {
+            std::vector<std::complex<int16_t>> data(size, std::complex<int16_t>(0, 0));
+            data[3] = std::complex<int16_t>(amplitude, 0);
+            const int32_t exponent = fft.forward(data.data());
+            for (uint32_t k = 0; k < size; k++)
+                {
+                    const std::complex<double> value(std::ldexp(data[k].real(), exponent), std::ldexp(data[k].imag(), exponent));
+                    const std::complex<double> expected = static_cast<double>(amplitude) * std::polar(1.0, -TWO_PI * 3.0 * k / size);
+                    EXPECT_LT(std::abs(value - expected), 1e-3 * amplitude);
+                }
+        }
+}
+
+
+TEST(AcqFixedPointFftTest, ProductOfPeaksFits)
+{
+    // A tone concentrates the whole block in one bin of the spectrum, with
+    // both components close to the full range. The spectrum of the code has
+    // the opposite phase in that bin, so that the product is real and twice
+    // the product of the components.
+    const uint32_t size = 256;
+    std::vector<std::complex<int16_t>> buffer(size);
+    for (uint32_t i = 0; i < size; i++)
+        {
+            const std::complex<double> sample = std::polar(1000.0, TWO_PI * 5.0 * i / size + HALF_PI / 2.0);
+            buffer[i] = std::complex<int16_t>(static_cast<int16_t>(std::lround(sample.real())), static_cast<int16_t>(std::lround(sample.imag())));
+        }
+    AcqFixedPointFft fft(size);
+    int32_t exponent = fft.forward(buffer.data());
+    std::vector<std::complex<float>> spectrum(size);
+    for (uint32_t k = 0; k < size; k++)
+        {
+            spectrum[k] = 1.4F * std::conj(std::complex<float>(std::ldexp(static_cast<float>(buffer[k].real()), exponent), std::ldexp(static_cast<float>(buffer[k].imag()), exponent)));
+        }
+    std::vector<std::complex<int16_t>> codes(size);
+    const int32_t codes_exponent = fixed_point_quantize(codes.data(), spectrum.data(), size);
+    const double expected = std::norm(std::complex<double>(spectrum[5])) / 1.4;
+
+    exponent += fixed_point_normalize(buffer.data(), size);
+    fixed_point_multiply(buffer.data(), buffer.data(), codes.data(), size);
+    exponent += codes_exponent + 15;
+    const std::complex<double> product(std::ldexp(buffer[5].real(), exponent), std::ldexp(buffer[5].imag(), exponent));
+    EXPECT_NEAR(product.real(), expected, 1e-3 * expected);
+    EXPECT_NEAR(product.imag(), 0.0, 1e-3 * expected);
+}
+
+
+TEST(AcqFixedPointFftTest, ProductSaturates)
+{
+    const std::vector<std::complex<int16_t>> a(1, std::complex<int16_t>(32767, -32767));
+    const std::vector<std::complex<int16_t>> b(1, std::complex<int16_t>(32767, 32767));
+    std::vector<std::complex<int16_t>> out(1);
+    fixed_point_multiply(out.data(), a.data(), b.data(), 1);
+    EXPECT_EQ(out[0].real(), 32767);
+    EXPECT_EQ(out[0].imag(), 0);
+}
+
+
+TEST(AcqFixedPointFftTest, DetectionMatchesFloatingPoint)
+{
+    const uint32_t size = 2048;
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> chip(0, 1);
+    std::vector<float> code(size);
+    std::vector<std::complex<double>> code_double(size);
+    for (uint32_t i = 0; i < size; i++)
+        {
+            code[i] = (chip(generator) != 0 ? 1.0F : -1.0F);
+            code_double[i] = code[i];
+        }
+
+    // Conjugated spectrum of the local code, as in the acquisition block
+    const std::vector<std::complex<double>> code_spectrum = naive_dft(code_double, false);
+    std::vector<std::complex<float>> fft_codes(size);
+    std::transform(code_spectrum.begin(), code_spectrum.end(), fft_codes.begin(), [](const std::complex<double>& x) { return std::complex<float>(std::conj(x)); });
+    std::vector<std::complex<int16_t>> fixed_codes(size);
+    const int32_t codes_exponent = fixed_point_quantize(fixed_codes.data(), fft_codes.data(), size);
+
+    AcqFixedPointFft fft(size);
+    std::vector<std::complex<int16_t>> buffer(size);
+    std::vector<float> fixed_magnitude(size);
+    std::vector<float> float_magnitude(size);
+    int fixed_detections = 0;
+    int float_detections = 0;
+    const int trials = 20;
+    for (int trial = 0; trial < trials; trial++)
+        {
+            const uint32_t delay = 97U * static_cast<uint32_t>(trial) + 11U;
+            const std::vector<std::complex<int16_t>> signal = quantized_signal(code, delay, 0.11F, generator);
+
+            // Floating point circular correlation, scaled like the result of
+            // the unnormalized FFTs of the floating point path
+            for (uint32_t lag = 0; lag < size; lag++)
+                {
+                    std::complex<float> sum(0.0, 0.0);
+                    for (uint32_t i = 0; i < size; i++)
+                        {
+                            sum += std::complex<float>(signal[(i + lag) % size].real(), signal[(i + lag) % size].imag()) * code[i];
+                        }
+                    float_magnitude[lag] = std::norm(sum) * static_cast<float>(size) * static_cast<float>(size);
+                }
+
+            // Fixed-point correlation
+            std::copy(signal.begin(), signal.end(), buffer.begin());
+            int32_t exponent = fixed_point_normalize(buffer.data(), size);
+            exponent += fft.forward(buffer.data());
+            exponent += fixed_point_normalize(buffer.data(), size);
+            fixed_point_multiply(buffer.data(), buffer.data(), fixed_codes.data(), size);
+            exponent += codes_exponent + 15;
+            exponent += fft.inverse(buffer.data());
+            fixed_point_magnitude_squared(fixed_magnitude.data(), buffer.data(), size, exponent);
+
+            const auto float_peak = std::max_element(float_magnitude.begin(), float_magnitude.end());
+            const auto fixed_peak = std::max_element(fixed_magnitude.begin(), fixed_magnitude.end());
+            float_detections += (static_cast<uint32_t>(float_peak - float_magnitude.begin()) == delay ? 1 : 0);
+            fixed_detections += (static_cast<uint32_t>(fixed_peak - fixed_magnitude.begin()) == delay ? 1 : 0);
+
+            // Same scale and same peak to mean ratio, so that the thresholds
+            // of the floating point path apply
+            const float float_mean = std::accumulate(float_magnitude.begin(), float_magnitude.end(), 0.0F) / size;
+            const float fixed_mean = std::accumulate(fixed_magnitude.begin(), fixed_magnitude.end(), 0.0F) / size;
+            EXPECT_NEAR(fixed_mean, float_mean, 0.01 * float_mean);
+            EXPECT_NEAR(fixed_magnitude[delay] / fixed_mean, float_magnitude[delay] / float_mean, 0.02 * float_magnitude[delay] / float_mean);
+        }
+    EXPECT_GT(float_detections, trials / 4);
+    EXPECT_LT(float_detections, trials);
+    EXPECT_NEAR(fixed_detections, float_detections, 1);
+}
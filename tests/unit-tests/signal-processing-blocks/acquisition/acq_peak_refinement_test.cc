@@ -0,0 +1,67 @@
+/*!
+ * \file acq_peak_refinement_test.cc
+ * \brief Tests for the interpolation of the acquisition peak below the
+ * resolution of the search grid.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "acq_peak_refinement.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+
+TEST(AcqPeakRefinementTest, ParabolicPeakOffset)
+{
+    // Samples of y = 1 - (x - 0.3)^2 at x = -1, 0, 1
+    EXPECT_NEAR(parabolic_peak_offset(1.0F - 1.69F, 1.0F - 0.09F, 1.0F - 0.49F), 0.3F, 1e-5);
+    EXPECT_FLOAT_EQ(parabolic_peak_offset(0.5F, 1.0F, 0.5F), 0.0F);
+    // Not a maximum
+    EXPECT_FLOAT_EQ(parabolic_peak_offset(1.0F, 0.5F, 1.0F), 0.0F);
+    EXPECT_FLOAT_EQ(parabolic_peak_offset(0.2F, 0.5F, 0.8F), 0.0F);
+}
+
+
+TEST(AcqPeakRefinementTest, ResidualFrequency)
+{
+    const double fs = 4e6;
+    const uint32_t length = 4000;  // 1 ms
+    const double max_freq_hz = 250.0;
+    std::mt19937 generator(7);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    std::vector<std::complex<float>> signal(length);
+    for (const double freq : {-110.0, -37.0, 0.0, 12.5, 95.0})
+        {
+            for (uint32_t n = 0; n < length; n++)
+                {
+                    const double phase = TWO_PI * freq * static_cast<double>(n) / fs + 0.4;
+                    signal[n] = std::complex<float>(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))) +
+                                std::complex<float>(noise(generator), noise(generator));
+                }
+            double estimate = 0.0;
+            ASSERT_TRUE(estimate_residual_frequency(signal.data(), length, fs, max_freq_hz, estimate));
+            EXPECT_NEAR(estimate, freq, 40.0);
+        }
+
+    // A residual outside the search interval is rejected
+    for (uint32_t n = 0; n < length; n++)
+        {
+            const double phase = TWO_PI * 600.0 * static_cast<double>(n) / fs;
+            signal[n] = std::complex<float>(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+        }
+    double estimate = 0.0;
+    EXPECT_FALSE(estimate_residual_frequency(signal.data(), length, fs, max_freq_hz, estimate));
+    EXPECT_FALSE(estimate_residual_frequency(signal.data(), 8, fs, max_freq_hz, estimate));
+}
@@ -0,0 +1,65 @@
+/*!
+ * \file acq_quantized_grid_test.cc
+ * \brief Tests for the 16-bit acquisition magnitude grid.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_quantized_grid.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+TEST(AcqQuantizedGridTest, StoreAndAccumulate)
+{
+    const uint32_t rows = 3;
+    const uint32_t cols = 1000;
+    AcqQuantizedGrid grid(rows, cols);
+    std::mt19937 generator(11);
+    std::exponential_distribution<float> noise(1.0);
+
+    std::vector<float> reference(cols, 0.0);
+    std::vector<float> values(cols);
+    for (int dwell = 0; dwell < 4; dwell++)
+        {
+            std::generate(values.begin(), values.end(), [&]() { return noise(generator); });
+            values[123] += 50.0;
+            grid.store_row(1, values.data(), dwell > 0);
+            std::transform(reference.begin(), reference.end(), values.begin(), reference.begin(), std::plus<float>());
+        }
+
+    // Four accumulations, each one with a rounding error below half a step
+    const auto max_it = std::max_element(reference.begin(), reference.end());
+    const float tolerance = 4.0F * *max_it / 65535.0F;
+    const float sum = std::accumulate(reference.begin(), reference.end(), 0.0F);
+    EXPECT_EQ(grid.row_argmax(1), 123U);
+    EXPECT_NEAR(grid.row_max(1), *max_it, tolerance);
+    EXPECT_NEAR(grid.row_sum(1), sum, 1e-5 * sum);
+
+    std::vector<float> row(cols);
+    grid.get_row(1, row.data());
+    for (uint32_t i = 0; i < cols; i++)
+        {
+            EXPECT_NEAR(row[i], reference[i], tolerance);
+            EXPECT_FLOAT_EQ(grid.value(1, i), row[i]);
+        }
+
+    // Other rows are untouched
+    EXPECT_FLOAT_EQ(grid.row_max(0), 0.0);
+    EXPECT_FLOAT_EQ(grid.row_sum(2), 0.0);
+
+    grid.reset();
+    EXPECT_FLOAT_EQ(grid.row_max(1), 0.0);
+    EXPECT_FLOAT_EQ(grid.value(1, 123), 0.0);
+}
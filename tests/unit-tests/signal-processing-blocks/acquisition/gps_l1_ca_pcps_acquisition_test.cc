@@ -18,6 +18,7 @@
 
 
 #include "GPS_L1_CA.h"
+#include "acq_conf.h"
 #include "acquisition_dump_reader.h"
 #include "concurrent_queue.h"
 #include "gnss_block_interface.h"
@@ -26,7 +27,9 @@
 #include "gnss_synchro.h"
 #include "gnuplot_i.h"
 #include "gps_l1_ca_pcps_acquisition.h"
+#include "gps_sdr_signal_replica.h"
 #include "in_memory_configuration.h"
+#include "pcps_acquisition.h"
 #include "test_flags.h"
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/blocks/file_source.h>
@@ -34,9 +37,15 @@
 #include <gnuradio/top_block.h>
 #include <gtest/gtest.h>
 #include <pmt/pmt.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
 #include <memory>
+#include <random>
 #include <utility>
+#include <vector>
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -51,8 +60,10 @@
 
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
 #endif
 
 #if PMT_USES_BOOST_ANY
@@ -134,8 +145,10 @@ protected:
 
     void init();
     void plot_grid() const;
+    int acquire_cshort_signal(int32_t fs_in, uint32_t delay_samples, double doppler_hz);
 
     gr::top_block_sptr top_block;
+    pcps_acquisition_sptr acquisition_block;
     std::shared_ptr<InMemoryConfiguration> config;
     Gnss_Synchro gnss_synchro;
     size_t item_size;
@@ -252,6 +265,57 @@ void GpsL1CaPcpsAcquisitionTest::plot_grid() const
 }
 
 
+// Runs the acquisition on 10 ms of the signal of PRN 1, with the given code
+// delay and Doppler, in noise, as 16-bit complex samples at full scale.
+// Returns the message of the acquisition, and keeps the acquisition block
+// in acquisition_block.
+int GpsL1CaPcpsAcquisitionTest::acquire_cshort_signal(int32_t fs_in, uint32_t delay_samples, double doppler_hz)
+{
+    const auto samples_per_code = static_cast<uint32_t>(std::round(fs_in / (GPS_L1_CA_CODE_RATE_CPS / GPS_L1_CA_CODE_LENGTH_CHIPS)));
+    std::vector<std::complex<float>> code(samples_per_code);
+    gps_l1_ca_code_gen_complex_sampled(code, 1, fs_in, 0);
+    std::mt19937 generator(7);
+    std::normal_distribution<double> noise(0.0, 6000.0);
+    const uint32_t n_samples = 10 * samples_per_code;
+    std::vector<int16_t> samples(2 * n_samples);
+    for (uint32_t n = 0; n < n_samples; n++)
+        {
+            const std::complex<double> sample = 4000.0 * static_cast<double>(code[(n + samples_per_code - delay_samples) % samples_per_code].real()) * std::polar(1.0, TWO_PI * doppler_hz * n / fs_in) + std::complex<double>(noise(generator), noise(generator));
+            samples[2 * n] = static_cast<int16_t>(std::lround(std::max(-32768.0, std::min(32767.0, sample.real()))));
+            samples[2 * n + 1] = static_cast<int16_t>(std::lround(std::max(-32768.0, std::min(32767.0, sample.imag()))));
+        }
+
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_in));
+    config->set_property("Acquisition_1C.item_type", "cshort");
+    top_block = gr::make_top_block("Acquisition test");
+    auto acquisition = gnss_make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
+    auto msg_rx = GpsL1CaPcpsAcquisitionTest_msg_rx_make();
+    acquisition->set_channel(1);
+    acquisition->set_gnss_synchro(&gnss_synchro);
+    acquisition->set_threshold(0.001);
+    acquisition->set_doppler_max(doppler_max);
+    acquisition->set_doppler_step(doppler_step);
+    acquisition->connect(top_block);
+    // With 16-bit samples, the left block is the PCPS acquisition block itself
+#if GNURADIO_USES_STD_POINTERS
+    acquisition_block = std::dynamic_pointer_cast<pcps_acquisition>(acquisition->get_left_block());
+#else
+    acquisition_block = boost::dynamic_pointer_cast<pcps_acquisition>(acquisition->get_left_block());
+#endif
+
+    // Two shorts per item, so that the source delivers std::complex<short>
+    auto source = gr::blocks::vector_source_s::make(samples, false, 2);
+    top_block->connect(source, 0, acquisition->get_left_block(), 0);
+    top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+
+    acquisition->set_local_code();
+    acquisition->set_state(1);  // Ensure that acquisition starts at the first sample
+    acquisition->init();
+    top_block->run();
+    return msg_rx->rx_message;
+}
+
+
 TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, Instantiate /*unused*/)
 {
     std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
@@ -385,3 +449,142 @@ TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, ValidationOfResults /*unused*/)
             plot_grid();
         }
 }
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, DopplerWindowThreshold /*unused*/)
+{
+    init();
+    config->set_property("Acquisition_1C.pfa", "0.01");
+    Acq_Conf acq_parameters;
+    acq_parameters.ms_per_code = 1;
+    acq_parameters.SetFromConfiguration(config.get(), "Acquisition_1C", GPS_L1_CA_CODE_RATE_CPS, GPS_L1_CA_OPT_ACQ_FS_SPS);
+    auto acquisition = pcps_make_acquisition(acq_parameters);
+    acquisition->set_gnss_synchro(&gnss_synchro);
+    acquisition->init();
+    acquisition->start();
+    const float full_grid_threshold = acquisition->get_threshold();
+    ASSERT_GT(full_grid_threshold, 0.0);
+
+    // A narrower Doppler window has fewer cells, so the same Pfa gives a lower threshold
+    EXPECT_TRUE(acquisition->set_doppler_window(1000, doppler_max / 10));
+    EXPECT_LT(acquisition->get_threshold(), full_grid_threshold);
+
+    // Restoring the configured grid restores the threshold
+    EXPECT_TRUE(acquisition->set_doppler_window(0, doppler_max));
+    EXPECT_FLOAT_EQ(acquisition->get_threshold(), full_grid_threshold);
+}
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, FixedPointCshort /*unused*/)
+{
+    // 2048 samples per code period, so that the FFT size is a power of two
+    const int32_t fs_in = 2048000;
+    const uint32_t expected_delay_samples = 700;
+    const double expected_doppler_hz = -1200.0;
+    init();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_in));
+    config->set_property("Acquisition_1C.item_type", "cshort");
+    config->set_property("Acquisition_1C.fixed_point", "true");
+
+    // The configuration allows the fixed-point correlation
+    Acq_Conf acq_parameters;
+    acq_parameters.ms_per_code = 1;
+    acq_parameters.SetFromConfiguration(config.get(), "Acquisition_1C", GPS_L1_CA_CODE_RATE_CPS, GPS_L1_CA_OPT_ACQ_FS_SPS);
+    EXPECT_TRUE(pcps_make_acquisition(acq_parameters)->is_fixed_point());
+
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0);
+    EXPECT_LE(std::abs(expected_doppler_hz - gnss_synchro.Acq_doppler_hz), doppler_step);
+}
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, FoldingFactor /*unused*/)
+{
+    // 2048 samples per code period, folded into 1024. The delay is in the
+    // second half of the code period, so the folded peak at 476 samples has
+    // to be resolved by the verification with the full code.
+    const int32_t fs_in = 2048000;
+    const uint32_t expected_delay_samples = 1500;
+    const double expected_doppler_hz = 2300.0;
+    init();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_in));
+    config->set_property("Acquisition_1C.item_type", "cshort");
+    config->set_property("Acquisition_1C.pfa", "0.01");
+
+    // The folded grid has half the cells, so the same Pfa gives a lower threshold
+    Acq_Conf acq_parameters;
+    acq_parameters.ms_per_code = 1;
+    acq_parameters.SetFromConfiguration(config.get(), "Acquisition_1C", GPS_L1_CA_CODE_RATE_CPS, GPS_L1_CA_OPT_ACQ_FS_SPS);
+    auto unfolded_acquisition = pcps_make_acquisition(acq_parameters);
+    unfolded_acquisition->set_gnss_synchro(&gnss_synchro);
+    unfolded_acquisition->init();
+    unfolded_acquisition->start();
+    config->set_property("Acquisition_1C.folding_factor", "2");
+    acq_parameters.SetFromConfiguration(config.get(), "Acquisition_1C", GPS_L1_CA_CODE_RATE_CPS, GPS_L1_CA_OPT_ACQ_FS_SPS);
+    ASSERT_EQ(acq_parameters.folding_factor, 2U);
+    auto folded_acquisition = pcps_make_acquisition(acq_parameters);
+    folded_acquisition->set_gnss_synchro(&gnss_synchro);
+    folded_acquisition->init();
+    folded_acquisition->start();
+    EXPECT_LT(folded_acquisition->get_threshold(), unfolded_acquisition->get_threshold());
+
+    EXPECT_GT(folded_acquisition->get_verification_threshold(), 0.0);
+
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0);
+    EXPECT_LE(std::abs(expected_doppler_hz - gnss_synchro.Acq_doppler_hz), doppler_step);
+
+    // The statistic has a mean of 2 for a lag with noise only, and of about
+    // twice the post-correlation SNR for the lag of the signal. Here the SNR
+    // is 2048 * 4000^2 / (2 * 6000^2), about 455.
+    ASSERT_NE(acquisition_block, nullptr);
+    const float verification_statistic = acquisition_block->get_verification_statistic();
+    EXPECT_GT(verification_statistic, acquisition_block->get_verification_threshold());
+    EXPECT_GT(verification_statistic, 300.0);
+    EXPECT_LT(verification_statistic, 3000.0);
+}
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, FoldingFactorWithoutPfa /*unused*/)
+{
+    // The folded peak is also verified when the threshold is set directly
+    const int32_t fs_in = 2048000;
+    const uint32_t expected_delay_samples = 1500;
+    const double expected_doppler_hz = 2300.0;
+    init();
+    config->set_property("Acquisition_1C.folding_factor", "2");
+
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0);
+    ASSERT_NE(acquisition_block, nullptr);
+    EXPECT_GT(acquisition_block->get_verification_threshold(), 0.0);
+    EXPECT_GT(acquisition_block->get_verification_statistic(), acquisition_block->get_verification_threshold());
+}
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, LowMemory /*unused*/)
+{
+    const int32_t fs_in = 2048000;
+    const uint32_t expected_delay_samples = 1100;
+    const double expected_doppler_hz = -3400.0;
+    init();
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    const double full_grid_delay_samples = gnss_synchro.Acq_delay_samples;
+    const double full_grid_doppler_hz = gnss_synchro.Acq_doppler_hz;
+
+    // The 16-bit grid and the wipeoffs generated on the fly find the same cell
+    config->set_property("Acquisition_1C.low_memory", "true");
+    gnss_synchro.Acq_delay_samples = 0.0;
+    gnss_synchro.Acq_doppler_hz = 0.0;
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0);
+    EXPECT_LE(std::abs(expected_doppler_hz - gnss_synchro.Acq_doppler_hz), doppler_step);
+    EXPECT_DOUBLE_EQ(gnss_synchro.Acq_delay_samples, full_grid_delay_samples);
+    EXPECT_DOUBLE_EQ(gnss_synchro.Acq_doppler_hz, full_grid_doppler_hz);
+
+    // Two non-coherent dwells accumulate in the 16-bit grid
+    config->set_property("Acquisition_1C.max_dwells", "2");
+    ASSERT_EQ(1, acquire_cshort_signal(fs_in, expected_delay_samples, expected_doppler_hz)) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+    EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0);
+    EXPECT_LE(std::abs(expected_doppler_hz - gnss_synchro.Acq_doppler_hz), doppler_step);
+}
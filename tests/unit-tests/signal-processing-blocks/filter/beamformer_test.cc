@@ -0,0 +1,122 @@
+/*!
+ * \file beamformer_test.cc
+ * \brief Implements unit tests for the fixed and adaptive weights of the
+ * beamformer block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beamformer.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+namespace
+{
+constexpr int BEAMFORMER_TEST_ELEMENTS = 4;
+constexpr int BEAMFORMER_TEST_SAMPLES = 20000;
+
+// Samples of the array elements with a signal from the zenith (same phase in
+// all the elements), a strong interference from another direction, and noise
+std::vector<std::vector<gr_complex>> array_samples(std::vector<gr_complex>& signal)
+{
+    std::mt19937 generator(1);
+    std::normal_distribution<float> noise(0.0, 0.1 / std::sqrt(2.0));
+    std::vector<std::vector<gr_complex>> samples(BEAMFORMER_TEST_ELEMENTS, std::vector<gr_complex>(BEAMFORMER_TEST_SAMPLES));
+    signal.resize(BEAMFORMER_TEST_SAMPLES);
+    for (int n = 0; n < BEAMFORMER_TEST_SAMPLES; n++)
+        {
+            signal[n] = std::polar(1.0F, static_cast<float>(2.0 * M_PI * 0.002 * n));
+            const gr_complex interference = std::polar(100.0F, static_cast<float>(2.0 * M_PI * 0.013 * n));
+            for (int element = 0; element < BEAMFORMER_TEST_ELEMENTS; element++)
+                {
+                    samples[element][n] = signal[n] + interference * std::polar(1.0F, static_cast<float>(M_PI * 0.7 * element)) + gr_complex(noise(generator), noise(generator));
+                }
+        }
+    return samples;
+}
+
+
+std::vector<gr_complex> run_beamformer(const std::vector<std::vector<gr_complex>>& samples, Beamformer_Algorithm algorithm)
+{
+    auto top_block = gr::make_top_block("BeamformerTest");
+    auto beamformer_block = make_beamformer_sptr(BEAMFORMER_TEST_ELEMENTS, algorithm, 1000, 4000, 1e-4);
+    auto sink = gr::blocks::vector_sink_c::make();
+    for (int element = 0; element < BEAMFORMER_TEST_ELEMENTS; element++)
+        {
+            top_block->connect(gr::blocks::vector_source_c::make(samples[element]), 0, beamformer_block, element);
+        }
+    top_block->connect(beamformer_block, 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+}  // namespace
+
+
+TEST(BeamformerTest, FixedWeightsAddElements)
+{
+    std::vector<gr_complex> signal;
+    const auto samples = array_samples(signal);
+    const auto output = run_beamformer(samples, Beamformer_Algorithm::Fixed);
+    ASSERT_EQ(output.size(), static_cast<size_t>(BEAMFORMER_TEST_SAMPLES));
+    for (int n = 0; n < BEAMFORMER_TEST_SAMPLES; n += 97)
+        {
+            gr_complex sum(0.0, 0.0);
+            for (int element = 0; element < BEAMFORMER_TEST_ELEMENTS; element++)
+                {
+                    sum += samples[element][n];
+                }
+            EXPECT_NEAR(std::abs(output[n] - sum), 0.0, 1e-3);
+        }
+}
+
+
+TEST(BeamformerTest, PowerInversionNullsInterference)
+{
+    std::vector<gr_complex> signal;
+    const auto samples = array_samples(signal);
+    const auto output = run_beamformer(samples, Beamformer_Algorithm::Power_Inversion);
+    ASSERT_EQ(output.size(), static_cast<size_t>(BEAMFORMER_TEST_SAMPLES));
+    // Input power of 10000 at each element, mostly from the interference
+    double power = 0.0;
+    for (int n = BEAMFORMER_TEST_SAMPLES / 2; n < BEAMFORMER_TEST_SAMPLES; n++)
+        {
+            power += std::norm(output[n]);
+        }
+    EXPECT_LT(power / (BEAMFORMER_TEST_SAMPLES / 2), 1.0);
+}
+
+
+TEST(BeamformerTest, MvdrKeepsZenithSignal)
+{
+    std::vector<gr_complex> signal;
+    const auto samples = array_samples(signal);
+    const auto output = run_beamformer(samples, Beamformer_Algorithm::MVDR);
+    ASSERT_EQ(output.size(), static_cast<size_t>(BEAMFORMER_TEST_SAMPLES));
+    double error_power = 0.0;
+    for (int n = BEAMFORMER_TEST_SAMPLES / 2; n < BEAMFORMER_TEST_SAMPLES; n++)
+        {
+            error_power += std::norm(output[n] - signal[n]);
+        }
+    EXPECT_LT(error_power / (BEAMFORMER_TEST_SAMPLES / 2), 0.05);
+}
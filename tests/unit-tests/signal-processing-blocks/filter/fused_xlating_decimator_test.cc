@@ -0,0 +1,252 @@
+/*!
+ * \file fused_xlating_decimator_test.cc
+ * \brief Implements unit tests for the fused data type conversion, frequency
+ * translation and decimation block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "freq_xlating_fir_filter.h"
+#include "fused_signal_conditioner.h"
+#include "fused_xlating_decimator.h"
+#include "ibyte_to_complex.h"
+#include "in_memory_configuration.h"
+#include "ishort_to_complex.h"
+#include "tone_fit.h"
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_sink_s.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+
+namespace
+{
+constexpr double FUSED_TEST_FS = 8e6;
+constexpr double FUSED_TEST_IF = 1.5e6;
+constexpr int FUSED_TEST_DECIMATION = 4;
+constexpr int FUSED_TEST_OUTPUTS = 20000;
+
+
+// Interleaved I and Q of a tone 100 kHz above the IF, and of a tone 1 MHz
+// below the IF that must be filtered out. With an inverted spectrum, the
+// tones are mirrored.
+template <typename T>
+std::vector<T> two_tones(double amplitude, bool inverted_spectrum)
+{
+    const int nsamples = FUSED_TEST_OUTPUTS * FUSED_TEST_DECIMATION;
+    std::vector<T> input(2 * nsamples);
+    for (int n = 0; n < nsamples; n++)
+        {
+            std::complex<double> sample = std::polar(amplitude, 2.0 * M_PI * (FUSED_TEST_IF + 1e5) * n / FUSED_TEST_FS) +
+                                          std::polar(amplitude, 2.0 * M_PI * (FUSED_TEST_IF - 1e6) * n / FUSED_TEST_FS);
+            if (inverted_spectrum)
+                {
+                    sample = std::conj(sample);
+                }
+            input[2 * n] = static_cast<T>(std::lround(sample.real()));
+            input[2 * n + 1] = static_cast<T>(std::lround(sample.imag()));
+        }
+    return input;
+}
+
+
+std::shared_ptr<InMemoryConfiguration> make_configuration(const std::string& data_type_adapter, bool inverted_spectrum, const std::string& output_item_type)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("DataTypeAdapter.implementation", data_type_adapter);
+    config->set_property("DataTypeAdapter.inverted_spectrum", inverted_spectrum ? "true" : "false");
+    config->set_property("InputFilter.input_item_type", "gr_complex");
+    config->set_property("InputFilter.output_item_type", output_item_type);
+    config->set_property("InputFilter.taps_item_type", "float");
+    config->set_property("InputFilter.filter_type", "lowpass");
+    config->set_property("InputFilter.bw", "400000");
+    config->set_property("InputFilter.tw", "200000");
+    config->set_property("InputFilter.IF", std::to_string(FUSED_TEST_IF));
+    config->set_property("InputFilter.sampling_frequency", std::to_string(FUSED_TEST_FS));
+    config->set_property("InputFilter.decimation_factor", std::to_string(FUSED_TEST_DECIMATION));
+    return config;
+}
+
+
+gr::basic_block_sptr make_source(const std::vector<int16_t>& input)
+{
+    return gr::blocks::vector_source_s::make(input);
+}
+
+
+gr::basic_block_sptr make_source(const std::vector<int8_t>& input)
+{
+    return gr::blocks::vector_source_b::make(std::vector<unsigned char>(input.cbegin(), input.cend()));
+}
+
+
+// Output of the Ishort_To_Complex or Ibyte_To_Complex data type adapter
+// followed by the Freq_Xlating_Fir_Filter input filter
+template <typename T>
+std::vector<gr_complex> run_reference_chain(const std::vector<T>& input, const std::string& data_type_adapter, bool inverted_spectrum)
+{
+    const auto config = make_configuration(data_type_adapter, inverted_spectrum, "gr_complex");
+    std::shared_ptr<GNSSBlockInterface> adapter;
+    if (data_type_adapter == "Ibyte_To_Complex")
+        {
+            adapter = std::make_shared<IbyteToComplex>(config.get(), "DataTypeAdapter", 1, 1);
+        }
+    else
+        {
+            adapter = std::make_shared<IshortToComplex>(config.get(), "DataTypeAdapter", 1, 1);
+        }
+    auto filter = std::make_shared<FreqXlatingFirFilter>(config.get(), "InputFilter", 1, 1);
+    auto top_block = gr::make_top_block("FusedXlatingDecimatorReference");
+    auto sink = gr::blocks::vector_sink_c::make();
+    adapter->connect(top_block);
+    filter->connect(top_block);
+    top_block->connect(make_source(input), 0, adapter->get_left_block(), 0);
+    top_block->connect(adapter->get_right_block(), 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+// Output of the Fused_Signal_Conditioner configured with the same options
+template <typename T>
+std::vector<gr_complex> run_fused_conditioner(const std::vector<T>& input, const std::string& data_type_adapter, bool inverted_spectrum, const std::string& output_item_type)
+{
+    const auto config = make_configuration(data_type_adapter, inverted_spectrum, output_item_type);
+    auto conditioner = std::make_shared<FusedSignalConditioner>(config.get(), nullptr, "SignalConditioner", "DataTypeAdapter", "InputFilter");
+    auto top_block = gr::make_top_block("FusedXlatingDecimatorFused");
+    conditioner->connect(top_block);
+    top_block->connect(make_source(input), 0, conditioner->get_left_block(), 0);
+    if (output_item_type == "cshort")
+        {
+            auto sink = gr::blocks::vector_sink_s::make(2);
+            top_block->connect(conditioner->get_right_block(), 0, sink, 0);
+            top_block->run();
+            const std::vector<int16_t> output = sink->data();
+            std::vector<gr_complex> output_complex(output.size() / 2);
+            for (size_t m = 0; m < output_complex.size(); m++)
+                {
+                    output_complex[m] = gr_complex(output[2 * m], output[2 * m + 1]);
+                }
+            return output_complex;
+        }
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(conditioner->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+// Largest difference between the fused and the reference outputs, relative
+// to the amplitude of the tone. They only differ by the float rounding of
+// the filter and of the NCO.
+double max_relative_error(const std::vector<gr_complex>& fused, const std::vector<gr_complex>& reference, double amplitude)
+{
+    double max_error = 0.0;
+    for (size_t m = 0; m < std::min(fused.size(), reference.size()); m++)
+        {
+            max_error = std::max(max_error, static_cast<double>(std::abs(fused[m] - reference[m])));
+        }
+    return max_error / amplitude;
+}
+}  // namespace
+
+
+TEST(FusedXlatingDecimatorTest, TranslatesAndDecimates)
+{
+    const double fs_out = FUSED_TEST_FS / FUSED_TEST_DECIMATION;
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, FUSED_TEST_FS, 0.4e6, 0.2e6);
+    const std::vector<int16_t> input = two_tones<int16_t>(100.0, false);
+
+    auto top_block = gr::make_top_block("FusedXlatingDecimatorTest");
+    auto fused = make_fused_xlating_decimator(sizeof(int16_t), sizeof(gr_complex), FUSED_TEST_DECIMATION, taps, FUSED_TEST_IF, FUSED_TEST_FS, false);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(gr::blocks::vector_source_s::make(input), 0, fused, 0);
+    top_block->connect(fused, 0, sink, 0);
+    top_block->run();
+
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), static_cast<size_t>(FUSED_TEST_OUTPUTS / 2));
+
+    // The tone is at 100 kHz in the output, and nothing else is left
+    double residual_power = 0.0;
+    const auto amplitude = fit_tone(output, 1e5, fs_out, taps.size(), &residual_power);
+    EXPECT_NEAR(std::abs(amplitude), 100.0, 1.0);
+    EXPECT_LT(residual_power, 0.5);
+}
+
+
+TEST(FusedXlatingDecimatorTest, MatchesIshortToComplexAndFreqXlatingFirFilter)
+{
+    const std::vector<int16_t> input = two_tones<int16_t>(1000.0, false);
+    const std::vector<gr_complex> reference = run_reference_chain(input, "Ishort_To_Complex", false);
+    const std::vector<gr_complex> fused = run_fused_conditioner(input, "Ishort_To_Complex", false, "gr_complex");
+    ASSERT_EQ(fused.size(), reference.size());
+    ASSERT_GT(fused.size(), static_cast<size_t>(FUSED_TEST_OUTPUTS / 2));
+    EXPECT_LT(max_relative_error(fused, reference, 1000.0), 1e-3);
+}
+
+
+TEST(FusedXlatingDecimatorTest, MatchesIbyteToComplexAndFreqXlatingFirFilter)
+{
+    const std::vector<int8_t> input = two_tones<int8_t>(50.0, false);
+    const std::vector<gr_complex> reference = run_reference_chain(input, "Ibyte_To_Complex", false);
+    const std::vector<gr_complex> fused = run_fused_conditioner(input, "Ibyte_To_Complex", false, "gr_complex");
+    ASSERT_EQ(fused.size(), reference.size());
+    ASSERT_GT(fused.size(), static_cast<size_t>(FUSED_TEST_OUTPUTS / 2));
+    EXPECT_LT(max_relative_error(fused, reference, 50.0), 1e-3);
+}
+
+
+TEST(FusedXlatingDecimatorTest, InvertedSpectrum)
+{
+    const double fs_out = FUSED_TEST_FS / FUSED_TEST_DECIMATION;
+    const std::vector<int16_t> input = two_tones<int16_t>(1000.0, true);
+    const std::vector<gr_complex> reference = run_reference_chain(input, "Ishort_To_Complex", true);
+    const std::vector<gr_complex> fused = run_fused_conditioner(input, "Ishort_To_Complex", true, "gr_complex");
+    ASSERT_EQ(fused.size(), reference.size());
+    EXPECT_LT(max_relative_error(fused, reference, 1000.0), 1e-3);
+
+    // The mirrored tone is back at 100 kHz
+    EXPECT_NEAR(std::abs(fit_tone(fused, 1e5, fs_out, 100)), 1000.0, 10.0);
+}
+
+
+TEST(FusedXlatingDecimatorTest, CshortOutput)
+{
+    const std::vector<int16_t> input = two_tones<int16_t>(1000.0, false);
+    const std::vector<gr_complex> reference = run_reference_chain(input, "Ishort_To_Complex", false);
+    const std::vector<gr_complex> fused = run_fused_conditioner(input, "Ishort_To_Complex", false, "cshort");
+    ASSERT_EQ(fused.size(), reference.size());
+    ASSERT_GT(fused.size(), static_cast<size_t>(FUSED_TEST_OUTPUTS / 2));
+
+    // Rounded to the nearest integer
+    for (size_t m = 0; m < fused.size(); m++)
+        {
+            EXPECT_LE(std::abs(fused[m].real() - reference[m].real()), 0.5F + 1e-2F) << "at sample " << m;
+            EXPECT_LE(std::abs(fused[m].imag() - reference[m].imag()), 0.5F + 1e-2F) << "at sample " << m;
+        }
+}
@@ -0,0 +1,137 @@
+/*!
+ * \file pfb_channelizer_test.cc
+ * \brief Implements unit tests for the polyphase filter bank channelizer.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "in_memory_configuration.h"
+#include "pfb_channelizer_cc.h"
+#include "pfb_channelizer_filter.h"
+#include "tone_fit.h"
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+namespace
+{
+constexpr double CHANNELIZER_TEST_FS = 4e6;
+constexpr int CHANNELIZER_TEST_CHANNELS = 8;
+constexpr int CHANNELIZER_TEST_DECIMATION = 4;
+constexpr int CHANNELIZER_TEST_SAMPLES = 80000;
+constexpr int CHANNELIZER_TEST_TRANSIENT = 200;
+
+
+// Mean power of the output of a band, after the filter transient
+double mean_power(const std::vector<gr_complex>& output)
+{
+    double power = 0.0;
+    for (size_t m = CHANNELIZER_TEST_TRANSIENT; m < output.size(); m++)
+        {
+            power += std::norm(output[m]);
+        }
+    return power / static_cast<double>(output.size() - CHANNELIZER_TEST_TRANSIENT);
+}
+}  // namespace
+
+
+TEST(PfbChannelizerTest, ExtractsBandsAtArbitraryFrequencies)
+{
+    const double fs_out = CHANNELIZER_TEST_FS / CHANNELIZER_TEST_DECIMATION;
+    // Band 0 is not centered in a channel of the filter bank (residual of 20 kHz)
+    const std::vector<double> band_if = {1.02e6, -1.5e6};
+
+    // Tone of amplitude 1 at 100 kHz above band 0, tone of amplitude 0.5 at
+    // 100 kHz below band 1, and a tone of amplitude 1 at DC, out of both bands
+    std::vector<gr_complex> input(CHANNELIZER_TEST_SAMPLES);
+    for (int n = 0; n < CHANNELIZER_TEST_SAMPLES; n++)
+        {
+            const double t = static_cast<double>(n) / CHANNELIZER_TEST_FS;
+            input[n] = std::polar(1.0F, static_cast<float>(2.0 * M_PI * 1.12e6 * t)) +
+                       std::polar(0.5F, static_cast<float>(2.0 * M_PI * -1.6e6 * t)) +
+                       gr_complex(1.0, 0.0);
+        }
+
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, CHANNELIZER_TEST_FS, 0.45 * fs_out, 0.1 * fs_out);
+    auto top_block = gr::make_top_block("PfbChannelizerTest");
+    auto channelizer = make_pfb_channelizer_cc(CHANNELIZER_TEST_CHANNELS, CHANNELIZER_TEST_DECIMATION, taps, band_if, CHANNELIZER_TEST_FS);
+    auto sink0 = gr::blocks::vector_sink_c::make();
+    auto sink1 = gr::blocks::vector_sink_c::make();
+    top_block->connect(gr::blocks::vector_source_c::make(input), 0, channelizer, 0);
+    top_block->connect(channelizer, 0, sink0, 0);
+    top_block->connect(channelizer, 1, sink1, 0);
+    top_block->run();
+
+    const std::vector<gr_complex> band0 = sink0->data();
+    const std::vector<gr_complex> band1 = sink1->data();
+    ASSERT_GT(band0.size(), static_cast<size_t>(10 * CHANNELIZER_TEST_TRANSIENT));
+    ASSERT_EQ(band0.size(), band1.size());
+
+    EXPECT_NEAR(std::abs(fit_tone(band0, 1e5, fs_out, CHANNELIZER_TEST_TRANSIENT)), 1.0, 0.02);
+    EXPECT_NEAR(mean_power(band0), 1.0, 0.02);
+    EXPECT_NEAR(std::abs(fit_tone(band1, -1e5, fs_out, CHANNELIZER_TEST_TRANSIENT)), 0.5, 0.01);
+    EXPECT_NEAR(mean_power(band1), 0.25, 0.01);
+}
+
+
+TEST(PfbChannelizerTest, KeepsBandsBetweenChannels)
+{
+    // Band centered between the channels at 1 MHz and 1.5 MHz, where a
+    // critically sampled bank would cut off one side of the band
+    const double band_if = 1.25e6;
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("InputFilter.sampling_frequency", std::to_string(CHANNELIZER_TEST_FS));
+    config->set_property("InputFilter.channels", std::to_string(CHANNELIZER_TEST_CHANNELS));
+    config->set_property("InputFilter.bands", "1");
+    config->set_property("InputFilter.band0_IF", std::to_string(band_if));
+    auto filter = std::make_shared<PfbChannelizerFilter>(config.get(), "InputFilter", 1, 1);
+    ASSERT_EQ(filter->bands(), 1);
+
+    // Tones of amplitude 1 at 180 kHz on both sides of the band center, and a
+    // tone of amplitude 1 at DC, out of the band
+    std::vector<gr_complex> input(CHANNELIZER_TEST_SAMPLES);
+    for (int n = 0; n < CHANNELIZER_TEST_SAMPLES; n++)
+        {
+            const double t = static_cast<double>(n) / CHANNELIZER_TEST_FS;
+            input[n] = std::polar(1.0F, static_cast<float>(2.0 * M_PI * (band_if - 1.8e5) * t)) +
+                       std::polar(1.0F, static_cast<float>(2.0 * M_PI * (band_if + 1.8e5) * t)) +
+                       gr_complex(1.0, 0.0);
+        }
+
+    auto top_block = gr::make_top_block("PfbChannelizerTest");
+    auto sink = gr::blocks::vector_sink_c::make();
+    filter->connect(top_block);
+    top_block->connect(gr::blocks::vector_source_c::make(input), 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+    top_block->run();
+
+    // The default decimation factor is half the number of channels
+    const double fs_out = 2.0 * CHANNELIZER_TEST_FS / CHANNELIZER_TEST_CHANNELS;
+    const std::vector<gr_complex> band = sink->data();
+    ASSERT_NEAR(static_cast<double>(band.size()), CHANNELIZER_TEST_SAMPLES * fs_out / CHANNELIZER_TEST_FS, 1.0);
+
+    EXPECT_NEAR(std::abs(fit_tone(band, -1.8e5, fs_out, CHANNELIZER_TEST_TRANSIENT)), 1.0, 0.02);
+    EXPECT_NEAR(std::abs(fit_tone(band, 1.8e5, fs_out, CHANNELIZER_TEST_TRANSIENT)), 1.0, 0.02);
+    EXPECT_NEAR(mean_power(band), 2.0, 0.05);
+}
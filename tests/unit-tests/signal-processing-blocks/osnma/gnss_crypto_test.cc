@@ -266,6 +266,74 @@ TEST(GnssCryptoTest, TestComputeCMAC_AES)
 }
 
 
+TEST(GnssCryptoTest, TestComputeCMAC_AESBatch)
+{
+    // Tests vectors from https://datatracker.ietf.org/doc/html/rfc4493#appendix-A
+    auto d_crypto = std::make_unique<Gnss_Crypto>();
+
+    std::vector<uint8_t> key = {
+        0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6,
+        0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+
+    std::vector<uint8_t> message{
+        0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+        0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+        0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+        0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+        0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+        0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+        0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17,
+        0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10};
+
+    std::vector<std::vector<uint8_t>> messages{
+        std::vector<uint8_t>(message.begin(), message.begin() + 16),
+        std::vector<uint8_t>(message.begin(), message.begin() + 40),
+        message};
+
+    std::vector<std::vector<uint8_t>> expected_output = {
+        {0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44,
+            0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C},
+        {0xDF, 0xA6, 0x67, 0x47, 0xDE, 0x9A, 0xE6, 0x30,
+            0x30, 0xCA, 0x32, 0x61, 0x14, 0x97, 0xC8, 0x27},
+        {0x51, 0xF0, 0xBE, 0xBF, 0x7E, 0x3B, 0x9D, 0x92,
+            0xFC, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3C, 0xFE}};
+
+    std::vector<std::vector<uint8_t>> output = d_crypto->compute_CMAC_AES(key, messages);
+
+    ASSERT_EQ(expected_output, output);
+}
+
+
+TEST(GnssCryptoTest, TestComputeHMACSHA256Batch)
+{
+    // The batched computation must match the computation of each MAC on its own
+    auto d_crypto = std::make_unique<Gnss_Crypto>();
+
+    std::vector<uint8_t> key = {
+        0x24, 0x24, 0x3B, 0x76, 0xF9, 0x14, 0xB1, 0xA7,
+        0x7D, 0x48, 0xE7, 0xF1, 0x48, 0x0C, 0xC2, 0x98};
+
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 10; i++)
+        {
+            std::vector<uint8_t> m(20 + 7 * i);
+            for (size_t k = 0; k < m.size(); k++)
+                {
+                    m[k] = static_cast<uint8_t>(i * 13 + k);
+                }
+            messages.push_back(m);
+        }
+
+    std::vector<std::vector<uint8_t>> output = d_crypto->compute_HMAC_SHA_256(key, messages);
+
+    ASSERT_EQ(messages.size(), output.size());
+    for (size_t i = 0; i < messages.size(); i++)
+        {
+            ASSERT_EQ(d_crypto->compute_HMAC_SHA_256(key, messages[i]), output[i]);
+        }
+}
+
+
 TEST(GnssCryptoTest, VerifySignatureP256)
 {
     auto d_crypto = std::make_unique<Gnss_Crypto>();
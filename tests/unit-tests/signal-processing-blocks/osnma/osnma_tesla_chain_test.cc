@@ -0,0 +1,187 @@
+/*!
+ * \file osnma_tesla_chain_test.cc
+ * \brief Tests for the OSNMA_TESLA_Chain class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_crypto.h"
+#include "gnss_sdr_filesystem.h"
+#include "osnma_tesla_chain.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class OsnmaTeslaChainTest : public ::testing::Test
+{
+protected:
+    Gnss_Crypto crypto;
+    DSM_KROOT_message kroot{};
+    // input data taken from Receiver Guidelines v1.3, A.5.2
+    const std::vector<uint8_t> K2{0x2D, 0xC3, 0xA3, 0xCD, 0xB1, 0x17, 0xFA, 0xAD, 0xB8, 0x3B, 0x5F, 0x0B, 0x6F, 0xEA, 0x88, 0xEB};
+    const uint32_t GST_0 = (1248 & 0x00000FFF) << 20 | (345600 & 0x000FFFFF);  // applicable time (GST_Kroot + 30)
+
+    void SetUp() override
+    {
+        kroot.kroot = {0x5B, 0xF8, 0xC9, 0xCB, 0xFC, 0xF7, 0x04, 0x22, 0x08, 0x14, 0x75, 0xFD, 0x44, 0x5D, 0xF0, 0xFF};  // Kroot, TOW 345570 GST_0 - 30
+        kroot.ks = 4;                                                                                                    // TABLE 10 --> 128 bits
+        kroot.alpha = 0x610BDF26D77B;
+        kroot.hf = 0;
+    }
+
+    // keys[i] is transmitted in the subframe starting at GST_0 - 30 + 30 * i, keys[0] is the KROOT
+    std::vector<std::vector<uint8_t>> build_chain(uint32_t length, const std::vector<uint8_t>& last_key) const
+    {
+        std::vector<std::vector<uint8_t>> keys(length + 1);
+        keys[length] = last_key;
+        for (uint32_t i = length; i > 0; i--)
+            {
+                const uint32_t GST_SFi = GST_0 - 30 + 30 * (i - 1);
+                std::vector<uint8_t> msg = keys[i];
+                msg.push_back((GST_SFi & 0xFF000000) >> 24);
+                msg.push_back((GST_SFi & 0x00FF0000) >> 16);
+                msg.push_back((GST_SFi & 0x0000FF00) >> 8);
+                msg.push_back(GST_SFi & 0x000000FF);
+                for (int k = 5; k >= 0; k--)
+                    {
+                        msg.push_back(static_cast<uint8_t>((kroot.alpha >> (k * 8)) & 0xFF));
+                    }
+                const std::vector<uint8_t> hash = crypto.compute_SHA_256(msg);
+                keys[i - 1] = std::vector<uint8_t>(hash.begin(), hash.begin() + last_key.size());
+            }
+        return keys;
+    }
+};
+
+
+TEST_F(OsnmaTeslaChainTest, VerifyFromKroot)
+{
+    OSNMA_TESLA_Chain chain;
+
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, K2, GST_0 + 30));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 2U);
+}
+
+
+TEST_F(OsnmaTeslaChainTest, WrongKeyFails)
+{
+    OSNMA_TESLA_Chain chain;
+    std::vector<uint8_t> key = K2;
+    key[15] ^= 0x01;
+
+    ASSERT_FALSE(chain.verify_key(crypto, kroot, GST_0, key, GST_0 + 30));
+    ASSERT_FALSE(chain.verify_key(crypto, kroot, GST_0, K2, GST_0 + 60));  // right key, wrong time
+    ASSERT_FALSE(chain.verify_key(crypto, kroot, GST_0, K2, GST_0 + 31));  // not aligned with the KROOT
+}
+
+
+TEST_F(OsnmaTeslaChainTest, CheckpointsReduceHashes)
+{
+    const uint32_t length = 400;
+    const std::vector<std::vector<uint8_t>> keys = build_chain(length, K2);
+    kroot.kroot = keys[0];
+    const std::string filename = (fs::temp_directory_path() / "osnma_tesla_chain_test.bin").string();
+    fs::remove(filename);
+
+    OSNMA_TESLA_Chain chain(filename);
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[300], GST_0 - 30 + 30 * 300));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 300U);
+
+    // The latest verified key is the closest one
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[301], GST_0 - 30 + 30 * 301));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 1U);
+
+    // An older key is hashed down to a checkpoint, not to the KROOT
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[250], GST_0 - 30 + 30 * 250));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 250U - 240U);
+
+    // Checkpoints survive a restart, and are not hashed again
+    OSNMA_TESLA_Chain restarted_chain(filename);
+    ASSERT_TRUE(restarted_chain.verify_key(crypto, kroot, GST_0, keys[399], GST_0 - 30 + 30 * 399));
+    ASSERT_LT(restarted_chain.get_last_number_of_hashes(), 120U);
+
+    // but are not used for another chain
+    OSNMA_TESLA_Chain other_chain(filename);
+    kroot.alpha = 0x610BDF26D77C;
+    ASSERT_FALSE(other_chain.verify_key(crypto, kroot, GST_0, keys[399], GST_0 - 30 + 30 * 399));
+    ASSERT_EQ(other_chain.get_last_number_of_hashes(), 399U);
+
+    fs::remove(filename);
+}
+
+
+TEST_F(OsnmaTeslaChainTest, VerifiedKeyIsHashedAgain)
+{
+    const std::vector<std::vector<uint8_t>> keys = build_chain(10, K2);
+    kroot.kroot = keys[0];
+    OSNMA_TESLA_Chain chain;
+
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[5], GST_0 - 30 + 30 * 5));
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[5], GST_0 - 30 + 30 * 5));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 5U);
+
+    // The KROOT is not a TESLA key of the chain
+    ASSERT_FALSE(chain.verify_key(crypto, kroot, GST_0, keys[0], GST_0 - 30));
+}
+
+
+TEST_F(OsnmaTeslaChainTest, StaleCheckpointsAreDiscarded)
+{
+    const uint32_t length = 130;
+    const std::vector<std::vector<uint8_t>> keys = build_chain(length, K2);
+    std::vector<uint8_t> other_key = K2;
+    other_key[0] ^= 0x01;
+    const std::vector<std::vector<uint8_t>> other_keys = build_chain(length, other_key);
+    const std::string filename = (fs::temp_directory_path() / "osnma_tesla_chain_stale_test.bin").string();
+    fs::remove(filename);
+
+    // Store the keys of another chain, then replace its KROOT in the file
+    // header (hf, key length, alpha, GST_0, KROOT) by the current one
+    {
+        kroot.kroot = other_keys[0];
+        OSNMA_TESLA_Chain other_chain(filename);
+        ASSERT_TRUE(other_chain.verify_key(crypto, kroot, GST_0, other_keys[length], GST_0 - 30 + 30 * length));
+    }
+    {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        file.seekp(1 + 1 + 8 + 4);
+        file.write(reinterpret_cast<const char*>(keys[0].data()), keys[0].size());
+    }
+
+    // The key does not hash down to the checkpoint read from the file, so
+    // the stored keys are dropped and the key is hashed down to the KROOT
+    kroot.kroot = keys[0];
+    OSNMA_TESLA_Chain chain(filename);
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[length], GST_0 - 30 + 30 * length));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), length - 120 + length);
+    ASSERT_EQ(chain.get_number_of_checkpoints(), 3U);
+    ASSERT_FALSE(chain.verify_key(crypto, kroot, GST_0, other_keys[length], GST_0 - 30 + 30 * length));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), length - 120);
+
+    fs::remove(filename);
+}
+
+
+TEST_F(OsnmaTeslaChainTest, ResetForgetsCheckpoints)
+{
+    const std::vector<std::vector<uint8_t>> keys = build_chain(10, K2);
+    kroot.kroot = keys[0];
+    OSNMA_TESLA_Chain chain;
+
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[8], GST_0 - 30 + 30 * 8));
+    chain.reset();
+    ASSERT_EQ(chain.get_number_of_checkpoints(), 0U);
+    ASSERT_TRUE(chain.verify_key(crypto, kroot, GST_0, keys[9], GST_0 - 30 + 30 * 9));
+    ASSERT_EQ(chain.get_last_number_of_hashes(), 9U);
+}
@@ -0,0 +1,135 @@
+/*!
+ * \file pvt_replay_test.cc
+ * \brief Tests for the recording and loading of PVT replay files.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beidou_dnav_iono.h"
+#include "galileo_has_data.h"
+#include "gnss_sdr_filesystem.h"
+#include "gps_cnav_iono.h"
+#include "gps_cnav_utc_model.h"
+#include "pvt_conf.h"
+#include "pvt_replay.h"
+#include "rtklib_rtkpos.h"
+#include "rtklib_solver.h"
+#include <array>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+
+TEST(PvtReplayTest, RoundTrip)
+{
+    const std::string filename = (fs::temp_directory_path() / "gnss_sdr_pvt_replay_test.dat").string();
+
+    Gps_CNAV_Iono cnav_iono;
+    cnav_iono.alpha0 = 1.1e-8;
+    cnav_iono.valid = true;
+    Gps_CNAV_Utc_Model cnav_utc;
+    cnav_utc.A0 = 3.0e-9;
+    cnav_utc.valid = true;
+    Beidou_Dnav_Iono bds_iono;
+    bds_iono.beta3 = 65536.0;
+    bds_iono.valid = true;
+
+    // HAS message without corrections, so that storing it has no effect on
+    // the solver. The records that follow check that it was read back whole.
+    Galileo_HAS_data has_data{};
+    has_data.tow = 3600;
+    has_data.has_status = 1;
+    has_data.Nsys = 1;
+    has_data.gnss_id_mask = {2};
+    has_data.satellite_mask = {0x8000000000000000ULL};
+    has_data.cell_mask = {{{true, false}}};
+    has_data.code_bias = {{12, -7}};
+
+    std::vector<obsd_t> base_obs(2);
+    base_obs[0].time = {1700000000, 0.5};
+    base_obs[0].sat = 3;
+    base_obs[0].P[0] = 2.1e7;
+    base_obs[0].L[0] = 1.1e8;
+    base_obs[1].time = base_obs[0].time;
+    base_obs[1].sat = 7;
+    base_obs[1].D[0] = -1234.5F;
+    const std::array<double, 3> base_position{4789000.1, 176000.2, 4195000.3};
+
+    std::map<int, Gnss_Synchro> observables;
+    Gnss_Synchro gs{};
+    gs.System = 'G';
+    gs.PRN = 11;
+    gs.Pseudorange_m = 2.2e7;
+    observables[0] = gs;
+
+    {
+        Pvt_Replay_Writer writer(filename, 1, 1, SYS_GPS);
+        ASSERT_TRUE(writer.is_open());
+        writer.write(cnav_iono);
+        writer.write(cnav_utc);
+        writer.write(bds_iono);
+        writer.write(has_data);
+        writer.write_base_observations(base_obs, base_position);
+        writer.write_epoch(observables, 0.02);
+    }
+
+    const Pvt_Replay_Session session = pvt_replay_load(filename);
+    fs::remove(filename);
+    ASSERT_EQ(session.epochs.size(), 1U);
+    const Pvt_Replay_Epoch& epoch = session.epochs[0];
+    EXPECT_EQ(epoch.nav_updates.size(), 5U);
+    EXPECT_EQ(epoch.observables.at(0).PRN, 11U);
+    EXPECT_DOUBLE_EQ(epoch.observables.at(0).Pseudorange_m, 2.2e7);
+    EXPECT_DOUBLE_EQ(epoch.kf_update_interval_s, 0.02);
+
+    prcopt_t opt{};
+    opt.mode = PMODE_KINEMA;
+    opt.nf = 1;
+    opt.navsys = SYS_GPS;
+    rtk_t rtk;
+    rtkinit(&rtk, &opt);
+    Pvt_Conf conf;
+    Rtklib_Solver solver(rtk, conf, "pvt_replay_test", 1, false, false);
+    for (const auto& nav_update : epoch.nav_updates)
+        {
+            nav_update(solver);
+        }
+    rtkfree(&rtk);
+
+    EXPECT_TRUE(solver.gps_cnav_iono.valid);
+    EXPECT_DOUBLE_EQ(solver.gps_cnav_iono.alpha0, 1.1e-8);
+    EXPECT_DOUBLE_EQ(solver.gps_cnav_utc_model.A0, 3.0e-9);
+    EXPECT_DOUBLE_EQ(solver.beidou_dnav_iono.beta3, 65536.0);
+
+    const std::vector<obsd_t>& read_base_obs = solver.get_base_observations();
+    ASSERT_EQ(read_base_obs.size(), 2U);
+    EXPECT_EQ(read_base_obs[0].time.time, base_obs[0].time.time);
+    EXPECT_DOUBLE_EQ(read_base_obs[0].time.sec, 0.5);
+    EXPECT_EQ(read_base_obs[0].sat, 3);
+    EXPECT_DOUBLE_EQ(read_base_obs[0].P[0], 2.1e7);
+    EXPECT_DOUBLE_EQ(read_base_obs[0].L[0], 1.1e8);
+    EXPECT_EQ(read_base_obs[1].sat, 7);
+    EXPECT_FLOAT_EQ(read_base_obs[1].D[0], -1234.5F);
+}
+
+
+TEST(PvtReplayTest, RejectsOtherFiles)
+{
+    const std::string filename = (fs::temp_directory_path() / "gnss_sdr_pvt_replay_test.txt").string();
+    {
+        std::ofstream file(filename);
+        file << "This is not a PVT replay file\n";
+    }
+    const Pvt_Replay_Session session = pvt_replay_load(filename);
+    fs::remove(filename);
+    EXPECT_TRUE(session.epochs.empty());
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file rtklib_solver_prediction_test.cc
+ * \brief Tests for the pseudorange rates predicted by the PVT solution for
+ * the vector tracking of the channels.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "pvt_conf.h"
+#include "rtklib_rtkpos.h"
+#include "rtklib_solver.h"
+#include <array>
+
+
+namespace
+{
+// Receiver at rest on the equator, at longitude 0
+sol_t receiver_at_rest()
+{
+    sol_t sol{};
+    sol.rr[0] = 6378137.0;
+    return sol;
+}
+}  // namespace
+
+
+TEST(RtklibSolverPredictionTest, ApproachingSatelliteHasNegativeRate)
+{
+    const sol_t sol = receiver_at_rest();
+    // Satellite above the receiver, moving towards it and without clock drift
+    std::array<double, 7> sat{26560000.0, 0.0, 0.0, -500.0, 0.0, 0.0, 0.0};
+    double rate = 0.0;
+    ASSERT_TRUE(Rtklib_Solver::compute_pseudorange_rate(sat, sol, rate));
+    EXPECT_NEAR(rate, -500.0, 1e-9);
+
+    sat[3] = 500.0;
+    ASSERT_TRUE(Rtklib_Solver::compute_pseudorange_rate(sat, sol, rate));
+    EXPECT_NEAR(rate, 500.0, 1e-9);
+}
+
+
+TEST(RtklibSolverPredictionTest, SagnacTerm)
+{
+    const sol_t sol = receiver_at_rest();
+    // The velocity across the line of sight does not change the geometric
+    // range rate, only the Earth rotation correction
+    const std::array<double, 7> sat{26560000.0, 0.0, 0.0, -500.0, 3000.0, 0.0, 0.0};
+    double rate = 0.0;
+    ASSERT_TRUE(Rtklib_Solver::compute_pseudorange_rate(sat, sol, rate));
+    const double sagnac_m_s = GNSS_OMEGA_EARTH_DOT / SPEED_OF_LIGHT_M_S * 3000.0 * sol.rr[0];
+    EXPECT_GT(sagnac_m_s, 1.0);
+    EXPECT_NEAR(rate, -500.0 + sagnac_m_s, 1e-9);
+}
+
+
+TEST(RtklibSolverPredictionTest, ClockDrifts)
+{
+    sol_t sol = receiver_at_rest();
+    const double receiver_drift_m_s = 25.0;
+    const double satellite_drift_s_s = 1e-9;
+    sol.dtr[5] = receiver_drift_m_s;
+    const std::array<double, 7> sat{26560000.0, 0.0, 0.0, -500.0, 0.0, 0.0, satellite_drift_s_s};
+    double rate = 0.0;
+    ASSERT_TRUE(Rtklib_Solver::compute_pseudorange_rate(sat, sol, rate));
+    EXPECT_NEAR(rate, -500.0 + receiver_drift_m_s - SPEED_OF_LIGHT_M_S * satellite_drift_s_s, 1e-9);
+}
+
+
+TEST(RtklibSolverPredictionTest, UnknownSatellite)
+{
+    prcopt_t opt{};
+    opt.mode = PMODE_SINGLE;
+    opt.nf = 1;
+    opt.navsys = SYS_GPS;
+    rtk_t rtk;
+    rtkinit(&rtk, &opt);
+    Pvt_Conf conf;
+    Rtklib_Solver solver(rtk, conf, "rtklib_solver_prediction_test", 1, false, false);
+    rtkfree(&rtk);
+
+    double rate = 123.0;
+    EXPECT_FALSE(solver.get_predicted_pseudorange_rate('G', 1, rate));
+    EXPECT_FALSE(solver.get_predicted_pseudorange_rate('X', 1, rate));
+    EXPECT_DOUBLE_EQ(rate, 123.0);
+
+    const sol_t sol{};
+    const std::array<double, 7> sat{};
+    EXPECT_FALSE(Rtklib_Solver::compute_pseudorange_rate(sat, sol, rate));
+}
@@ -0,0 +1,113 @@
+/*!
+ * \file polyphase_resampler_test.cc
+ * \brief Implements unit tests for the polyphase resampler conditioner.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "in_memory_configuration.h"
+#include "polyphase_resampler.h"
+#include "polyphase_resampler_conditioner.h"
+#include "tone_fit.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <volk/volk.h>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_sink_s.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+
+namespace
+{
+constexpr double POLYPHASE_TEST_FS_IN = 4e6;
+constexpr double POLYPHASE_TEST_TONE = 0.3e6;
+constexpr int POLYPHASE_TEST_SAMPLES = 200000;
+constexpr int POLYPHASE_TEST_TRANSIENT = 100;
+}  // namespace
+
+
+TEST(PolyphaseResamplerTest, IrrationalRatioKeepsToneAndRejectsAliases)
+{
+    const double fs_out = POLYPHASE_TEST_FS_IN / std::sqrt(2.0);
+    // Wanted tone, and a tone out of the output band that would alias on it
+    std::vector<gr_complex> input(POLYPHASE_TEST_SAMPLES);
+    for (int n = 0; n < POLYPHASE_TEST_SAMPLES; n++)
+        {
+            input[n] = std::polar(1.0F, static_cast<float>(2.0 * M_PI * POLYPHASE_TEST_TONE * n / POLYPHASE_TEST_FS_IN)) +
+                       std::polar(1.0F, static_cast<float>(2.0 * M_PI * 1.9e6 * n / POLYPHASE_TEST_FS_IN));
+        }
+
+    std::shared_ptr<InMemoryConfiguration> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_out));
+    config->set_property("Resampler.sample_freq_in", std::to_string(POLYPHASE_TEST_FS_IN));
+    config->set_property("Resampler.sample_freq_out", std::to_string(fs_out));
+    auto resampler = std::make_shared<PolyphaseResamplerConditioner>(config.get(), "Resampler", 1, 1);
+
+    auto top_block = gr::make_top_block("PolyphaseResamplerTest");
+    auto sink = gr::blocks::vector_sink_c::make();
+    resampler->connect(top_block);
+    top_block->connect(gr::blocks::vector_source_c::make(input), 0, resampler->get_left_block(), 0);
+    top_block->connect(resampler->get_right_block(), 0, sink, 0);
+    const auto start = std::chrono::system_clock::now();
+    top_block->run();
+    const std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    std::cout << "Resampled " << POLYPHASE_TEST_SAMPLES << " samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
+
+    const std::vector<gr_complex> output = sink->data();
+    EXPECT_NEAR(static_cast<double>(output.size()), POLYPHASE_TEST_SAMPLES * fs_out / POLYPHASE_TEST_FS_IN, 100.0);
+    double residual_power = 0.0;
+    const auto amplitude = fit_tone(output, POLYPHASE_TEST_TONE, fs_out, POLYPHASE_TEST_TRANSIENT, &residual_power);
+    EXPECT_NEAR(std::abs(amplitude), 1.0, 1e-3);
+    EXPECT_LT(10.0 * std::log10(residual_power), -55.0);
+}
+
+
+TEST(PolyphaseResamplerTest, ShortItems)
+{
+    const double fs_out = 2.5e6;
+    std::vector<int16_t> input(2 * POLYPHASE_TEST_SAMPLES);
+    for (int n = 0; n < POLYPHASE_TEST_SAMPLES; n++)
+        {
+            const double phase = 2.0 * M_PI * POLYPHASE_TEST_TONE * n / POLYPHASE_TEST_FS_IN;
+            input[2 * n] = static_cast<int16_t>(std::round(1000.0 * std::cos(phase)));
+            input[2 * n + 1] = static_cast<int16_t>(std::round(1000.0 * std::sin(phase)));
+        }
+
+    // Two shorts per item, so that the vector blocks carry std::complex<short>
+    auto top_block = gr::make_top_block("PolyphaseResamplerShortTest");
+    auto resampler = make_polyphase_resampler(sizeof(lv_16sc_t), POLYPHASE_TEST_FS_IN, fs_out);
+    auto source = gr::blocks::vector_source_s::make(input, false, 2);
+    auto sink = gr::blocks::vector_sink_s::make(2);
+    top_block->connect(source, 0, resampler, 0);
+    top_block->connect(resampler, 0, sink, 0);
+    top_block->run();
+
+    const std::vector<int16_t> output = sink->data();
+    std::vector<gr_complex> output_complex(output.size() / 2);
+    for (size_t m = 0; m < output_complex.size(); m++)
+        {
+            output_complex[m] = gr_complex(output[2 * m], output[2 * m + 1]) / 1000.0F;
+        }
+    double residual_power = 0.0;
+    const auto amplitude = fit_tone(output_complex, POLYPHASE_TEST_TONE, fs_out, POLYPHASE_TEST_TRANSIENT, &residual_power);
+    EXPECT_NEAR(std::abs(amplitude), 1.0, 1e-3);
+    EXPECT_LT(10.0 * std::log10(residual_power), -50.0);
+}
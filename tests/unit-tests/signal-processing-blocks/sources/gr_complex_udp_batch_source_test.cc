@@ -0,0 +1,159 @@
+/*!
+ * \file gr_complex_udp_batch_source_test.cc
+ * \brief Tests of the UDP batch source, replaying pcap files.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "gr_complex_udp_batch_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <complex>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#endif
+
+namespace
+{
+constexpr int UDP_BATCH_TEST_PORT = 1234;
+
+
+void write_le32(std::ofstream &file, uint32_t value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+
+// Writes each payload in an Ethernet / IPv4 / UDP frame of a pcap file
+std::string write_pcap_file(const std::string &name, const std::vector<std::vector<uint8_t>> &payloads)
+{
+    const std::string filename = (fs::temp_directory_path() / name).string();
+    std::ofstream file(filename, std::ios::binary);
+    write_le32(file, 0xa1b2c3d4);  // magic number, in the byte order of the machine
+    const uint16_t version[2] = {2, 4};
+    file.write(reinterpret_cast<const char *>(version), sizeof(version));
+    write_le32(file, 0);      // time zone
+    write_le32(file, 0);      // timestamp accuracy
+    write_le32(file, 65535);  // snapshot length
+    write_le32(file, 1);      // Ethernet
+    for (const auto &payload : payloads)
+        {
+            std::vector<uint8_t> frame(14 + 20 + 8, 0);
+            frame[12] = 0x08;  // IPv4
+            frame[14] = 0x45;
+            frame[14 + 9] = 17;  // UDP
+            uint8_t *udp_header = &frame[14 + 20];
+            udp_header[2] = UDP_BATCH_TEST_PORT >> 8;
+            udp_header[3] = UDP_BATCH_TEST_PORT & 0xFF;
+            udp_header[4] = static_cast<uint8_t>((payload.size() + 8) >> 8);
+            udp_header[5] = static_cast<uint8_t>((payload.size() + 8) & 0xFF);
+            frame.insert(frame.end(), payload.begin(), payload.end());
+            write_le32(file, 0);
+            write_le32(file, 0);
+            write_le32(file, static_cast<uint32_t>(frame.size()));
+            write_le32(file, static_cast<uint32_t>(frame.size()));
+            file.write(reinterpret_cast<const char *>(frame.data()), static_cast<std::streamsize>(frame.size()));
+        }
+    return filename;
+}
+
+
+std::vector<gr_complex> replay(const std::string &filename, const std::string &wire_sample_type, bool IQ_swap, bool packet_counter)
+{
+    auto top_block = gr::make_top_block("gr_complex_udp_batch_source_test");
+    auto source = Gr_Complex_Udp_Batch_Source::make("pcap_file", filename, UDP_BATCH_TEST_PORT, 1, wire_sample_type, IQ_swap, packet_counter, 1 << 16, 0);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, sink, 0);
+    top_block->run();
+    fs::remove(filename);
+    return sink->data();
+}
+
+
+// Payload of 4 cbyte samples, starting with the packet counter
+std::vector<uint8_t> counted_packet(uint32_t counter)
+{
+    const auto value = static_cast<uint8_t>(counter + 1);
+    return {0, 0, 0, static_cast<uint8_t>(counter), value, value, value, value, value, value, value, value};
+}
+}  // namespace
+
+
+TEST(GrComplexUdpBatchSourceTest, C2bitsTwoSamplesPerByte)
+{
+    // Most significant nibble first, bit order Q1 Q0 I1 I0, levels -3, -1, 1, 3
+    const std::vector<std::vector<uint8_t>> payloads = {{0x1B, 0xE4}};
+    const std::vector<gr_complex> normal = replay(write_pcap_file("udp_batch_c2bits.pcap", payloads), "c2bits", false, false);
+    const std::vector<gr_complex> expected = {{1, 3}, {-3, -1}, {-1, -3}, {3, 1}};
+    EXPECT_EQ(normal, expected);
+
+    const std::vector<gr_complex> swapped = replay(write_pcap_file("udp_batch_c2bits.pcap", payloads), "c2bits", true, false);
+    ASSERT_EQ(swapped.size(), expected.size());
+    for (size_t n = 0; n < expected.size(); n++)
+        {
+            EXPECT_EQ(swapped[n], gr_complex(expected[n].imag(), expected[n].real()));
+        }
+}
+
+
+TEST(GrComplexUdpBatchSourceTest, IQOrder)
+{
+    // Same order as Gr_Complex_Ip_Packet_Source: the first byte of a cbyte
+    // sample is the imaginary part unless IQ_swap is set, and the least
+    // significant nibble of a c4bits sample is the real part unless IQ_swap is set
+    const std::vector<std::vector<uint8_t>> cbyte_payloads = {{1, 2, static_cast<uint8_t>(-3), 4}};
+    EXPECT_EQ(replay(write_pcap_file("udp_batch_cbyte.pcap", cbyte_payloads), "cbyte", false, false), (std::vector<gr_complex>{{2, 1}, {4, -3}}));
+    EXPECT_EQ(replay(write_pcap_file("udp_batch_cbyte.pcap", cbyte_payloads), "cbyte", true, false), (std::vector<gr_complex>{{1, 2}, {-3, 4}}));
+
+    const std::vector<std::vector<uint8_t>> c4bits_payloads = {{0x21, 0x0F}};
+    EXPECT_EQ(replay(write_pcap_file("udp_batch_c4bits.pcap", c4bits_payloads), "c4bits", false, false), (std::vector<gr_complex>{{3, 5}, {-1, 1}}));
+    EXPECT_EQ(replay(write_pcap_file("udp_batch_c4bits.pcap", c4bits_payloads), "c4bits", true, false), (std::vector<gr_complex>{{5, 3}, {1, -1}}));
+}
+
+
+TEST(GrComplexUdpBatchSourceTest, ReordersPackets)
+{
+    const std::vector<std::vector<uint8_t>> payloads = {counted_packet(0), counted_packet(2), counted_packet(1), counted_packet(3)};
+    const std::vector<gr_complex> output = replay(write_pcap_file("udp_batch_reorder.pcap", payloads), "cbyte", false, true);
+    ASSERT_EQ(output.size(), 16U);
+    for (size_t n = 0; n < output.size(); n++)
+        {
+            const auto value = static_cast<float>(n / 4 + 1);
+            EXPECT_EQ(output[n], gr_complex(value, value)) << "at sample " << n;
+        }
+}
+
+
+TEST(GrComplexUdpBatchSourceTest, FillsLostPacketsWithZeros)
+{
+    // Packet 1 is lost, packet 4 arrives late, after its place was filled
+    std::vector<std::vector<uint8_t>> payloads = {counted_packet(0), counted_packet(2), counted_packet(3)};
+    for (uint32_t counter = 5; counter < 20; counter++)
+        {
+            payloads.push_back(counted_packet(counter));
+        }
+    payloads.push_back(counted_packet(4));
+    const std::vector<gr_complex> output = replay(write_pcap_file("udp_batch_losses.pcap", payloads), "cbyte", false, true);
+    ASSERT_EQ(output.size(), 20U * 4U);
+    for (size_t n = 0; n < output.size(); n++)
+        {
+            const size_t packet = n / 4;
+            const float value = (packet == 1 || packet == 4) ? 0.0F : static_cast<float>(packet + 1);
+            EXPECT_EQ(output[n], gr_complex(value, value)) << "at sample " << n;
+        }
+}
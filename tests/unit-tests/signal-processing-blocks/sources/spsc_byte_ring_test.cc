@@ -0,0 +1,143 @@
+/*!
+ * \file spsc_byte_ring_test.cc
+ * \brief Implements unit tests for the lock-free ring buffer of bytes used by
+ * the UDP batch signal source.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "spsc_byte_ring.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+TEST(SpscByteRingTest, WrapsAround)
+{
+    Spsc_Byte_Ring ring(100);
+    EXPECT_EQ(ring.capacity(), 128U);
+    std::vector<uint8_t> data(96);
+    std::vector<uint8_t> output(96);
+    for (int round = 0; round < 10; round++)
+        {
+            for (size_t i = 0; i < data.size(); i++)
+                {
+                    data[i] = static_cast<uint8_t>(round + i);
+                }
+            ASSERT_TRUE(ring.write(data.data(), data.size()));
+            EXPECT_EQ(ring.read_available(), data.size());
+            ASSERT_EQ(ring.read(output.data(), output.size()), output.size());
+            EXPECT_EQ(output, data);
+        }
+    EXPECT_EQ(ring.read_available(), 0U);
+}
+
+
+TEST(SpscByteRingTest, RejectsWritesWhenFull)
+{
+    Spsc_Byte_Ring ring(64);
+    const std::vector<uint8_t> data(48, 1);
+    EXPECT_TRUE(ring.write(data.data(), data.size()));
+    EXPECT_FALSE(ring.write(data.data(), data.size()));
+    EXPECT_EQ(ring.read_available(), data.size());
+    EXPECT_EQ(ring.write_space(), 16U);
+    std::vector<uint8_t> output(100);
+    EXPECT_EQ(ring.read(output.data(), output.size()), data.size());
+}
+
+
+TEST(SpscByteRingTest, WritesZeros)
+{
+    Spsc_Byte_Ring ring(16);
+    const std::vector<uint8_t> data(12, 0xFF);
+    std::vector<uint8_t> output(12);
+    ASSERT_TRUE(ring.write(data.data(), data.size()));
+    ASSERT_EQ(ring.read(output.data(), output.size()), output.size());
+    ASSERT_TRUE(ring.write_zeros(12));
+    ASSERT_EQ(ring.read(output.data(), output.size()), output.size());
+    EXPECT_EQ(output, std::vector<uint8_t>(12, 0));
+}
+
+
+TEST(SpscByteRingTest, ReadsInPlace)
+{
+    Spsc_Byte_Ring ring(16);
+    std::vector<uint8_t> data(12);
+    for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = static_cast<uint8_t>(i);
+        }
+    ASSERT_TRUE(ring.write(data.data(), data.size()));
+    ring.advance_read(10);
+    ASSERT_TRUE(ring.write(data.data(), data.size()));
+
+    // The unread bytes wrap around the end of the buffer
+    size_t bytes = 0;
+    const uint8_t* first = ring.read_pointer(bytes);
+    ASSERT_EQ(bytes, 6U);
+    EXPECT_EQ(first[0], 10);
+    EXPECT_EQ(first[2], 0);
+    ring.advance_read(bytes);
+    const uint8_t* second = ring.read_pointer(bytes);
+    ASSERT_EQ(bytes, 8U);
+    EXPECT_EQ(second[0], 4);
+    ring.advance_read(100);
+    EXPECT_EQ(ring.read_available(), 0U);
+    EXPECT_EQ(ring.write_space(), 16U);
+}
+
+
+TEST(SpscByteRingTest, KeepsOrderBetweenThreads)
+{
+    Spsc_Byte_Ring ring(4096);
+    const uint32_t total_bytes = 1 << 22;
+    std::thread producer([&ring, total_bytes]() {
+        std::vector<uint8_t> packet(1000);
+        uint32_t written = 0;
+        while (written < total_bytes)
+            {
+                const uint32_t bytes = std::min(static_cast<uint32_t>(packet.size()), total_bytes - written);
+                for (uint32_t i = 0; i < bytes; i++)
+                    {
+                        packet[i] = static_cast<uint8_t>((written + i) % 251);
+                    }
+                while (!ring.write(packet.data(), bytes))
+                    {
+                        std::this_thread::yield();
+                    }
+                written += bytes;
+            }
+    });
+
+    std::vector<uint8_t> output(777);
+    uint32_t read = 0;
+    uint32_t errors = 0;
+    while (read < total_bytes)
+        {
+            const size_t bytes = ring.read(output.data(), output.size());
+            for (size_t i = 0; i < bytes; i++)
+                {
+                    if (output[i] != static_cast<uint8_t>((read + i) % 251))
+                        {
+                            errors++;
+                        }
+                }
+            read += bytes;
+            if (bytes == 0)
+                {
+                    std::this_thread::yield();
+                }
+        }
+    producer.join();
+    EXPECT_EQ(errors, 0U);
+}
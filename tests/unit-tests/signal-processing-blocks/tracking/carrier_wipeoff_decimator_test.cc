@@ -0,0 +1,199 @@
+/*!
+ * \file carrier_wipeoff_decimator_test.cc
+ * \brief Tests for the carrier wipe-off and pre-decimation of the input of a
+ * tracking channel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L2C.h"
+#include "carrier_wipeoff_decimator.h"
+#include "gnss_synchro.h"
+#include "gps_l2_m_dll_pll_tracking.h"
+#include "gps_l2c_signal_replica.h"
+#include "in_memory_configuration.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+namespace
+{
+// Outputs of a GPS L2 CM tracking channel fed with the signal, with the given
+// pre-decimation (0 runs the correlators at the input rate)
+std::vector<Gnss_Synchro> track_gps_l2_m(const std::vector<gr_complex>& signal, double fs_in, double predecimation_samples_per_chip, const Gnss_Synchro& acquisition)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(static_cast<int64_t>(fs_in)));
+    config->set_property("Tracking_2S.item_type", "gr_complex");
+    config->set_property("Tracking_2S.pull_in_time_s", "0");
+    config->set_property("Tracking_2S.predecimation_samples_per_chip", std::to_string(predecimation_samples_per_chip));
+    auto tracking = std::make_shared<GpsL2MDllPllTracking>(config.get(), "Tracking_2S", 1, 1);
+
+    Gnss_Synchro gnss_synchro = acquisition;
+    tracking->set_channel(0);
+    tracking->set_gnss_synchro(&gnss_synchro);
+
+    auto top_block = gr::make_top_block("CarrierWipeoffDecimatorTest");
+    auto sink = gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro));
+    tracking->connect(top_block);
+    top_block->connect(gr::blocks::vector_source_c::make(signal), 0, tracking->get_left_block(), 0);
+    top_block->connect(tracking->get_right_block(), 0, sink, 0);
+    tracking->start_tracking();
+    top_block->run();
+
+    const std::vector<unsigned char> bytes = sink->data();
+    const auto* items = reinterpret_cast<const Gnss_Synchro*>(bytes.data());
+    return std::vector<Gnss_Synchro>(items, items + bytes.size() / sizeof(Gnss_Synchro));
+}
+}  // namespace
+
+
+TEST(CarrierWipeoffDecimatorTest, DecimationFactor)
+{
+    EXPECT_EQ(Carrier_Wipeoff_Decimator::compute_decimation_factor(20.46e6, 1.023e6, 2.0), 10);
+    EXPECT_EQ(Carrier_Wipeoff_Decimator::compute_decimation_factor(20.46e6, 1.023e6, 3.0), 6);
+    EXPECT_EQ(Carrier_Wipeoff_Decimator::compute_decimation_factor(20.46e6, 10.23e6, 2.0), 1);
+    EXPECT_EQ(Carrier_Wipeoff_Decimator::compute_decimation_factor(20.46e6, 1.023e6, 0.0), 1);
+}
+
+
+TEST(CarrierWipeoffDecimatorTest, RemovesCarrierAndDumps)
+{
+    const int decimation = 6;
+    const int n_samples = 10003;  // the last group is incomplete
+    const double rem_carrier_phase_rad = 2.5;
+    const double phase_step_rad = 2.0 * M_PI * 3000.0 / 20e6;
+    const double phase_rate_step_rad = 2.0 * M_PI * 500.0 / (20e6 * 20e6);
+
+    std::vector<gr_complex> input(n_samples);
+    std::vector<lv_16sc_t> input_16sc(n_samples);
+    for (int n = 0; n < n_samples; n++)
+        {
+            const double phase = rem_carrier_phase_rad + phase_step_rad * n + phase_rate_step_rad * n * (n - 1) / 2.0;
+            input[n] = std::polar(100.0F, static_cast<float>(phase));
+            input_16sc[n] = lv_16sc_t(static_cast<int16_t>(std::lround(input[n].real())), static_cast<int16_t>(std::lround(input[n].imag())));
+        }
+
+    Carrier_Wipeoff_Decimator decimator;
+    decimator.init(2 * n_samples, decimation);
+    EXPECT_EQ(decimator.decimation_factor(), decimation);
+
+    const int outputs = decimator.wipeoff_and_decimate(input.data(), rem_carrier_phase_rad, phase_step_rad, phase_rate_step_rad, n_samples);
+    ASSERT_EQ(outputs, (n_samples + decimation - 1) / decimation);
+    for (int k = 0; k < outputs - 1; k++)
+        {
+            EXPECT_LT(std::abs(decimator.output()[k] - gr_complex(100.0 * decimation, 0.0)), 1.0) << "at output " << k;
+        }
+    EXPECT_EQ(decimator.last_group_samples(), n_samples % decimation);
+    EXPECT_LT(std::abs(decimator.output()[outputs - 1] - gr_complex(100.0 * (n_samples % decimation), 0.0)), 1.0);
+
+    // Same result, up to the rounding of the input, for 16-bit samples
+    std::vector<gr_complex> output(decimator.output(), decimator.output() + outputs);
+    EXPECT_EQ(decimator.wipeoff_and_decimate(input_16sc.data(), rem_carrier_phase_rad, phase_step_rad, phase_rate_step_rad, n_samples), outputs);
+    for (int k = 0; k < outputs; k++)
+        {
+            EXPECT_LT(std::abs(decimator.output()[k] - output[k]), 0.01 * 100.0 * decimation);
+        }
+}
+
+
+TEST(CarrierWipeoffDecimatorTest, TrackingMatchesFullRate)
+{
+    // 4 Msps is about 7.8 samples per chip of the L2 CM code. Keeping 2
+    // samples per chip decimates by 3, and a code period of 80000 samples
+    // ends with a shorter group.
+    const double fs_in = 4e6;
+    const double doppler_hz = 1234.5;
+    const double delay_samples = 1000.3;
+    const double code_rate_cps = GPS_L2_M_CODE_RATE_CPS * (1.0 + doppler_hz / GPS_L2_FREQ_HZ);
+    const auto n_samples = static_cast<int>(1.6 * fs_in);
+    const auto code_length = static_cast<int>(GPS_L2_M_CODE_LENGTH_CHIPS);
+    ASSERT_EQ(Carrier_Wipeoff_Decimator::compute_decimation_factor(fs_in, GPS_L2_M_CODE_RATE_CPS, 2.0), 3);
+
+    // Signal at 55 dB-Hz
+    std::vector<float> code(code_length);
+    gps_l2c_m_code_gen_float(code, 1);
+    std::mt19937 generator(1234);
+    std::normal_distribution<float> noise(0.0, static_cast<float>(std::sqrt(0.5 * fs_in / std::pow(10.0, 5.5))));
+    std::vector<gr_complex> signal(n_samples);
+    for (int n = 0; n < n_samples; n++)
+        {
+            const auto chip = static_cast<int64_t>(std::floor((n - delay_samples) * code_rate_cps / fs_in));
+            const float chip_value = code[((chip % code_length) + code_length) % code_length];
+            signal[n] = chip_value * std::polar(1.0F, static_cast<float>(2.0 * M_PI * doppler_hz * n / fs_in + 0.3)) +
+                        gr_complex(noise(generator), noise(generator));
+        }
+
+    Gnss_Synchro acquisition = Gnss_Synchro();
+    acquisition.Channel_ID = 0;
+    acquisition.System = 'G';
+    const std::string signal_name = "2S";
+    signal_name.copy(acquisition.Signal, 2, 0);
+    acquisition.PRN = 1;
+    acquisition.Acq_delay_samples = std::round(delay_samples);
+    acquisition.Acq_doppler_hz = doppler_hz - 4.5;
+    acquisition.Acq_samplestamp_samples = 0;
+
+    const std::vector<Gnss_Synchro> full_rate = track_gps_l2_m(signal, fs_in, 0.0, acquisition);
+    const std::vector<Gnss_Synchro> decimated = track_gps_l2_m(signal, fs_in, 2.0, acquisition);
+
+    // Each output of the decimated channel is compared with the output of the
+    // full rate channel for the same code period
+    const double samples_per_chip = fs_in / GPS_L2_M_CODE_RATE_CPS;
+    int compared = 0;
+    double code_phase_error_sum = 0.0;
+    double doppler_sum = 0.0;
+    for (const auto& output : decimated)
+        {
+            if (!output.Flag_valid_symbol_output)
+                {
+                    continue;
+                }
+            const Gnss_Synchro* reference = nullptr;
+            for (const auto& candidate : full_rate)
+                {
+                    if (candidate.Flag_valid_symbol_output &&
+                        std::abs(static_cast<double>(candidate.Tracking_sample_counter) - static_cast<double>(output.Tracking_sample_counter)) < 0.5 * code_length * samples_per_chip)
+                        {
+                            reference = &candidate;
+                        }
+                }
+            ASSERT_NE(reference, nullptr) << "at sample " << output.Tracking_sample_counter;
+
+            // The sample counter and the time of the code epoch used by the
+            // observables agree with those of the full rate channel
+            EXPECT_LE(std::abs(static_cast<double>(output.Tracking_sample_counter) - static_cast<double>(reference->Tracking_sample_counter)), 1.0);
+            const double code_phase_error = (static_cast<double>(output.Tracking_sample_counter) + output.Code_phase_samples) -
+                                            (static_cast<double>(reference->Tracking_sample_counter) + reference->Code_phase_samples);
+            EXPECT_LT(std::abs(code_phase_error), 0.1 * samples_per_chip) << "at sample " << output.Tracking_sample_counter;
+            EXPECT_NEAR(output.Carrier_Doppler_hz, reference->Carrier_Doppler_hz, 5.0);
+            code_phase_error_sum += code_phase_error;
+            doppler_sum += output.Carrier_Doppler_hz;
+            compared++;
+        }
+    ASSERT_GE(compared, 20);
+    EXPECT_LT(std::abs(code_phase_error_sum / compared), 0.05 * samples_per_chip);
+    EXPECT_NEAR(doppler_sum / compared, doppler_hz, 2.0);
+}
@@ -0,0 +1,192 @@
+/*!
+ * \file cpu_multicorrelator_real_codes_16sc_test.cc
+ * \brief Checks the correlator for std::complex<short> input samples
+ * against the float one, and compares their execution times.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "cpu_multicorrelator_real_codes_16sc.h"
+#include "gps_sdr_signal_replica.h"
+#include <gnuradio/gr_complex.h>
+#include <gtest/gtest.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Four samples per chip, so that the spacing of the high dynamics resampler
+// of the float correlator is exact
+constexpr double CORRELATOR_16SC_TEST_FS_IN = 4.0 * GPS_L1_CA_CODE_RATE_CPS;
+constexpr int CORRELATOR_16SC_TEST_SAMPLES = 4092;
+constexpr double CORRELATOR_16SC_TEST_DOPPLER_HZ = 1500.0;
+constexpr float CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS = 100.0;
+constexpr float CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD = 0.5;
+
+
+// Samples of a GPS L1 C/A signal of the given amplitude in noise, rounded to
+// int16, and the same samples in float
+void generate_16sc_samples(double amplitude,
+    double noise_std,
+    double phase_rate_step_rad,
+    double code_phase_rate_step_chips,
+    volk_gnsssdr::vector<lv_16sc_t>& input_16sc,
+    volk_gnsssdr::vector<gr_complex>& input)
+{
+    const double code_phase_step_chips = GPS_L1_CA_CODE_RATE_CPS / CORRELATOR_16SC_TEST_FS_IN;
+    const double phase_step_rad = 2.0 * M_PI * CORRELATOR_16SC_TEST_DOPPLER_HZ / CORRELATOR_16SC_TEST_FS_IN;
+    volk_gnsssdr::vector<float> code(GPS_L1_CA_CODE_LENGTH_CHIPS);
+    gps_l1_ca_code_gen_float(code, 1, 0);
+
+    std::mt19937 generator(3);
+    std::normal_distribution<double> noise(0.0, noise_std);
+    input_16sc.resize(CORRELATOR_16SC_TEST_SAMPLES);
+    input.resize(CORRELATOR_16SC_TEST_SAMPLES);
+    for (int n = 0; n < CORRELATOR_16SC_TEST_SAMPLES; n++)
+        {
+            const double code_phase = code_phase_step_chips * n + code_phase_rate_step_chips * n * n - CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS;
+            const int code_length = static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS);
+            const int chip = (static_cast<int>(std::floor(code_phase)) % code_length + code_length) % code_length;
+            const double carrier_phase = CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD + phase_step_rad * n + phase_rate_step_rad * n * (n - 1) / 2.0;
+            const std::complex<double> sample = amplitude * code[chip] * std::polar(1.0, carrier_phase) + std::complex<double>(noise(generator), noise(generator));
+            input_16sc[n] = lv_16sc_t(static_cast<int16_t>(std::lround(std::max(-32768.0, std::min(32767.0, sample.real())))),
+                static_cast<int16_t>(std::lround(std::max(-32768.0, std::min(32767.0, sample.imag())))));
+            input[n] = gr_complex(input_16sc[n].real(), input_16sc[n].imag());
+        }
+}
+
+
+// Correlates the same samples with both correlators, with a signal of the
+// given amplitude in noise
+void check_16sc_correlator(double amplitude, double noise_std, bool high_dynamics)
+{
+    const double code_phase_step_chips = GPS_L1_CA_CODE_RATE_CPS / CORRELATOR_16SC_TEST_FS_IN;
+    const double phase_step_rad = 2.0 * M_PI * CORRELATOR_16SC_TEST_DOPPLER_HZ / CORRELATOR_16SC_TEST_FS_IN;
+    const double phase_rate_step_rad = high_dynamics ? 1e-9 : 0.0;
+    const double code_phase_rate_step_chips = high_dynamics ? 1e-11 : 0.0;
+
+    volk_gnsssdr::vector<float> code(GPS_L1_CA_CODE_LENGTH_CHIPS);
+    gps_l1_ca_code_gen_float(code, 1, 0);
+    std::array<float, 3> shifts_chips{-0.5, 0.0, 0.5};
+
+    volk_gnsssdr::vector<lv_16sc_t> input_16sc;
+    volk_gnsssdr::vector<gr_complex> input;
+    generate_16sc_samples(amplitude, noise_std, phase_rate_step_rad, code_phase_rate_step_chips, input_16sc, input);
+
+    volk_gnsssdr::vector<gr_complex> corr_out(3);
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.set_high_dynamics_resampler(high_dynamics);
+    correlator.init(2 * CORRELATOR_16SC_TEST_SAMPLES, 3);
+    correlator.set_local_code_and_taps(GPS_L1_CA_CODE_LENGTH_CHIPS, code.data(), shifts_chips.data());
+    correlator.set_input_output_vectors(corr_out.data(), input.data());
+    correlator.Carrier_wipeoff_multicorrelator_resampler(CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD, phase_step_rad, phase_rate_step_rad, CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS, code_phase_step_chips, code_phase_rate_step_chips, CORRELATOR_16SC_TEST_SAMPLES);
+
+    volk_gnsssdr::vector<gr_complex> corr_out_16sc(3);
+    Cpu_Multicorrelator_Real_Codes_16sc correlator_16sc;
+    correlator_16sc.set_high_dynamics_resampler(high_dynamics);
+    correlator_16sc.init(2 * CORRELATOR_16SC_TEST_SAMPLES, 3);
+    correlator_16sc.set_local_code_and_taps(GPS_L1_CA_CODE_LENGTH_CHIPS, code.data(), shifts_chips.data());
+    correlator_16sc.set_input_output_vectors(corr_out_16sc.data(), input_16sc.data());
+    correlator_16sc.Carrier_wipeoff_multicorrelator_resampler(CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD, phase_step_rad, phase_rate_step_rad, CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS, code_phase_step_chips, code_phase_rate_step_chips, CORRELATOR_16SC_TEST_SAMPLES);
+
+    // The prompt correlator collects the whole signal power, give or take
+    // three standard deviations of the correlated noise
+    const double noise_level = noise_std * std::sqrt(static_cast<double>(CORRELATOR_16SC_TEST_SAMPLES));
+    const float prompt = std::abs(corr_out[1]);
+    EXPECT_GT(prompt, 0.9 * amplitude * CORRELATOR_16SC_TEST_SAMPLES - 3.0 * noise_level);
+    for (int n = 0; n < 3; n++)
+        {
+            EXPECT_LT(std::abs(corr_out_16sc[n] - corr_out[n]), 0.01 * prompt);
+        }
+}
+}  // namespace
+
+
+TEST(CpuMulticorrelatorRealCodes16scTest, MatchesFloatCorrelator)
+{
+    check_16sc_correlator(200.0, 300.0, false);
+    check_16sc_correlator(200.0, 300.0, true);
+}
+
+
+TEST(CpuMulticorrelatorRealCodes16scTest, RecoversFromSaturation)
+{
+    // 64 samples of this amplitude overflow the 16-bit accumulators
+    check_16sc_correlator(2000.0, 300.0, false);
+}
+
+
+TEST(CpuMulticorrelatorRealCodes16scTest, NoiseOverflowsPartialSums)
+{
+    // The partial sums of the noise reach the 16-bit limits within a chunk
+    // and come back, so the result of the chunk alone does not show it
+    check_16sc_correlator(100.0, 3000.0, false);
+    check_16sc_correlator(1000.0, 4000.0, true);
+}
+
+
+TEST(CpuMulticorrelatorRealCodes16scTest, ExecutionTime)
+{
+    constexpr int iterations = 1000;
+    const double code_phase_step_chips = GPS_L1_CA_CODE_RATE_CPS / CORRELATOR_16SC_TEST_FS_IN;
+    const double phase_step_rad = 2.0 * M_PI * CORRELATOR_16SC_TEST_DOPPLER_HZ / CORRELATOR_16SC_TEST_FS_IN;
+    volk_gnsssdr::vector<float> code(GPS_L1_CA_CODE_LENGTH_CHIPS);
+    gps_l1_ca_code_gen_float(code, 1, 0);
+    std::array<float, 3> shifts_chips{-0.5, 0.0, 0.5};
+
+    std::cout << "Correlation of " << CORRELATOR_16SC_TEST_SAMPLES << " samples with 3 correlators:\n";
+    std::cout << "  input bytes per call: " << CORRELATOR_16SC_TEST_SAMPLES * sizeof(gr_complex) << " vs. " << CORRELATOR_16SC_TEST_SAMPLES * sizeof(lv_16sc_t) << '\n';
+    // Noise levels from a 12-bit front-end to the full 16-bit range
+    for (const double noise_std : {300.0, 1000.0, 3000.0, 8000.0})
+        {
+            volk_gnsssdr::vector<lv_16sc_t> input_16sc;
+            volk_gnsssdr::vector<gr_complex> input;
+            generate_16sc_samples(noise_std / 1.5, noise_std, 0.0, 0.0, input_16sc, input);
+
+            volk_gnsssdr::vector<gr_complex> corr_out(3);
+            Cpu_Multicorrelator_Real_Codes correlator;
+            correlator.init(2 * CORRELATOR_16SC_TEST_SAMPLES, 3);
+            correlator.set_local_code_and_taps(GPS_L1_CA_CODE_LENGTH_CHIPS, code.data(), shifts_chips.data());
+            correlator.set_input_output_vectors(corr_out.data(), input.data());
+            auto start = std::chrono::steady_clock::now();
+            for (int k = 0; k < iterations; k++)
+                {
+                    correlator.Carrier_wipeoff_multicorrelator_resampler(CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD, phase_step_rad, 0.0, CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS, code_phase_step_chips, 0.0, CORRELATOR_16SC_TEST_SAMPLES);
+                }
+            const std::chrono::duration<double> elapsed_float = std::chrono::steady_clock::now() - start;
+
+            volk_gnsssdr::vector<gr_complex> corr_out_16sc(3);
+            Cpu_Multicorrelator_Real_Codes_16sc correlator_16sc;
+            correlator_16sc.init(2 * CORRELATOR_16SC_TEST_SAMPLES, 3);
+            correlator_16sc.set_local_code_and_taps(GPS_L1_CA_CODE_LENGTH_CHIPS, code.data(), shifts_chips.data());
+            correlator_16sc.set_input_output_vectors(corr_out_16sc.data(), input_16sc.data());
+            start = std::chrono::steady_clock::now();
+            for (int k = 0; k < iterations; k++)
+                {
+                    correlator_16sc.Carrier_wipeoff_multicorrelator_resampler(CORRELATOR_16SC_TEST_REM_CARRIER_PHASE_RAD, phase_step_rad, 0.0, CORRELATOR_16SC_TEST_REM_CODE_PHASE_CHIPS, code_phase_step_chips, 0.0, CORRELATOR_16SC_TEST_SAMPLES);
+                }
+            const std::chrono::duration<double> elapsed_16sc = std::chrono::steady_clock::now() - start;
+
+            std::cout << "  noise std " << noise_std << ": gr_complex input " << elapsed_float.count() * 1e6 / iterations
+                      << " [us], cshort input " << elapsed_16sc.count() * 1e6 / iterations << " [us]\n";
+            EXPECT_LT(std::abs(corr_out_16sc[1] - corr_out[1]), 0.01 * std::abs(corr_out[1]));
+        }
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file multiband_tracking_group_test.cc
+ * \brief Tests for the carrier dynamics shared by the tracking channels of
+ * the same satellite in different frequency bands.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "multiband_tracking_group.h"
+#include <gtest/gtest.h>
+
+
+TEST(MultibandTrackingGroupTest, SharedBySatellite)
+{
+    const auto group_l1 = Multiband_Tracking_Group::join('G', 7);
+    const auto group_l5 = Multiband_Tracking_Group::join('G', 7);
+    const auto group_e1 = Multiband_Tracking_Group::join('E', 7);
+    EXPECT_EQ(group_l1.get(), group_l5.get());
+    EXPECT_NE(group_l1.get(), group_e1.get());
+
+    EXPECT_TRUE(Multiband_Tracking_Group::is_primary_signal("1C"));
+    EXPECT_TRUE(Multiband_Tracking_Group::is_primary_signal("1B"));
+    EXPECT_FALSE(Multiband_Tracking_Group::is_primary_signal("L5"));
+    EXPECT_FALSE(Multiband_Tracking_Group::is_primary_signal("5X"));
+}
+
+
+TEST(MultibandTrackingGroupTest, ScalesDopplerToBand)
+{
+    const double f_l1 = 1575.42e6;
+    const double f_l5 = 1176.45e6;
+    Multiband_Tracking_Group group;
+
+    double doppler_hz = 0.0;
+    EXPECT_FALSE(group.get_doppler(1.0, f_l5, 0.1, doppler_hz));
+
+    // Constant Doppler rate on L1
+    const double doppler_rate_hz_s = 0.8;
+    for (int k = 0; k <= 100; k++)
+        {
+            const double t = 1.0 + 0.001 * k;
+            group.publish(t, 2500.0 + doppler_rate_hz_s * (t - 1.0), f_l1);
+        }
+    const double doppler_l1 = 2500.0 + doppler_rate_hz_s * 0.1;
+
+    ASSERT_TRUE(group.get_doppler(1.1, f_l5, 0.1, doppler_hz));
+    EXPECT_NEAR(doppler_hz, doppler_l1 * f_l5 / f_l1, 1e-6);
+
+    // Secondary channels ahead of or behind the primary one
+    ASSERT_TRUE(group.get_doppler(1.15, f_l5, 0.1, doppler_hz));
+    EXPECT_NEAR(doppler_hz, (doppler_l1 + doppler_rate_hz_s * 0.05) * f_l5 / f_l1, 1e-6);
+    ASSERT_TRUE(group.get_doppler(1.05, f_l5, 0.1, doppler_hz));
+    EXPECT_NEAR(doppler_hz, (doppler_l1 - doppler_rate_hz_s * 0.05) * f_l5 / f_l1, 1e-6);
+    EXPECT_FALSE(group.get_doppler(1.3, f_l5, 0.1, doppler_hz));
+
+    group.withdraw();
+    EXPECT_FALSE(group.get_doppler(1.1, f_l5, 0.1, doppler_hz));
+}
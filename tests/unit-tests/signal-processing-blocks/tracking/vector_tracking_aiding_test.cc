@@ -0,0 +1,65 @@
+/*!
+ * \file vector_tracking_aiding_test.cc
+ * \brief Tests for the propagation of the Doppler predicted by the PVT
+ * solution to the tracking channels.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "vector_tracking_aiding.h"
+#include <gtest/gtest.h>
+
+
+TEST(VectorTrackingAidingTest, PropagatesPrediction)
+{
+    const double carrier_freq_hz = 1575.42e6;
+    const double fs_in = 4e6;
+    Vector_Tracking_Aiding aiding;
+    aiding.configure(carrier_freq_hz, fs_in, 1.0);
+
+    double doppler_hz = 0.0;
+    EXPECT_FALSE(aiding.get_doppler(1000, doppler_hz));
+
+    // An approaching satellite has a negative pseudorange rate and a positive Doppler
+    const double rate_0 = -500.0;
+    aiding.update(4000000ULL, rate_0);
+    ASSERT_TRUE(aiding.get_doppler(4000000ULL, doppler_hz));
+    EXPECT_NEAR(doppler_hz, -rate_0 * carrier_freq_hz / SPEED_OF_LIGHT_M_S, 1e-6);
+
+    // A second prediction 0.5 s later sets the rate of change of the Doppler
+    const double rate_1 = -499.0;
+    aiding.update(6000000ULL, rate_1);
+    const double doppler_1 = -rate_1 * carrier_freq_hz / SPEED_OF_LIGHT_M_S;
+    const double doppler_rate = (doppler_1 + rate_0 * carrier_freq_hz / SPEED_OF_LIGHT_M_S) / 0.5;
+    ASSERT_TRUE(aiding.get_doppler(7000000ULL, doppler_hz));
+    EXPECT_NEAR(doppler_hz, doppler_1 + doppler_rate * 0.25, 1e-6);
+
+    // Older predictions are not used
+    EXPECT_FALSE(aiding.get_doppler(6000000ULL + 4000001ULL, doppler_hz));
+    EXPECT_FALSE(aiding.get_doppler(5000000ULL, doppler_hz));
+
+    aiding.reset();
+    EXPECT_FALSE(aiding.get_doppler(6000000ULL, doppler_hz));
+}
+
+
+TEST(VectorTrackingAidingTest, NoRateAfterGap)
+{
+    Vector_Tracking_Aiding aiding;
+    aiding.configure(1176.45e6, 1e6, 0.5);
+    aiding.update(1000000ULL, 100.0);
+    // The previous prediction is too old to estimate the rate of change
+    aiding.update(2000000ULL, 200.0);
+    double doppler_hz = 0.0;
+    ASSERT_TRUE(aiding.get_doppler(2400000ULL, doppler_hz));
+    EXPECT_NEAR(doppler_hz, -200.0 * 1176.45e6 / SPEED_OF_LIGHT_M_S, 1e-6);
+}
@@ -760,3 +760,77 @@ TEST(ReedSolomonE6BTest, DecodeErasure)
     std::vector<uint8_t> decoded(encoded_input.begin(), encoded_input.begin() + 32);
     EXPECT_TRUE(expected_output == decoded);
 }
+
+
+TEST(ReedSolomonE6BTest, DecodeErasuresMultipleColumns)
+{
+    auto rs = std::make_unique<ReedSolomon>();
+
+    // Shortened HAS-like message: 10 information rows and 20 columns
+    const int message_size = 10;
+    const int n_columns = 20;
+    std::vector<std::vector<uint8_t>> code_matrix(255, std::vector<uint8_t>(n_columns, 0));
+    std::vector<std::vector<uint8_t>> expected_output(32, std::vector<uint8_t>(n_columns, 0));
+    for (int col = 0; col < n_columns; col++)
+        {
+            std::vector<uint8_t> message(32, 0);
+            for (int row = 0; row < message_size; row++)
+                {
+                    message[row] = static_cast<uint8_t>(31 * row + 17 * col + 5);
+                    expected_output[row][col] = message[row];
+                }
+            const std::vector<uint8_t> codeword = rs->encode_with_generator_matrix(message);
+            for (int row = 0; row < 255; row++)
+                {
+                    code_matrix[row][col] = codeword[row];
+                }
+        }
+
+    // Known symbols: two information rows, the zero-padded rows and some parity rows
+    std::vector<int> known_positions = {1, 7};
+    for (int row = message_size; row < 32; row++)
+        {
+            known_positions.push_back(row);
+        }
+    for (int row = 100; row < 100 + message_size - 2; row++)
+        {
+            known_positions.push_back(row);
+        }
+    std::vector<bool> known(255, false);
+    for (auto pos : known_positions)
+        {
+            known[pos] = true;
+        }
+    std::vector<int> erasure_positions;
+    for (int row = 0; row < 255; row++)
+        {
+            if (!known[row])
+                {
+                    code_matrix[row] = std::vector<uint8_t>(n_columns, 0);
+                    erasure_positions.push_back(row);
+                }
+        }
+
+    std::vector<std::vector<uint8_t>> decoded;
+    EXPECT_EQ(rs->decode_erasures(code_matrix, known_positions, decoded), 0);
+    EXPECT_TRUE(expected_output == decoded);
+
+    // Same result as decoding each column on its own
+    for (int col = 0; col < n_columns; col++)
+        {
+            std::vector<uint8_t> code_column(255);
+            for (int row = 0; row < 255; row++)
+                {
+                    code_column[row] = code_matrix[row][col];
+                }
+            EXPECT_TRUE(rs->decode(code_column, erasure_positions) >= 0);
+            for (int row = 0; row < 32; row++)
+                {
+                    EXPECT_EQ(code_column[row], decoded[row][col]);
+                }
+        }
+
+    // Not enough known symbols
+    known_positions.pop_back();
+    EXPECT_EQ(rs->decode_erasures(code_matrix, known_positions, decoded), -1);
+}
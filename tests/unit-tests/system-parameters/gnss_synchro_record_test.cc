@@ -0,0 +1,98 @@
+/*!
+ * \file gnss_synchro_record_test.cc
+ * \brief Tests for the fixed-layout Gnss_Synchro capture records
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include "gnss_synchro_record.h"
+
+
+TEST(GnssSynchroRecordTest, RoundTrip)
+{
+    Gnss_Synchro gs{};
+    gs.System = 'E';
+    gs.Signal[0] = '1';
+    gs.Signal[1] = 'B';
+    gs.PRN = 11;
+    gs.Channel_ID = 7;
+    gs.Acq_delay_samples = 1234.5;
+    gs.Acq_doppler_hz = -2500.0;
+    gs.Acq_samplestamp_samples = 987654321;
+    gs.Acq_doppler_step = 250;
+    gs.fs = 4000000;
+    gs.Prompt_I = 0.5;
+    gs.Prompt_Q = -0.25;
+    gs.CN0_dB_hz = 45.3;
+    gs.Carrier_Doppler_hz = -2480.7;
+    gs.Carrier_phase_rads = 12.5;
+    gs.Code_phase_samples = 0.125;
+    gs.Tracking_sample_counter = 123456789012;
+    gs.correlation_length_ms = 4;
+    gs.TOW_at_current_symbol_ms = 345678000;
+    gs.Pseudorange_m = 22000000.5;
+    gs.RX_time = 345678.07;
+    gs.interp_TOW_ms = 345678000.3;
+    gs.Flag_valid_symbol_output = true;
+    gs.Flag_valid_word = true;
+    gs.Flag_PLL_180_deg_phase_locked = true;
+
+    Gnss_Synchro_Record record{};
+    gnss_synchro_to_record(gs, 3, record);
+    EXPECT_EQ(record.stream, 3U);
+
+    Gnss_Synchro out{};
+    gnss_synchro_from_record(record, out);
+    EXPECT_EQ(out.System, gs.System);
+    EXPECT_EQ(out.Signal[0], gs.Signal[0]);
+    EXPECT_EQ(out.Signal[1], gs.Signal[1]);
+    EXPECT_EQ(out.PRN, gs.PRN);
+    EXPECT_EQ(out.Channel_ID, gs.Channel_ID);
+    EXPECT_EQ(out.Acq_delay_samples, gs.Acq_delay_samples);
+    EXPECT_EQ(out.Acq_doppler_hz, gs.Acq_doppler_hz);
+    EXPECT_EQ(out.Acq_samplestamp_samples, gs.Acq_samplestamp_samples);
+    EXPECT_EQ(out.Acq_doppler_step, gs.Acq_doppler_step);
+    EXPECT_EQ(out.fs, gs.fs);
+    EXPECT_EQ(out.Prompt_I, gs.Prompt_I);
+    EXPECT_EQ(out.Prompt_Q, gs.Prompt_Q);
+    EXPECT_EQ(out.CN0_dB_hz, gs.CN0_dB_hz);
+    EXPECT_EQ(out.Carrier_Doppler_hz, gs.Carrier_Doppler_hz);
+    EXPECT_EQ(out.Carrier_phase_rads, gs.Carrier_phase_rads);
+    EXPECT_EQ(out.Code_phase_samples, gs.Code_phase_samples);
+    EXPECT_EQ(out.Tracking_sample_counter, gs.Tracking_sample_counter);
+    EXPECT_EQ(out.correlation_length_ms, gs.correlation_length_ms);
+    EXPECT_EQ(out.TOW_at_current_symbol_ms, gs.TOW_at_current_symbol_ms);
+    EXPECT_EQ(out.Pseudorange_m, gs.Pseudorange_m);
+    EXPECT_EQ(out.RX_time, gs.RX_time);
+    EXPECT_EQ(out.interp_TOW_ms, gs.interp_TOW_ms);
+    EXPECT_FALSE(out.Flag_valid_acquisition);
+    EXPECT_TRUE(out.Flag_valid_symbol_output);
+    EXPECT_TRUE(out.Flag_valid_word);
+    EXPECT_FALSE(out.Flag_valid_pseudorange);
+    EXPECT_TRUE(out.Flag_PLL_180_deg_phase_locked);
+}
+
+
+TEST(GnssSynchroRecordTest, FileHeader)
+{
+    Gnss_Synchro_Record_File_Header header = gnss_synchro_record_file_header(13, Gnss_Synchro_Record_Tap::TELEMETRY);
+    EXPECT_TRUE(gnss_synchro_record_file_header_is_valid(header));
+    EXPECT_EQ(header.n_streams, 13U);
+    EXPECT_EQ(header.tap, static_cast<uint32_t>(Gnss_Synchro_Record_Tap::TELEMETRY));
+
+    header.version = GNSS_SYNCHRO_RECORD_VERSION + 1;
+    EXPECT_FALSE(gnss_synchro_record_file_header_is_valid(header));
+
+    header = gnss_synchro_record_file_header(13, Gnss_Synchro_Record_Tap::TRACKING);
+    header.magic[0] = 'X';
+    EXPECT_FALSE(gnss_synchro_record_file_header_is_valid(header));
+}
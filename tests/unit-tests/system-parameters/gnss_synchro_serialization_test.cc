@@ -0,0 +1,93 @@
+/*!
+ * \file gnss_synchro_serialization_test.cc
+ * \brief Tests for the Boost serialization of Gnss_Synchro objects
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2026  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <sstream>
+
+
+namespace
+{
+// Gnss_Synchro as serialized before Flag_refined_acquisition was added
+class Gnss_Synchro_V0 : public Gnss_Synchro
+{
+public:
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version)
+    {
+        Gnss_Synchro::serialize(ar, version);
+    }
+};
+}  // namespace
+
+
+TEST(GnssSynchroSerializationTest, RoundTrip)
+{
+    Gnss_Synchro gs{};
+    gs.System = 'G';
+    gs.Signal[0] = '1';
+    gs.Signal[1] = 'C';
+    gs.PRN = 5;
+    gs.Acq_doppler_hz = -1234.5;
+    gs.Tracking_sample_counter = 123456789;
+    gs.Flag_valid_acquisition = true;
+    gs.Flag_refined_acquisition = true;
+
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa << gs;
+    }
+    Gnss_Synchro read{};
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia >> read;
+    }
+    EXPECT_EQ(read.System, 'G');
+    EXPECT_EQ(read.PRN, 5U);
+    EXPECT_DOUBLE_EQ(read.Acq_doppler_hz, -1234.5);
+    EXPECT_EQ(read.Tracking_sample_counter, 123456789U);
+    EXPECT_TRUE(read.Flag_valid_acquisition);
+    EXPECT_TRUE(read.Flag_refined_acquisition);
+}
+
+
+TEST(GnssSynchroSerializationTest, ReadsVersionZero)
+{
+    // The base class is serialized with the version of the derived class,
+    // which is 0, so the archive has the layout of the older Gnss_Synchro
+    Gnss_Synchro_V0 gs{};
+    gs.PRN = 17;
+    gs.Pseudorange_m = 21000000.5;
+    gs.Flag_PLL_180_deg_phase_locked = true;
+    gs.Flag_refined_acquisition = true;
+
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa << gs;
+    }
+    Gnss_Synchro read{};
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia >> read;
+    }
+    EXPECT_EQ(read.PRN, 17U);
+    EXPECT_DOUBLE_EQ(read.Pseudorange_m, 21000000.5);
+    EXPECT_TRUE(read.Flag_PLL_180_deg_phase_locked);
+    // The field is not in the archive, so it keeps its default value
+    EXPECT_FALSE(read.Flag_refined_acquisition);
+}